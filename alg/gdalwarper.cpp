@@ -1163,6 +1163,11 @@ const char *GDALWarpGetOptionList(void)
            "Can be set to a numeric value or ALL_CPUS to set the number of "
            "threads to use to parallelize the computation part of the warping. "
            "If not set, computation will be done in a single thread..'/>"
+           "<Option name='NUM_CONCURRENT_CHUNKS' type='string' description='"
+           "Can be set to a numeric value or ALL_CPUS to set the number of "
+           "chunks processed concurrently by GDALChunkAndWarpMulti(). Reading "
+           "and writing remain serialized, but the computation of several "
+           "chunks overlaps.' default='2'/>"
            "<Option name='STREAMABLE_OUTPUT' type='boolean' description='"
            "This defaults to FALSE, but may be set to TRUE typically when "
            "writing to a streamed file. The gdalwarp utility automatically "
@@ -1399,6 +1404,17 @@ const char *GDALWarpGetOptionList(void)
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>NUM_CONCURRENT_CHUNKS: (GDAL >= 3.12) Can be set to a numeric value or
+ * ALL_CPUS to set the number of chunks that GDALChunkAndWarpMulti() processes
+ * concurrently. Defaults to 2. When greater than 2, each concurrent chunk uses
+ * its own clone of the transformer (the option is ignored if it cannot be
+ * cloned, or if pfnPreWarpChunkProcessor or pfnPostWarpChunkProcessor is
+ * set). Reading from the source dataset and writing to the destination
+ * dataset remain serialized, while the computation of several chunks
+ * overlaps. The total working memory of the chunks being processed is bounded
+ * by the larger of twice dfWarpMemoryLimit and GDAL_CACHEMAX. This can be
+ * combined with NUM_THREADS.</li>
+ *
  * <li>STREAMABLE_OUTPUT: (GDAL >= 2.0) This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
@@ -553,6 +553,9 @@ class CPL_DLL GDALWarpOperation final
                           int nDstYSize);
     void ReportTiming(const char *);
 
+    std::unique_ptr<GDALWarpOperation> CreateChunkOperation(void *pProgressArg);
+    CPLErr WarpChunksConcurrently(int nConcurrentChunks, double dfTotalPixels);
+
   public:
     GDALWarpOperation();
     ~GDALWarpOperation();
@@ -22,6 +22,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
@@ -1160,6 +1161,285 @@ static void ChunkThreadMain(void *pThreadData)
     }
 }
 
+/************************************************************************/
+/*                     ConcurrentChunksState                            */
+/************************************************************************/
+
+namespace
+{
+struct ConcurrentChunksState
+{
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+
+    const GDALWarpChunk *pasChunkList = nullptr;
+    int nChunkListCount = 0;
+    std::vector<double> adfChunkMemory{};
+    std::vector<double> adfChunkFraction{};
+
+    int iNextChunk = 0;
+    double dfMemoryInFlight = 0;
+    double dfMemoryBudget = 0;
+    bool bStop = false;
+    CPLErr eErr = CE_None;
+
+    double dfProgress = 0;
+    GDALProgressFunc pfnProgress = nullptr;
+    void *pProgressArg = nullptr;
+
+    CPLMutex *hIOMutex = nullptr;
+    CPLErrorAccumulator *poErrorAccumulator = nullptr;
+};
+
+struct ConcurrentChunksWorker
+{
+    ConcurrentChunksState *psState = nullptr;
+    std::unique_ptr<GDALWarpOperation> poOperation{};
+    CPLJoinableThread *hThreadHandle = nullptr;
+
+    // Progress of the chunk being processed by this worker.
+    double dfChunkFraction = 0;
+    double dfChunkComplete = 0;
+};
+}  // namespace
+
+/************************************************************************/
+/*                     ConcurrentChunksProgress()                       */
+/************************************************************************/
+
+// Progress callback installed on the per-worker operations, that sums the
+// progress of all chunks being processed into a monotonic global progress.
+static int CPL_STDCALL ConcurrentChunksProgress(double dfComplete,
+                                                const char *pszMessage,
+                                                void *pProgressArg)
+{
+    auto psWorker = static_cast<ConcurrentChunksWorker *>(pProgressArg);
+    auto psState = psWorker->psState;
+    std::lock_guard oLock(psState->oMutex);
+    psState->dfProgress += (dfComplete - psWorker->dfChunkComplete) *
+                           psWorker->dfChunkFraction;
+    psWorker->dfChunkComplete = dfComplete;
+    return psState->pfnProgress(std::min(1.0, psState->dfProgress), pszMessage,
+                                psState->pProgressArg);
+}
+
+/************************************************************************/
+/*                    ConcurrentChunksThreadMain()                      */
+/************************************************************************/
+
+static void ConcurrentChunksThreadMain(void *pThreadData)
+
+{
+    auto psWorker = static_cast<ConcurrentChunksWorker *>(pThreadData);
+    auto psState = psWorker->psState;
+
+    auto oAccumulator = psState->poErrorAccumulator->InstallForCurrentScope();
+    CPL_IGNORE_RET_VAL(oAccumulator);
+
+    while (true)
+    {
+        // Pick the next chunk, and wait until its working memory fits in
+        // the budget.
+        int iChunk = 0;
+        {
+            std::unique_lock oLock(psState->oMutex);
+            if (psState->bStop ||
+                psState->iNextChunk == psState->nChunkListCount)
+                break;
+            iChunk = psState->iNextChunk++;
+            const double dfChunkMemory = psState->adfChunkMemory[iChunk];
+            psState->oCV.wait(oLock,
+                              [psState, dfChunkMemory]
+                              {
+                                  return psState->bStop ||
+                                         psState->dfMemoryInFlight == 0 ||
+                                         psState->dfMemoryInFlight +
+                                                 dfChunkMemory <=
+                                             psState->dfMemoryBudget;
+                              });
+            if (psState->bStop)
+                break;
+            psState->dfMemoryInFlight += dfChunkMemory;
+            psWorker->dfChunkFraction = psState->adfChunkFraction[iChunk];
+            psWorker->dfChunkComplete = 0;
+        }
+
+        CPLDebug("GDAL", "Start chunk %d / %d.", iChunk,
+                 psState->nChunkListCount);
+
+        // Reads and writes are serialized by the IO mutex, which
+        // WarpRegion() releases while the kernel runs.
+        CPLErr eErr = CE_None;
+        if (!CPLAcquireMutex(psState->hIOMutex, 600.0))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failed to acquire IOMutex in WarpRegion().");
+            eErr = CE_Failure;
+        }
+        else
+        {
+            const GDALWarpChunk *psChunk = psState->pasChunkList + iChunk;
+            eErr = psWorker->poOperation->WarpRegion(
+                psChunk->dx, psChunk->dy, psChunk->dsx, psChunk->dsy,
+                psChunk->sx, psChunk->sy, psChunk->ssx, psChunk->ssy,
+                psChunk->sExtraSx, psChunk->sExtraSy, 0.0, 1.0);
+            CPLReleaseMutex(psState->hIOMutex);
+        }
+
+        CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
+                 psState->nChunkListCount);
+
+        {
+            std::lock_guard oLock(psState->oMutex);
+            psState->dfMemoryInFlight -= psState->adfChunkMemory[iChunk];
+            if (eErr != CE_None)
+            {
+                psState->eErr = eErr;
+                psState->bStop = true;
+            }
+        }
+        psState->oCV.notify_all();
+    }
+}
+
+/************************************************************************/
+/*                       CreateChunkOperation()                         */
+/************************************************************************/
+
+// Creates an operation that processes chunks on behalf of this one in
+// WarpChunksConcurrently(), with its own transformer, kernel thread data and
+// warp mutex, but sharing the IO mutex of this operation.
+// Returns nullptr if the transformer cannot be cloned.
+std::unique_ptr<GDALWarpOperation>
+GDALWarpOperation::CreateChunkOperation(void *pProgressArg)
+{
+    GDALTransformerArgUniquePtr poTransformerArg;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        poTransformerArg.reset(
+            GDALCloneTransformer(psOptions->pTransformerArg));
+    }
+    if (!poTransformerArg)
+        return nullptr;
+
+    GDALWarpOptions *psChunkOptions = GDALCloneWarpOptions(psOptions);
+    psChunkOptions->pfnTransformer = nullptr;
+    psChunkOptions->pTransformerArg = nullptr;
+    if (psOptions->pfnProgress != GDALDummyProgress)
+    {
+        psChunkOptions->pfnProgress = ConcurrentChunksProgress;
+        psChunkOptions->pProgressArg = pProgressArg;
+    }
+
+    auto poOperation = std::make_unique<GDALWarpOperation>();
+    const CPLErr eErr = poOperation->Initialize(
+        psChunkOptions, psOptions->pfnTransformer, std::move(poTransformerArg));
+    GDALDestroyWarpOptions(psChunkOptions);
+    if (eErr != CE_None)
+        return nullptr;
+
+    poOperation->hIOMutex = hIOMutex;
+    poOperation->hWarpMutex = CPLCreateMutex();
+    CPLReleaseMutex(poOperation->hWarpMutex);
+
+    return poOperation;
+}
+
+/************************************************************************/
+/*                      WarpChunksConcurrently()                        */
+/************************************************************************/
+
+// Processes the chunk list with up to nConcurrentChunks chunks in flight,
+// each one handled by a dedicated worker thread and operation. The total
+// working memory of the chunks in flight is bounded by the larger of twice
+// the warp memory limit and GDAL_CACHEMAX.
+// Returns CE_Warning, without having processed anything, if the workers
+// cannot be set up.
+CPLErr GDALWarpOperation::WarpChunksConcurrently(int nConcurrentChunks,
+                                                 double dfTotalPixels)
+{
+    ConcurrentChunksState sState;
+    sState.pasChunkList = pasChunkList;
+    sState.nChunkListCount = nChunkListCount;
+    sState.dfMemoryBudget =
+        std::max(2 * psOptions->dfWarpMemoryLimit,
+                 static_cast<double>(GDALGetCacheMax64()));
+    sState.pfnProgress = psOptions->pfnProgress;
+    sState.pProgressArg = psOptions->pProgressArg;
+    sState.hIOMutex = hIOMutex;
+    for (int iChunk = 0; iChunk < nChunkListCount; ++iChunk)
+    {
+        const GDALWarpChunk *psChunk = pasChunkList + iChunk;
+        sState.adfChunkMemory.push_back(GetWorkingMemoryForWindow(
+            psChunk->ssx, psChunk->ssy, psChunk->dsx, psChunk->dsy));
+        sState.adfChunkFraction.push_back(
+            psChunk->dsx * static_cast<double>(psChunk->dsy) / dfTotalPixels);
+    }
+
+    std::vector<std::unique_ptr<ConcurrentChunksWorker>> apoWorkers;
+    for (int i = 0; i < nConcurrentChunks; ++i)
+    {
+        auto poWorker = std::make_unique<ConcurrentChunksWorker>();
+        poWorker->psState = &sState;
+        poWorker->poOperation = CreateChunkOperation(poWorker.get());
+        if (!poWorker->poOperation)
+            break;
+        apoWorkers.push_back(std::move(poWorker));
+    }
+
+    CPLErr eErr = CE_Warning;
+    if (apoWorkers.size() == static_cast<size_t>(nConcurrentChunks))
+    {
+        CPLDebug("GDAL", "Warping %d chunks with %d concurrent workers",
+                 nChunkListCount, nConcurrentChunks);
+
+        CPLErrorAccumulator oErrorAccumulator;
+        sState.poErrorAccumulator = &oErrorAccumulator;
+        for (auto &poWorker : apoWorkers)
+        {
+            poWorker->hThreadHandle = CPLCreateJoinableThread(
+                ConcurrentChunksThreadMain, poWorker.get());
+            if (poWorker->hThreadHandle == nullptr)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "CPLCreateJoinableThread() failed in "
+                         "ChunkAndWarpMulti()");
+                {
+                    std::lock_guard oLock(sState.oMutex);
+                    sState.eErr = CE_Failure;
+                    sState.bStop = true;
+                }
+                sState.oCV.notify_all();
+                break;
+            }
+        }
+
+        for (auto &poWorker : apoWorkers)
+        {
+            if (poWorker->hThreadHandle)
+                CPLJoinThread(poWorker->hThreadHandle);
+        }
+
+        oErrorAccumulator.ReplayErrors();
+        eErr = sState.eErr;
+    }
+    else
+    {
+        CPLDebug("GDAL", "Cannot clone the transformer: warping chunks with "
+                         "2 concurrent workers");
+    }
+
+    // The IO mutex belongs to this operation.
+    for (auto &poWorker : apoWorkers)
+    {
+        CPLDestroyMutex(poWorker->poOperation->hWarpMutex);
+        poWorker->poOperation->hWarpMutex = nullptr;
+        poWorker->poOperation->hIOMutex = nullptr;
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                         ChunkAndWarpMulti()                          */
 /************************************************************************/
@@ -1176,6 +1456,12 @@ static void ChunkThreadMain(void *pThreadData)
  * internally this method uses multiple threads to interleave input/output
  * for one region while the processing is being done for another.
  *
+ * By default two chunks are processed at a time. The NUM_CONCURRENT_CHUNKS
+ * warp option can be set to process more chunks concurrently, each with its
+ * own clone of the transformer, provided the transformer can be cloned and
+ * no pre/post warp chunk processor is set. Reading from the source dataset
+ * and writing to the destination dataset remain serialized.
+ *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
  * @param nDstXSize Width of output window on destination file to be produced.
@@ -1194,15 +1480,46 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     CPLReleaseMutex(hIOMutex);
     CPLReleaseMutex(hWarpMutex);
 
-    CPLCond *hCond = CPLCreateCond();
-    CPLMutex *hCondMutex = CPLCreateMutex();
-    CPLReleaseMutex(hCondMutex);
-
     /* -------------------------------------------------------------------- */
     /*      Collect the list of chunks to operate on.                       */
     /* -------------------------------------------------------------------- */
     CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
 
+    double dfPixelsProcessed = 0.0;
+    double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
+
+    /* -------------------------------------------------------------------- */
+    /*      Process more than 2 chunks at a time if requested, and if the   */
+    /*      transformer can be cloned and no user chunk processor is set.   */
+    /* -------------------------------------------------------------------- */
+    const char *pszConcurrentChunks =
+        CSLFetchNameValueDef(psOptions->papszWarpOptions,
+                             "NUM_CONCURRENT_CHUNKS", "2");
+    int nConcurrentChunks = EQUAL(pszConcurrentChunks, "ALL_CPUS")
+                                ? CPLGetNumCPUs()
+                                : atoi(pszConcurrentChunks);
+    nConcurrentChunks = std::min(std::min(nConcurrentChunks, 128),
+                                 nChunkListCount);
+    if (nConcurrentChunks > 2 &&
+        psOptions->pfnPreWarpChunkProcessor == nullptr &&
+        psOptions->pfnPostWarpChunkProcessor == nullptr)
+    {
+        const CPLErr eErr =
+            WarpChunksConcurrently(nConcurrentChunks, dfTotalPixels);
+        if (eErr != CE_Warning)
+        {
+            WipeChunkList();
+
+            psOptions->pfnProgress(1.0, "", psOptions->pProgressArg);
+
+            return eErr;
+        }
+    }
+
+    CPLCond *hCond = CPLCreateCond();
+    CPLMutex *hCondMutex = CPLCreateMutex();
+    CPLReleaseMutex(hCondMutex);
+
     /* -------------------------------------------------------------------- */
     /*      Process them one at a time, updating the progress               */
     /*      information for each region.                                    */
@@ -1216,9 +1533,6 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
         asThreadData[i].poErrorAccumulator = &oErrorAccumulator;
     }
 
-    double dfPixelsProcessed = 0.0;
-    double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
-
     CPLErr eErr = CE_None;
     for (int iChunk = 0; iChunk < nChunkListCount + 1; iChunk++)
     {
@@ -19,6 +19,8 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
@@ -27,13 +29,16 @@
 
 #include "gdal_alg_priv.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "polygonize_polygonizer.h"
 
@@ -65,6 +70,782 @@ static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
     return CE_None;
 }
 
+/************************************************************************/
+/*                               GPStrip                                */
+/*                                                                      */
+/*      Horizontal strip of the raster, polygonized in multi-threaded   */
+/*      mode.                                                           */
+/************************************************************************/
+
+// Vertical arc of a polygon crossing the line between two strips, at a given
+// arm (column + 1) of the line. Its index is the one in the polygon piece.
+struct GPBoundaryArc
+{
+    GInt32 nId = -1;
+    int iArm = 0;
+    bool bInner = false;
+    size_t iArc = 0;
+};
+
+// Polygon completed in a strip. The polygons lying in the strip are built
+// there. For the ones crossing the first line of the strip, the piece of the
+// strip must be joined to the arcs collected in the previous strips.
+template <class DataType> struct GPStripPolygon
+{
+    DataType nValue{};
+    std::unique_ptr<OGRPolygon> poGeom{};
+    GInt32 nId = -1;
+    std::unique_ptr<RPolygon> poPiece{};
+};
+
+template <class DataType> struct GPStrip
+{
+    int iStrip = 0;
+    int nFirstRow = 0;
+    int nRows = 0;
+
+    // Number of lines of the previous strip (0 or 1) stored before the lines
+    // of the strip, so that the polygons crossing strips are connected.
+    int nRowsAbove = 0;
+
+    // Pixel values, with masked pixels set to GP_NODATA_MARKER
+    std::vector<DataType> anVal{};
+
+    // Polygon ids of the pixels, local to the strip, or final ones in the
+    // second pass.
+    std::vector<GInt32> anId{};
+
+    // Map of the local polygon ids to the local final ones
+    std::vector<GInt32> anPolyIdMap{};
+
+    // Second pass: polygons completed in the strip, in the order they are
+    // completed, pieces of the polygons continuing below the strip, and
+    // vertical arcs crossing the line above the strip and its last line.
+    std::vector<GPStripPolygon<DataType>> aoPolygons{};
+    std::vector<std::pair<GInt32, std::unique_ptr<RPolygon>>> aoOpenPieces{};
+    std::vector<GPBoundaryArc> aoTopArcs{};
+    std::vector<GPBoundaryArc> aoBottomArcs{};
+
+    std::atomic<bool> bDone{false};
+};
+
+/************************************************************************/
+/*                            GPReadStrip()                             */
+/************************************************************************/
+
+template <class DataType>
+static bool GPReadStrip(GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+                        GByte *pabyMaskLine, int nXSize, GDALDataType eDT,
+                        GPStrip<DataType> &oStrip)
+{
+    const int nFirstRow = oStrip.nFirstRow - oStrip.nRowsAbove;
+    const int nRows = oStrip.nRowsAbove + oStrip.nRows;
+    try
+    {
+        oStrip.anVal.resize(static_cast<size_t>(nRows) * nXSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for strip of %d lines", nRows);
+        return false;
+    }
+
+    if (GDALRasterIO(hSrcBand, GF_Read, 0, nFirstRow, nXSize, nRows,
+                     oStrip.anVal.data(), nXSize, nRows, eDT, 0,
+                     0) != CE_None)
+    {
+        return false;
+    }
+
+    if (hMaskBand != nullptr)
+    {
+        for (int iRow = 0; iRow < nRows; ++iRow)
+        {
+            if (GPMaskImageData(
+                    hMaskBand, pabyMaskLine, nFirstRow + iRow, nXSize,
+                    oStrip.anVal.data() + static_cast<size_t>(iRow) * nXSize) !=
+                CE_None)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                            GPLabelStrip()                            */
+/*                                                                      */
+/*      Assign polygon ids to the pixels of a strip, as if it was a     */
+/*      raster of its own. If panFinalPolyIdMap is set, ids are then    */
+/*      translated to the final ones of the whole raster.               */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+static bool GPLabelStrip(GPStrip<DataType> &oStrip, int nXSize,
+                         int nConnectedness, const GInt32 *panFinalPolyIdMap,
+                         GInt32 nIdBase)
+{
+    GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oEnum(
+        nConnectedness);
+
+    const int nRows = oStrip.nRowsAbove + oStrip.nRows;
+    try
+    {
+        oStrip.anId.resize(static_cast<size_t>(nRows) * nXSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for strip of %d lines", nRows);
+        return false;
+    }
+
+    for (int iRow = 0; iRow < nRows; ++iRow)
+    {
+        const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+        DataType *panThisLineVal = oStrip.anVal.data() + nOffset;
+        GInt32 *panThisLineId = oStrip.anId.data() + nOffset;
+        const bool bOK =
+            iRow == 0
+                ? oEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
+                                    panThisLineId, nXSize)
+                : oEnum.ProcessLine(panThisLineVal - nXSize, panThisLineVal,
+                                    panThisLineId - nXSize, panThisLineId,
+                                    nXSize);
+        if (!bOK)
+            return false;
+    }
+
+    if (panFinalPolyIdMap)
+    {
+        for (GInt32 &nId : oStrip.anId)
+        {
+            if (nId >= 0)
+                nId = panFinalPolyIdMap[nIdBase + nId];
+        }
+        return true;
+    }
+
+    oEnum.CompleteMerges();
+    try
+    {
+        oStrip.anPolyIdMap.assign(oEnum.panPolyIdMap,
+                                  oEnum.panPolyIdMap + oEnum.nNextPolygonId);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate polygon id map of strip");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           GPFindFinalId()                            */
+/************************************************************************/
+
+static GInt32 GPFindFinalId(std::vector<GInt32> &anPolyIdMap, GInt32 nId)
+{
+    while (anPolyIdMap[nId] != nId)
+    {
+        anPolyIdMap[nId] = anPolyIdMap[anPolyIdMap[nId]];
+        nId = anPolyIdMap[nId];
+    }
+    return nId;
+}
+
+/************************************************************************/
+/*                        GPStripPolygonReceiver                        */
+/*                                                                      */
+/*      Receive the polygons completed while tracing a strip. The arcs  */
+/*      of the ones crossing the line above the strip are kept, to be   */
+/*      joined to the ones of the previous strips. The other ones are   */
+/*      built.                                                          */
+/************************************************************************/
+
+template <class DataType>
+class GPStripPolygonReceiver final : public PolygonReceiver<DataType>
+{
+    GPStrip<DataType> &m_oStrip;
+    const double *m_padfGeoTransform;
+    bool m_bOK = true;
+
+    CPL_DISALLOW_COPY_ASSIGN(GPStripPolygonReceiver)
+
+  public:
+    // Polygon ids of the pieces of the polygons of the line above the strip
+    std::map<const RPolygon *, GInt32> m_oMapPieceToId{};
+
+    GPStripPolygonReceiver(GPStrip<DataType> &oStrip,
+                           const double *padfGeoTransform)
+        : m_oStrip(oStrip), m_padfGeoTransform(padfGeoTransform)
+    {
+    }
+
+    void receive(RPolygon *poPolygon, DataType nPolygonCellValue) override
+    {
+        GPStripPolygon<DataType> oPolygon;
+        oPolygon.nValue = nPolygonCellValue;
+        const auto oIter = m_oMapPieceToId.find(poPolygon);
+        if (oIter != m_oMapPieceToId.end())
+        {
+            oPolygon.nId = oIter->second;
+            oPolygon.poPiece = std::make_unique<RPolygon>();
+            oPolygon.poPiece->oArcs = std::move(poPolygon->oArcs);
+            m_oMapPieceToId.erase(oIter);
+        }
+        else
+        {
+            oPolygon.poGeom = std::make_unique<OGRPolygon>();
+            if (!BuildOGRPolygon(*poPolygon, m_padfGeoTransform,
+                                 *oPolygon.poGeom))
+            {
+                m_bOK = false;
+            }
+        }
+        m_oStrip.aoPolygons.push_back(std::move(oPolygon));
+    }
+
+    bool IsOK() const
+    {
+        return m_bOK;
+    }
+};
+
+/************************************************************************/
+/*                         GPGetBoundaryArcs()                          */
+/*                                                                      */
+/*      Collect the vertical arcs crossing a line, except the ones of   */
+/*      the outer polygon and of masked pixels, that are never output.  */
+/************************************************************************/
+
+static void GPGetBoundaryArcs(const TwoArm *paoArm, const GInt32 *panLineId,
+                              int nXSize, std::vector<GPBoundaryArc> &aoArcs)
+{
+    for (int iArm = 1; iArm <= nXSize + 1; ++iArm)
+    {
+        const TwoArm &oArm = paoArm[iArm];
+        if (!oArm.bSolidVertical)
+            continue;
+
+        // The inner arc bounds the polygon of the pixel of the arm, and the
+        // outer arc the one of the pixel on its left.
+        if (iArm <= nXSize && panLineId[iArm - 1] >= 0)
+        {
+            aoArcs.push_back(GPBoundaryArc{panLineId[iArm - 1], iArm, true,
+                                           oArm.oArcVerInner.iIndex});
+        }
+        if (iArm >= 2 && panLineId[iArm - 2] >= 0)
+        {
+            aoArcs.push_back(GPBoundaryArc{panLineId[iArm - 2], iArm, false,
+                                           oArm.oArcVerOuter.iIndex});
+        }
+    }
+}
+
+/************************************************************************/
+/*                            GPTraceStrip()                            */
+/*                                                                      */
+/*      Collect the polygon edges of a strip whose pixels have their    */
+/*      final polygon ids. The tracing starts from the line above the   */
+/*      strip, with new arcs standing for the ones of the previous      */
+/*      strips that cross it.                                           */
+/************************************************************************/
+
+template <class DataType>
+static bool GPTraceStrip(GPStrip<DataType> &oStrip, int nXSize, int nYSize,
+                         const double *padfGeoTransform)
+{
+    GPStripPolygonReceiver<DataType> oReceiver(oStrip, padfGeoTransform);
+    Polygonizer<GInt32, DataType> oPolygonizer{-1, &oReceiver};
+
+    try
+    {
+        std::vector<TwoArm> aoLastLineArm(static_cast<size_t>(nXSize) + 2);
+        std::vector<TwoArm> aoThisLineArm(static_cast<size_t>(nXSize) + 2);
+        TwoArm *paoLastLineArm = aoLastLineArm.data();
+        TwoArm *paoThisLineArm = aoThisLineArm.data();
+
+        const DataType *panLastLineVal = oStrip.anVal.data();
+        if (oStrip.nRowsAbove > 0)
+        {
+            const GInt32 *panLastLineId = oStrip.anId.data();
+            if (!oPolygonizer.initializeLastLine(panLastLineId, paoLastLineArm,
+                                                 oStrip.nFirstRow - 1, nXSize))
+            {
+                return false;
+            }
+            GPGetBoundaryArcs(paoLastLineArm, panLastLineId, nXSize,
+                              oStrip.aoTopArcs);
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                if (panLastLineId[iX] >= 0)
+                {
+                    oReceiver.m_oMapPieceToId[paoLastLineArm[iX + 1]
+                                                  .poPolyInside] =
+                        panLastLineId[iX];
+                }
+            }
+        }
+        else
+        {
+            for (auto &oArm : aoLastLineArm)
+                oArm.poPolyInside = oPolygonizer.getTheOuterPolygon();
+        }
+
+        for (int iRow = 0; iRow < oStrip.nRows; ++iRow)
+        {
+            const size_t nOffset =
+                static_cast<size_t>(oStrip.nRowsAbove + iRow) * nXSize;
+            if (!oPolygonizer.processLine(
+                    oStrip.anId.data() + nOffset, panLastLineVal,
+                    paoThisLineArm, paoLastLineArm, oStrip.nFirstRow + iRow,
+                    nXSize))
+            {
+                return false;
+            }
+            panLastLineVal = oStrip.anVal.data() + nOffset;
+            std::swap(paoThisLineArm, paoLastLineArm);
+        }
+
+        if (oStrip.nFirstRow + oStrip.nRows == nYSize)
+        {
+            // Complete the remaining polygons
+            std::vector<GInt32> anOuterLineId(
+                nXSize, decltype(oPolygonizer)::THE_OUTER_POLYGON_ID);
+            if (!oPolygonizer.processLine(anOuterLineId.data(), panLastLineVal,
+                                          paoThisLineArm, paoLastLineArm,
+                                          nYSize, nXSize))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            // Take the pieces of the polygons continuing below the strip
+            const GInt32 *panLastLineId =
+                oStrip.anId.data() +
+                static_cast<size_t>(oStrip.nRowsAbove + oStrip.nRows - 1) *
+                    nXSize;
+            GPGetBoundaryArcs(paoLastLineArm, panLastLineId, nXSize,
+                              oStrip.aoBottomArcs);
+            std::map<GInt32, RPolygon *> oMapOpenPieces;
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                if (panLastLineId[iX] >= 0)
+                {
+                    oMapOpenPieces[panLastLineId[iX]] =
+                        paoLastLineArm[iX + 1].poPolyInside;
+                }
+            }
+            for (auto &oIter : oMapOpenPieces)
+            {
+                auto poPiece = std::make_unique<RPolygon>();
+                poPiece->oArcs = std::move(oIter.second->oArcs);
+                oStrip.aoOpenPieces.emplace_back(oIter.first,
+                                                 std::move(poPiece));
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALPolygonize()");
+        return false;
+    }
+
+    return oReceiver.IsOK();
+}
+
+/************************************************************************/
+/*                           GPStitchStrip()                            */
+/*                                                                      */
+/*      Append the arcs of the pieces of polygons of a strip to the     */
+/*      polygons collected in the previous strips. The arcs crossing    */
+/*      the line above the strip continue the ones that crossed the     */
+/*      last line of the previous strip, at the same arm.               */
+/************************************************************************/
+
+template <class DataType>
+static void
+GPStitchStrip(GPStrip<DataType> &oStrip,
+              std::map<GInt32, std::unique_ptr<RPolygon>> &oMapOpenPolygons,
+              std::vector<size_t> &anInnerArcOfArm,
+              std::vector<size_t> &anOuterArcOfArm)
+{
+    std::map<GInt32, RPolygon *> oMapPieces;
+    for (auto &oPolygon : oStrip.aoPolygons)
+    {
+        if (oPolygon.poPiece)
+            oMapPieces[oPolygon.nId] = oPolygon.poPiece.get();
+    }
+    for (auto &oPiece : oStrip.aoOpenPieces)
+        oMapPieces[oPiece.first] = oPiece.second.get();
+
+    // Index of the arcs of each piece in the polygon
+    constexpr size_t NEW_ARC = std::numeric_limits<size_t>::max();
+    std::map<GInt32, std::vector<size_t>> oMapArcIndices;
+    for (const auto &oIter : oMapPieces)
+        oMapArcIndices[oIter.first].resize(oIter.second->oArcs.size(),
+                                           NEW_ARC);
+    for (const auto &oArc : oStrip.aoTopArcs)
+    {
+        oMapArcIndices[oArc.nId][oArc.iArc] =
+            oArc.bInner ? anInnerArcOfArm[oArc.iArm]
+                        : anOuterArcOfArm[oArc.iArm];
+    }
+
+    for (const auto &oIter : oMapPieces)
+    {
+        auto &poPolygon = oMapOpenPolygons[oIter.first];
+        if (!poPolygon)
+            poPolygon = std::make_unique<RPolygon>();
+
+        auto &oArcs = oIter.second->oArcs;
+        auto &anArcIndices = oMapArcIndices[oIter.first];
+        const size_t nFirstNewArc = poPolygon->oArcs.size();
+        size_t iNewArc = nFirstNewArc;
+        for (size_t &iArc : anArcIndices)
+        {
+            if (iArc == NEW_ARC)
+                iArc = iNewArc++;
+        }
+
+        for (size_t i = 0; i < oArcs.size(); ++i)
+        {
+            auto &oArc = oArcs[i];
+            const bool bConnected = oArc.nConnection != i;
+            oArc.nConnection =
+                static_cast<unsigned>(anArcIndices[oArc.nConnection]);
+            if (anArcIndices[i] >= nFirstNewArc)
+            {
+                poPolygon->oArcs.push_back(std::move(oArc));
+            }
+            else
+            {
+                // Continuation of an arc of the previous strips. Its next
+                // arc is set where it ends.
+                auto &oPrevArc = poPolygon->oArcs[anArcIndices[i]];
+                oPrevArc.poArc->insert(oPrevArc.poArc->end(),
+                                       oArc.poArc->begin(), oArc.poArc->end());
+                if (bConnected)
+                    oPrevArc.nConnection = oArc.nConnection;
+            }
+        }
+        oArcs.clear();
+    }
+
+    for (const auto &oArc : oStrip.aoBottomArcs)
+    {
+        (oArc.bInner ? anInnerArcOfArm : anOuterArcOfArm)[oArc.iArm] =
+            oMapArcIndices[oArc.nId][oArc.iArc];
+    }
+}
+
+/************************************************************************/
+/*                          GPProcessStrips()                           */
+/*                                                                      */
+/*      Read the strips in this thread, process them in worker          */
+/*      threads, and consume them in order in this thread. Only a few   */
+/*      strips are in memory at a time.                                 */
+/************************************************************************/
+
+template <class DataType>
+static bool
+GPProcessStrips(CPLJobQueue *poJobQueue, int nThreads, int nYSize,
+                int nStripYSize,
+                const std::function<bool(GPStrip<DataType> &)> &pfnRead,
+                const std::function<bool(GPStrip<DataType> &)> &pfnProcess,
+                const std::function<bool(GPStrip<DataType> &)> &pfnConsume)
+{
+    const int nStrips = DIV_ROUND_UP(nYSize, nStripYSize);
+    std::vector<std::unique_ptr<GPStrip<DataType>>> apoStrips(nThreads + 1);
+    const int nMaxStripsInMemory = static_cast<int>(apoStrips.size());
+
+    CPLErrorAccumulator oErrorAccumulator;
+    std::atomic<bool> bSuccess{true};
+    bool bOK = true;
+    int iNextStripToConsume = 0;
+
+    const auto ConsumeNextStrip = [&]()
+    {
+        auto &poStrip = apoStrips[iNextStripToConsume % nMaxStripsInMemory];
+        while (!poStrip->bDone && poJobQueue->WaitEvent())
+        {
+        }
+        ++iNextStripToConsume;
+        bOK = bSuccess && pfnConsume(*poStrip);
+        poStrip.reset();
+    };
+
+    for (int iStrip = 0; bOK && iStrip < nStrips; ++iStrip)
+    {
+        if (iStrip - iNextStripToConsume == nMaxStripsInMemory)
+        {
+            ConsumeNextStrip();
+            if (!bOK)
+                break;
+        }
+
+        auto poStrip = std::make_unique<GPStrip<DataType>>();
+        poStrip->iStrip = iStrip;
+        poStrip->nFirstRow = iStrip * nStripYSize;
+        poStrip->nRows = std::min(nStripYSize, nYSize - poStrip->nFirstRow);
+        poStrip->nRowsAbove = iStrip > 0 ? 1 : 0;
+        if (!pfnRead(*poStrip))
+        {
+            bOK = false;
+            break;
+        }
+
+        GPStrip<DataType> *poStripToProcess = poStrip.get();
+        apoStrips[iStrip % nMaxStripsInMemory] = std::move(poStrip);
+        poJobQueue->SubmitJob(
+            [poStripToProcess, &pfnProcess, &bSuccess, &oErrorAccumulator]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                if (bSuccess && !pfnProcess(*poStripToProcess))
+                    bSuccess = false;
+                poStripToProcess->bDone = true;
+            });
+    }
+
+    while (bOK && iNextStripToConsume < nStrips)
+        ConsumeNextStrip();
+
+    poJobQueue->WaitCompletion();
+    apoStrips.clear();
+    oErrorAccumulator.ReplayErrors();
+
+    return bOK && bSuccess;
+}
+
+/************************************************************************/
+/*                     GDALPolygonizeMultiThreadedT()                   */
+/*                                                                      */
+/*      Same as the two passes of GDALPolygonizeT(), but with the       */
+/*      raster split in horizontal strips that are labeled, and then    */
+/*      traced, independently in worker threads. Each strip also        */
+/*      stores the last line of the previous strip, which connects the  */
+/*      polygons crossing strips after the first pass, and gives the    */
+/*      arcs crossing the boundary in the second pass. The pieces of    */
+/*      the polygons crossing strips are joined in this thread, that    */
+/*      also writes the features. Apart from the final polygon id map,  */
+/*      memory use only depends on the number of strips in memory and   */
+/*      on the polygons crossing strips.                                */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+static CPLErr GDALPolygonizeMultiThreadedT(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+    OGRPolygonWriter<DataType> &oPolygonWriter, const double *padfGeoTransform,
+    int nConnectedness, GDALDataType eDT, CPLJobQueue *poJobQueue,
+    int nThreads, int nStripYSize, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    std::vector<GByte> abyMaskLine;
+    std::vector<GInt32> anLastLineId;
+    std::vector<size_t> anInnerArcOfArm;
+    std::vector<size_t> anOuterArcOfArm;
+    try
+    {
+        abyMaskLine.resize(nXSize);
+        anLastLineId.resize(nXSize);
+        anInnerArcOfArm.resize(static_cast<size_t>(nXSize) + 2);
+        anOuterArcOfArm.resize(static_cast<size_t>(nXSize) + 2);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers in GDALPolygonize()");
+        return CE_Failure;
+    }
+
+    const auto ReadStrip = [hSrcBand, hMaskBand, &abyMaskLine, nXSize,
+                            eDT](GPStrip<DataType> &oStrip)
+    {
+        return GPReadStrip(hSrcBand, hMaskBand, abyMaskLine.data(), nXSize, eDT,
+                           oStrip);
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: label each strip, and merge the polygons of its     */
+    /*      first line with the ones of the same pixels in the previous     */
+    /*      strip. anPolyIdMap maps the ids of the strips, shifted by       */
+    /*      anIdBase[iStrip], to the final ids.                             */
+    /* -------------------------------------------------------------------- */
+    std::vector<GInt32> anPolyIdMap;
+    std::vector<GInt32> anIdBase;
+
+    const auto LabelStripFirstPass = [nXSize, nConnectedness](
+                                         GPStrip<DataType> &oStrip)
+    {
+        if (!GPLabelStrip<DataType, EqualityTest>(oStrip, nXSize,
+                                                  nConnectedness, nullptr, 0))
+        {
+            return false;
+        }
+        oStrip.anVal = std::vector<DataType>();
+        return true;
+    };
+
+    const auto ConsumeStripFirstPass = [&](GPStrip<DataType> &oStrip)
+    {
+        const size_t nIds = oStrip.anPolyIdMap.size();
+        if (nIds > static_cast<size_t>(std::numeric_limits<GInt32>::max() -
+                                       1) -
+                       anPolyIdMap.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "GDALPolygonize(): maximum number of polygons reached");
+            return false;
+        }
+        const GInt32 nIdBase = static_cast<GInt32>(anPolyIdMap.size());
+        try
+        {
+            anIdBase.push_back(nIdBase);
+            for (const GInt32 nId : oStrip.anPolyIdMap)
+                anPolyIdMap.push_back(nIdBase + nId);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate polygon id map");
+            return false;
+        }
+
+        if (oStrip.nRowsAbove > 0)
+        {
+            const GInt32 *panFirstLineId = oStrip.anId.data();
+            for (int i = 0; i < nXSize; i++)
+            {
+                if (panFirstLineId[i] < 0)
+                    continue;
+                const GInt32 nLastId =
+                    GPFindFinalId(anPolyIdMap, anLastLineId[i]);
+                const GInt32 nThisId =
+                    GPFindFinalId(anPolyIdMap, nIdBase + panFirstLineId[i]);
+                if (nLastId < nThisId)
+                    anPolyIdMap[nThisId] = nLastId;
+                else if (nThisId < nLastId)
+                    anPolyIdMap[nLastId] = nThisId;
+            }
+        }
+
+        const GInt32 *panStripLastLineId =
+            oStrip.anId.data() +
+            static_cast<size_t>(oStrip.nRowsAbove + oStrip.nRows - 1) * nXSize;
+        for (int i = 0; i < nXSize; i++)
+        {
+            anLastLineId[i] = panStripLastLineId[i] < 0
+                                  ? panStripLastLineId[i]
+                                  : nIdBase + panStripLastLineId[i];
+        }
+
+        if (!pfnProgress(0.10 * ((oStrip.nFirstRow + oStrip.nRows) /
+                                 static_cast<double>(nYSize)),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+        return true;
+    };
+
+    if (!GPProcessStrips<DataType>(poJobQueue, nThreads, nYSize, nStripYSize,
+                                   ReadStrip, LabelStripFirstPass,
+                                   ConsumeStripFirstPass))
+    {
+        return CE_Failure;
+    }
+
+    for (GInt32 nId = 0; nId < static_cast<GInt32>(anPolyIdMap.size()); ++nId)
+        anPolyIdMap[nId] = GPFindFinalId(anPolyIdMap, nId);
+
+    CPLDebug("GDALPolygonize", "Merged polygons of %d strips of %d lines",
+             static_cast<int>(anIdBase.size()), nStripYSize);
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: label again each strip, with final ids, and        */
+    /*      collect polygon edges in worker threads. Then join the pieces   */
+    /*      of the polygons crossing strips, and write the features in      */
+    /*      this thread, in order.                                          */
+    /* -------------------------------------------------------------------- */
+    std::map<GInt32, std::unique_ptr<RPolygon>> oMapOpenPolygons;
+
+    const auto ProcessStripSecondPass =
+        [nXSize, nYSize, nConnectedness, &anPolyIdMap, &anIdBase,
+         padfGeoTransform](GPStrip<DataType> &oStrip)
+    {
+        const bool bOK =
+            GPLabelStrip<DataType, EqualityTest>(
+                oStrip, nXSize, nConnectedness, anPolyIdMap.data(),
+                anIdBase[oStrip.iStrip]) &&
+            GPTraceStrip(oStrip, nXSize, nYSize, padfGeoTransform);
+        oStrip.anVal = std::vector<DataType>();
+        oStrip.anId = std::vector<GInt32>();
+        return bOK;
+    };
+
+    const auto ConsumeStripSecondPass = [&](GPStrip<DataType> &oStrip)
+    {
+        try
+        {
+            GPStitchStrip(oStrip, oMapOpenPolygons, anInnerArcOfArm,
+                          anOuterArcOfArm);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in GDALPolygonize()");
+            return false;
+        }
+
+        for (auto &oPolygon : oStrip.aoPolygons)
+        {
+            if (oPolygon.poGeom)
+            {
+                oPolygonWriter.write(std::move(oPolygon.poGeom),
+                                     oPolygon.nValue);
+            }
+            else
+            {
+                const auto oIter = oMapOpenPolygons.find(oPolygon.nId);
+                CPLAssert(oIter != oMapOpenPolygons.end());
+                oPolygonWriter.receive(oIter->second.get(), oPolygon.nValue);
+                oMapOpenPolygons.erase(oIter);
+            }
+            if (oPolygonWriter.getErr() != CE_None)
+                return false;
+        }
+
+        if (!pfnProgress(0.10 + 0.90 * ((oStrip.nFirstRow + oStrip.nRows) /
+                                        static_cast<double>(nYSize)),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+        return true;
+    };
+
+    if (!GPProcessStrips<DataType>(poJobQueue, nThreads, nYSize, nStripYSize,
+                                   ReadStrip, ProcessStripSecondPass,
+                                   ConsumeStripSecondPass))
+    {
+        return CE_Failure;
+    }
+
+    return oPolygonWriter.getErr();
+}
+
 /************************************************************************/
 /*                           GDALPolygonizeT()                          */
 /************************************************************************/
@@ -108,29 +889,6 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         return CE_Failure;
     }
 
-    DataType *panLastLineVal =
-        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
-    DataType *panThisLineVal =
-        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
-    GInt32 *panLastLineId =
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
-    GInt32 *panThisLineId =
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
-
-    GByte *pabyMaskLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
-
-    if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
-        panLastLineId == nullptr || panThisLineId == nullptr ||
-        pabyMaskLine == nullptr)
-    {
-        CPLFree(panThisLineId);
-        CPLFree(panLastLineId);
-        CPLFree(panThisLineVal);
-        CPLFree(panLastLineVal);
-        CPLFree(pabyMaskLine);
-        return CE_Failure;
-    }
-
     /* -------------------------------------------------------------------- */
     /*      Get the geotransform, if there is one, so we can convert the    */
     /*      vectors into georeferenced coordinates.                         */
@@ -166,6 +924,69 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         adfGeoTransform[5] = 1;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      In multi-threaded mode, process the raster by strips.           */
+    /* -------------------------------------------------------------------- */
+    // The GDAL_NUM_THREADS configuration option is not used as a default,
+    // since features may then be written in a different order.
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS", "1");
+    int nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszNumThreads);
+    nThreads = std::max(1, std::min(128, nThreads));
+
+    if (nThreads > 1 && nXSize > 0 && nYSize > 1)
+    {
+        // Strips of about 1 million pixels, but at least 4 strips per
+        // thread, and aligned on source blocks when possible.
+        constexpr int MAX_PIXELS_PER_STRIP = 1024 * 1024;
+        int nStripYSize = std::max(1, MAX_PIXELS_PER_STRIP / nXSize);
+        nStripYSize =
+            std::min(nStripYSize, DIV_ROUND_UP(nYSize, 4 * nThreads));
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        GDALGetBlockSize(hSrcBand, &nBlockXSize, &nBlockYSize);
+        if (nBlockYSize > 1 && nStripYSize > nBlockYSize)
+            nStripYSize = (nStripYSize / nBlockYSize) * nBlockYSize;
+
+        CPLWorkerThreadPool *poThreadPool =
+            nStripYSize < nYSize ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        auto poJobQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        if (poJobQueue)
+        {
+            OGRPolygonWriter<DataType> oPolygonWriter{hOutLayer, iPixValField,
+                                                      adfGeoTransform};
+            return GDALPolygonizeMultiThreadedT<DataType, EqualityTest>(
+                hSrcBand, hMaskBand, oPolygonWriter, adfGeoTransform,
+                nConnectedness, eDT, poJobQueue.get(), nThreads, nStripYSize,
+                pfnProgress, pProgressArg);
+        }
+    }
+
+    DataType *panLastLineVal =
+        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
+    DataType *panThisLineVal =
+        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
+    GInt32 *panLastLineId =
+        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
+    GInt32 *panThisLineId =
+        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
+
+    GByte *pabyMaskLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
+
+    if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
+        panLastLineId == nullptr || panThisLineId == nullptr ||
+        pabyMaskLine == nullptr)
+    {
+        CPLFree(panThisLineId);
+        CPLFree(panLastLineId);
+        CPLFree(panThisLineVal);
+        CPLFree(panLastLineVal);
+        CPLFree(pabyMaskLine);
+        return CE_Failure;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      The first pass over the raster is only used to build up the     */
     /*      polygon id map so we will know in advance what polygons are     */
@@ -489,6 +1310,12 @@ GBool GDALFloatEquals(float A, float B)
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number|ALL_CPUS: (GDAL >= 3.12) Number of worker threads
+ * used to polygonize the raster by horizontal strips. Defaults to 1. The
+ * GDAL_NUM_THREADS configuration option is not taken into account. The
+ * geometries written are the same as in single-threaded mode, but features
+ * whose polygon is completed on the same raster line may be written in a
+ * different order.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -563,6 +1390,12 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number|ALL_CPUS: (GDAL >= 3.12) Number of worker threads
+ * used to polygonize the raster by horizontal strips. Defaults to 1. The
+ * GDAL_NUM_THREADS configuration option is not taken into account. The
+ * geometries written are the same as in single-threaded mode, but features
+ * whose polygon is completed on the same raster line may be written in a
+ * different order.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -441,6 +441,43 @@ bool Polygonizer<PolyIdType, DataType>::processLine(
     }
 }
 
+template <typename PolyIdType, typename DataType>
+bool Polygonizer<PolyIdType, DataType>::initializeLastLine(
+    const PolyIdType *panLastLineId, TwoArm *poLastLineArm,
+    const IndexType nLastRow, const IndexType nCols)
+{
+    try
+    {
+        poLastLineArm->poPolyInside = poTheOuterPolygon_;
+        for (IndexType col = 0; col <= nCols; ++col)
+        {
+            TwoArm *poArm = poLastLineArm + col + 1;
+            poArm->iRow = nLastRow;
+            poArm->iCol = col;
+            poArm->poPolyInside = col < nCols ? getPolygon(panLastLineId[col])
+                                              : poTheOuterPolygon_;
+            poArm->poPolyLeft = (poArm - 1)->poPolyInside;
+            poArm->poPolyInside->updateBottomRightPos(nLastRow, col);
+
+            // The vertical inner arc bounds the polygon of the cell, and the
+            // vertical outer arc the one of the cell on its left.
+            poArm->bSolidVertical = poArm->poPolyInside != poArm->poPolyLeft;
+            if (poArm->bSolidVertical)
+            {
+                poArm->oArcVerInner = poArm->poPolyInside->newArc(true);
+                poArm->oArcVerOuter = poArm->poPolyLeft->newArc(false);
+            }
+        }
+        return true;
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in Polygonizer::initializeLastLine");
+        return false;
+    }
+}
+
 template <typename DataType>
 OGRPolygonWriter<DataType>::OGRPolygonWriter(OGRLayerH hOutLayer,
                                              int iPixValField,
@@ -453,27 +490,25 @@ OGRPolygonWriter<DataType>::OGRPolygonWriter(OGRLayerH hOutLayer,
     poFeature_->SetGeometryDirectly(poPolygon_);
 }
 
-template <typename DataType>
-void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
-                                         DataType nPolygonCellValue)
+bool BuildOGRPolygon(const RPolygon &oPolygon, const double *padfGeoTransform,
+                     OGRPolygon &oOGRPolygon)
 {
-    std::vector<bool> oAccessedArc(poPolygon->oArcs.size(), false);
-    double *padfGeoTransform = padfGeoTransform_;
+    std::vector<bool> oAccessedArc(oPolygon.oArcs.size(), false);
 
-    OGRLinearRing *poFirstRing = poPolygon_->getExteriorRing();
-    if (poFirstRing && poPolygon_->getNumInteriorRings() == 0)
+    OGRLinearRing *poFirstRing = oOGRPolygon.getExteriorRing();
+    if (poFirstRing && oOGRPolygon.getNumInteriorRings() == 0)
     {
         poFirstRing->empty();
     }
     else
     {
         poFirstRing = nullptr;
-        poPolygon_->empty();
+        oOGRPolygon.empty();
     }
 
-    auto AddRingToPolygon =
-        [this, &poPolygon, &oAccessedArc,
-         padfGeoTransform](std::size_t iFirstArcIndex, OGRLinearRing *poRing)
+    auto AddRingToPolygon = [&oPolygon, &oOGRPolygon, &oAccessedArc,
+                             padfGeoTransform](std::size_t iFirstArcIndex,
+                                               OGRLinearRing *poRing)
     {
         std::unique_ptr<OGRLinearRing> poNewRing;
         if (!poRing)
@@ -483,9 +518,9 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
         }
 
         auto AddArcToRing =
-            [&poPolygon, poRing, padfGeoTransform](std::size_t iArcIndex)
+            [&oPolygon, poRing, padfGeoTransform](std::size_t iArcIndex)
         {
-            const auto &oArc = poPolygon->oArcs[iArcIndex];
+            const auto &oArc = oPolygon.oArcs[iArcIndex];
             const bool bArcFollowRighthand = oArc.bFollowRighthand;
             const int nArcPointCount = static_cast<int>(oArc.poArc->size());
             int nDstPointIdx = poRing->getNumPoints();
@@ -521,7 +556,7 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
         }
 
         std::size_t iArcIndex = iFirstArcIndex;
-        std::size_t iNextArcIndex = poPolygon->oArcs[iArcIndex].nConnection;
+        std::size_t iNextArcIndex = oPolygon.oArcs[iArcIndex].nConnection;
         oAccessedArc[iArcIndex] = true;
         while (iNextArcIndex != iFirstArcIndex)
         {
@@ -530,7 +565,7 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
                 return false;
             }
             iArcIndex = iNextArcIndex;
-            iNextArcIndex = poPolygon->oArcs[iArcIndex].nConnection;
+            iNextArcIndex = oPolygon.oArcs[iArcIndex].nConnection;
             oAccessedArc[iArcIndex] = true;
         }
 
@@ -538,7 +573,7 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
         poRing->closeRings();
 
         if (poNewRing)
-            poPolygon_->addRingDirectly(poNewRing.release());
+            oOGRPolygon.addRingDirectly(poNewRing.release());
         return true;
     };
 
@@ -548,13 +583,38 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
         {
             if (!AddRingToPolygon(i, poFirstRing))
             {
-                eErr_ = CE_Failure;
-                return;
+                return false;
             }
             poFirstRing = nullptr;
         }
     }
+    return true;
+}
 
+template <typename DataType>
+void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
+                                         DataType nPolygonCellValue)
+{
+    if (!BuildOGRPolygon(*poPolygon, padfGeoTransform_, *poPolygon_))
+    {
+        eErr_ = CE_Failure;
+        return;
+    }
+    writeFeature(nPolygonCellValue);
+}
+
+template <typename DataType>
+void OGRPolygonWriter<DataType>::write(std::unique_ptr<OGRPolygon> poPolygon,
+                                       DataType nPolygonCellValue)
+{
+    poPolygon_ = poPolygon.release();
+    poFeature_->SetGeometryDirectly(poPolygon_);
+    writeFeature(nPolygonCellValue);
+}
+
+template <typename DataType>
+void OGRPolygonWriter<DataType>::writeFeature(DataType nPolygonCellValue)
+{
     // Create the feature object
     poFeature_->SetFID(OGRNullFID);
     if (iPixValField_ >= 0)
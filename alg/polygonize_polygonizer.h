@@ -22,6 +22,7 @@
 #include <vector>
 #include <limits>
 #include <map>
+#include <memory>
 
 #include "cpl_error.h"
 #include "ogr_api.h"
@@ -175,8 +176,23 @@ template <typename PolyIdType, typename DataType> class Polygonizer
                      const DataType *panLastLineVal, TwoArm *poThisLineArm,
                      TwoArm *poLastLineArm, IndexType nCurrentRow,
                      IndexType nCols);
+
+    /**
+     * Initialize the arms of a line, so that the processing can start at the
+     * next line, as if the lines above had been processed. New arcs are
+     * created for the vertical arcs crossing the line.
+     */
+    bool initializeLastLine(const PolyIdType *panLastLineId,
+                            TwoArm *poLastLineArm, IndexType nLastRow,
+                            IndexType nCols);
 };
 
+/**
+ * Build the geometry of a raster polygon.
+ */
+bool BuildOGRPolygon(const RPolygon &oPolygon, const double *padfGeoTransform,
+                     OGRPolygon &oOGRPolygon);
+
 /**
  * Write raster polygon object to OGR layer.
  */
@@ -192,6 +208,8 @@ class OGRPolygonWriter : public PolygonReceiver<DataType>
 
     CPLErr eErr_{CE_None};
 
+    void writeFeature(DataType nPolygonCellValue);
+
   public:
     OGRPolygonWriter(OGRLayerH hOutLayer, int iPixValField,
                      double *padfGeoTransform);
@@ -203,6 +221,12 @@ class OGRPolygonWriter : public PolygonReceiver<DataType>
 
     void receive(RPolygon *poPolygon, DataType nPolygonCellValue) override;
 
+    /**
+     * Write a polygon geometry built with BuildOGRPolygon().
+     */
+    void write(std::unique_ptr<OGRPolygon> poPolygon,
+               DataType nPolygonCellValue);
+
     inline CPLErr getErr()
     {
         return eErr_;
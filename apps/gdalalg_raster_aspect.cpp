@@ -47,6 +47,7 @@ GDALRasterAspectAlgorithm::GDALRasterAspectAlgorithm(bool standaloneStep)
            _("Do not try to interpolate values at dataset edges or close to "
              "nodata values"),
            &m_noEdges);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -73,6 +74,8 @@ bool GDALRasterAspectAlgorithm::RunStep(GDALPipelineStepRunContext &)
         aosOptions.AddString("-zero_for_flat");
     if (!m_noEdges)
         aosOptions.AddString("-compute_edges");
+    aosOptions.AddString("-num_threads");
+    aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
 
     GDALDEMProcessingOptions *psOptions =
         GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
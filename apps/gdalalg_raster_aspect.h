@@ -41,6 +41,8 @@ class GDALRasterAspectAlgorithm /* non final */
     std::string m_gradientAlg = "Horn";
     bool m_zeroForFlat = false;
     bool m_noEdges = false;
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
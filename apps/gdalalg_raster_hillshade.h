@@ -48,6 +48,8 @@ class GDALRasterHillshadeAlgorithm /* non final */
     std::string m_gradientAlg = "Horn";
     std::string m_variant = "regular";
     bool m_noEdges = false;
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -41,6 +41,7 @@ GDALRasterTRIAlgorithm::GDALRasterTRIAlgorithm(bool standaloneStep)
            _("Do not try to interpolate values at dataset edges or close to "
              "nodata values"),
            &m_noEdges);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -63,6 +64,8 @@ bool GDALRasterTRIAlgorithm::RunStep(GDALPipelineStepRunContext &)
     aosOptions.AddString(m_algorithm.c_str());
     if (!m_noEdges)
         aosOptions.AddString("-compute_edges");
+    aosOptions.AddString("-num_threads");
+    aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
 
     GDALDEMProcessingOptions *psOptions =
         GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
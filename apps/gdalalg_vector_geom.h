@@ -15,6 +15,7 @@
 
 #include "gdalalg_vector_pipeline.h"
 #include "ogr_geos.h"
+#include "ogrlayerarrow.h"
 
 //! @cond Doxygen_Suppress
 
@@ -141,9 +142,121 @@ class GDALVectorGeomOneToOneAlgorithmLayer /* non final */
         {
             return m_srcLayer.TestCapability(pszCap);
         }
+        if (EQUAL(pszCap, OLCFastGetArrowStream))
+        {
+            return CanProcessArrowGeomColumn() && !m_poAttrQuery &&
+                   !m_poFilterGeom && m_srcLayer.TestCapability(pszCap);
+        }
         return false;
     }
 
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions = nullptr) override
+    {
+        // Process the WKB geometry columns of the batches of the source
+        // layer in place, instead of going through OGRFeature, and give
+        // them the requested encoding.
+        if (TestCapability(OLCFastGetArrowStream) &&
+            HasSameIgnoredFieldsAsSource())
+        {
+            CPLStringList aosOptions(papszOptions);
+            aosOptions.SetNameValue("GEOMETRY_ENCODING", "WKB");
+            OGRArrowArrayStream oSrcStream;
+            if (!m_srcLayer.GetArrowStream(oSrcStream.get(),
+                                           aosOptions.List()))
+                return false;
+
+            struct ArrowSchema sSchema;
+            if (oSrcStream.get_schema(&sSchema) == 0)
+            {
+                std::vector<int> anCols;
+                // (Arrow column index, geometry field index) of WKB columns
+                std::vector<std::pair<int, int>> anGeomColumns;
+                bool bOK = true;
+                const auto poLayerDefn = GetLayerDefn();
+                for (int i = 0; bOK && i < poLayerDefn->GetGeomFieldCount();
+                     ++i)
+                {
+                    const auto poGeomFieldDefn =
+                        poLayerDefn->GetGeomFieldDefn(i);
+                    if (poGeomFieldDefn->IsIgnored())
+                        continue;
+                    const int iCol = OGRArrowGetWKBColumnIndex(
+                        &sSchema, poGeomFieldDefn->GetNameRef());
+                    if (IsSelectedGeomField(i))
+                    {
+                        anCols.push_back(iCol);
+                        bOK = iCol >= 0;
+                    }
+                    if (iCol >= 0)
+                        anGeomColumns.emplace_back(iCol, i);
+                }
+                sSchema.release(&sSchema);
+
+                if (bOK)
+                {
+                    bool bInterleaved = false;
+                    const bool bGeoArrow =
+                        OGRIsGeoArrowGeometryEncodingRequested(papszOptions,
+                                                               bInterleaved);
+                    return OGRWrapArrowArrayStream(
+                        oSrcStream.get(),
+                        [this, anCols, anGeomColumns, poLayerDefn, bGeoArrow,
+                         bInterleaved](const struct ArrowSchema *schema,
+                                       struct ArrowArray *array)
+                        {
+                            for (const int iCol : anCols)
+                            {
+                                if (!ProcessArrowGeomColumn(schema, array,
+                                                            iCol))
+                                    return false;
+                            }
+                            if (bGeoArrow)
+                            {
+                                for (const auto &[iCol, iGeomField] :
+                                     anGeomColumns)
+                                {
+                                    const auto eGeomType =
+                                        poLayerDefn
+                                            ->GetGeomFieldDefn(iGeomField)
+                                            ->GetType();
+                                    if (OGRGeoArrowIsSupportedGeometryType(
+                                            eGeomType) &&
+                                        !OGRArrowWKBColumnToGeoArrow(
+                                            schema, array, iCol, eGeomType,
+                                            bInterleaved))
+                                    {
+                                        return false;
+                                    }
+                                }
+                            }
+                            return true;
+                        },
+                        out_stream,
+                        [poLayerDefn, &anGeomColumns,
+                         papszOptions](struct ArrowSchema *schema)
+                        {
+                            for (const auto &[iCol, iGeomField] :
+                                 anGeomColumns)
+                            {
+                                if (!OGRArrowSetGeometryColumnSchema(
+                                        schema, iCol,
+                                        poLayerDefn->GetGeomFieldDefn(
+                                            iGeomField),
+                                        papszOptions))
+                                {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        });
+                }
+            }
+        }
+
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    }
+
   protected:
     const typename T::Options m_opts;
 
@@ -172,6 +285,22 @@ class GDALVectorGeomOneToOneAlgorithmLayer /* non final */
     virtual std::unique_ptr<OGRFeature>
     TranslateFeature(std::unique_ptr<OGRFeature> poSrcFeature) const = 0;
 
+    /** Whether ProcessArrowGeomColumn() is implemented, and can be used
+     * with the current options. */
+    virtual bool CanProcessArrowGeomColumn() const
+    {
+        return false;
+    }
+
+    /** Process the WKB geometry column iCol of an Arrow batch read from the
+     * source layer, equivalently to what TranslateFeature() does.
+     * The column must be considered as read-only. */
+    virtual bool ProcessArrowGeomColumn(const struct ArrowSchema *,
+                                        struct ArrowArray *, int) const
+    {
+        return false;
+    }
+
     void TranslateFeature(
         std::unique_ptr<OGRFeature> poSrcFeature,
         std::vector<std::unique_ptr<OGRFeature>> &apoOutFeatures) override
@@ -183,6 +312,27 @@ class GDALVectorGeomOneToOneAlgorithmLayer /* non final */
 
   private:
     int m_iGeomIdx = -1;
+
+    bool HasSameIgnoredFieldsAsSource() const
+    {
+        const auto poLayerDefn = GetLayerDefn();
+        const auto poSrcLayerDefn = m_srcLayer.GetLayerDefn();
+        if (poLayerDefn == poSrcLayerDefn)
+            return true;
+        for (int i = 0; i < poLayerDefn->GetFieldCount(); ++i)
+        {
+            if (poLayerDefn->GetFieldDefn(i)->IsIgnored() !=
+                poSrcLayerDefn->GetFieldDefn(i)->IsIgnored())
+                return false;
+        }
+        for (int i = 0; i < poLayerDefn->GetGeomFieldCount(); ++i)
+        {
+            if (poLayerDefn->GetGeomFieldDefn(i)->IsIgnored() !=
+                poSrcLayerDefn->GetGeomFieldDefn(i)->IsIgnored())
+                return false;
+        }
+        return true;
+    }
 };
 
 #ifdef HAVE_GEOS
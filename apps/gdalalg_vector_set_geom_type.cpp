@@ -106,6 +106,11 @@ class GDALVectorSetGeomTypeAlgorithmLayer final
         {
             return m_srcLayer.TestCapability(pszCap);
         }
+        if (EQUAL(pszCap, OLCFastGetArrowStream))
+        {
+            return GDALVectorGeomOneToOneAlgorithmLayer::TestCapability(
+                pszCap);
+        }
         return false;
     }
 
@@ -115,6 +120,29 @@ class GDALVectorSetGeomTypeAlgorithmLayer final
     std::unique_ptr<OGRFeature>
     TranslateFeature(std::unique_ptr<OGRFeature> poSrcFeature) const override;
 
+    bool CanProcessArrowGeomColumn() const override
+    {
+        // Only changes of the coordinate dimension can be done on WKB
+        return m_opts.m_layerOnly ||
+               (m_opts.m_type.empty() && !m_opts.m_multi && !m_opts.m_single &&
+                !m_opts.m_linear && !m_opts.m_curve && !m_opts.m_skip &&
+                !m_opts.m_dim.empty());
+    }
+
+    bool ProcessArrowGeomColumn(const struct ArrowSchema *schema,
+                                struct ArrowArray *array,
+                                int iCol) const override
+    {
+        if (m_opts.m_layerOnly)
+            return true;
+        const bool bHasZ = EQUAL(m_opts.m_dim.c_str(), "XYZ") ||
+                           EQUAL(m_opts.m_dim.c_str(), "XYZM");
+        const bool bHasM = EQUAL(m_opts.m_dim.c_str(), "XYM") ||
+                           EQUAL(m_opts.m_dim.c_str(), "XYZM");
+        return OGRArrowWKBColumnSetCoordinateDimension(schema, array, iCol,
+                                                       bHasZ, bHasM);
+    }
+
   private:
     OGRFeatureDefn *m_poFeatureDefn = nullptr;
 
@@ -66,6 +66,19 @@ class GDALVectorSwapXYAlgorithmLayer final
 
     std::unique_ptr<OGRFeature>
     TranslateFeature(std::unique_ptr<OGRFeature> poSrcFeature) const override;
+
+    bool CanProcessArrowGeomColumn() const override
+    {
+        return true;
+    }
+
+    bool ProcessArrowGeomColumn(const struct ArrowSchema *schema,
+                                struct ArrowArray *array,
+                                int iCol) const override
+    {
+        return OGRArrowWKBColumnMakeWritable(schema, array, iCol) &&
+               OGRArrowWKBColumnSwapXY(schema, array, iCol);
+    }
 };
 
 /************************************************************************/
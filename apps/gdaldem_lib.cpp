@@ -102,8 +102,10 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__x86_64__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -172,6 +174,7 @@ struct GDALDEMProcessingOptions
     bool bMultiDirectional = false;
     CPLStringList aosCreationOptions{};
     int nBand = 1;
+    std::string osNumThreads{};
 };
 
 /************************************************************************/
@@ -307,6 +310,313 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
     return nVal;
 }
 
+/************************************************************************/
+/*                     GDALGeneric3x3LineParams                         */
+/************************************************************************/
+
+template <class T> struct GDALGeneric3x3LineParams
+{
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg = nullptr;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample = nullptr;
+    const AlgorithmParameters *pData = nullptr;
+    int nXSize = 0;
+    bool bSrcHasNoData = false;
+    T fSrcNoDataValue = 0;
+    bool bIsSrcNoDataNan = false;
+    float fDstNoDataValue = 0;
+    bool bComputeAtEdges = false;
+};
+
+/************************************************************************/
+/*                    GDALGeneric3x3LineHasNoData()                     */
+/************************************************************************/
+
+template <class T>
+static bool GDALGeneric3x3LineHasNoData(const T *pafLine, int nXSize,
+                                        T fSrcNoDataValue)
+{
+    int iX = 0;
+    if constexpr (std::numeric_limits<T>::is_integer)
+    {
+        for (; iX + 3 < nXSize; iX += 4)
+        {
+            if (pafLine[iX] == fSrcNoDataValue ||
+                pafLine[iX + 1] == fSrcNoDataValue ||
+                pafLine[iX + 2] == fSrcNoDataValue ||
+                pafLine[iX + 3] == fSrcNoDataValue)
+            {
+                return true;
+            }
+        }
+        for (; iX < nXSize; iX++)
+        {
+            if (pafLine[iX] == fSrcNoDataValue)
+                return true;
+        }
+    }
+    else
+    {
+        for (; iX + 3 < nXSize; iX += 4)
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]) ||
+                pafLine[iX + 1] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 1]) ||
+                pafLine[iX + 2] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 2]) ||
+                pafLine[iX + 3] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 3]))
+            {
+                return true;
+            }
+        }
+        for (; iX < nXSize; iX++)
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]))
+                return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     GDALGeneric3x3ProcessLine()                      */
+/************************************************************************/
+
+// Computes a line of output, which is not the first or last line of the
+// raster, from the source line above, the source line and the source line
+// below.
+template <class T>
+static void
+GDALGeneric3x3ProcessLine(const GDALGeneric3x3LineParams<T> &sParams,
+                          const T *pafLine1, const T *pafLine2,
+                          const T *pafLine3, bool bOneOfThreeLinesHasNoData,
+                          float *pafOutputBuf)
+{
+    const int nXSize = sParams.nXSize;
+    const bool bSrcHasNoData = sParams.bSrcHasNoData;
+    const T fSrcNoDataValue = sParams.fSrcNoDataValue;
+
+    if (sParams.bComputeAtEdges && nXSize >= 2)
+    {
+        int j = 0;
+        T afWin[9] = {
+            INTERPOL(pafLine1[j], pafLine1[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine1[j],
+            pafLine1[j + 1],
+            INTERPOL(pafLine2[j], pafLine2[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine2[j],
+            pafLine2[j + 1],
+            INTERPOL(pafLine3[j], pafLine3[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine3[j],
+            pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, sParams.bIsSrcNoDataNan,
+            afWin, sParams.fDstNoDataValue, sParams.pfnAlg, sParams.pData,
+            sParams.bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        pafOutputBuf[0] = sParams.fDstNoDataValue;
+    }
+
+    int j = 1;
+    if (sParams.pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    {
+        j = sParams.pfnAlg_multisample(pafLine1, pafLine2, pafLine3, nXSize,
+                                       sParams.pData, pafOutputBuf);
+    }
+
+    for (; j < nXSize - 1; j++)
+    {
+        T afWin[9] = {pafLine1[j - 1], pafLine1[j], pafLine1[j + 1],
+                      pafLine2[j - 1], pafLine2[j], pafLine2[j + 1],
+                      pafLine3[j - 1], pafLine3[j], pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, sParams.bIsSrcNoDataNan,
+            afWin, sParams.fDstNoDataValue, sParams.pfnAlg, sParams.pData,
+            sParams.bComputeAtEdges);
+    }
+
+    if (sParams.bComputeAtEdges && nXSize >= 2)
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {pafLine1[j - 1],
+                      pafLine1[j],
+                      INTERPOL(pafLine1[j], pafLine1[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine2[j - 1],
+                      pafLine2[j],
+                      INTERPOL(pafLine2[j], pafLine2[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine3[j - 1],
+                      pafLine3[j],
+                      INTERPOL(pafLine3[j], pafLine3[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue)};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, sParams.bIsSrcNoDataNan,
+            afWin, sParams.fDstNoDataValue, sParams.pfnAlg, sParams.pData,
+            sParams.bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if (nXSize > 1)
+            pafOutputBuf[nXSize - 1] = sParams.fDstNoDataValue;
+    }
+}
+
+/************************************************************************/
+/*                     GDALGeneric3x3ProcessRows()                      */
+/************************************************************************/
+
+// Computes nRows consecutive lines of output. pafSrc must contain nRows + 2
+// source lines, starting with the line above the first output line.
+template <class T>
+static void
+GDALGeneric3x3ProcessRows(const GDALGeneric3x3LineParams<T> &sParams,
+                          const T *pafSrc, int nRows, float *pafOutputBuf)
+{
+    const int nXSize = sParams.nXSize;
+    const auto LineHasNoData = [&sParams, pafSrc, nXSize](int iLine)
+    {
+        return sParams.bSrcHasNoData &&
+               GDALGeneric3x3LineHasNoData(
+                   pafSrc + static_cast<size_t>(iLine) * nXSize, nXSize,
+                   sParams.fSrcNoDataValue);
+    };
+
+    bool bPrevLineHasNoData = LineHasNoData(0);
+    bool bCurLineHasNoData = LineHasNoData(1);
+    for (int iRow = 0; iRow < nRows; ++iRow)
+    {
+        const bool bNextLineHasNoData = LineHasNoData(iRow + 2);
+        const T *pafLine1 = pafSrc + static_cast<size_t>(iRow) * nXSize;
+        GDALGeneric3x3ProcessLine(
+            sParams, pafLine1, pafLine1 + nXSize, pafLine1 + 2 * nXSize,
+            bPrevLineHasNoData || bCurLineHasNoData || bNextLineHasNoData,
+            pafOutputBuf + static_cast<size_t>(iRow) * nXSize);
+        bPrevLineHasNoData = bCurLineHasNoData;
+        bCurLineHasNoData = bNextLineHasNoData;
+    }
+}
+
+/************************************************************************/
+/*                    GDALGeneric3x3ProcessStrips()                     */
+/************************************************************************/
+
+// Computes the output lines 1 to nYSize - 2 by horizontal strips processed
+// in parallel by the jobs of poJobQueue. Reading and writing is done by the
+// calling thread, while the strips of the previous/next round are computed.
+template <class T>
+static CPLErr GDALGeneric3x3ProcessStrips(
+    const GDALGeneric3x3LineParams<T> &sParams, GDALRasterBandH hSrcBand,
+    GDALRasterBandH hDstBand, GDALDataType eReadDT, int nYSize, int nThreads,
+    CPLJobQueue *poJobQueue, GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize = sParams.nXSize;
+
+    // Minimum number of pixels computed by a job, to amortize scheduling.
+    constexpr int MIN_PIXELS_PER_JOB = 256 * 1024;
+    const int nRowsPerJob = std::max(1, MIN_PIXELS_PER_JOB / nXSize);
+    const int nRowsPerRound = static_cast<int>(std::min<int64_t>(
+        nYSize - 2, static_cast<int64_t>(nRowsPerJob) * nThreads));
+
+    struct Round
+    {
+        std::vector<T> aSrc{};
+        std::vector<float> aDst{};
+        int nFirstRow = 0;
+        int nRows = 0;
+    };
+
+    Round aRounds[2];
+    try
+    {
+        for (auto &sRound : aRounds)
+        {
+            sRound.aSrc.resize(static_cast<size_t>(nRowsPerRound + 2) *
+                               nXSize);
+            sRound.aDst.resize(static_cast<size_t>(nRowsPerRound) * nXSize);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffers for multi-threaded processing");
+        return CE_Failure;
+    }
+
+    const auto ReadRound = [&](Round &sRound, int nFirstRow)
+    {
+        sRound.nFirstRow = nFirstRow;
+        sRound.nRows = std::min(nRowsPerRound, nYSize - 1 - nFirstRow);
+        return GDALRasterIO(hSrcBand, GF_Read, 0, nFirstRow - 1, nXSize,
+                            sRound.nRows + 2, sRound.aSrc.data(), nXSize,
+                            sRound.nRows + 2, eReadDT, 0, 0);
+    };
+
+    const auto SubmitRound = [&](Round &sRound)
+    {
+        for (int iRow = 0; iRow < sRound.nRows; iRow += nRowsPerJob)
+        {
+            const int nJobRows = std::min(nRowsPerJob, sRound.nRows - iRow);
+            const T *pafSrc =
+                sRound.aSrc.data() + static_cast<size_t>(iRow) * nXSize;
+            float *pafDst =
+                sRound.aDst.data() + static_cast<size_t>(iRow) * nXSize;
+            poJobQueue->SubmitJob(
+                [&sParams, pafSrc, nJobRows, pafDst]()
+                {
+                    GDALGeneric3x3ProcessRows(sParams, pafSrc, nJobRows,
+                                              pafDst);
+                });
+        }
+    };
+
+    CPLErr eErr = ReadRound(aRounds[0], 1);
+    if (eErr == CE_None)
+        SubmitRound(aRounds[0]);
+    for (int iRound = 0; eErr == CE_None; ++iRound)
+    {
+        Round &sCurRound = aRounds[iRound % 2];
+        Round &sNextRound = aRounds[1 - (iRound % 2)];
+        const int nNextFirstRow = sCurRound.nFirstRow + sCurRound.nRows;
+        const bool bHasNextRound = nNextFirstRow < nYSize - 1;
+
+        if (bHasNextRound)
+            eErr = ReadRound(sNextRound, nNextFirstRow);
+        poJobQueue->WaitCompletion();
+        if (eErr != CE_None)
+            break;
+        if (bHasNextRound)
+            SubmitRound(sNextRound);
+
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, sCurRound.nFirstRow, nXSize,
+                            sCurRound.nRows, sCurRound.aDst.data(), nXSize,
+                            sCurRound.nRows, GDT_Float32, 0, 0);
+        if (eErr == CE_None &&
+            !pfnProgress(1.0 * nNextFirstRow / nYSize, nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+        if (!bHasNextRound)
+            break;
+    }
+    poJobQueue->WaitCompletion();
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                  GDALGeneric3x3Processing()                          */
 /************************************************************************/
@@ -318,7 +628,7 @@ static CPLErr GDALGeneric3x3Processing(
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisample,
     std::unique_ptr<AlgorithmParameters> pData, bool bComputeAtEdges,
-    GDALProgressFunc pfnProgress, void *pProgressData)
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -394,6 +704,17 @@ static CPLErr GDALGeneric3x3Processing(
     if (!bDstHasNoData)
         fDstNoDataValue = 0.0;
 
+    GDALGeneric3x3LineParams<T> sParams;
+    sParams.pfnAlg = pfnAlg;
+    sParams.pfnAlg_multisample = pfnAlg_multisample;
+    sParams.pData = pData.get();
+    sParams.nXSize = nXSize;
+    sParams.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
+    sParams.fSrcNoDataValue = fSrcNoDataValue;
+    sParams.bIsSrcNoDataNan = bIsSrcNoDataNan;
+    sParams.fDstNoDataValue = fDstNoDataValue;
+    sParams.bComputeAtEdges = bComputeAtEdges;
+
     int nLine1Off = 0;
     int nLine2Off = nXSize;
     int nLine3Off = 2 * nXSize;
@@ -424,30 +745,8 @@ static CPLErr GDALGeneric3x3Processing(
         }
         if (bSrcHasNoData)
         {
-            abLineHasNoDataValue[i] = false;
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue)
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[i * nXSize + iX]))
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
+            abLineHasNoDataValue[i] = GDALGeneric3x3LineHasNoData(
+                pafThreeLineWin + i * nXSize, nXSize, fSrcNoDataValue);
         }
     }
 
@@ -504,6 +803,38 @@ static CPLErr GDALGeneric3x3Processing(
     }
 
     int i = 1;  // Used after for.
+
+    /* -------------------------------------------------------------------- */
+    /*      Process the inner lines by strips in parallel if requested.     */
+    /* -------------------------------------------------------------------- */
+    auto poThreadPool = nThreads > 1 && nYSize > 2
+                            ? GDALGetGlobalThreadPool(nThreads)
+                            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        eErr = GDALGeneric3x3ProcessStrips(sParams, hSrcBand, hDstBand, eReadDT,
+                                           nYSize, nThreads, poJobQueue.get(),
+                                           pfnProgress, pProgressData);
+
+        // Reload the last 2 lines for the computation of the last line
+        if (eErr == CE_None && bComputeAtEdges && nXSize >= 2)
+        {
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nYSize - 2, nXSize, 2,
+                                pafThreeLineWin, nXSize, 2, eReadDT, 0, 0);
+            nLine1Off = 0;
+            nLine2Off = nXSize;
+        }
+        if (eErr != CE_None)
+        {
+            CPLFree(pafOutputBuf);
+            CPLFree(pafThreeLineWin);
+
+            return eErr;
+        }
+        i = nYSize - 1;
+    }
+
     for (; i < nYSize - 1; i++)
     {
         /* Read third line of the line buffer */
@@ -523,167 +854,19 @@ static CPLErr GDALGeneric3x3Processing(
         bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
         if (bSrcHasNoData)
         {
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
-            }
-            else
-            {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX]) ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 1]) ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 2]) ||
-                        pafThreeLineWin[nLine3Off + iX + 3] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 3]))
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] ==
-                                fSrcNoDataValue ||
-                            std::isnan(pafThreeLineWin[nLine3Off + iX]))
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
+            abLineHasNoDataValue[nLine3Off / nXSize] =
+                GDALGeneric3x3LineHasNoData(pafThreeLineWin + nLine3Off,
+                                            nXSize, fSrcNoDataValue);
 
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
-            }
+            bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
+                                        abLineHasNoDataValue[1] ||
+                                        abLineHasNoDataValue[2];
         }
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
-
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
-        {
-            j = pfnAlg_multisample(
-                pafThreeLineWin + nLine1Off, pafThreeLineWin + nLine2Off,
-                pafThreeLineWin + nLine3Off, nXSize, pData.get(), pafOutputBuf);
-        }
-
-        for (; j < nXSize - 1; j++)
-        {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
-        }
+        GDALGeneric3x3ProcessLine(sParams, pafThreeLineWin + nLine1Off,
+                                  pafThreeLineWin + nLine2Off,
+                                  pafThreeLineWin + nLine3Off,
+                                  bOneOfThreeLinesHasNoData, pafOutputBuf);
 
         /* -----------------------------------------
          * Write Line to Raster
@@ -1131,6 +1314,73 @@ static int GDALHillshadeAlg_same_res_multisample(
     }
     return j;
 }
+
+// Vectorized version of GDALHillshadeAlg<T, alg>, giving the same results.
+template <class T, class REG_T, GradientAlg alg>
+static int GDALHillshadeAlg_multisample(const T *pafFirstLine,
+                                        const T *pafSecondLine,
+                                        const T *pafThirdLine, int nXSize,
+                                        const AlgorithmParameters *pData,
+                                        float *pafOutputBuf)
+{
+    const GDALHillshadeAlgData *psData =
+        static_cast<const GDALHillshadeAlgData *>(pData);
+    const auto reg_inv_ewres = XMMReg4Double::Set1(psData->inv_ewres_xscale);
+    const auto reg_inv_nsres = XMMReg4Double::Set1(psData->inv_nsres_yscale);
+    const auto reg_fact_x =
+        XMMReg4Double::Set1(psData->sin_az_mul_cos_alt_mul_z_mul_254);
+    const auto reg_fact_y =
+        XMMReg4Double::Set1(psData->cos_az_mul_cos_alt_mul_z_mul_254);
+    const auto reg_constant_num =
+        XMMReg4Double::Set1(psData->sin_altRadians_mul_254);
+    const auto reg_constant_denom = XMMReg4Double::Set1(psData->square_z);
+    const auto reg_zero = XMMReg4Double::Zero();
+    const auto reg_half = XMMReg4Double::Set1(0.5);
+    const auto reg_one = reg_half + reg_half;
+
+    int j = 1;  // Used after for.
+    for (; j < nXSize - 4; j += 4)
+    {
+        const T *firstLine = pafFirstLine + j - 1;
+        const T *secondLine = pafSecondLine + j - 1;
+        const T *thirdLine = pafThirdLine + j - 1;
+
+        const auto firstLine1 = REG_T::Load4Val(firstLine + 1);
+        const auto secondLine0 = REG_T::Load4Val(secondLine);
+        const auto secondLine2 = REG_T::Load4Val(secondLine + 2);
+        const auto thirdLine1 = REG_T::Load4Val(thirdLine + 1);
+        const auto accX =
+            alg == GradientAlg::HORN
+                ? (REG_T::Load4Val(firstLine) + secondLine0 + secondLine0 +
+                   REG_T::Load4Val(thirdLine)) -
+                      (REG_T::Load4Val(firstLine + 2) + secondLine2 +
+                       secondLine2 + REG_T::Load4Val(thirdLine + 2))
+                : secondLine0 - secondLine2;
+        const auto accY =
+            alg == GradientAlg::HORN
+                ? (REG_T::Load4Val(thirdLine) + thirdLine1 + thirdLine1 +
+                   REG_T::Load4Val(thirdLine + 2)) -
+                      (REG_T::Load4Val(firstLine) + firstLine1 + firstLine1 +
+                       REG_T::Load4Val(firstLine + 2))
+                : thirdLine1 - firstLine1;
+
+        const auto reg_x = accX.cast_to_double() * reg_inv_ewres;
+        const auto reg_y = accY.cast_to_double() * reg_inv_nsres;
+        const auto reg_xx_plus_yy = reg_x * reg_x + reg_y * reg_y;
+        const auto reg_numerator =
+            reg_constant_num - (reg_y * reg_fact_y - reg_x * reg_fact_x);
+        const auto reg_denominator =
+            reg_one + reg_constant_denom * reg_xx_plus_yy;
+        const auto num_div_sqrt_denom =
+            reg_numerator * reg_denominator.approx_inv_sqrt(reg_one, reg_half);
+
+        const auto res = XMMReg4Double::Ternary(
+            XMMReg4Double::Greater(num_div_sqrt_denom, reg_zero),
+            num_div_sqrt_denom + reg_one, reg_one);
+        res.cast_to_float().Store4Val(pafOutputBuf + j);
+    }
+    return j;
+}
 #endif
 
 static const double INV_SQUARE_OF_HALF_PI = 1.0 / ((M_PI * M_PI) / 4);
@@ -3072,6 +3322,11 @@ static std::unique_ptr<GDALArgumentParser> GDALDEMAppOptionsGetParser(
 
         subParser->add_hidden_alias_for(bandArg, "--b");
 
+        subParser->add_argument("-num_threads")
+            .metavar("<value>|ALL_CPUS")
+            .store_into(psOptions->osNumThreads)
+            .help(_("Number of threads to use for the computation."));
+
         subParser->add_creation_options_argument(psOptions->aosCreationOptions);
 
         if (psOptionsForBinary)
@@ -3854,6 +4109,12 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                     GDALHillshadeAlg<float, GradientAlg::ZEVENBERGEN_THORNE>;
                 pfnAlgInt32 =
                     GDALHillshadeAlg<GInt32, GradientAlg::ZEVENBERGEN_THORNE>;
+#ifdef HAVE_16_SSE_REG
+                pfnAlgFloat_multisample = GDALHillshadeAlg_multisample<
+                    float, XMMReg4Float, GradientAlg::ZEVENBERGEN_THORNE>;
+                pfnAlgInt32_multisample = GDALHillshadeAlg_multisample<
+                    GInt32, XMMReg4Int, GradientAlg::ZEVENBERGEN_THORNE>;
+#endif
             }
         }
         else
@@ -3890,6 +4151,14 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 {
                     pfnAlgFloat = GDALHillshadeAlg<float, GradientAlg::HORN>;
                     pfnAlgInt32 = GDALHillshadeAlg<GInt32, GradientAlg::HORN>;
+#ifdef HAVE_16_SSE_REG
+                    pfnAlgFloat_multisample =
+                        GDALHillshadeAlg_multisample<float, XMMReg4Float,
+                                                     GradientAlg::HORN>;
+                    pfnAlgInt32_multisample =
+                        GDALHillshadeAlg_multisample<GInt32, XMMReg4Int,
+                                                     GradientAlg::HORN>;
+#endif
                 }
             }
         }
@@ -4146,19 +4415,28 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         if (bDstHasNoData)
             GDALSetRasterNoDataValue(hDstBand, dfDstNoDataValue);
 
+        const char *pszNumThreads =
+            !psOptions->osNumThreads.empty()
+                ? psOptions->osNumThreads.c_str()
+                : CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        const int nThreads =
+            std::clamp(EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszNumThreads),
+                       1, 128);
+
         if (eSrcDT == GDT_Byte || eSrcDT == GDT_Int16 || eSrcDT == GDT_UInt16)
         {
             GDALGeneric3x3Processing<GInt32>(
                 hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                pfnProgress, pProgressData);
         }
         else
         {
             GDALGeneric3x3Processing<float>(
                 hSrcBand, hDstBand, pfnAlgFloat, pfnAlgFloat_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                pfnProgress, pProgressData);
         }
     }
 
@@ -39,6 +39,7 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
@@ -47,6 +48,7 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -613,6 +615,12 @@ class LayerTranslator
                         GDALProgressFunc pfnProgress, void *pProgressArg,
                         const GDALVectorTranslateOptions *psOptions);
 
+    bool ClipSrcArrowArray(const TargetLayerInfo *psInfo,
+                           const struct ArrowSchema *schema,
+                           struct ArrowArray *array, int iArrowGeomFieldIndex,
+                           int nNumThreads, std::vector<GByte> &abyClippedWKB,
+                           std::vector<uint32_t> &anClippedOffsets);
+
   public:
     GDALDataset *m_poSrcDS = nullptr;
     GDALDataset *m_poODS = nullptr;
@@ -666,6 +674,72 @@ class LayerTranslator
 
     ClipGeomDesc GetDstClipGeom(const OGRSpatialReference *poGeomSRS);
     ClipGeomDesc GetSrcClipGeom(const OGRSpatialReference *poGeomSRS);
+
+    // Set on the translators of worker threads, to protect SRS objects shared
+    // between threads when computing clip geometries.
+    std::mutex *m_poClipGeomMutex = nullptr;
+
+    enum class FeatureTranslationStatus
+    {
+        OK,
+        SKIP_FEATURE,
+        SET_FROM_FAILED,
+    };
+
+    FeatureTranslationStatus TranslateFeature(
+        std::unique_ptr<OGRFeature> &poFeature,
+        std::unique_ptr<OGRFeature> &poDstFeature, OGRFeatureDefn *poDstFDefn,
+        const TargetLayerInfo *psInfo,
+        std::vector<TargetLayerInfo::ReprojectionInfo> &aoReprojectionInfo,
+        GIntBig nSrcFID, GIntBig nDesiredFID,
+        OGRGeometryCollection *poCollToExplode, int iGeomCollToExplode,
+        const OGRGeometry *poSrcGeometry,
+        const OGRSpatialReference *poOutputSRS, bool bRunSetPrecision,
+        bool &bReprojectionFailed, const GDALVectorTranslateOptions *psOptions);
+
+    bool TranslateGeometry(std::unique_ptr<OGRGeometry> &poDstGeometry,
+                           int iGeom, const OGRFeatureDefn *poDstFDefn,
+                           TargetLayerInfo::ReprojectionInfo &oReprojectionInfo,
+                           const TargetLayerInfo *psInfo,
+                           const OGRFeature *poSrcFeature, GIntBig nSrcFID,
+                           const OGRSpatialReference *poOutputSRS,
+                           bool bRunSetPrecision, bool &bReprojectionFailed,
+                           const GDALVectorTranslateOptions *psOptions);
+
+    bool WriteFeature(TargetLayerInfo *psInfo,
+                      FeatureTranslationStatus eStatus,
+                      bool bReprojectionFailed, OGRFeature *poDstFeature,
+                      GIntBig nSrcFID, GIntBig nDesiredFID,
+                      GIntBig &nFeaturesWritten,
+                      const GDALVectorTranslateOptions *psOptions);
+
+    bool UpdateGroupTransaction(OGRLayer *poDstLayer,
+                                int &nFeaturesInTransaction,
+                                GIntBig &nTotalEventsDone,
+                                const GDALVectorTranslateOptions *psOptions);
+
+    bool
+    HasGeometryProcessing(const GDALVectorTranslateOptions *psOptions) const;
+
+    struct ParallelWorker
+    {
+        std::unique_ptr<LayerTranslator> poTranslator{};
+        std::vector<TargetLayerInfo::ReprojectionInfo> aoReprojectionInfo{};
+    };
+
+    bool CreateParallelWorkers(const TargetLayerInfo *psInfo, int nNumThreads,
+                               std::mutex &oClipGeomMutex,
+                               std::vector<ParallelWorker> &aoWorkers);
+
+    bool TranslateInParallel(
+        TargetLayerInfo *psInfo, std::vector<ParallelWorker> &aoWorkers,
+        OGRFeatureDefn *poDstFDefn, const OGRSpatialReference *poOutputSRS,
+        bool bRunSetPrecision, GIntBig nCountLayerFeatures,
+        GIntBig *pnReadFeatureCount, GIntBig &nCount,
+        GIntBig &nFeaturesWritten, int &nFeaturesInTransaction,
+        GIntBig &nTotalEventsDone, GDALProgressFunc pfnProgress,
+        void *pProgressArg, bool &bRet,
+        const GDALVectorTranslateOptions *psOptions);
 };
 
 static OGRLayer *GetLayerAndOverwriteIfNecessary(GDALDataset *poDstDS,
@@ -4297,7 +4371,7 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
           CPLTestBool(CPLGetConfigOption("OGR2OGR_USE_ARROW_API", "YES"))) ||
          CPLTestBool(CPLGetConfigOption("OGR2OGR_USE_ARROW_API", "NO"))) &&
         !psOptions->bUpsert && !psOptions->bSkipFailures &&
-        !psOptions->poClipSrc && !psOptions->poClipDst &&
+        !psOptions->poClipDst &&
         psOptions->oGCPs.nGCPCount == 0 && !psOptions->bWrapDateline &&
         !m_papszSelFields && !m_bAddMissingFields &&
         m_eGType == GEOMTYPE_UNCHANGED && psOptions->eGeomOp == GEOMOP_NONE &&
@@ -4328,6 +4402,14 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
             }
         }
 
+        // -clipsrc is applied on the WKB geometry column
+        if (psOptions->poClipSrc &&
+            (poSrcLayer->GetLayerDefn()->GetGeomFieldCount() != 1 ||
+             poDstLayer->GetLayerDefn()->GetGeomFieldCount() != 1))
+        {
+            return false;
+        }
+
         const CPLStringList aosGetArrowStreamOptions(BuildGetArrowStreamOptions(
             poSrcLayer, poDstLayer, psOptions, bPreserveFID));
         if (poSrcLayer->GetArrowStream(streamSrc.get(),
@@ -4336,7 +4418,7 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
             struct ArrowSchema schemaSrc;
             if (streamSrc.get_schema(&schemaSrc) == 0)
             {
-                if (psOptions->bTransform &&
+                if ((psOptions->bTransform || psOptions->poClipSrc) &&
                     GetArrowGeomFieldIndex(&schemaSrc,
                                            poSrcLayer->GetGeometryColumn()) < 0)
                 {
@@ -6130,6 +6212,69 @@ SetupCT(TargetLayerInfo *psInfo, OGRLayer *poSrcLayer, bool bTransform,
     return true;
 }
 
+/************************************************************************/
+/*                     GetNumReprojectionThreads()                      */
+/************************************************************************/
+
+/** Returns the number of threads to use to process geometries, from the
+ * GDAL_NUM_THREADS configuration option.
+ */
+static int GetNumReprojectionThreads()
+{
+    // An explicit GDAL_NUM_THREADS is honoured even on a single CPU
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads)
+    {
+        if (EQUAL(pszNumThreads, "ALL_CPUS"))
+            return CPLGetNumCPUs();
+        return std::max(1, std::min(atoi(pszNumThreads), 1024));
+    }
+
+    const int nNumCPUs = CPLGetNumCPUs();
+    return nNumCPUs <= 1 ? 1 : std::max(2, nNumCPUs / 2);
+}
+
+/************************************************************************/
+/*                          GeomArrayReleaser                           */
+/************************************************************************/
+
+/** Installed on the geometry child of an Arrow array whose offset and data
+ * buffers have been replaced, to restore the original ones before calling
+ * the original release callback.
+ */
+struct GeomArrayReleaser
+{
+    const void *origin_buffers_1 = nullptr;
+    const void *origin_buffers_2 = nullptr;
+    void (*origin_release)(struct ArrowArray *) = nullptr;
+    void *origin_private_data = nullptr;
+
+    static void init(struct ArrowArray *psGeomArray)
+    {
+        GeomArrayReleaser *releaser = new GeomArrayReleaser();
+        CPLAssert(psGeomArray->n_buffers >= 3);
+        releaser->origin_buffers_1 = psGeomArray->buffers[1];
+        releaser->origin_buffers_2 = psGeomArray->buffers[2];
+        releaser->origin_private_data = psGeomArray->private_data;
+        releaser->origin_release = psGeomArray->release;
+        psGeomArray->release = GeomArrayReleaser::release;
+        psGeomArray->private_data = releaser;
+    }
+
+    static void release(struct ArrowArray *psGeomArray)
+    {
+        GeomArrayReleaser *releaser =
+            static_cast<GeomArrayReleaser *>(psGeomArray->private_data);
+        psGeomArray->buffers[1] = releaser->origin_buffers_1;
+        psGeomArray->buffers[2] = releaser->origin_buffers_2;
+        psGeomArray->private_data = releaser->origin_private_data;
+        psGeomArray->release = releaser->origin_release;
+        if (psGeomArray->release)
+            psGeomArray->release(psGeomArray);
+        delete releaser;
+    }
+};
+
 /************************************************************************/
 /*                 LayerTranslator::TranslateArrow()                    */
 /************************************************************************/
@@ -6156,10 +6301,13 @@ bool LayerTranslator::TranslateArrow(
     }
 
     int iArrowGeomFieldIndex = -1;
-    if (m_bTransform)
+    if (m_bTransform || m_poClipSrcOri)
     {
         iArrowGeomFieldIndex = GetArrowGeomFieldIndex(
             &schema, psInfo->m_poSrcLayer->GetGeometryColumn());
+    }
+    if (m_bTransform)
+    {
         if (!SetupCT(psInfo, psInfo->m_poSrcLayer, m_bTransform,
                      m_bWrapDateline, m_osDateLineOffset, m_poUserSourceSRS,
                      nullptr, m_poOutputSRS, m_poGCPCoordTrans, false))
@@ -6173,29 +6321,9 @@ bool LayerTranslator::TranslateArrow(
     GIntBig nCount = 0;
     bool bGoOn = true;
     std::vector<GByte> abyModifiedWKB;
-    const int nNumReprojectionThreads = []()
-    {
-        const int nNumCPUs = CPLGetNumCPUs();
-        if (nNumCPUs <= 1)
-        {
-            return 1;
-        }
-        else
-        {
-            const char *pszNumThreads =
-                CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
-            if (pszNumThreads)
-            {
-                if (EQUAL(pszNumThreads, "ALL_CPUS"))
-                    return CPLGetNumCPUs();
-                return std::min(atoi(pszNumThreads), 1024);
-            }
-            else
-            {
-                return std::max(2, nNumCPUs / 2);
-            }
-        }
-    }();
+    std::vector<GByte> abyClippedWKB;
+    std::vector<uint32_t> anClippedOffsets;
+    const int nNumReprojectionThreads = GetNumReprojectionThreads();
 
     // Somewhat arbitrary threshold (config option only/mostly for autotest purposes)
     const int MIN_FEATURES_FOR_THREADED_REPROJ = atoi(CPLGetConfigOption(
@@ -6237,42 +6365,26 @@ bool LayerTranslator::TranslateArrow(
             nCount += array.length;
         }
 
+        // Clipping with -clipsrc, which may remove rows
+        if (m_poClipSrcOri &&
+            !ClipSrcArrowArray(
+                psInfo, &schema, &array, iArrowGeomFieldIndex,
+                array.length >= MIN_FEATURES_FOR_THREADED_REPROJ
+                    ? nNumReprojectionThreads
+                    : 1,
+                abyClippedWKB, anClippedOffsets))
+        {
+            bRet = false;
+            if (array.release)
+                array.release(&array);
+            break;
+        }
+
         const auto nArrayLength = array.length;
 
         // Coordinate reprojection
-        if (m_bTransform)
+        if (m_bTransform && nArrayLength > 0)
         {
-            struct GeomArrayReleaser
-            {
-                const void *origin_buffers_2 = nullptr;
-                void (*origin_release)(struct ArrowArray *) = nullptr;
-                void *origin_private_data = nullptr;
-
-                static void init(struct ArrowArray *psGeomArray)
-                {
-                    GeomArrayReleaser *releaser = new GeomArrayReleaser();
-                    CPLAssert(psGeomArray->n_buffers >= 3);
-                    releaser->origin_buffers_2 = psGeomArray->buffers[2];
-                    releaser->origin_private_data = psGeomArray->private_data;
-                    releaser->origin_release = psGeomArray->release;
-                    psGeomArray->release = GeomArrayReleaser::release;
-                    psGeomArray->private_data = releaser;
-                }
-
-                static void release(struct ArrowArray *psGeomArray)
-                {
-                    GeomArrayReleaser *releaser =
-                        static_cast<GeomArrayReleaser *>(
-                            psGeomArray->private_data);
-                    psGeomArray->buffers[2] = releaser->origin_buffers_2;
-                    psGeomArray->private_data = releaser->origin_private_data;
-                    psGeomArray->release = releaser->origin_release;
-                    if (psGeomArray->release)
-                        psGeomArray->release(psGeomArray);
-                    delete releaser;
-                }
-            };
-
             auto *psGeomArray = array.children[iArrowGeomFieldIndex];
             GeomArrayReleaser::init(psGeomArray);
 
@@ -6282,9 +6394,11 @@ bool LayerTranslator::TranslateArrow(
                 static_cast<const uint32_t *>(psGeomArray->buffers[1]);
             auto poCT = psInfo->m_aoReprojectionInfo[0].m_poCT.get();
 
+            const size_t nWKBBufferSize = static_cast<size_t>(
+                panOffsets[psGeomArray->offset + nArrayLength]);
             try
             {
-                abyModifiedWKB.resize(panOffsets[nArrayLength]);
+                abyModifiedWKB.resize(nWKBBufferSize);
             }
             catch (const std::exception &)
             {
@@ -6294,7 +6408,7 @@ bool LayerTranslator::TranslateArrow(
                     array.release(&array);
                 break;
             }
-            memcpy(abyModifiedWKB.data(), pabyWKB, panOffsets[nArrayLength]);
+            memcpy(abyModifiedWKB.data(), pabyWKB, nWKBBufferSize);
             psGeomArray->buffers[2] = abyModifiedWKB.data();
 
             // Collect left-most, right-most, top-most, bottom-most coordinates.
@@ -6433,8 +6547,10 @@ bool LayerTranslator::TranslateArrow(
         }
 
         // Write batch to target layer
-        const bool bWriteOK = psInfo->m_poDstLayer->WriteArrowBatch(
-            &schema, &array, aosOptionsWriteArrowBatch.List());
+        const bool bWriteOK =
+            nArrayLength == 0 ||
+            psInfo->m_poDstLayer->WriteArrowBatch(
+                &schema, &array, aosOptionsWriteArrowBatch.List());
 
         if (array.release)
             array.release(&array);
@@ -6468,6 +6584,240 @@ bool LayerTranslator::TranslateArrow(
     return bRet;
 }
 
+/************************************************************************/
+/*                 LayerTranslator::ClipSrcArrowArray()                 */
+/************************************************************************/
+
+/** Applies -clipsrc on the WKB geometry column of an Arrow array.
+ *
+ * Geometries whose bounding box does not intersect the clip geometry, or
+ * is contained in a rectangular clip geometry, are handled without being
+ * instantiated as OGRGeometry. Rows that are discarded by the clipping are
+ * removed from the array, which is then replaced by a copy.
+ * The offset and data buffers of the geometry column are replaced by
+ * abyClippedWKB and anClippedOffsets if geometries have been clipped.
+ *
+ * @return false in case of error.
+ */
+bool LayerTranslator::ClipSrcArrowArray(const TargetLayerInfo *psInfo,
+                                        const struct ArrowSchema *schema,
+                                        struct ArrowArray *array,
+                                        int iArrowGeomFieldIndex,
+                                        int nNumThreads,
+                                        std::vector<GByte> &abyClippedWKB,
+                                        std::vector<uint32_t> &anClippedOffsets)
+{
+    const size_t nLength = static_cast<size_t>(array->length);
+    if (nLength == 0)
+        return true;
+
+    // Geometries of the feature based code path are in the SRS of the
+    // source layer.
+    const auto clipGeomDesc =
+        GetSrcClipGeom(psInfo->m_poSrcLayer->GetLayerDefn()
+                           ->GetGeomFieldDefn(0)
+                           ->GetSpatialRef());
+    const auto eDstGeomType = wkbFlatten(
+        psInfo->m_poDstLayer->GetLayerDefn()->GetGeomFieldDefn(0)->GetType());
+
+    enum class ClipAction
+    {
+        KEEP,
+        DROP,
+        REPLACE
+    };
+
+    std::vector<ClipAction> aeActions(nLength, ClipAction::KEEP);
+    std::vector<std::vector<GByte>> aabyClippedWKB(nLength);
+
+    const auto ProcessRows = [&](size_t iStart, size_t iEnd)
+    {
+        const auto psGeomArray = array->children[iArrowGeomFieldIndex];
+        const GByte *pabyValidity =
+            psGeomArray->null_count == 0
+                ? nullptr
+                : static_cast<const GByte *>(psGeomArray->buffers[0]);
+        const uint32_t *panOffsets =
+            static_cast<const uint32_t *>(psGeomArray->buffers[1]);
+        const GByte *pabyData =
+            static_cast<const GByte *>(psGeomArray->buffers[2]);
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const size_t iShifted =
+                static_cast<size_t>(i + psGeomArray->offset);
+            if (pabyValidity &&
+                (pabyValidity[iShifted >> 3] & (1 << (iShifted % 8))) == 0)
+            {
+                // Null geometries are kept, as in Translate()
+                continue;
+            }
+
+            if (!clipGeomDesc.poGeom || !clipGeomDesc.poEnv)
+            {
+                aeActions[i] = ClipAction::DROP;
+                continue;
+            }
+
+            const GByte *pabyWKB = pabyData + panOffsets[iShifted];
+            const size_t nWKBSize =
+                static_cast<size_t>(panOffsets[iShifted + 1]) -
+                panOffsets[iShifted];
+
+            OGREnvelope sEnvelope;
+            if (OGRWKBGetBoundingBox(pabyWKB, nWKBSize, sEnvelope) &&
+                sEnvelope.IsInit())
+            {
+                if (!clipGeomDesc.poEnv->Intersects(sEnvelope))
+                {
+                    aeActions[i] = ClipAction::DROP;
+                    continue;
+                }
+                if (clipGeomDesc.bGeomIsRectangle &&
+                    clipGeomDesc.poEnv->Contains(sEnvelope))
+                {
+                    continue;
+                }
+            }
+
+            OGRGeometry *poGeomRaw = nullptr;
+            OGRGeometryFactory::createFromWkb(pabyWKB, nullptr, &poGeomRaw,
+                                              nWKBSize, wkbVariantIso);
+            std::unique_ptr<OGRGeometry> poGeom(poGeomRaw);
+            if (!poGeom)
+                continue;
+            if (poGeom->IsEmpty())
+            {
+                aeActions[i] = ClipAction::DROP;
+                continue;
+            }
+
+            std::unique_ptr<OGRGeometry> poClipped;
+            OGREnvelope oGeomEnv;
+            poGeom->getEnvelope(&oGeomEnv);
+            if (clipGeomDesc.poEnv->Intersects(oGeomEnv))
+            {
+                poClipped.reset(
+                    clipGeomDesc.poGeom->Intersection(poGeom.get()));
+            }
+            if (poClipped == nullptr || poClipped->IsEmpty() ||
+                (poClipped->getDimension() < poGeom->getDimension() &&
+                 eDstGeomType != wkbUnknown))
+            {
+                aeActions[i] = ClipAction::DROP;
+                continue;
+            }
+
+            auto &abyWKB = aabyClippedWKB[i];
+            abyWKB.resize(poClipped->WkbSize());
+            poClipped->exportToWkb(wkbNDR, abyWKB.data(), wkbVariantIso);
+            aeActions[i] = ClipAction::REPLACE;
+        }
+    };
+
+    if (nNumThreads >= 2)
+    {
+        std::vector<std::future<void>> oTasks;
+        for (int iThread = 0; iThread < nNumThreads; ++iThread)
+        {
+            oTasks.emplace_back(std::async(
+                std::launch::async, ProcessRows,
+                static_cast<size_t>(iThread * nLength / nNumThreads),
+                static_cast<size_t>((iThread + 1) * nLength / nNumThreads)));
+        }
+        for (auto &oTask : oTasks)
+        {
+            oTask.get();
+        }
+    }
+    else
+    {
+        ProcessRows(0, nLength);
+    }
+
+    // Remove discarded rows from a copy of the array, as the buffers of
+    // the source array must not be modified.
+    std::vector<bool> abyKeep(nLength);
+    bool bHasReplacedGeom = false;
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        abyKeep[i] = aeActions[i] != ClipAction::DROP;
+        bHasReplacedGeom |= aeActions[i] == ClipAction::REPLACE;
+    }
+    if (std::find(abyKeep.begin(), abyKeep.end(), false) != abyKeep.end())
+    {
+        struct ArrowArray sCopy;
+        if (!OGRCloneArrowArray(schema, array, &sCopy))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "OGRCloneArrowArray() failed");
+            return false;
+        }
+        array->release(array);
+        memcpy(array, &sCopy, sizeof(sCopy));
+        if (!OGRCompactArrowArray(schema, array, abyKeep))
+            return false;
+    }
+
+    if (!bHasReplacedGeom)
+        return true;
+
+    // Build new offset and data buffers for the geometry column, with the
+    // clipped geometries.
+    auto psGeomArray = array->children[iArrowGeomFieldIndex];
+    const size_t nGeomOffset = static_cast<size_t>(psGeomArray->offset);
+    const size_t nNewLength = static_cast<size_t>(array->length);
+    const uint32_t *panOffsets =
+        static_cast<const uint32_t *>(psGeomArray->buffers[1]);
+    const GByte *pabyData = static_cast<const GByte *>(psGeomArray->buffers[2]);
+    try
+    {
+        abyClippedWKB.clear();
+        anClippedOffsets.clear();
+        anClippedOffsets.resize(nGeomOffset + nNewLength + 1);
+        size_t iRow = 0;
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            if (!abyKeep[i])
+                continue;
+            anClippedOffsets[nGeomOffset + iRow] =
+                static_cast<uint32_t>(abyClippedWKB.size());
+            if (aeActions[i] == ClipAction::REPLACE)
+            {
+                abyClippedWKB.insert(abyClippedWKB.end(),
+                                     aabyClippedWKB[i].begin(),
+                                     aabyClippedWKB[i].end());
+            }
+            else
+            {
+                const size_t iShifted = nGeomOffset + iRow;
+                abyClippedWKB.insert(abyClippedWKB.end(),
+                                     pabyData + panOffsets[iShifted],
+                                     pabyData + panOffsets[iShifted + 1]);
+            }
+            if (abyClippedWKB.size() > UINT32_MAX)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Too large geometry column after clipping");
+                return false;
+            }
+            ++iRow;
+        }
+        anClippedOffsets[nGeomOffset + iRow] =
+            static_cast<uint32_t>(abyClippedWKB.size());
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+
+    GeomArrayReleaser::init(psGeomArray);
+    psGeomArray->buffers[1] = anClippedOffsets.data();
+    psGeomArray->buffers[2] = abyClippedWKB.data();
+
+    return true;
+}
+
 /************************************************************************/
 /*                     LayerTranslator::Translate()                     */
 /************************************************************************/
@@ -6484,13 +6834,10 @@ bool LayerTranslator::Translate(
                               pfnProgress, pProgressArg, psOptions);
     }
 
-    const int eGType = m_eGType;
     const OGRSpatialReference *poOutputSRS = m_poOutputSRS;
 
     OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
     OGRLayer *poDstLayer = psInfo->m_poDstLayer;
-    const int *const panMap = psInfo->m_anMap.data();
-    const int iSrcZField = psInfo->m_iSrcZField;
     const bool bPreserveFID = psInfo->m_bPreserveFID;
     const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
     const auto poDstFDefn = poDstLayer->GetLayerDefn();
@@ -6534,8 +6881,28 @@ bool LayerTranslator::Translate(
     int nFeaturesInTransaction = 0;
     GIntBig nCount = 0; /* written + failed */
     GIntBig nFeaturesWritten = 0;
-    bool bRunSetPrecisionEvaluated = false;
-    bool bRunSetPrecision = false;
+
+    // OGR_APPLY_GEOM_SET_PRECISION default value for
+    // OGRLayer::CreateFeature() purposes, but here in the
+    // ogr2ogr -xyRes context, we force calling SetPrecision(),
+    // unless the user explicitly asks not to do it by
+    // setting the config option to NO.
+    const bool bRunSetPrecision =
+        psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN &&
+        CPLTestBool(
+            CPLGetConfigOption("OGR_APPLY_GEOM_SET_PRECISION", "YES"));
+
+    // Once the first feature has been translated, the processing of the
+    // following ones may be dispatched to worker threads.
+    int nNumThreads = 1;
+    if (poFeatureIn == nullptr && psOptions->nFIDToFetch == OGRNullFID &&
+        !bExplodeCollections && nDstGeomFieldCount > 0 &&
+        HasGeometryProcessing(psOptions) &&
+        CPLTestBool(
+            CPLGetConfigOption("OGR2OGR_USE_PARALLEL_PIPELINE", "YES")))
+    {
+        nNumThreads = GetNumReprojectionThreads();
+    }
 
     bool bRet = true;
     CPLErrorReset();
@@ -6556,6 +6923,31 @@ bool LayerTranslator::Translate(
             break;
         }
 
+        if (nNumThreads > 1 && psInfo->m_nFeaturesRead > 0)
+        {
+            std::mutex oClipGeomMutex;
+            std::vector<ParallelWorker> aoWorkers;
+            if (!psInfo->m_bPerFeatureCT &&
+                CreateParallelWorkers(psInfo, nNumThreads, oClipGeomMutex,
+                                      aoWorkers))
+            {
+                CPLDebug("GDALVectorTranslate",
+                         "Processing features of layer %s with %d threads",
+                         poSrcLayer->GetName(), nNumThreads);
+                if (!TranslateInParallel(
+                        psInfo, aoWorkers, poDstFDefn, poOutputSRS,
+                        bRunSetPrecision, nCountLayerFeatures,
+                        pnReadFeatureCount, nCount, nFeaturesWritten,
+                        nFeaturesInTransaction, nTotalEventsDone, pfnProgress,
+                        pProgressArg, bRet, psOptions))
+                {
+                    return false;
+                }
+                break;
+            }
+            nNumThreads = 1;
+        }
+
         if (poFeatureIn != nullptr)
             poFeature.reset(poFeatureIn);
         else if (psOptions->nFIDToFetch != OGRNullFID)
@@ -6628,743 +7020,1181 @@ bool LayerTranslator::Translate(
 
         for (int iPart = 0; iPart < nIters; iPart++)
         {
-            if (psOptions->nLayerTransaction &&
-                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
+            if (!UpdateGroupTransaction(poDstLayer, nFeaturesInTransaction,
+                                        nTotalEventsDone, psOptions))
             {
-                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
-                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nFeaturesInTransaction = 0;
-            }
-            else if (!psOptions->nLayerTransaction &&
-                     psOptions->nGroupTransactions > 0 &&
-                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
-            {
-                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
-                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
-                        OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nTotalEventsDone = 0;
+                return false;
             }
 
             CPLErrorReset();
-            if (psInfo->m_bCanAvoidSetFrom)
+            bool bReprojectionFailed = false;
+            const auto eStatus = TranslateFeature(
+                poFeature, poDstFeature, poDstFDefn, psInfo,
+                psInfo->m_aoReprojectionInfo, nSrcFID, nDesiredFID,
+                poCollToExplode.get(), iGeomCollToExplode, poSrcGeometry,
+                poOutputSRS, bRunSetPrecision, bReprojectionFailed, psOptions);
+            if (!WriteFeature(psInfo, eStatus, bReprojectionFailed,
+                              poDstFeature.get(), nSrcFID, nDesiredFID,
+                              nFeaturesWritten, psOptions))
             {
-                poDstFeature = std::move(poFeature);
-                // From now on, poFeature is null !
-                poDstFeature->SetFDefnUnsafe(poDstFDefn);
-                poDstFeature->SetFID(nDesiredFID);
+                return false;
             }
-            else
-            {
-                /* Optimization to avoid duplicating the source geometry in the
-                 */
-                /* target feature : we steal it from the source feature for
-                 * now... */
-                std::unique_ptr<OGRGeometry> poStolenGeometry;
-                if (!bExplodeCollections && nSrcGeomFieldCount == 1 &&
-                    (nDstGeomFieldCount == 1 ||
-                     (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
-                {
-                    poStolenGeometry.reset(poFeature->StealGeometry());
-                }
-                else if (!bExplodeCollections && iRequestedSrcGeomField >= 0)
-                {
-                    poStolenGeometry.reset(
-                        poFeature->StealGeometry(iRequestedSrcGeomField));
-                }
-
-                if (nDstGeomFieldCount == 0 && poStolenGeometry &&
-                    m_poClipSrcOri)
-                {
-                    if (poStolenGeometry->IsEmpty())
-                        goto end_loop;
-
-                    const auto clipGeomDesc =
-                        GetSrcClipGeom(poStolenGeometry->getSpatialReference());
+        }
 
-                    if (clipGeomDesc.poGeom && clipGeomDesc.poEnv)
-                    {
-                        OGREnvelope oEnv;
-                        poStolenGeometry->getEnvelope(&oEnv);
-                        if (!clipGeomDesc.poEnv->Contains(oEnv) &&
-                            !(clipGeomDesc.poEnv->Intersects(oEnv) &&
-                              clipGeomDesc.poGeom->Intersects(
-                                  poStolenGeometry.get())))
-                        {
-                            goto end_loop;
-                        }
-                    }
-                }
+        /* Report progress */
+        nCount++;
+        bool bGoOn = true;
+        if (pfnProgress)
+        {
+            bGoOn = pfnProgress(nCountLayerFeatures
+                                    ? nCount * 1.0 / nCountLayerFeatures
+                                    : 1.0,
+                                "", pProgressArg) != FALSE;
+        }
+        if (!bGoOn)
+        {
+            bRet = false;
+            break;
+        }
 
-                poDstFeature->Reset();
+        if (pnReadFeatureCount)
+            *pnReadFeatureCount = nCount;
 
-                if (poDstFeature->SetFrom(
-                        poFeature.get(), panMap, /* bForgiving = */ TRUE,
-                        /* bUseISO8601ForDateTimeAsString = */ true) !=
-                    OGRERR_NONE)
-                {
-                    if (psOptions->nGroupTransactions)
-                    {
-                        if (psOptions->nLayerTransaction)
-                        {
-                            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
-                            {
-                                return false;
-                            }
-                        }
-                    }
+        if (psOptions->nFIDToFetch != OGRNullFID)
+            break;
+        if (poFeatureIn != nullptr)
+            break;
+    }
 
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Unable to translate feature " CPL_FRMT_GIB
-                             " from layer %s.",
-                             nSrcFID, poSrcLayer->GetName());
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                bRet = false;
+        }
+    }
 
-                    return false;
-                }
+    if (poFeatureIn == nullptr)
+    {
+        CPLDebug("GDALVectorTranslate",
+                 CPL_FRMT_GIB " features written in layer '%s'",
+                 nFeaturesWritten, poDstLayer->GetName());
+    }
 
-                /* ... and now we can attach the stolen geometry */
-                if (poStolenGeometry)
-                {
-                    poDstFeature->SetGeometryDirectly(
-                        poStolenGeometry.release());
-                }
+    return bRet;
+}
 
-                if (!psInfo->m_oMapResolved.empty())
-                {
-                    for (const auto &kv : psInfo->m_oMapResolved)
-                    {
-                        const int nDstField = kv.first;
-                        const int nSrcField = kv.second.nSrcField;
-                        if (poFeature->IsFieldSetAndNotNull(nSrcField))
-                        {
-                            const auto poDomain = kv.second.poDomain;
-                            const auto &oMapKV =
-                                psInfo->m_oMapDomainToKV[poDomain];
-                            const auto iter = oMapKV.find(
-                                poFeature->GetFieldAsString(nSrcField));
-                            if (iter != oMapKV.end())
-                            {
-                                poDstFeature->SetField(nDstField,
-                                                       iter->second.c_str());
-                            }
-                        }
-                    }
-                }
+/************************************************************************/
+/*              LayerTranslator::UpdateGroupTransaction()               */
+/************************************************************************/
 
-                if (nDesiredFID != OGRNullFID)
-                    poDstFeature->SetFID(nDesiredFID);
-            }
+/** Commits the current transaction and starts a new one, if the number of
+ * features of the group of transactions (-gt) is reached.
+ *
+ * @return false if the translation must be stopped.
+ */
+bool LayerTranslator::UpdateGroupTransaction(
+    OGRLayer *poDstLayer, int &nFeaturesInTransaction,
+    GIntBig &nTotalEventsDone, const GDALVectorTranslateOptions *psOptions)
+{
+    if (psOptions->nLayerTransaction &&
+        ++nFeaturesInTransaction == psOptions->nGroupTransactions)
+    {
+        if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+            poDstLayer->StartTransaction() == OGRERR_FAILURE)
+        {
+            return false;
+        }
+        nFeaturesInTransaction = 0;
+    }
+    else if (!psOptions->nLayerTransaction &&
+             psOptions->nGroupTransactions > 0 &&
+             ++nTotalEventsDone >= psOptions->nGroupTransactions)
+    {
+        if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+            m_poODS->StartTransaction(psOptions->bForceTransaction) ==
+                OGRERR_FAILURE)
+        {
+            return false;
+        }
+        nTotalEventsDone = 0;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 LayerTranslator::TranslateFeature()                  */
+/************************************************************************/
 
-            if (psOptions->bEmptyStrAsNull)
+/** Builds poDstFeature from poFeature, by mapping its fields and processing
+ * its geometries.
+ *
+ * poFeature may be moved into poDstFeature, or have its geometries stolen.
+ * poCollToExplode, if not null, is the collection from which a part is taken
+ * for the geometry field iGeomCollToExplode.
+ *
+ * This method may be called from worker threads, with per-thread
+ * aoReprojectionInfo and LayerTranslator instances.
+ *
+ * bReprojectionFailed is set to true if the reprojection of a geometry
+ * failed.
+ */
+LayerTranslator::FeatureTranslationStatus LayerTranslator::TranslateFeature(
+    std::unique_ptr<OGRFeature> &poFeature,
+    std::unique_ptr<OGRFeature> &poDstFeature, OGRFeatureDefn *poDstFDefn,
+    const TargetLayerInfo *psInfo,
+    std::vector<TargetLayerInfo::ReprojectionInfo> &aoReprojectionInfo,
+    GIntBig nSrcFID, GIntBig nDesiredFID,
+    OGRGeometryCollection *poCollToExplode, int iGeomCollToExplode,
+    const OGRGeometry *poSrcGeometry, const OGRSpatialReference *poOutputSRS,
+    bool bRunSetPrecision, bool &bReprojectionFailed,
+    const GDALVectorTranslateOptions *psOptions)
+{
+    const int *const panMap = psInfo->m_anMap.data();
+    const int nSrcGeomFieldCount = poFeature->GetGeomFieldCount();
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
+    const bool bExplodeCollections =
+        m_bExplodeCollections && nDstGeomFieldCount <= 1;
+    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
+
+    if (psInfo->m_bCanAvoidSetFrom)
+    {
+        poDstFeature = std::move(poFeature);
+        // From now on, poFeature is null !
+        poDstFeature->SetFDefnUnsafe(poDstFDefn);
+        poDstFeature->SetFID(nDesiredFID);
+    }
+    else
+    {
+        /* Optimization to avoid duplicating the source geometry in the
+         */
+        /* target feature : we steal it from the source feature for
+         * now... */
+        std::unique_ptr<OGRGeometry> poStolenGeometry;
+        if (!bExplodeCollections && nSrcGeomFieldCount == 1 &&
+            (nDstGeomFieldCount == 1 ||
+             (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
+        {
+            poStolenGeometry.reset(poFeature->StealGeometry());
+        }
+        else if (!bExplodeCollections && iRequestedSrcGeomField >= 0)
+        {
+            poStolenGeometry.reset(
+                poFeature->StealGeometry(iRequestedSrcGeomField));
+        }
+
+        if (nDstGeomFieldCount == 0 && poStolenGeometry && m_poClipSrcOri)
+        {
+            if (poStolenGeometry->IsEmpty())
+                return FeatureTranslationStatus::SKIP_FEATURE;
+
+            const auto clipGeomDesc =
+                GetSrcClipGeom(poStolenGeometry->getSpatialReference());
+
+            if (clipGeomDesc.poGeom && clipGeomDesc.poEnv)
             {
-                for (int i = 0; i < poDstFeature->GetFieldCount(); i++)
+                OGREnvelope oEnv;
+                poStolenGeometry->getEnvelope(&oEnv);
+                if (!clipGeomDesc.poEnv->Contains(oEnv) &&
+                    !(clipGeomDesc.poEnv->Intersects(oEnv) &&
+                      clipGeomDesc.poGeom->Intersects(poStolenGeometry.get())))
                 {
-                    if (!poDstFeature->IsFieldSetAndNotNull(i))
-                        continue;
-                    auto fieldDef = poDstFeature->GetFieldDefnRef(i);
-                    if (fieldDef->GetType() != OGRFieldType::OFTString)
-                        continue;
-                    auto str = poDstFeature->GetFieldAsString(i);
-                    if (strcmp(str, "") == 0)
-                        poDstFeature->SetFieldNull(i);
+                    return FeatureTranslationStatus::SKIP_FEATURE;
                 }
             }
+        }
+
+        poDstFeature->Reset();
+
+        if (poDstFeature->SetFrom(
+                poFeature.get(), panMap, /* bForgiving = */ TRUE,
+                /* bUseISO8601ForDateTimeAsString = */ true) != OGRERR_NONE)
+        {
+            return FeatureTranslationStatus::SET_FROM_FAILED;
+        }
+
+        /* ... and now we can attach the stolen geometry */
+        if (poStolenGeometry)
+        {
+            poDstFeature->SetGeometryDirectly(poStolenGeometry.release());
+        }
 
-            if (!psInfo->m_anDateTimeFieldIdx.empty())
+        if (!psInfo->m_oMapResolved.empty())
+        {
+            for (const auto &kv : psInfo->m_oMapResolved)
             {
-                for (int i : psInfo->m_anDateTimeFieldIdx)
+                const int nDstField = kv.first;
+                const int nSrcField = kv.second.nSrcField;
+                if (poFeature->IsFieldSetAndNotNull(nSrcField))
                 {
-                    if (!poDstFeature->IsFieldSetAndNotNull(i))
-                        continue;
-                    auto psField = poDstFeature->GetRawFieldRef(i);
-                    if (psField->Date.TZFlag == 0 || psField->Date.TZFlag == 1)
+                    const auto poDomain = kv.second.poDomain;
+                    const auto oIterKV =
+                        psInfo->m_oMapDomainToKV.find(poDomain);
+                    if (oIterKV == psInfo->m_oMapDomainToKV.end())
                         continue;
+                    const auto &oMapKV = oIterKV->second;
+                    const auto iter =
+                        oMapKV.find(poFeature->GetFieldAsString(nSrcField));
+                    if (iter != oMapKV.end())
+                    {
+                        poDstFeature->SetField(nDstField, iter->second.c_str());
+                    }
+                }
+            }
+        }
 
-                    const int nTZOffsetInSec =
-                        (psField->Date.TZFlag - 100) * 15 * 60;
-                    if (nTZOffsetInSec == psOptions->nTZOffsetInSec)
-                        continue;
+        if (nDesiredFID != OGRNullFID)
+            poDstFeature->SetFID(nDesiredFID);
+    }
+
+    if (psOptions->bEmptyStrAsNull)
+    {
+        for (int i = 0; i < poDstFeature->GetFieldCount(); i++)
+        {
+            if (!poDstFeature->IsFieldSetAndNotNull(i))
+                continue;
+            auto fieldDef = poDstFeature->GetFieldDefnRef(i);
+            if (fieldDef->GetType() != OGRFieldType::OFTString)
+                continue;
+            auto str = poDstFeature->GetFieldAsString(i);
+            if (strcmp(str, "") == 0)
+                poDstFeature->SetFieldNull(i);
+        }
+    }
+
+    if (!psInfo->m_anDateTimeFieldIdx.empty())
+    {
+        for (int i : psInfo->m_anDateTimeFieldIdx)
+        {
+            if (!poDstFeature->IsFieldSetAndNotNull(i))
+                continue;
+            auto psField = poDstFeature->GetRawFieldRef(i);
+            if (psField->Date.TZFlag == 0 || psField->Date.TZFlag == 1)
+                continue;
+
+            const int nTZOffsetInSec = (psField->Date.TZFlag - 100) * 15 * 60;
+            if (nTZOffsetInSec == psOptions->nTZOffsetInSec)
+                continue;
+
+            struct tm brokendowntime;
+            memset(&brokendowntime, 0, sizeof(brokendowntime));
+            brokendowntime.tm_year = psField->Date.Year - 1900;
+            brokendowntime.tm_mon = psField->Date.Month - 1;
+            brokendowntime.tm_mday = psField->Date.Day;
+            GIntBig nUnixTime = CPLYMDHMSToUnixTime(&brokendowntime);
+            int nSec = psField->Date.Hour * 3600 + psField->Date.Minute * 60 +
+                       static_cast<int>(psField->Date.Second);
+            nSec += psOptions->nTZOffsetInSec - nTZOffsetInSec;
+            nUnixTime += nSec;
+            CPLUnixTimeToYMDHMS(nUnixTime, &brokendowntime);
+
+            psField->Date.Year =
+                static_cast<GInt16>(brokendowntime.tm_year + 1900);
+            psField->Date.Month = static_cast<GByte>(brokendowntime.tm_mon + 1);
+            psField->Date.Day = static_cast<GByte>(brokendowntime.tm_mday);
+            psField->Date.Hour = static_cast<GByte>(brokendowntime.tm_hour);
+            psField->Date.Minute = static_cast<GByte>(brokendowntime.tm_min);
+            psField->Date.Second = static_cast<float>(
+                brokendowntime.tm_sec + fmod(psField->Date.Second, 1));
+            psField->Date.TZFlag = static_cast<GByte>(
+                100 + psOptions->nTZOffsetInSec / (15 * 60));
+        }
+    }
+
+    /* Erase native data if asked explicitly */
+    if (!m_bNativeData)
+    {
+        poDstFeature->SetNativeData(nullptr);
+        poDstFeature->SetNativeMediaType(nullptr);
+    }
 
-                    struct tm brokendowntime;
-                    memset(&brokendowntime, 0, sizeof(brokendowntime));
-                    brokendowntime.tm_year = psField->Date.Year - 1900;
-                    brokendowntime.tm_mon = psField->Date.Month - 1;
-                    brokendowntime.tm_mday = psField->Date.Day;
-                    GIntBig nUnixTime = CPLYMDHMSToUnixTime(&brokendowntime);
-                    int nSec = psField->Date.Hour * 3600 +
-                               psField->Date.Minute * 60 +
-                               static_cast<int>(psField->Date.Second);
-                    nSec += psOptions->nTZOffsetInSec - nTZOffsetInSec;
-                    nUnixTime += nSec;
-                    CPLUnixTimeToYMDHMS(nUnixTime, &brokendowntime);
+    for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+    {
+        std::unique_ptr<OGRGeometry> poDstGeometry;
 
-                    psField->Date.Year =
-                        static_cast<GInt16>(brokendowntime.tm_year + 1900);
-                    psField->Date.Month =
-                        static_cast<GByte>(brokendowntime.tm_mon + 1);
-                    psField->Date.Day =
-                        static_cast<GByte>(brokendowntime.tm_mday);
-                    psField->Date.Hour =
-                        static_cast<GByte>(brokendowntime.tm_hour);
-                    psField->Date.Minute =
-                        static_cast<GByte>(brokendowntime.tm_min);
-                    psField->Date.Second = static_cast<float>(
-                        brokendowntime.tm_sec + fmod(psField->Date.Second, 1));
-                    psField->Date.TZFlag = static_cast<GByte>(
-                        100 + psOptions->nTZOffsetInSec / (15 * 60));
+        if (poCollToExplode && iGeom == iGeomCollToExplode)
+        {
+            if (poSrcGeometry && poCollToExplode->IsEmpty())
+            {
+                const OGRwkbGeometryType eSrcType =
+                    poSrcGeometry->getGeometryType();
+                const OGRwkbGeometryType eSrcFlattenType = wkbFlatten(eSrcType);
+                OGRwkbGeometryType eDstType = eSrcType;
+                switch (eSrcFlattenType)
+                {
+                    case wkbMultiPoint:
+                        eDstType = wkbPoint;
+                        break;
+                    case wkbMultiLineString:
+                        eDstType = wkbLineString;
+                        break;
+                    case wkbMultiPolygon:
+                        eDstType = wkbPolygon;
+                        break;
+                    case wkbMultiCurve:
+                        eDstType = wkbCompoundCurve;
+                        break;
+                    case wkbMultiSurface:
+                        eDstType = wkbCurvePolygon;
+                        break;
+                    default:
+                        break;
                 }
+                eDstType = OGR_GT_SetModifier(eDstType, OGR_GT_HasZ(eSrcType),
+                                              OGR_GT_HasM(eSrcType));
+                poDstGeometry.reset(
+                    OGRGeometryFactory::createGeometry(eDstType));
+            }
+            else
+            {
+                OGRGeometry *poPart = poCollToExplode->getGeometryRef(0);
+                poCollToExplode->removeGeometry(0, FALSE);
+                poDstGeometry.reset(poPart);
+            }
+        }
+        else
+        {
+            poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
+        }
+        if (poDstGeometry == nullptr)
+            continue;
+
+        // poFeature hasn't been moved if iSrcZField != -1
+        // cppcheck-suppress accessMoved
+        if (!TranslateGeometry(poDstGeometry, iGeom, poDstFDefn,
+                               aoReprojectionInfo[iGeom], psInfo,
+                               poFeature.get(), nSrcFID, poOutputSRS,
+                               bRunSetPrecision, bReprojectionFailed,
+                               psOptions))
+        {
+            return FeatureTranslationStatus::SKIP_FEATURE;
+        }
+
+        poDstFeature->SetGeomFieldDirectly(iGeom, poDstGeometry.release());
+    }
+
+    return FeatureTranslationStatus::OK;
+}
+
+/************************************************************************/
+/*                 LayerTranslator::TranslateGeometry()                 */
+/************************************************************************/
+
+/** Applies the geometry operations requested by the user on a geometry
+ * of the target geometry field iGeom.
+ *
+ * @return false if the feature must be skipped.
+ */
+bool LayerTranslator::TranslateGeometry(
+    std::unique_ptr<OGRGeometry> &poDstGeometry, int iGeom,
+    const OGRFeatureDefn *poDstFDefn,
+    TargetLayerInfo::ReprojectionInfo &oReprojectionInfo,
+    const TargetLayerInfo *psInfo, const OGRFeature *poSrcFeature,
+    GIntBig nSrcFID, const OGRSpatialReference *poOutputSRS,
+    bool bRunSetPrecision, bool &bReprojectionFailed,
+    const GDALVectorTranslateOptions *psOptions)
+{
+    const int eGType = m_eGType;
+
+    if (psInfo->m_iSrcZField != -1 && poSrcFeature != nullptr)
+    {
+        SetZ(poDstGeometry.get(),
+             poSrcFeature->GetFieldAsDouble(psInfo->m_iSrcZField));
+        /* This will correct the coordinate dimension to 3 */
+        poDstGeometry.reset(poDstGeometry->clone());
+    }
+
+    if (m_nCoordDim == 2 || m_nCoordDim == 3)
+    {
+        poDstGeometry->setCoordinateDimension(m_nCoordDim);
+    }
+    else if (m_nCoordDim == 4)
+    {
+        poDstGeometry->set3D(TRUE);
+        poDstGeometry->setMeasured(TRUE);
+    }
+    else if (m_nCoordDim == COORD_DIM_XYM)
+    {
+        poDstGeometry->set3D(FALSE);
+        poDstGeometry->setMeasured(TRUE);
+    }
+    else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+    {
+        const OGRwkbGeometryType eDstLayerGeomType =
+            poDstFDefn->GetGeomFieldDefn(iGeom)->GetType();
+        poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
+        poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+    }
+
+    if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+    {
+        if (m_dfGeomOpParam > 0)
+            poDstGeometry->segmentize(m_dfGeomOpParam);
+    }
+    else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+    {
+        if (m_dfGeomOpParam > 0)
+        {
+            auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                poDstGeometry->SimplifyPreserveTopology(m_dfGeomOpParam));
+            if (poNewGeom)
+            {
+                poDstGeometry = std::move(poNewGeom);
             }
+        }
+    }
+
+    if (m_poClipSrcOri)
+    {
+        if (poDstGeometry->IsEmpty())
+            return false;
+
+        const auto clipGeomDesc =
+            GetSrcClipGeom(poDstGeometry->getSpatialReference());
+
+        if (!(clipGeomDesc.poGeom && clipGeomDesc.poEnv))
+            return false;
 
-            /* Erase native data if asked explicitly */
-            if (!m_bNativeData)
+        OGREnvelope oDstEnv;
+        poDstGeometry->getEnvelope(&oDstEnv);
+
+        if (!(clipGeomDesc.bGeomIsRectangle &&
+              clipGeomDesc.poEnv->Contains(oDstEnv)))
+        {
+            std::unique_ptr<OGRGeometry> poClipped;
+            if (clipGeomDesc.poEnv->Intersects(oDstEnv))
+            {
+                poClipped.reset(
+                    clipGeomDesc.poGeom->Intersection(poDstGeometry.get()));
+            }
+            if (poClipped == nullptr || poClipped->IsEmpty())
             {
-                poDstFeature->SetNativeData(nullptr);
-                poDstFeature->SetNativeMediaType(nullptr);
+                return false;
             }
 
-            for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+            const int nDim = poDstGeometry->getDimension();
+            if (poClipped->getDimension() < nDim &&
+                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                    wkbUnknown)
             {
-                std::unique_ptr<OGRGeometry> poDstGeometry;
+                CPLDebug("OGR2OGR",
+                         "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                         "as its intersection with -clipsrc is a %s "
+                         "whereas the input is a %s",
+                         nSrcFID, psInfo->m_poSrcLayer->GetName(),
+                         OGRToOGCGeomType(poClipped->getGeometryType()),
+                         OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                return false;
+            }
 
-                if (poCollToExplode && iGeom == iGeomCollToExplode)
-                {
-                    if (poSrcGeometry && poCollToExplode->IsEmpty())
-                    {
-                        const OGRwkbGeometryType eSrcType =
-                            poSrcGeometry->getGeometryType();
-                        const OGRwkbGeometryType eSrcFlattenType =
-                            wkbFlatten(eSrcType);
-                        OGRwkbGeometryType eDstType = eSrcType;
-                        switch (eSrcFlattenType)
-                        {
-                            case wkbMultiPoint:
-                                eDstType = wkbPoint;
-                                break;
-                            case wkbMultiLineString:
-                                eDstType = wkbLineString;
-                                break;
-                            case wkbMultiPolygon:
-                                eDstType = wkbPolygon;
-                                break;
-                            case wkbMultiCurve:
-                                eDstType = wkbCompoundCurve;
-                                break;
-                            case wkbMultiSurface:
-                                eDstType = wkbCurvePolygon;
-                                break;
-                            default:
-                                break;
-                        }
-                        eDstType =
-                            OGR_GT_SetModifier(eDstType, OGR_GT_HasZ(eSrcType),
-                                               OGR_GT_HasM(eSrcType));
-                        poDstGeometry.reset(
-                            OGRGeometryFactory::createGeometry(eDstType));
-                    }
-                    else
-                    {
-                        OGRGeometry *poPart =
-                            poCollToExplode->getGeometryRef(0);
-                        poCollToExplode->removeGeometry(0, FALSE);
-                        poDstGeometry.reset(poPart);
-                    }
-                }
-                else
+            poDstGeometry = std::move(poClipped);
+        }
+    }
+
+    OGRCoordinateTransformation *const poCT = oReprojectionInfo.m_poCT.get();
+    char **const papszTransformOptions =
+        oReprojectionInfo.m_aosTransformOptions.List();
+    const bool bReprojCanInvalidateValidity =
+        oReprojectionInfo.m_bCanInvalidateValidity;
+
+    if (poCT != nullptr || papszTransformOptions != nullptr)
+    {
+        // If we need to change the geometry type to linear, and
+        // we have a geometry with curves, then convert it to
+        // linear first, to avoid invalidities due to the fact
+        // that validity of arc portions isn't always kept while
+        // reprojecting and then discretizing.
+        if (bReprojCanInvalidateValidity &&
+            (!psInfo->m_bSupportCurves ||
+             m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+             m_eGeomTypeConversion ==
+                 GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
+        {
+            if (poDstGeometry->hasCurveGeometry(TRUE))
+            {
+                OGRwkbGeometryType eTargetType =
+                    OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(), eTargetType));
+            }
+        }
+        else if (bReprojCanInvalidateValidity &&
+                 eGType != GEOMTYPE_UNCHANGED &&
+                 !OGR_GT_IsNonLinear(static_cast<OGRwkbGeometryType>(eGType)) &&
+                 poDstGeometry->hasCurveGeometry(TRUE))
+        {
+            poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                poDstGeometry.release(),
+                static_cast<OGRwkbGeometryType>(eGType)));
+        }
+
+        // Collect left-most, right-most, top-most, bottom-most coordinates.
+        if (oReprojectionInfo.m_bWarnAboutDifferentCoordinateOperations)
+        {
+            struct Visitor : public OGRDefaultConstGeometryVisitor
+            {
+                TargetLayerInfo::ReprojectionInfo &m_info;
+
+                explicit Visitor(TargetLayerInfo::ReprojectionInfo &info)
+                    : m_info(info)
                 {
-                    poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
                 }
-                if (poDstGeometry == nullptr)
-                    continue;
 
-                // poFeature hasn't been moved if iSrcZField != -1
-                // cppcheck-suppress accessMoved
-                if (iSrcZField != -1 && poFeature != nullptr)
+                using OGRDefaultConstGeometryVisitor::visit;
+
+                void visit(const OGRPoint *point) override
                 {
-                    SetZ(poDstGeometry.get(),
-                         poFeature->GetFieldAsDouble(iSrcZField));
-                    /* This will correct the coordinate dimension to 3 */
-                    poDstGeometry.reset(poDstGeometry->clone());
+                    m_info.UpdateExtremePoints(point->getX(), point->getY(),
+                                               point->getZ());
                 }
+            };
 
-                if (m_nCoordDim == 2 || m_nCoordDim == 3)
+            Visitor oVisit(oReprojectionInfo);
+            poDstGeometry->accept(&oVisit);
+        }
+
+        for (int iIter = 0; iIter < 2; ++iIter)
+        {
+            auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
+                OGRGeometryFactory::transformWithOptions(
+                    poDstGeometry.get(), poCT, papszTransformOptions,
+                    m_transformWithOptionsCache));
+            if (poReprojectedGeom == nullptr)
+            {
+                // Reported by WriteFeature()
+                bReprojectionFailed = true;
+                if (!psOptions->bSkipFailures)
                 {
-                    poDstGeometry->setCoordinateDimension(m_nCoordDim);
+                    return false;
                 }
-                else if (m_nCoordDim == 4)
+            }
+
+            // Check if a curve geometry is no longer valid after
+            // reprojection
+            const auto eType = poDstGeometry->getGeometryType();
+            const auto eFlatType = wkbFlatten(eType);
+
+            const auto IsValid = [](const OGRGeometry *poGeom)
+            {
+                CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+                return poGeom->IsValid();
+            };
+
+            if (iIter == 0 && bReprojCanInvalidateValidity &&
+                OGRGeometryFactory::haveGEOS() &&
+                (eFlatType == wkbCurvePolygon ||
+                 eFlatType == wkbCompoundCurve || eFlatType == wkbMultiCurve ||
+                 eFlatType == wkbMultiSurface) &&
+                poDstGeometry->hasCurveGeometry(TRUE) &&
+                IsValid(poDstGeometry.get()))
+            {
+                OGRwkbGeometryType eTargetType =
+                    OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                auto poDstGeometryTmp =
+                    std::unique_ptr<OGRGeometry>(OGRGeometryFactory::forceTo(
+                        poReprojectedGeom->clone(), eTargetType));
+                if (!IsValid(poDstGeometryTmp.get()))
                 {
-                    poDstGeometry->set3D(TRUE);
-                    poDstGeometry->setMeasured(TRUE);
+                    CPLDebug("OGR2OGR",
+                             "Curve geometry no longer valid after "
+                             "reprojection: transforming it into "
+                             "linear one before reprojecting");
+                    poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                        poDstGeometry.release(), eTargetType));
+                    poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                        poDstGeometry.release(), eType));
                 }
-                else if (m_nCoordDim == COORD_DIM_XYM)
+                else
                 {
-                    poDstGeometry->set3D(FALSE);
-                    poDstGeometry->setMeasured(TRUE);
+                    poDstGeometry = std::move(poReprojectedGeom);
+                    break;
                 }
-                else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+            }
+            else
+            {
+                poDstGeometry = std::move(poReprojectedGeom);
+                break;
+            }
+        }
+    }
+    else if (poOutputSRS != nullptr)
+    {
+        poDstGeometry->assignSpatialReference(poOutputSRS);
+    }
+
+    if (poDstGeometry != nullptr)
+    {
+        if (m_poClipDstOri)
+        {
+            if (poDstGeometry->IsEmpty())
+                return false;
+
+            const auto clipGeomDesc =
+                GetDstClipGeom(poDstGeometry->getSpatialReference());
+            if (!clipGeomDesc.poGeom || !clipGeomDesc.poEnv)
+            {
+                return false;
+            }
+
+            OGREnvelope oDstEnv;
+            poDstGeometry->getEnvelope(&oDstEnv);
+
+            if (!(clipGeomDesc.bGeomIsRectangle &&
+                  clipGeomDesc.poEnv->Contains(oDstEnv)))
+            {
+                std::unique_ptr<OGRGeometry> poClipped;
+                if (clipGeomDesc.poEnv->Intersects(oDstEnv))
                 {
-                    const OGRwkbGeometryType eDstLayerGeomType =
-                        poDstLayer->GetLayerDefn()
-                            ->GetGeomFieldDefn(iGeom)
-                            ->GetType();
-                    poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
-                    poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+                    poClipped.reset(
+                        clipGeomDesc.poGeom->Intersection(poDstGeometry.get()));
                 }
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+                if (poClipped == nullptr || poClipped->IsEmpty())
                 {
-                    if (m_dfGeomOpParam > 0)
-                        poDstGeometry->segmentize(m_dfGeomOpParam);
+                    return false;
                 }
-                else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
-                {
-                    if (m_dfGeomOpParam > 0)
-                    {
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->SimplifyPreserveTopology(
-                                m_dfGeomOpParam));
-                        if (poNewGeom)
-                        {
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
+
+                const int nDim = poDstGeometry->getDimension();
+                if (poClipped->getDimension() < nDim &&
+                    wkbFlatten(
+                        poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                        wkbUnknown)
+                {
+                    CPLDebug(
+                        "OGR2OGR",
+                        "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                        "as its intersection with -clipdst is a %s "
+                        "whereas the input is a %s",
+                        nSrcFID, psInfo->m_poSrcLayer->GetName(),
+                        OGRToOGCGeomType(poClipped->getGeometryType()),
+                        OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                    return false;
                 }
 
-                if (m_poClipSrcOri)
-                {
-                    if (poDstGeometry->IsEmpty())
-                        goto end_loop;
+                poDstGeometry = std::move(poClipped);
+            }
+        }
 
-                    const auto clipGeomDesc =
-                        GetSrcClipGeom(poDstGeometry->getSpatialReference());
+        if (psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN &&
+            OGRGeometryFactory::haveGEOS() &&
+            !poDstGeometry->hasCurveGeometry() && bRunSetPrecision)
+        {
+            auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                poDstGeometry->SetPrecision(psOptions->dfXYRes,
+                                            /* nFlags = */ 0));
+            if (!poNewGeom)
+                return false;
+            poDstGeometry = std::move(poNewGeom);
+        }
 
-                    if (!(clipGeomDesc.poGeom && clipGeomDesc.poEnv))
-                        goto end_loop;
+        if (m_bMakeValid)
+        {
+            const bool bIsGeomCollection =
+                wkbFlatten(poDstGeometry->getGeometryType()) ==
+                wkbGeometryCollection;
+            auto poNewGeom =
+                std::unique_ptr<OGRGeometry>(poDstGeometry->MakeValid());
+            if (!poNewGeom)
+                return false;
+            poDstGeometry = std::move(poNewGeom);
+            if (!bIsGeomCollection)
+            {
+                poDstGeometry.reset(
+                    OGRGeometryFactory::removeLowerDimensionSubGeoms(
+                        poDstGeometry.get()));
+            }
+        }
 
-                    OGREnvelope oDstEnv;
-                    poDstGeometry->getEnvelope(&oDstEnv);
+        if (m_bSkipInvalidGeom && !poDstGeometry->IsValid())
+            return false;
 
-                    if (!(clipGeomDesc.bGeomIsRectangle &&
-                          clipGeomDesc.poEnv->Contains(oDstEnv)))
-                    {
-                        std::unique_ptr<OGRGeometry> poClipped;
-                        if (clipGeomDesc.poEnv->Intersects(oDstEnv))
-                        {
-                            poClipped.reset(clipGeomDesc.poGeom->Intersection(
-                                poDstGeometry.get()));
-                        }
-                        if (poClipped == nullptr || poClipped->IsEmpty())
-                        {
-                            goto end_loop;
-                        }
+        if (m_eGeomTypeConversion != GTC_DEFAULT)
+        {
+            OGRwkbGeometryType eTargetType = poDstGeometry->getGeometryType();
+            eTargetType = ConvertType(m_eGeomTypeConversion, eTargetType);
+            poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                poDstGeometry.release(), eTargetType));
+        }
+        else if (eGType != GEOMTYPE_UNCHANGED)
+        {
+            poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                poDstGeometry.release(),
+                static_cast<OGRwkbGeometryType>(eGType)));
+        }
+    }
 
-                        const int nDim = poDstGeometry->getDimension();
-                        if (poClipped->getDimension() < nDim &&
-                            wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                           ->GetType()) != wkbUnknown)
-                        {
-                            CPLDebug(
-                                "OGR2OGR",
-                                "Discarding feature " CPL_FRMT_GIB
-                                " of layer %s, "
-                                "as its intersection with -clipsrc is a %s "
-                                "whereas the input is a %s",
-                                nSrcFID, poSrcLayer->GetName(),
-                                OGRToOGCGeomType(poClipped->getGeometryType()),
-                                OGRToOGCGeomType(
-                                    poDstGeometry->getGeometryType()));
-                            goto end_loop;
-                        }
+    return true;
+}
 
-                        poDstGeometry = std::move(poClipped);
-                    }
-                }
+/************************************************************************/
+/*                   LayerTranslator::WriteFeature()                    */
+/************************************************************************/
 
-                OGRCoordinateTransformation *const poCT =
-                    psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
-                char **const papszTransformOptions =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_aosTransformOptions.List();
-                const bool bReprojCanInvalidateValidity =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_bCanInvalidateValidity;
-
-                if (poCT != nullptr || papszTransformOptions != nullptr)
-                {
-                    // If we need to change the geometry type to linear, and
-                    // we have a geometry with curves, then convert it to
-                    // linear first, to avoid invalidities due to the fact
-                    // that validity of arc portions isn't always kept while
-                    // reprojecting and then discretizing.
-                    if (bReprojCanInvalidateValidity &&
-                        (!psInfo->m_bSupportCurves ||
-                         m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                         m_eGeomTypeConversion ==
-                             GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
-                    {
-                        if (poDstGeometry->hasCurveGeometry(TRUE))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                poDstGeometry.release(), eTargetType));
-                        }
-                    }
-                    else if (bReprojCanInvalidateValidity &&
-                             eGType != GEOMTYPE_UNCHANGED &&
-                             !OGR_GT_IsNonLinear(
-                                 static_cast<OGRwkbGeometryType>(eGType)) &&
-                             poDstGeometry->hasCurveGeometry(TRUE))
-                    {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
-                    }
+/** Reports the errors of TranslateFeature(), and writes poDstFeature into
+ * the target layer if it has been successfully translated.
+ *
+ * @return false if the translation must be stopped.
+ */
+bool LayerTranslator::WriteFeature(TargetLayerInfo *psInfo,
+                                   FeatureTranslationStatus eStatus,
+                                   bool bReprojectionFailed,
+                                   OGRFeature *poDstFeature, GIntBig nSrcFID,
+                                   GIntBig nDesiredFID,
+                                   GIntBig &nFeaturesWritten,
+                                   const GDALVectorTranslateOptions *psOptions)
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
 
-                    // Collect left-most, right-most, top-most, bottom-most coordinates.
-                    if (psInfo->m_aoReprojectionInfo[iGeom]
-                            .m_bWarnAboutDifferentCoordinateOperations)
-                    {
-                        struct Visitor : public OGRDefaultConstGeometryVisitor
-                        {
-                            TargetLayerInfo::ReprojectionInfo &m_info;
+    if (bReprojectionFailed)
+    {
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+            {
+                if (poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                    !psOptions->bSkipFailures)
+                {
+                    return false;
+                }
+            }
+        }
 
-                            explicit Visitor(
-                                TargetLayerInfo::ReprojectionInfo &info)
-                                : m_info(info)
-                            {
-                            }
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Failed to reproject feature " CPL_FRMT_GIB
+                 " (geometry probably out of source or "
+                 "destination SRS).",
+                 nSrcFID);
+        if (!psOptions->bSkipFailures)
+        {
+            return false;
+        }
+    }
 
-                            using OGRDefaultConstGeometryVisitor::visit;
+    if (eStatus == FeatureTranslationStatus::SET_FROM_FAILED)
+    {
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+            {
+                if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                {
+                    return false;
+                }
+            }
+        }
 
-                            void visit(const OGRPoint *point) override
-                            {
-                                m_info.UpdateExtremePoints(point->getX(),
-                                                           point->getY(),
-                                                           point->getZ());
-                            }
-                        };
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unable to translate feature " CPL_FRMT_GIB
+                 " from layer %s.",
+                 nSrcFID, poSrcLayer->GetName());
 
-                        Visitor oVisit(psInfo->m_aoReprojectionInfo[iGeom]);
-                        poDstGeometry->accept(&oVisit);
-                    }
+        return false;
+    }
 
-                    for (int iIter = 0; iIter < 2; ++iIter)
-                    {
-                        auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
-                            OGRGeometryFactory::transformWithOptions(
-                                poDstGeometry.get(), poCT,
-                                papszTransformOptions,
-                                m_transformWithOptionsCache));
-                        if (poReprojectedGeom == nullptr)
-                        {
-                            if (psOptions->nGroupTransactions)
-                            {
-                                if (psOptions->nLayerTransaction)
-                                {
-                                    if (poDstLayer->CommitTransaction() !=
-                                            OGRERR_NONE &&
-                                        !psOptions->bSkipFailures)
-                                    {
-                                        return false;
-                                    }
-                                }
-                            }
+    if (eStatus == FeatureTranslationStatus::SKIP_FEATURE)
+        return true;
 
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Failed to reproject feature " CPL_FRMT_GIB
-                                     " (geometry probably out of source or "
-                                     "destination SRS).",
-                                     nSrcFID);
-                            if (!psOptions->bSkipFailures)
-                            {
-                                return false;
-                            }
-                        }
+    CPLErrorReset();
+    if ((psOptions->bUpsert ? poDstLayer->UpsertFeature(poDstFeature)
+                            : poDstLayer->CreateFeature(poDstFeature)) ==
+        OGRERR_NONE)
+    {
+        nFeaturesWritten++;
+        if (nDesiredFID != OGRNullFID && poDstFeature->GetFID() != nDesiredFID)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Feature id " CPL_FRMT_GIB " not preserved", nDesiredFID);
+        }
+    }
+    else if (!psOptions->bSkipFailures)
+    {
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+                poDstLayer->RollbackTransaction();
+        }
 
-                        // Check if a curve geometry is no longer valid after
-                        // reprojection
-                        const auto eType = poDstGeometry->getGeometryType();
-                        const auto eFlatType = wkbFlatten(eType);
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unable to write feature " CPL_FRMT_GIB " from layer %s.",
+                 nSrcFID, poSrcLayer->GetName());
 
-                        const auto IsValid = [](const OGRGeometry *poGeom)
-                        {
-                            CPLErrorHandlerPusher oErrorHandler(
-                                CPLQuietErrorHandler);
-                            return poGeom->IsValid();
-                        };
-
-                        if (iIter == 0 && bReprojCanInvalidateValidity &&
-                            OGRGeometryFactory::haveGEOS() &&
-                            (eFlatType == wkbCurvePolygon ||
-                             eFlatType == wkbCompoundCurve ||
-                             eFlatType == wkbMultiCurve ||
-                             eFlatType == wkbMultiSurface) &&
-                            poDstGeometry->hasCurveGeometry(TRUE) &&
-                            IsValid(poDstGeometry.get()))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            auto poDstGeometryTmp =
-                                std::unique_ptr<OGRGeometry>(
-                                    OGRGeometryFactory::forceTo(
-                                        poReprojectedGeom->clone(),
-                                        eTargetType));
-                            if (!IsValid(poDstGeometryTmp.get()))
-                            {
-                                CPLDebug("OGR2OGR",
-                                         "Curve geometry no longer valid after "
-                                         "reprojection: transforming it into "
-                                         "linear one before reprojecting");
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eTargetType));
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eType));
-                            }
-                            else
-                            {
-                                poDstGeometry = std::move(poReprojectedGeom);
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            poDstGeometry = std::move(poReprojectedGeom);
-                            break;
-                        }
-                    }
-                }
-                else if (poOutputSRS != nullptr)
-                {
-                    poDstGeometry->assignSpatialReference(poOutputSRS);
-                }
+        return false;
+    }
+    else
+    {
+        CPLDebug("GDALVectorTranslate",
+                 "Unable to write feature " CPL_FRMT_GIB " into layer %s.",
+                 nSrcFID, poSrcLayer->GetName());
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+            {
+                poDstLayer->RollbackTransaction();
+                CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
+            }
+            else
+            {
+                m_poODS->RollbackTransaction();
+                m_poODS->StartTransaction(psOptions->bForceTransaction);
+            }
+        }
+    }
 
-                if (poDstGeometry != nullptr)
-                {
-                    if (m_poClipDstOri)
-                    {
-                        if (poDstGeometry->IsEmpty())
-                            goto end_loop;
+    return true;
+}
 
-                        const auto clipGeomDesc = GetDstClipGeom(
-                            poDstGeometry->getSpatialReference());
-                        if (!clipGeomDesc.poGeom || !clipGeomDesc.poEnv)
-                        {
-                            goto end_loop;
-                        }
+/************************************************************************/
+/*               LayerTranslator::HasGeometryProcessing()               */
+/************************************************************************/
 
-                        OGREnvelope oDstEnv;
-                        poDstGeometry->getEnvelope(&oDstEnv);
+/** Returns whether geometries go through operations costly enough to be
+ * worth being done by worker threads.
+ */
+bool LayerTranslator::HasGeometryProcessing(
+    const GDALVectorTranslateOptions *psOptions) const
+{
+    return m_bTransform || m_bWrapDateline || m_poGCPCoordTrans ||
+           m_poClipSrcOri || m_poClipDstOri || m_bMakeValid ||
+           m_bSkipInvalidGeom || m_eGeomOp != GEOMOP_NONE ||
+           psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN;
+}
 
-                        if (!(clipGeomDesc.bGeomIsRectangle &&
-                              clipGeomDesc.poEnv->Contains(oDstEnv)))
-                        {
-                            std::unique_ptr<OGRGeometry> poClipped;
-                            if (clipGeomDesc.poEnv->Intersects(oDstEnv))
-                            {
-                                poClipped.reset(
-                                    clipGeomDesc.poGeom->Intersection(
-                                        poDstGeometry.get()));
-                            }
+/************************************************************************/
+/*               LayerTranslator::CreateParallelWorkers()               */
+/************************************************************************/
 
-                            if (poClipped == nullptr || poClipped->IsEmpty())
-                            {
-                                goto end_loop;
-                            }
+/** Creates the per-thread state used by TranslateInParallel(): a copy of
+ * the settings of this translator, and clones of the coordinate
+ * transformations.
+ *
+ * @return false if a coordinate transformation cannot be cloned.
+ */
+bool LayerTranslator::CreateParallelWorkers(
+    const TargetLayerInfo *psInfo, int nNumThreads, std::mutex &oClipGeomMutex,
+    std::vector<ParallelWorker> &aoWorkers)
+{
+    if (!GDALGetGlobalThreadPool(nNumThreads))
+        return false;
 
-                            const int nDim = poDstGeometry->getDimension();
-                            if (poClipped->getDimension() < nDim &&
-                                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                               ->GetType()) != wkbUnknown)
-                            {
-                                CPLDebug(
-                                    "OGR2OGR",
-                                    "Discarding feature " CPL_FRMT_GIB
-                                    " of layer %s, "
-                                    "as its intersection with -clipdst is a %s "
-                                    "whereas the input is a %s",
-                                    nSrcFID, poSrcLayer->GetName(),
-                                    OGRToOGCGeomType(
-                                        poClipped->getGeometryType()),
-                                    OGRToOGCGeomType(
-                                        poDstGeometry->getGeometryType()));
-                                goto end_loop;
-                            }
+    aoWorkers.resize(nNumThreads);
+    for (auto &oWorker : aoWorkers)
+    {
+        auto poTranslator = std::make_unique<LayerTranslator>();
+        poTranslator->m_poSrcDS = m_poSrcDS;
+        poTranslator->m_poODS = m_poODS;
+        poTranslator->m_eGType = m_eGType;
+        poTranslator->m_eGeomTypeConversion = m_eGeomTypeConversion;
+        poTranslator->m_bMakeValid = m_bMakeValid;
+        poTranslator->m_bSkipInvalidGeom = m_bSkipInvalidGeom;
+        poTranslator->m_nCoordDim = m_nCoordDim;
+        poTranslator->m_eGeomOp = m_eGeomOp;
+        poTranslator->m_dfGeomOpParam = m_dfGeomOpParam;
+        poTranslator->m_bExplodeCollections = m_bExplodeCollections;
+        poTranslator->m_bNativeData = m_bNativeData;
+        poTranslator->m_poClipGeomMutex = &oClipGeomMutex;
+
+        // Start from the clip geometries already computed for the first
+        // feature, so that worker threads do not need to reproject them.
+        poTranslator->m_poClipSrcOri = m_poClipSrcOri;
+        poTranslator->m_bWarnedClipSrcSRS = m_bWarnedClipSrcSRS;
+        if (m_poClipSrcReprojectedToSrcSRS)
+            poTranslator->m_poClipSrcReprojectedToSrcSRS.reset(
+                m_poClipSrcReprojectedToSrcSRS->clone());
+        poTranslator->m_poClipSrcReprojectedToSrcSRS_SRS =
+            m_poClipSrcReprojectedToSrcSRS_SRS;
+        poTranslator->m_oClipSrcEnv = m_oClipSrcEnv;
+        poTranslator->m_bClipSrcIsRectangle = m_bClipSrcIsRectangle;
+
+        poTranslator->m_poClipDstOri = m_poClipDstOri;
+        poTranslator->m_bWarnedClipDstSRS = m_bWarnedClipDstSRS;
+        if (m_poClipDstReprojectedToDstSRS)
+            poTranslator->m_poClipDstReprojectedToDstSRS.reset(
+                m_poClipDstReprojectedToDstSRS->clone());
+        poTranslator->m_poClipDstReprojectedToDstSRS_SRS =
+            m_poClipDstReprojectedToDstSRS_SRS;
+        poTranslator->m_oClipDstEnv = m_oClipDstEnv;
+        poTranslator->m_bClipDstIsRectangle = m_bClipDstIsRectangle;
+
+        oWorker.poTranslator = std::move(poTranslator);
+
+        for (const auto &oInfo : psInfo->m_aoReprojectionInfo)
+        {
+            oWorker.aoReprojectionInfo.emplace_back();
+            auto &oWorkerInfo = oWorker.aoReprojectionInfo.back();
+            if (oInfo.m_poCT)
+            {
+                oWorkerInfo.m_poCT.reset(oInfo.m_poCT->Clone());
+                if (!oWorkerInfo.m_poCT)
+                {
+                    CPLDebug("GDALVectorTranslate",
+                             "Cannot clone coordinate transformation. "
+                             "Translating features in a single thread");
+                    aoWorkers.clear();
+                    return false;
+                }
+            }
+            oWorkerInfo.m_aosTransformOptions = oInfo.m_aosTransformOptions;
+            oWorkerInfo.m_bCanInvalidateValidity =
+                oInfo.m_bCanInvalidateValidity;
+            oWorkerInfo.m_bWarnAboutDifferentCoordinateOperations =
+                oInfo.m_bWarnAboutDifferentCoordinateOperations;
+        }
+    }
+    return true;
+}
 
-                            poDstGeometry = std::move(poClipped);
-                        }
-                    }
+/************************************************************************/
+/*                LayerTranslator::TranslateInParallel()                */
+/************************************************************************/
 
-                    if (psOptions->dfXYRes !=
-                            OGRGeomCoordinatePrecision::UNKNOWN &&
-                        OGRGeometryFactory::haveGEOS() &&
-                        !poDstGeometry->hasCurveGeometry())
-                    {
-                        // OGR_APPLY_GEOM_SET_PRECISION default value for
-                        // OGRLayer::CreateFeature() purposes, but here in the
-                        // ogr2ogr -xyRes context, we force calling SetPrecision(),
-                        // unless the user explicitly asks not to do it by
-                        // setting the config option to NO.
-                        if (!bRunSetPrecisionEvaluated)
-                        {
-                            bRunSetPrecisionEvaluated = true;
-                            bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
-                                "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
-                        }
-                        if (bRunSetPrecision)
-                        {
-                            auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                                poDstGeometry->SetPrecision(psOptions->dfXYRes,
-                                                            /* nFlags = */ 0));
-                            if (!poNewGeom)
-                                goto end_loop;
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
+/** Translates the remaining features of the source layer with a pipeline
+ * where the current thread reads source features and writes target
+ * features, while worker threads map fields and process geometries of
+ * batches of features. Features are written in the order they are read.
+ *
+ * @return false if the translation must be stopped immediately. bRet is
+ * set to false if reading the source layer failed or if the progress
+ * function requested to stop.
+ */
+bool LayerTranslator::TranslateInParallel(
+    TargetLayerInfo *psInfo, std::vector<ParallelWorker> &aoWorkers,
+    OGRFeatureDefn *poDstFDefn, const OGRSpatialReference *poOutputSRS,
+    bool bRunSetPrecision, GIntBig nCountLayerFeatures,
+    GIntBig *pnReadFeatureCount, GIntBig &nCount, GIntBig &nFeaturesWritten,
+    int &nFeaturesInTransaction, GIntBig &nTotalEventsDone,
+    GDALProgressFunc pfnProgress, void *pProgressArg, bool &bRet,
+    const GDALVectorTranslateOptions *psOptions)
+{
+    auto poThreadPool =
+        GDALGetGlobalThreadPool(static_cast<int>(aoWorkers.size()));
+    if (!poThreadPool)
+        return false;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
 
-                    if (m_bMakeValid)
-                    {
-                        const bool bIsGeomCollection =
-                            wkbFlatten(poDstGeometry->getGeometryType()) ==
-                            wkbGeometryCollection;
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->MakeValid());
-                        if (!poNewGeom)
-                            goto end_loop;
-                        poDstGeometry = std::move(poNewGeom);
-                        if (!bIsGeomCollection)
-                        {
-                            poDstGeometry.reset(
-                                OGRGeometryFactory::
-                                    removeLowerDimensionSubGeoms(
-                                        poDstGeometry.get()));
-                        }
-                    }
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
 
-                    if (m_bSkipInvalidGeom && !poDstGeometry->IsValid())
-                        goto end_loop;
+    struct PendingFeature
+    {
+        std::unique_ptr<OGRFeature> poFeature{};
+        std::unique_ptr<OGRFeature> poDstFeature{};
+        GIntBig nSrcFID = OGRNullFID;
+        GIntBig nDesiredFID = OGRNullFID;
+        FeatureTranslationStatus eStatus = FeatureTranslationStatus::OK;
+        bool bReprojectionFailed = false;
+        int iWorker = 0;
+    };
 
-                    if (m_eGeomTypeConversion != GTC_DEFAULT)
-                    {
-                        OGRwkbGeometryType eTargetType =
-                            poDstGeometry->getGeometryType();
-                        eTargetType =
-                            ConvertType(m_eGeomTypeConversion, eTargetType);
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(), eTargetType));
-                    }
-                    else if (eGType != GEOMTYPE_UNCHANGED)
-                    {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
-                    }
-                }
+    struct Batch
+    {
+        std::vector<PendingFeature> aoFeatures{};
+        std::atomic<size_t> nNextFeature{0};
+        CPLErrorAccumulator oErrorAccumulator{};
+    };
 
-                poDstFeature->SetGeomFieldDirectly(iGeom,
-                                                   poDstGeometry.release());
+    // Number of features read ahead of the ones being processed by worker
+    // threads.
+    const size_t nBatchSize = 256 * aoWorkers.size();
+    bool bEOF = false;
+    bool bReadError = false;
+
+    const auto ReadBatch = [&]()
+    {
+        std::unique_ptr<Batch> poBatch;
+        while (!bEOF)
+        {
+            if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+            {
+                bEOF = true;
+                break;
             }
 
             CPLErrorReset();
-            if ((psOptions->bUpsert
-                     ? poDstLayer->UpsertFeature(poDstFeature.get())
-                     : poDstLayer->CreateFeature(poDstFeature.get())) ==
-                OGRERR_NONE)
+            std::unique_ptr<OGRFeature> poFeature(poSrcLayer->GetNextFeature());
+            if (poFeature == nullptr)
             {
-                nFeaturesWritten++;
-                if (nDesiredFID != OGRNullFID &&
-                    poDstFeature->GetFID() != nDesiredFID)
-                {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Feature id " CPL_FRMT_GIB " not preserved",
-                             nDesiredFID);
-                }
+                bReadError = CPLGetLastErrorType() == CE_Failure;
+                bEOF = true;
+                break;
             }
-            else if (!psOptions->bSkipFailures)
+            psInfo->m_nFeaturesRead++;
+
+            PendingFeature oPending;
+            oPending.nSrcFID = poFeature->GetFID();
+            if (psInfo->m_bPreserveFID)
+                oPending.nDesiredFID = oPending.nSrcFID;
+            else if (psInfo->m_iSrcFIDField >= 0 &&
+                     poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
+                oPending.nDesiredFID =
+                    poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
+            oPending.poFeature = std::move(poFeature);
+
+            if (!poBatch)
             {
-                if (psOptions->nGroupTransactions)
-                {
-                    if (psOptions->nLayerTransaction)
-                        poDstLayer->RollbackTransaction();
-                }
+                poBatch = std::make_unique<Batch>();
+                poBatch->aoFeatures.reserve(nBatchSize);
+            }
+            poBatch->aoFeatures.push_back(std::move(oPending));
+            if (poBatch->aoFeatures.size() == nBatchSize)
+                break;
+        }
+        return poBatch;
+    };
 
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " from layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
+    const auto ProcessBatch = [&](Batch *poBatch, int iWorker)
+    {
+        auto oAccumulator = poBatch->oErrorAccumulator.InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oAccumulator);
+        auto &oWorker = aoWorkers[iWorker];
+        while (true)
+        {
+            const size_t i = poBatch->nNextFeature++;
+            if (i >= poBatch->aoFeatures.size())
+                break;
+            auto &oPending = poBatch->aoFeatures[i];
+            oPending.iWorker = iWorker;
+            if (!psInfo->m_bCanAvoidSetFrom)
+                oPending.poDstFeature =
+                    std::make_unique<OGRFeature>(poDstFDefn);
+            oPending.eStatus = oWorker.poTranslator->TranslateFeature(
+                oPending.poFeature, oPending.poDstFeature, poDstFDefn, psInfo,
+                oWorker.aoReprojectionInfo, oPending.nSrcFID,
+                oPending.nDesiredFID, nullptr, -1, nullptr, poOutputSRS,
+                bRunSetPrecision, oPending.bReprojectionFailed, psOptions);
+            oPending.poFeature.reset();
+        }
+    };
 
+    // Returns false if the translation must be stopped
+    bool bStopWriting = false;
+    const auto WriteBatch = [&](Batch *poBatch)
+    {
+        poBatch->oErrorAccumulator.ReplayErrors();
+        for (auto &oPending : poBatch->aoFeatures)
+        {
+            if (!UpdateGroupTransaction(poDstLayer, nFeaturesInTransaction,
+                                        nTotalEventsDone, psOptions))
+            {
                 return false;
             }
-            else
+
+            // Geometries reprojected by worker threads reference the
+            // target SRS of their cloned coordinate transformation.
+            OGRFeature *poDstFeature = oPending.poDstFeature.get();
+            if (oPending.eStatus == FeatureTranslationStatus::OK)
             {
-                CPLDebug("GDALVectorTranslate",
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " into layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
-                if (psOptions->nGroupTransactions)
+                const auto &aoWorkerInfo =
+                    aoWorkers[oPending.iWorker].aoReprojectionInfo;
+                for (int iGeom = 0; iGeom < poDstFeature->GetGeomFieldCount();
+                     ++iGeom)
                 {
-                    if (psOptions->nLayerTransaction)
-                    {
-                        poDstLayer->RollbackTransaction();
-                        CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
-                    }
-                    else
+                    auto poGeom = poDstFeature->GetGeomFieldRef(iGeom);
+                    const auto poWorkerCT = aoWorkerInfo[iGeom].m_poCT.get();
+                    if (poGeom && poWorkerCT &&
+                        poGeom->getSpatialReference() ==
+                            poWorkerCT->GetTargetCS())
                     {
-                        m_poODS->RollbackTransaction();
-                        m_poODS->StartTransaction(psOptions->bForceTransaction);
+                        poGeom->assignSpatialReference(
+                            psInfo->m_aoReprojectionInfo[iGeom]
+                                .m_poCT->GetTargetCS());
                     }
                 }
             }
 
-        end_loop:;  // nothing
+            if (!WriteFeature(psInfo, oPending.eStatus,
+                              oPending.bReprojectionFailed, poDstFeature,
+                              oPending.nSrcFID, oPending.nDesiredFID,
+                              nFeaturesWritten, psOptions))
+            {
+                return false;
+            }
+            oPending.poDstFeature.reset();
+
+            /* Report progress */
+            nCount++;
+            if (pfnProgress &&
+                !pfnProgress(nCountLayerFeatures
+                                 ? nCount * 1.0 / nCountLayerFeatures
+                                 : 1.0,
+                             "", pProgressArg))
+            {
+                bRet = false;
+                bStopWriting = true;
+                break;
+            }
+
+            if (pnReadFeatureCount)
+                *pnReadFeatureCount = nCount;
         }
+        return true;
+    };
 
-        /* Report progress */
-        nCount++;
-        bool bGoOn = true;
-        if (pfnProgress)
+    // Reading of batch N+1 and writing of batch N-1 are done by the current
+    // thread while batch N is processed by worker threads.
+    std::unique_ptr<Batch> poProcessedBatch;
+    std::unique_ptr<Batch> poBatch = ReadBatch();
+    bool bOK = true;
+    while (poBatch)
+    {
+        for (int iWorker = 0; iWorker < static_cast<int>(aoWorkers.size());
+             ++iWorker)
         {
-            bGoOn = pfnProgress(nCountLayerFeatures
-                                    ? nCount * 1.0 / nCountLayerFeatures
-                                    : 1.0,
-                                "", pProgressArg) != FALSE;
+            Batch *poBatchPtr = poBatch.get();
+            poJobQueue->SubmitJob([&ProcessBatch, poBatchPtr, iWorker]()
+                                  { ProcessBatch(poBatchPtr, iWorker); });
         }
-        if (!bGoOn)
+
+        auto poNextBatch = ReadBatch();
+        if (poProcessedBatch)
         {
-            bRet = false;
-            break;
+            bOK = WriteBatch(poProcessedBatch.get());
+            poProcessedBatch.reset();
         }
-
-        if (pnReadFeatureCount)
-            *pnReadFeatureCount = nCount;
-
-        if (psOptions->nFIDToFetch != OGRNullFID)
-            break;
-        if (poFeatureIn != nullptr)
+        poJobQueue->WaitCompletion();
+        if (!bOK || bStopWriting)
             break;
+
+        poProcessedBatch = std::move(poBatch);
+        poBatch = std::move(poNextBatch);
     }
+    if (bOK && !bStopWriting && poProcessedBatch)
+        bOK = WriteBatch(poProcessedBatch.get());
+    if (!bOK)
+        return false;
 
-    if (psOptions->nGroupTransactions)
+    if (bReadError && !bStopWriting)
+        bRet = false;
+
+    // Merge the extreme points collected by worker threads, that are used
+    // to check that the same coordinate operation has been used.
+    for (const auto &oWorker : aoWorkers)
     {
-        if (psOptions->nLayerTransaction)
+        for (size_t iGeom = 0; iGeom < oWorker.aoReprojectionInfo.size();
+             ++iGeom)
         {
-            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
-                bRet = false;
+            const auto &oWorkerInfo = oWorker.aoReprojectionInfo[iGeom];
+            if (oWorkerInfo.m_dfLeftX <= oWorkerInfo.m_dfRightX)
+            {
+                auto &oInfo = psInfo->m_aoReprojectionInfo[iGeom];
+                oInfo.UpdateExtremePoints(oWorkerInfo.m_dfLeftX,
+                                          oWorkerInfo.m_dfLeftY,
+                                          oWorkerInfo.m_dfLeftZ);
+                oInfo.UpdateExtremePoints(oWorkerInfo.m_dfRightX,
+                                          oWorkerInfo.m_dfRightY,
+                                          oWorkerInfo.m_dfRightZ);
+                oInfo.UpdateExtremePoints(oWorkerInfo.m_dfBottomX,
+                                          oWorkerInfo.m_dfBottomY,
+                                          oWorkerInfo.m_dfBottomZ);
+                oInfo.UpdateExtremePoints(oWorkerInfo.m_dfTopX,
+                                          oWorkerInfo.m_dfTopY,
+                                          oWorkerInfo.m_dfTopZ);
+            }
         }
     }
 
-    if (poFeatureIn == nullptr)
-    {
-        CPLDebug("GDALVectorTranslate",
-                 CPL_FRMT_GIB " features written in layer '%s'",
-                 nFeaturesWritten, poDstLayer->GetName());
-    }
-
-    return bRet;
+    return true;
 }
 
 /************************************************************************/
@@ -7382,6 +8212,9 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
 {
     if (m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
     {
+        std::unique_lock<std::mutex> oLock;
+        if (m_poClipGeomMutex)
+            oLock = std::unique_lock<std::mutex>(*m_poClipGeomMutex);
         auto poClipDstSRS = m_poClipDstOri->getSpatialReference();
         if (poClipDstSRS && poGeomSRS && !poClipDstSRS->IsSame(poGeomSRS))
         {
@@ -7440,6 +8273,9 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
 {
     if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
     {
+        std::unique_lock<std::mutex> oLock;
+        if (m_poClipGeomMutex)
+            oLock = std::unique_lock<std::mutex>(*m_poClipGeomMutex);
         auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
         if (poClipSrcSRS && poGeomSRS && !poClipSrcSRS->IsSame(poGeomSRS))
         {
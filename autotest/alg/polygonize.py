@@ -16,6 +16,7 @@
 import struct
 from collections import defaultdict
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -427,3 +428,132 @@ def test_polygonize_8():
         wkt
         == "POLYGON ((1 4,1 3,0 3,0 1,1 1,1 0,3 0,3 1,4 1,4 3,3 3,3 4,1 4),(1 3,3 3,3 1,1 1,1 3))"
     )
+
+
+###############################################################################
+# Test that multi-threaded polygonization, which processes the raster by strips
+# and merges polygons crossing strips, produces the same geometries.
+
+
+def _polygonize_to_sorted_list(src_band, mask_band, options, is_int_polygonize):
+
+    mem_ds = ogr.GetDriverByName("MEM").CreateDataSource("out")
+    mem_layer = mem_ds.CreateLayer("poly", None, ogr.wkbPolygon)
+    mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTReal))
+
+    if is_int_polygonize:
+        result = gdal.Polygonize(src_band, mask_band, mem_layer, 0, options)
+    else:
+        result = gdal.FPolygonize(src_band, mask_band, mem_layer, 0, options)
+    assert result == 0, "Polygonize failed"
+
+    return sorted(
+        (f.GetField("DN"), f.GetGeometryRef().ExportToWkt()) for f in mem_layer
+    )
+
+
+@pytest.mark.require_driver("AAIGRID")
+@pytest.mark.parametrize("is_int_polygonize", [True, False])
+@pytest.mark.parametrize(
+    "filename,mask_filename,options",
+    [
+        ("data/polygonize_in.grd", None, []),
+        ("data/polygonize_in_5.grd", "data/polygonize_in_5_mask.grd", []),
+        (
+            "data/polygonize_in_5.grd",
+            "data/polygonize_in_5_mask.grd",
+            ["8CONNECTED=8"],
+        ),
+        ("data/polygonize_check_area.tif", None, []),
+    ],
+)
+def test_polygonize_multi_threaded(
+    filename, mask_filename, options, is_int_polygonize
+):
+
+    src_ds = gdal.Open(filename)
+    src_band = src_ds.GetRasterBand(1)
+    mask_band = src_band.GetMaskBand()
+    if mask_filename:
+        mask_ds = gdal.Open(mask_filename)
+        mask_band = mask_ds.GetRasterBand(1)
+
+    expected = _polygonize_to_sorted_list(
+        src_band, mask_band, options + ["NUM_THREADS=1"], is_int_polygonize
+    )
+    got = _polygonize_to_sorted_list(
+        src_band, mask_band, options + ["NUM_THREADS=4"], is_int_polygonize
+    )
+    assert got == expected
+
+
+@pytest.mark.parametrize("options", [[], ["8CONNECTED=8"]])
+def test_polygonize_multi_threaded_many_strips(options):
+
+    # Pseudo-random raster with few distinct values, so that many polygons
+    # cross strip boundaries and get merged.
+    width = 97
+    height = 211
+    seed = 12345
+    values = []
+    for _ in range(width * height):
+        seed = (seed * 1103515245 + 12345) % (1 << 31)
+        values.append((seed >> 16) % 3)
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, width, height, struct.pack("B" * len(values), *values)
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    src_band = src_ds.GetRasterBand(1)
+
+    expected = _polygonize_to_sorted_list(
+        src_band, src_band.GetMaskBand(), options + ["NUM_THREADS=1"], True
+    )
+    got = _polygonize_to_sorted_list(
+        src_band, src_band.GetMaskBand(), options + ["NUM_THREADS=4"], True
+    )
+    assert len(got) > 100
+    assert got == expected
+
+
+###############################################################################
+# Test that the multi-threaded mode is only enabled by the NUM_THREADS option,
+# and not by the GDAL_NUM_THREADS configuration option.
+
+
+@pytest.mark.parametrize(
+    "options,config_options,expect_multi_threaded",
+    [
+        ([], {"GDAL_NUM_THREADS": "4"}, False),
+        (["NUM_THREADS=4"], {}, True),
+    ],
+)
+def test_polygonize_multi_threaded_opt_in(
+    options, config_options, expect_multi_threaded
+):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 10, 100)
+    src_ds.GetRasterBand(1).Fill(1)
+    src_band = src_ds.GetRasterBand(1)
+
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    try:
+        gdal.PushErrorHandler(handler)
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        with gdaltest.config_options(
+            dict(config_options, CPL_DEBUG="GDALPolygonize")
+        ):
+            got = _polygonize_to_sorted_list(src_band, None, options, True)
+    finally:
+        gdal.PopErrorHandler()
+
+    assert len(got) == 1 and got[0][0] == 1
+    assert (
+        any("strips" in msg for msg in debug_msgs) == expect_multi_threaded
+    ), debug_msgs
@@ -2041,6 +2041,49 @@ def test_warp_multi_threaded_errors(tmp_vsimem):
             gdal.Warp("", ds, format="MEM", multithread=True)
 
 
+###############################################################################
+# Test processing more than 2 chunks concurrently
+
+
+@pytest.mark.parametrize("num_concurrent_chunks", ["4", "ALL_CPUS"])
+def test_warp_multi_concurrent_chunks(num_concurrent_chunks):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    ref_ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        dstSRS="EPSG:4326",
+        resampleAlg="bilinear",
+        width=200,
+        height=200,
+        warpMemoryLimit=10000,
+    )
+
+    tab_pct = [0]
+
+    def callback(pct, msg, user_data):
+        assert pct >= tab_pct[0]
+        tab_pct[0] = pct
+        return 1
+
+    ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        dstSRS="EPSG:4326",
+        resampleAlg="bilinear",
+        width=200,
+        height=200,
+        warpMemoryLimit=10000,
+        multithread=True,
+        warpOptions=["NUM_CONCURRENT_CHUNKS=" + num_concurrent_chunks],
+        callback=callback,
+    )
+    assert ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
+    assert tab_pct[0] == 1.0
+
+
 ###############################################################################
 
 
@@ -20,6 +20,7 @@
 #include "gdal_unit_test.h"
 
 #include "cpl_compressor.h"
+#include "cpl_csv.h"
 #include "cpl_error.h"
 #include "cpl_float.h"
 #include "cpl_hash_set.h"
@@ -47,6 +48,7 @@
 #include <cmath>
 #include <limits>
 #include <fstream>
+#include <mutex>
 #include <string>
 
 #include "gtest_include.h"
@@ -4852,6 +4854,95 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
     ASSERT_EQ(ctxt.nCounter, 3 * 3);
 }
 
+// Test CPLWorkerThreadPool with jobs waiting for sub-jobs, and work stealing
+TEST_F(test_cpl, CPLWorkerThreadPool_nested_job_queues)
+{
+    CPLWorkerThreadPool oPool;
+    ASSERT_TRUE(oPool.Setup(4, nullptr, nullptr, true));
+
+    for (int iIter = 0; iIter < 10; ++iIter)
+    {
+        std::atomic<int> nCounter{0};
+        {
+            auto poQueue = oPool.CreateJobQueue();
+            for (int i = 0; i < 8; ++i)
+            {
+                poQueue->SubmitJob(
+                    [&oPool, &nCounter]()
+                    {
+                        auto poSubQueue = oPool.CreateJobQueue();
+                        for (int j = 0; j < 50; ++j)
+                            poSubQueue->SubmitJob([&nCounter]()
+                                                  { nCounter++; });
+                        poSubQueue->WaitCompletion();
+                        nCounter++;
+                    });
+            }
+            poQueue->WaitCompletion();
+        }
+        ASSERT_EQ(nCounter, 8 * 51);
+    }
+
+    // Jobs of very different durations
+    std::vector<int> anDurations(100);
+    std::vector<void *> apData;
+    for (int i = 0; i < 100; ++i)
+    {
+        anDurations[i] = (i < 4) ? 5000 : 1;
+        apData.push_back(&anDurations[i]);
+    }
+    ASSERT_TRUE(oPool.SubmitJobs(
+        [](void *pData)
+        {
+            int *pnDuration = static_cast<int *>(pData);
+            CPLSleep(*pnDuration * 1e-6);
+            *pnDuration = -1;
+        },
+        apData));
+    oPool.WaitCompletion();
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(anDurations[i], -1);
+    }
+}
+
+// Test that a single worker thread runs jobs in submission order
+TEST_F(test_cpl, CPLWorkerThreadPool_fifo_order)
+{
+    CPLWorkerThreadPool oPool;
+    ASSERT_TRUE(oPool.Setup(1, nullptr, nullptr, true));
+
+    struct Context
+    {
+        std::mutex oMutex{};
+        std::vector<int> anOrder{};
+    };
+
+    Context ctxt;
+    std::vector<std::pair<Context *, int>> aoJobs;
+    for (int i = 0; i < 100; ++i)
+        aoJobs.emplace_back(&ctxt, i);
+    std::vector<void *> apData;
+    for (auto &oJob : aoJobs)
+        apData.push_back(&oJob);
+
+    ASSERT_TRUE(oPool.SubmitJobs(
+        [](void *pData)
+        {
+            auto poJob = static_cast<std::pair<Context *, int> *>(pData);
+            std::lock_guard<std::mutex> oGuard(poJob->first->oMutex);
+            poJob->first->anOrder.push_back(poJob->second);
+        },
+        apData));
+    oPool.WaitCompletion();
+
+    ASSERT_EQ(ctxt.anOrder.size(), aoJobs.size());
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(ctxt.anOrder[i], i);
+    }
+}
+
 // Test /vsimem/ PRead() implementation
 TEST_F(test_cpl, vsimem_pread)
 {
@@ -6041,4 +6132,87 @@ TEST_F(test_cpl, CPLHasUnbalancedPathTraversal)
     EXPECT_TRUE(CPLHasUnbalancedPathTraversal("a\\..\\..\\"));
 }
 
+TEST_F(test_cpl, CSVSplitRecord)
+{
+    const auto Split = [](const char *pszRecord, const char *pszDelimiter,
+                          bool bHonourStrings = true,
+                          bool bMergeDelimiter = false)
+    {
+        return CPLStringList(CSVSplitRecord(pszRecord, pszDelimiter,
+                                            bHonourStrings, false,
+                                            bMergeDelimiter));
+    };
+
+    EXPECT_EQ(Split("", ",").size(), 0);
+    {
+        const auto aosTokens = Split("a,b,c", ",");
+        ASSERT_EQ(aosTokens.size(), 3);
+        EXPECT_STREQ(aosTokens[0], "a");
+        EXPECT_STREQ(aosTokens[1], "b");
+        EXPECT_STREQ(aosTokens[2], "c");
+    }
+    {
+        const auto aosTokens = Split("a,,b,", ",");
+        ASSERT_EQ(aosTokens.size(), 4);
+        EXPECT_STREQ(aosTokens[0], "a");
+        EXPECT_STREQ(aosTokens[1], "");
+        EXPECT_STREQ(aosTokens[2], "b");
+        EXPECT_STREQ(aosTokens[3], "");
+    }
+    {
+        const auto aosTokens = Split(",", ",");
+        ASSERT_EQ(aosTokens.size(), 2);
+        EXPECT_STREQ(aosTokens[0], "");
+        EXPECT_STREQ(aosTokens[1], "");
+    }
+    {
+        const auto aosTokens = Split("a,,b,,", ",", true, true);
+        ASSERT_EQ(aosTokens.size(), 3);
+        EXPECT_STREQ(aosTokens[0], "a");
+        EXPECT_STREQ(aosTokens[1], "b");
+        EXPECT_STREQ(aosTokens[2], "");
+    }
+    {
+        const auto aosTokens = Split("a,\"b,\"\"c\",d", ",");
+        ASSERT_EQ(aosTokens.size(), 3);
+        EXPECT_STREQ(aosTokens[0], "a");
+        EXPECT_STREQ(aosTokens[1], "b,\"c");
+        EXPECT_STREQ(aosTokens[2], "d");
+    }
+    {
+        const auto aosTokens = Split("a::b", "::");
+        ASSERT_EQ(aosTokens.size(), 2);
+        EXPECT_STREQ(aosTokens[0], "a");
+        EXPECT_STREQ(aosTokens[1], "b");
+    }
+    {
+        const auto aosTokens = Split("\"a,b\"", ",", false);
+        ASSERT_EQ(aosTokens.size(), 2);
+        EXPECT_STREQ(aosTokens[0], "\"a");
+        EXPECT_STREQ(aosTokens[1], "b\"");
+    }
+}
+
+TEST_F(test_cpl, CSVReadRecordL)
+{
+    const char *pszFilename = "/vsimem/test_cpl_CSVReadRecordL.csv";
+    const char *pszContent = "a,\"b\nc\",d\n\ne,f\n";
+    VSIFCloseL(VSIFileFromMemBuffer(
+        pszFilename,
+        reinterpret_cast<GByte *>(const_cast<char *>(pszContent)),
+        strlen(pszContent), false));
+    VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+    ASSERT_NE(fp, nullptr);
+    std::string osRecord;
+    EXPECT_TRUE(CSVReadRecordL(fp, 0, ",", true, true, osRecord));
+    EXPECT_STREQ(osRecord.c_str(), "a,\"b\nc\",d");
+    EXPECT_TRUE(CSVReadRecordL(fp, 0, ",", true, true, osRecord));
+    EXPECT_STREQ(osRecord.c_str(), "");
+    EXPECT_TRUE(CSVReadRecordL(fp, 0, ",", true, true, osRecord));
+    EXPECT_STREQ(osRecord.c_str(), "e,f");
+    EXPECT_FALSE(CSVReadRecordL(fp, 0, ",", true, true, osRecord));
+    VSIFCloseL(fp);
+    VSIUnlink(pszFilename);
+}
+
 }  // namespace
@@ -23,7 +23,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
 #include <limits>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 
 #include "test_data.h"
@@ -5158,6 +5162,68 @@ TEST_F(test_gdal, GDALComputeRasterMinMaxLocation_with_mask)
     EXPECT_EQ(nMaxY, 0);
 }
 
+// Test that multi-threaded statistics do not depend on the number of threads
+TEST_F(test_gdal, ComputeStatistics_multithreaded)
+{
+    for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16, GDT_Float32})
+    {
+        GDALDatasetUniquePtr poDS(
+            MEMDataset::Create("", 257, 300, 1, eDT, nullptr));
+        auto poBand = poDS->GetRasterBand(1);
+        std::vector<float> afValues(257 * 300);
+        for (size_t i = 0; i < afValues.size(); ++i)
+            afValues[i] = static_cast<float>((i * 7919) % 251) * 0.75f;
+        EXPECT_EQ(poBand->RasterIO(GF_Write, 0, 0, 257, 300, afValues.data(),
+                                   257, 300, GDT_Float32, 0, 0, nullptr),
+                  CE_None);
+        if (eDT == GDT_Float32)
+            poBand->SetNoDataValue(0);
+
+        struct Result
+        {
+            double adfStats[4] = {0, 0, 0, 0};
+            double adfMinMax[2] = {0, 0};
+            std::vector<GUIntBig> anHistogram = std::vector<GUIntBig>(10);
+        };
+
+        const auto Compute = [poBand](const char *pszThreads)
+        {
+            CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", pszThreads,
+                                          false);
+            Result sRes;
+            EXPECT_EQ(poBand->ComputeStatistics(
+                          false, &sRes.adfStats[0], &sRes.adfStats[1],
+                          &sRes.adfStats[2], &sRes.adfStats[3], nullptr,
+                          nullptr),
+                      CE_None);
+            EXPECT_EQ(poBand->ComputeRasterMinMax(false, sRes.adfMinMax),
+                      CE_None);
+            EXPECT_EQ(poBand->GetHistogram(-0.5, 255.5, 10,
+                                           sRes.anHistogram.data(), false,
+                                           false, nullptr, nullptr),
+                      CE_None);
+            return sRes;
+        };
+
+        const Result sRef = Compute(nullptr);
+        const Result sRes1 = Compute("1");
+        const Result sRes4 = Compute("4");
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_NEAR(sRes1.adfStats[i], sRef.adfStats[i],
+                        1e-10 * std::fabs(sRef.adfStats[i]));
+            EXPECT_EQ(sRes4.adfStats[i], sRes1.adfStats[i]);
+        }
+        for (int i = 0; i < 2; ++i)
+        {
+            EXPECT_EQ(sRes1.adfMinMax[i], sRef.adfMinMax[i]);
+            EXPECT_EQ(sRes4.adfMinMax[i], sRef.adfMinMax[i]);
+        }
+        EXPECT_EQ(sRes1.anHistogram, sRef.anHistogram);
+        EXPECT_EQ(sRes4.anHistogram, sRef.anHistogram);
+    }
+}
+
 TEST_F(test_gdal, GDALTranspose2D)
 {
     constexpr int COUNT = 6;
@@ -6081,4 +6147,248 @@ TEST_F(test_gdal, GDALRasterBand_window_iterator)
     EXPECT_EQ(windows[8].nYSize, 600 - 512);
 }
 
+// Test GDALDataset::RasterIOAsync()
+TEST_F(test_gdal, GDALDataset_RasterIOAsync)
+{
+    if (GDALGetDriverByName("GTiff") == nullptr)
+    {
+        GTEST_SKIP() << "GTIFF driver missing";
+    }
+
+    for (const int nOpenFlags :
+         {GDAL_OF_RASTER, GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE})
+    {
+        GDALDatasetUniquePtr poDS(GDALDataset::Open(
+            GCORE_DATA_DIR "byte.tif", nOpenFlags, nullptr, nullptr, nullptr));
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GByte> abyRef(20 * 20);
+        ASSERT_EQ(poDS->RasterIO(GF_Read, 0, 0, 20, 20, abyRef.data(), 20,
+                                 20, GDT_Byte, 1, nullptr, 0, 0, 0, nullptr),
+                  CE_None);
+
+        constexpr int N_REQUESTS = 10;
+        std::vector<std::vector<GByte>> aabyBuffers(
+            N_REQUESTS, std::vector<GByte>(10 * 10));
+        std::vector<std::future<CPLErr>> aoFutures;
+        std::atomic<int> nCompleted{0};
+        for (int i = 0; i < N_REQUESTS; ++i)
+        {
+            aoFutures.push_back(poDS->RasterIOAsync(
+                i, i, 10, 10, aabyBuffers[i].data(), 10, 10, GDT_Byte, 1,
+                nullptr, 0, 0, 0, nullptr,
+                [&nCompleted](CPLErr eErr)
+                {
+                    if (eErr == CE_None)
+                        ++nCompleted;
+                }));
+        }
+        for (int i = 0; i < N_REQUESTS; ++i)
+        {
+            EXPECT_EQ(aoFutures[i].get(), CE_None);
+            for (int y = 0; y < 10; ++y)
+            {
+                for (int x = 0; x < 10; ++x)
+                {
+                    EXPECT_EQ(aabyBuffers[i][y * 10 + x],
+                              abyRef[(i + y) * 20 + i + x]);
+                }
+            }
+        }
+        EXPECT_EQ(nCompleted, N_REQUESTS);
+
+        // Invalid window
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(poDS->RasterIOAsync(15, 15, 10, 10, aabyBuffers[0].data(),
+                                      10, 10, GDT_Byte, 1, nullptr, 0, 0, 0)
+                      .get(),
+                  CE_Failure);
+    }
+}
+
+// Test that an exception thrown by the completion callback of
+// GDALDataset::RasterIOAsync() does not leave the future unset
+TEST_F(test_gdal, GDALDataset_RasterIOAsync_exception)
+{
+    if (GDALGetDriverByName("GTiff") == nullptr)
+    {
+        GTEST_SKIP() << "GTIFF driver missing";
+    }
+
+    GDALDatasetUniquePtr poDS(GDALDataset::Open(GCORE_DATA_DIR "byte.tif"));
+    ASSERT_TRUE(poDS != nullptr);
+    std::vector<GByte> abyBuffer(20 * 20);
+    CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+    EXPECT_EQ(poDS->RasterIOAsync(0, 0, 20, 20, abyBuffer.data(), 20, 20,
+                                  GDT_Byte, 1, nullptr, 0, 0, 0, nullptr,
+                                  [](CPLErr)
+                                  { throw std::runtime_error("test"); })
+                  .get(),
+              CE_Failure);
+}
+
+// Test GDALDatasetRasterIOAsync(), and that GDALClose() waits for, or
+// cancels, the requests in flight
+TEST_F(test_gdal, GDALDatasetRasterIOAsync)
+{
+    if (GDALGetDriverByName("GTiff") == nullptr)
+    {
+        GTEST_SKIP() << "GTIFF driver missing";
+    }
+
+    struct Results
+    {
+        std::mutex oMutex{};
+        int nSuccess = 0;
+        int nFailure = 0;
+    };
+
+    const auto Completion = [](CPLErr eErr, void *pUserData)
+    {
+        auto psResults = static_cast<Results *>(pUserData);
+        std::lock_guard oLock(psResults->oMutex);
+        if (eErr == CE_None)
+            ++psResults->nSuccess;
+        else
+            ++psResults->nFailure;
+    };
+
+    for (const int nOpenFlags :
+         {GDAL_OF_RASTER, GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE})
+    {
+        GDALDatasetH hDS = GDALOpenEx(GCORE_DATA_DIR "byte.tif", nOpenFlags,
+                                      nullptr, nullptr, nullptr);
+        ASSERT_TRUE(hDS != nullptr);
+
+        constexpr int N_REQUESTS = 100;
+        std::vector<std::vector<GByte>> aabyBuffers(
+            N_REQUESTS, std::vector<GByte>(20 * 20));
+        Results sResults;
+        for (int i = 0; i < N_REQUESTS; ++i)
+        {
+            EXPECT_EQ(GDALDatasetRasterIOAsync(
+                          hDS, 0, 0, 20, 20, aabyBuffers[i].data(), 20, 20,
+                          GDT_Byte, 1, nullptr, 0, 0, 0, nullptr, Completion,
+                          &sResults),
+                      CE_None);
+        }
+
+        {
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            GDALClose(hDS);
+        }
+
+        // All requests have either completed or been cancelled
+        std::lock_guard oLock(sResults.oMutex);
+        EXPECT_EQ(sResults.nSuccess + sResults.nFailure, N_REQUESTS);
+    }
+
+    // A request that cannot be queued fails immediately, without calling
+    // the completion callback
+    GDALDatasetH hDS = GDALOpen(GCORE_DATA_DIR "byte.tif", GA_ReadOnly);
+    ASSERT_TRUE(hDS != nullptr);
+    std::vector<GByte> abyBuffer(10 * 10);
+    Results sResults;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(GDALDatasetRasterIOAsync(
+                      hDS, 15, 15, 10, 10, abyBuffer.data(), 10, 10, GDT_Byte,
+                      1, nullptr, 0, 0, 0, nullptr, Completion, &sResults),
+                  CE_Failure);
+        const int nBand = 2;
+        EXPECT_EQ(GDALDatasetRasterIOAsync(
+                      hDS, 0, 0, 10, 10, abyBuffer.data(), 10, 10, GDT_Byte,
+                      1, &nBand, 0, 0, 0, nullptr, Completion, &sResults),
+                  CE_Failure);
+    }
+    GDALClose(hDS);
+    EXPECT_EQ(sResults.nSuccess + sResults.nFailure, 0);
+}
+
+// Test that the completion callback of a request can close the dataset
+TEST_F(test_gdal, GDALDataset_RasterIOAsync_close_from_completion)
+{
+    if (GDALGetDriverByName("GTiff") == nullptr)
+    {
+        GTEST_SKIP() << "GTIFF driver missing";
+    }
+
+    for (const int nOpenFlags :
+         {GDAL_OF_RASTER, GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE})
+    {
+        GDALDataset *poDS = GDALDataset::Open(GCORE_DATA_DIR "byte.tif",
+                                              nOpenFlags, nullptr, nullptr,
+                                              nullptr);
+        ASSERT_TRUE(poDS != nullptr);
+        std::vector<GByte> abyBuffer(20 * 20);
+        auto oFuture = poDS->RasterIOAsync(
+            0, 0, 20, 20, abyBuffer.data(), 20, 20, GDT_Byte, 1, nullptr, 0,
+            0, 0, nullptr,
+            [poDS](CPLErr) { GDALClose(GDALDataset::ToHandle(poDS)); });
+        EXPECT_EQ(oFuture.get(), CE_None);
+    }
+}
+
+// Test that the AVX2 and SSE2 variants of the overview and statistics
+// kernels give the same results. GDAL_USE_AVX2=NO is only honoured in DEBUG
+// builds without -mavx2, otherwise both computations use the same kernels.
+TEST_F(test_gdal, overview_and_statistics_kernels_avx2_vs_sse2)
+{
+    for (const GDALDataType eDT :
+         {GDT_Byte, GDT_UInt16, GDT_Float32, GDT_Float64})
+    {
+        for (const char *pszResampling : {"AVERAGE", "RMS"})
+        {
+            const auto Compute = [eDT, pszResampling](const char *pszUseAVX2)
+            {
+                CPLConfigOptionSetter oSetter("GDAL_USE_AVX2", pszUseAVX2,
+                                              false);
+                auto poDS = std::unique_ptr<GDALDataset>(
+                    MEMDataset::Create("", 259, 131, 1, eDT, nullptr));
+                auto poBand = poDS->GetRasterBand(1);
+                std::vector<double> adfValues(259 * 131);
+                for (size_t i = 0; i < adfValues.size(); ++i)
+                {
+                    adfValues[i] = static_cast<double>((i * 7919) % 65521);
+                    if (eDT == GDT_Byte)
+                        adfValues[i] = std::fmod(adfValues[i], 256.0);
+                    else if (eDT != GDT_UInt16)
+                        adfValues[i] *= 0.37;
+                }
+                EXPECT_EQ(poBand->RasterIO(GF_Write, 0, 0, 259, 131,
+                                           adfValues.data(), 259, 131,
+                                           GDT_Float64, 0, 0, nullptr),
+                          CE_None);
+
+                std::vector<double> adfRes(5);
+                EXPECT_EQ(poBand->ComputeStatistics(
+                              false, &adfRes[0], &adfRes[1], &adfRes[2],
+                              &adfRes[3], nullptr, nullptr),
+                          CE_None);
+
+                const int nOvrFactor = 2;
+                EXPECT_EQ(poDS->BuildOverviews(pszResampling, 1, &nOvrFactor,
+                                               0, nullptr, nullptr, nullptr,
+                                               nullptr),
+                          CE_None);
+                auto poOvrBand = poBand->GetOverview(0);
+                EXPECT_NE(poOvrBand, nullptr);
+                if (poOvrBand)
+                    adfRes[4] = GDALChecksumImage(
+                        poOvrBand, 0, 0, poOvrBand->GetXSize(),
+                        poOvrBand->GetYSize());
+                return adfRes;
+            };
+
+            const auto adfRef = Compute(nullptr);
+            const auto adfNoAVX2 = Compute("NO");
+            for (int i = 0; i < 5; ++i)
+            {
+                EXPECT_EQ(adfNoAVX2[i], adfRef[i])
+                    << GDALGetDataTypeName(eDT) << " " << pszResampling << " "
+                    << i;
+            }
+        }
+    }
+}
+
 }  // namespace
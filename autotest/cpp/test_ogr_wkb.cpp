@@ -858,4 +858,83 @@ TEST_F(test_ogr_wkb, OGRWKBTransformFixture_ct_failure)
     }
 }
 
+TEST_F(test_ogr_wkb, OGRWKBSwapXY)
+{
+    for (const char *pszWKT :
+         {"POINT (1 2)", "POINT EMPTY", "LINESTRING ZM (1 2 3 4,5 6 7 8)",
+          "POLYGON ((0 0,0 1,1 1,0 0))",
+          "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((10 0,10 1,11 1,10 0)))",
+          "GEOMETRYCOLLECTION (POINT M (1 2 3),CIRCULARSTRING (0 0,1 1,2 0))",
+          "CURVEPOLYGON (COMPOUNDCURVE ((0 0,0 1),(0 1,1 1,0 0)))"})
+    {
+        for (const auto eByteOrder : {wkbNDR, wkbXDR})
+        {
+            auto poGeom = OGRGeometryFactory::createFromWkt(pszWKT).first;
+            ASSERT_NE(poGeom, nullptr) << pszWKT;
+            std::vector<GByte> abyWkb(poGeom->WkbSize());
+            poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+
+            EXPECT_TRUE(OGRWKBSwapXY(abyWkb.data(), abyWkb.size()));
+            EXPECT_FALSE(OGRWKBSwapXY(abyWkb.data(), abyWkb.size() - 1));
+
+            OGRGeometry *poGot = nullptr;
+            ASSERT_EQ(OGRGeometryFactory::createFromWkb(
+                          abyWkb.data(), nullptr, &poGot, abyWkb.size()),
+                      OGRERR_NONE);
+            poGeom->swapXY();
+            EXPECT_TRUE(poGot->Equals(poGeom.get())) << pszWKT;
+            delete poGot;
+        }
+    }
+}
+
+TEST_F(test_ogr_wkb, OGRWKBSetCoordinateDimension)
+{
+    for (const char *pszWKT :
+         {"POINT (1 2)", "POINT EMPTY", "POINT ZM (1 2 3 4)",
+          "LINESTRING Z (1 2 3,4 5 6)", "POLYGON M ((0 0 1,0 1 2,1 1 3,0 0 1))",
+          "MULTIPOINT ((1 2),EMPTY)", "TIN Z (((0 0 1,0 1 2,1 1 3,0 0 1)))",
+          "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING EMPTY)",
+          "CURVEPOLYGON (COMPOUNDCURVE ((0 0,0 1),(0 1,1 1,0 0)))"})
+    {
+        for (const auto eByteOrder : {wkbNDR, wkbXDR})
+        {
+            auto poGeom = OGRGeometryFactory::createFromWkt(pszWKT).first;
+            ASSERT_NE(poGeom, nullptr) << pszWKT;
+            std::vector<GByte> abyWkb(poGeom->WkbSize());
+            poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+
+            for (int nDim = 0; nDim < 4; ++nDim)
+            {
+                const bool bHasZ = (nDim & 1) != 0;
+                const bool bHasM = (nDim & 2) != 0;
+                std::vector<GByte> abyOut{0xFF};
+                ASSERT_TRUE(OGRWKBSetCoordinateDimension(
+                    abyWkb.data(), abyWkb.size(), bHasZ, bHasM, abyOut))
+                    << pszWKT;
+                EXPECT_EQ(abyOut[0], 0xFF);
+
+                OGRGeometry *poGot = nullptr;
+                ASSERT_EQ(OGRGeometryFactory::createFromWkb(
+                              abyOut.data() + 1, nullptr, &poGot,
+                              abyOut.size() - 1),
+                          OGRERR_NONE)
+                    << pszWKT;
+                std::unique_ptr<OGRGeometry> poExpected(poGeom->clone());
+                poExpected->set3D(bHasZ);
+                poExpected->setMeasured(bHasM);
+                EXPECT_STREQ(poGot->exportToWkt().c_str(),
+                             poExpected->exportToWkt().c_str());
+                delete poGot;
+            }
+        }
+    }
+
+    std::vector<GByte> abyOut;
+    const GByte abyTruncated[] = {wkbNDR, wkbLineString, 0, 0, 0, 2, 0, 0, 0};
+    EXPECT_FALSE(OGRWKBSetCoordinateDimension(
+        abyTruncated, sizeof(abyTruncated), true, false, abyOut));
+    EXPECT_TRUE(abyOut.empty());
+}
+
 }  // namespace
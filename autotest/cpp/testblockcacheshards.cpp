@@ -0,0 +1,142 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test eviction behaviour of the sharded block cache
+ * Author:   GDAL contributors
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "gdal_priv.h"
+
+#include <cstring>
+#include <vector>
+
+#include "gtest_include.h"
+
+namespace
+{
+
+// ---------------------------------------------------------------------------
+
+constexpr int BLOCK_SIZE = 64;
+constexpr int BLOCKS_PER_ROW = 8;
+
+class MyRasterBand final : public GDALRasterBand
+{
+  public:
+    int nReadBlocks = 0;
+    int nWrittenBlocks = 0;
+
+    MyRasterBand()
+    {
+        nBlockXSize = BLOCK_SIZE;
+        nBlockYSize = BLOCK_SIZE;
+        eDataType = GDT_Byte;
+    }
+
+    CPLErr IReadBlock(int, int, void *pData) override
+    {
+        ++nReadBlocks;
+        memset(pData, 1, BLOCK_SIZE * BLOCK_SIZE);
+        return CE_None;
+    }
+
+    CPLErr IWriteBlock(int, int, void *) override
+    {
+        ++nWrittenBlocks;
+        return CE_None;
+    }
+};
+
+class MyDataset final : public GDALDataset
+{
+  public:
+    explicit MyDataset(GDALAccess eAccessIn)
+    {
+        eAccess = eAccessIn;
+        nRasterXSize = BLOCK_SIZE * BLOCKS_PER_ROW;
+        nRasterYSize = BLOCK_SIZE;
+        SetBand(1, new MyRasterBand());
+    }
+
+    MyRasterBand *GetMyBand()
+    {
+        return cpl::down_cast<MyRasterBand *>(GetRasterBand(1));
+    }
+};
+
+// ---------------------------------------------------------------------------
+
+// Check that reading blocks of a dataset, while the cache is full of dirty
+// blocks of another dataset, evicts the clean blocks first and only flushes
+// dirty blocks of the other dataset as a last resort.
+TEST(testblockcacheshards, dirty_blocks_of_other_dataset_are_last_resort)
+{
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(100 * 1000 * 1000);
+
+    MyDataset oDirtyDS(GA_Update);
+    std::vector<GByte> abyBuffer(BLOCK_SIZE * BLOCK_SIZE, 2);
+    for (int i = 0; i < BLOCKS_PER_ROW; ++i)
+    {
+        ASSERT_EQ(oDirtyDS.GetRasterBand(1)->RasterIO(
+                      GF_Write, i * BLOCK_SIZE, 0, BLOCK_SIZE, BLOCK_SIZE,
+                      abyBuffer.data(), BLOCK_SIZE, BLOCK_SIZE, GDT_Byte, 0, 0,
+                      nullptr),
+                  CE_None);
+    }
+    EXPECT_EQ(oDirtyDS.GetMyBand()->nWrittenBlocks, 0);
+
+    // Leave room for the dirty blocks only, so that any other block
+    // triggers an eviction.
+    GDALSetCacheMax64(GDALGetCacheUsed64() + BLOCK_SIZE * BLOCK_SIZE / 2);
+
+    GUIntBig nLockAcquisitionsBefore = 0;
+    GUIntBig nLockContentionsBefore = 0;
+    GDALRasterBlock::GetCacheLockStatistics(&nLockAcquisitionsBefore,
+                                            &nLockContentionsBefore);
+
+    MyDataset oCleanDS(GA_ReadOnly);
+    for (int iIter = 0; iIter < 2; ++iIter)
+    {
+        for (int i = 0; i < BLOCKS_PER_ROW; ++i)
+        {
+            ASSERT_EQ(oCleanDS.GetRasterBand(1)->RasterIO(
+                          GF_Read, i * BLOCK_SIZE, 0, BLOCK_SIZE, BLOCK_SIZE,
+                          abyBuffer.data(), BLOCK_SIZE, BLOCK_SIZE, GDT_Byte,
+                          0, 0, nullptr),
+                      CE_None);
+            EXPECT_EQ(abyBuffer[0], 1);
+        }
+    }
+
+    // Only the first block read may find no clean block to evict. Afterwards
+    // the clean blocks of oCleanDS are recycled.
+    EXPECT_LE(oDirtyDS.GetMyBand()->nWrittenBlocks, 1);
+    EXPECT_EQ(oCleanDS.GetMyBand()->nReadBlocks, 2 * BLOCKS_PER_ROW);
+    EXPECT_LE(GDALGetCacheUsed64(), GDALGetCacheMax64());
+
+    GUIntBig nLockAcquisitions = 0;
+    GUIntBig nLockContentions = 0;
+    GDALRasterBlock::GetCacheLockStatistics(&nLockAcquisitions,
+                                            &nLockContentions);
+    // At least one lock acquisition per block read in Internalize()
+    EXPECT_GE(nLockAcquisitions,
+              nLockAcquisitionsBefore + 2 * BLOCKS_PER_ROW);
+    EXPECT_GE(nLockContentions, nLockContentionsBefore);
+    EXPECT_LE(nLockContentions, nLockAcquisitions);
+
+    oCleanDS.FlushCache(false);
+    oDirtyDS.FlushCache(false);
+    EXPECT_EQ(oDirtyDS.GetMyBand()->nWrittenBlocks, BLOCKS_PER_ROW);
+    EXPECT_EQ(GDALGetCacheUsed64(), 0);
+
+    GDALSetCacheMax64(nOldCacheMax);
+}
+
+}  // namespace
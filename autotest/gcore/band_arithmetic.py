@@ -896,3 +896,36 @@ def test_band_arithmetic_pow_band_band_error():
     ds2 = gdal.GetDriverByName("MEM").Create("", 2, 1)
     with pytest.raises(Exception, match="Bands do not have the same dimensions"):
         gdal.pow(ds1.GetRasterBand(1), ds2.GetRasterBand(1))
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_band_arithmetic_fused_evaluation(tmp_vsimem, num_threads):
+
+    np = pytest.importorskip("numpy")
+    gdaltest.importorskip_gdal_array()
+
+    # Large enough to be evaluated by several strips
+    ds = gdal.GetDriverByName("MEM").Create("", 700, 800, 2, gdal.GDT_Int16)
+    R = ds.GetRasterBand(1)
+    R.SetNoDataValue(7)
+    R.WriteArray((np.arange(700 * 800) % 253 + 1).reshape(800, 700))
+    G = ds.GetRasterBand(2)
+    G.WriteArray((np.arange(700 * 800) % 37 - 18).reshape(800, 700))
+
+    # R is referenced several times, and is read only once per strip
+    res = (R + G) * R - gdal.abs(G) / R
+    gdal.GetDriverByName("VRT").CreateCopy(tmp_vsimem / "out.vrt", res)
+    with gdal.Open(tmp_vsimem / "out.vrt") as vrt_ds:
+        expected = vrt_ds.GetRasterBand(1).ReadAsArray()
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        assert np.array_equal(res.ReadAsArray(), expected, equal_nan=True)
+        assert np.array_equal(
+            res.ReadAsArray(10, 20, 600, 700),
+            expected[20:720, 10:610],
+            equal_nan=True,
+        )
+        assert res.ComputeRasterMinMax(False) == (
+            np.nanmin(expected),
+            np.nanmax(expected),
+        )
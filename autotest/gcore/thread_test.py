@@ -594,3 +594,51 @@ def test_thread_safe_GetGCPs():
         for t in threads:
             t.join()
         assert res[0]
+
+
+###############################################################################
+# Test that RasterIO() requests on a thread-safe dataset decoded by worker
+# threads give the same result as sequential ones
+
+
+@pytest.mark.parametrize("driver", ["GTiff", "ENVI"])
+def test_thread_safe_parallel_rasterio(tmp_vsimem, driver):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 600, 400, 3)
+    for i in range(3):
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0, 0, 600, 400, bytes((x * (i + 1)) % 251 for x in range(600 * 400))
+        )
+
+    tmpfilename = str(tmp_vsimem / "test.bin")
+    options = ["TILED=YES", "BLOCKXSIZE=64", "BLOCKYSIZE=32"]
+    gdal.GetDriverByName(driver).CreateCopy(
+        tmpfilename, src_ds, options=options if driver == "GTiff" else []
+    )
+
+    windows = [(0, 0, 600, 400), (10, 5, 550, 390), (63, 31, 3, 3), (1, 1, 1, 1)]
+    with gdal.Open(tmpfilename) as ds:
+        expected_ds = [ds.ReadRaster(*window) for window in windows]
+        expected_band = [ds.GetRasterBand(2).ReadRaster(*window) for window in windows]
+
+    messages = []
+
+    def handler(ecls, ecode, emsg):
+        if "GDALParallelRasterIORead()" in emsg:
+            messages.append(emsg)
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "CPL_DEBUG": "ON"}
+    ), gdaltest.error_handler(handler):
+        with gdal.OpenEx(tmpfilename, gdal.OF_RASTER | gdal.OF_THREAD_SAFE) as ds:
+            for window, expected in zip(windows, expected_ds):
+                assert ds.ReadRaster(*window) == expected
+            for window, expected in zip(windows, expected_band):
+                assert ds.GetRasterBand(2).ReadRaster(*window) == expected
+            assert ds.ReadRaster(buf_type=gdal.GDT_UInt16) == src_ds.ReadRaster(
+                buf_type=gdal.GDT_UInt16
+            )
+
+    # At least the whole raster requests span several chunks: check that they
+    # have been read by worker threads.
+    assert len(messages) >= 3, messages
@@ -2389,6 +2389,47 @@ def test_tiff_ovr_multithreading_multiband():
     gdal.Unlink("/vsimem/test.tif")
 
 
+###############################################################################
+# Test that generating several overview levels concurrently, when using
+# multithreading, gives the same result as generating them one after the other
+
+
+@pytest.mark.parametrize("resampling", ["AVERAGE", "CUBIC"])
+def test_tiff_ovr_multithreading_multiband_pipeline(tmp_vsimem, resampling):
+
+    checksums = {}
+    for pipeline in ("NO", "YES"):
+        filename = str(tmp_vsimem / f"test_{pipeline}.tif")
+        ds = gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            creationOptions=[
+                "COMPRESS=LZW",
+                "TILED=YES",
+                "BLOCKXSIZE=16",
+                "BLOCKYSIZE=16",
+            ],
+        )
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": "4",
+                "GDAL_OVR_CHUNK_MAX_SIZE": "100",
+                "GDAL_OVR_PIPELINE": pipeline,
+            }
+        ):
+            ds.BuildOverviews(resampling, [2, 4, 8, 16])
+        ds = None
+        ds = gdal.Open(filename)
+        checksums[pipeline] = [
+            ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+            for i in range(4)
+            for j in range(4)
+        ]
+        ds = None
+
+    assert checksums["YES"] == checksums["NO"]
+
+
 ###############################################################################
 
 
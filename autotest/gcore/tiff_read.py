@@ -4988,6 +4988,119 @@ def test_tiff_read_multi_threaded(
     ds = None
 
 
+###############################################################################
+# Test multi-threaded decoding of windows aligned on tiles/strips, which
+# may decode tiles/strips directly into the output buffer
+
+
+@pytest.mark.parametrize(
+    "creation_options",
+    [
+        ["COMPRESS=NONE", "TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=16"],
+        ["COMPRESS=NONE", "BLOCKYSIZE=16"],
+        ["COMPRESS=NONE", "BLOCKYSIZE=16", "ENDIANNESS=BIG"],
+        ["COMPRESS=DEFLATE", "TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=16"],
+        ["COMPRESS=DEFLATE", "BLOCKYSIZE=16", "PREDICTOR=2"],
+        ["COMPRESS=DEFLATE", "BLOCKYSIZE=16", "INTERLEAVE=BAND"],
+    ],
+)
+@pytest.mark.parametrize("dtype", [gdal.GDT_Byte, gdal.GDT_UInt16])
+def test_tiff_read_multi_threaded_block_aligned_windows(
+    tmp_vsimem, creation_options, dtype
+):
+
+    ref_ds = gdal.GetDriverByName("MEM").Create("", 100, 70, 3, dtype)
+    for band in range(ref_ds.RasterCount):
+        buf = b""
+        for j in range(ref_ds.RasterYSize):
+            buf += array.array("B", [(band * 10 + j * 3 + i) % 256 for i in range(100)])
+        ref_ds.GetRasterBand(band + 1).WriteRaster(
+            0, 0, ref_ds.RasterXSize, ref_ds.RasterYSize, buf, buf_type=gdal.GDT_Byte
+        )
+
+    tmpfile = tmp_vsimem / "test_tiff_read_multi_threaded_block_aligned.tif"
+    gdal.GetDriverByName("GTiff").CreateCopy(tmpfile, ref_ds, options=creation_options)
+
+    ds = gdal.OpenEx(tmpfile, open_options=["NUM_THREADS=2"])
+    pixel_size = gdal.GetDataTypeSize(dtype) // 8
+    nbands = ds.RasterCount
+    blockxsize, blockysize = ds.GetRasterBand(1).GetBlockSize()
+    for xoff, yoff, xsize, ysize in [
+        (0, 0, ds.RasterXSize, ds.RasterYSize),
+        (0, blockysize, ds.RasterXSize, 2 * blockysize),
+        (0, blockysize, ds.RasterXSize, ds.RasterYSize - blockysize),
+        (
+            blockxsize if blockxsize < ds.RasterXSize else 0,
+            0,
+            ds.RasterXSize - (blockxsize if blockxsize < ds.RasterXSize else 0),
+            ds.RasterYSize,
+        ),
+    ]:
+        assert ds.ReadRaster(xoff, yoff, xsize, ysize) == ref_ds.ReadRaster(
+            xoff, yoff, xsize, ysize
+        )
+        assert ds.ReadRaster(
+            xoff,
+            yoff,
+            xsize,
+            ysize,
+            buf_pixel_space=nbands * pixel_size,
+            buf_band_space=pixel_size,
+        ) == ref_ds.ReadRaster(
+            xoff,
+            yoff,
+            xsize,
+            ysize,
+            buf_pixel_space=nbands * pixel_size,
+            buf_band_space=pixel_size,
+        )
+        assert ds.ReadRaster(
+            xoff, yoff, xsize, ysize, buf_type=gdal.GDT_Float32
+        ) == ref_ds.ReadRaster(xoff, yoff, xsize, ysize, buf_type=gdal.GDT_Float32)
+        for i in range(1, 1 + nbands):
+            assert ds.GetRasterBand(i).ReadRaster(
+                xoff, yoff, xsize, ysize
+            ) == ref_ds.GetRasterBand(i).ReadRaster(xoff, yoff, xsize, ysize)
+
+
+###############################################################################
+# Test that multi-threaded reading of windows aligned on tiles/strips, in
+# update mode, takes into account dirty blocks of the block cache
+
+
+@pytest.mark.parametrize("compress", ["NONE", "DEFLATE"])
+def test_tiff_read_multi_threaded_block_aligned_windows_update(tmp_vsimem, compress):
+
+    tmpfile = tmp_vsimem / "test_tiff_read_multi_threaded_block_aligned_update.tif"
+    ds = gdal.GetDriverByName("GTiff").Create(
+        tmpfile,
+        64,
+        64,
+        1,
+        options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "COMPRESS=" + compress],
+    )
+    ds.GetRasterBand(1).Fill(1)
+    ds = None
+
+    ds = gdal.OpenEx(tmpfile, gdal.OF_UPDATE, open_options=["NUM_THREADS=2"])
+    band = ds.GetRasterBand(1)
+    # Block by block read/modify/write loop, reading each time a window of
+    # 2 tiles so that the multi-threaded code path is used.
+    for yoff in range(0, 64, 16):
+        for xoff in range(0, 64, 32):
+            data = band.ReadRaster(xoff, yoff, 32, 16)
+            assert data == b"\x01" * (32 * 16)
+            band.WriteRaster(xoff, yoff, 1, 1, b"\x02")
+            data = band.ReadRaster(xoff, yoff, 32, 16)
+            assert data == b"\x02" + b"\x01" * (32 * 16 - 1)
+            band.WriteRaster(xoff, yoff, 1, 1, b"\x01")
+    ds = None
+
+    ds = gdal.Open(tmpfile)
+    assert ds.GetRasterBand(1).ReadRaster() == b"\x01" * (64 * 64)
+    ds = None
+
+
 ###############################################################################
 # Test multi-threaded decoding with /vsicurl
 
@@ -11,6 +11,8 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import os
+import re
 import sys
 import time
 
@@ -1678,3 +1680,312 @@ def test_vsicurl_GDAL_HTTP_MAX_TOTAL_CONNECTIONS(server):
         full_filename = f"/vsicurl/http://localhost:{server.port}/test.bin"
         statres = gdal.VSIStatL(full_filename)
         assert statres.size == 3
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_READ_AHEAD with sequential and strided reads
+
+
+class ReadAheadRecordingHandler(webserver.FileHandler):
+    """FileHandler recording the start offset of the Range of GET requests,
+    together with the index of the read request in progress (or last
+    issued) by the test at that time."""
+
+    def __init__(self, _dict):
+        super().__init__(_dict)
+        self.current_read = -1
+        self.gets = []
+
+    def do_GET(self, request):
+        res = re.search(r"bytes=(\d+)\-(\d+)", request.headers.get("Range", ""))
+        if res:
+            self.gets.append((int(res.group(1)), int(res.group(2)), self.current_read))
+        super().do_GET(request)
+
+    def prefetched_gets(self, read_ranges):
+        """Return the GET requests starting after the end of the range of the
+        read request in progress. Those can only come from read-ahead."""
+        return [
+            (start, end)
+            for start, end, current_read in self.gets
+            if current_read >= 0 and start >= read_ranges[current_read][1]
+        ]
+
+
+@pytest.mark.parametrize("read_ahead", [True, False])
+@pytest.mark.parametrize("pattern", ["sequential", "strided"])
+def test_vsicurl_read_ahead(server, pattern, read_ahead):
+
+    gdal.VSICurlClearCache()
+
+    content = bytes(i % 251 for i in range(1024 * 1024))
+    handler = ReadAheadRecordingHandler({"/test.bin": content})
+    options = {
+        "CPL_VSIL_CURL_READ_AHEAD": "YES" if read_ahead else "NO",
+        "CPL_VSIL_CURL_CHUNK_SIZE": "4096",
+    }
+    if pattern == "sequential":
+        read_ranges = [(offset, offset + 1000) for offset in range(0, 200000, 1000)]
+    else:
+        read_ranges = [
+            (offset, offset + 3000) for offset in range(100, len(content), 50000)
+        ]
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        f = gdal.VSIFOpenL(f"/vsicurl/http://localhost:{server.port}/test.bin", "rb")
+        assert f
+        try:
+            for idx, (start, end) in enumerate(read_ranges):
+                handler.current_read = idx
+                gdal.VSIFSeekL(f, start, 0)
+                assert gdal.VSIFReadL(1, end - start, f) == content[start:end]
+        finally:
+            gdal.VSIFCloseL(f)
+
+    # Each GET request must be a range of the file
+    assert handler.gets
+    for start, end, _ in handler.gets:
+        assert start <= end < len(content)
+
+    prefetched = handler.prefetched_gets(read_ranges)
+    if read_ahead:
+        # Some ranges must have been fetched before being read
+        assert prefetched, handler.gets
+        if pattern == "strided":
+            # and they must be aligned on the chunk size
+            for start, end in prefetched:
+                assert start % 4096 == 0, (start, end)
+            # Without read-ahead, there is one GET per read request, or two
+            # when the read spans two chunks and the first one is cached.
+            # With it, subsequent reads are served from the cache.
+            synchronous_gets = [
+                (start, end, current_read)
+                for start, end, current_read in handler.gets
+                if (start, end) not in prefetched
+            ]
+            assert len(synchronous_gets) < len(read_ranges), handler.gets
+    else:
+        # Without read-ahead, GET requests are only issued for the data being
+        # read
+        assert not prefetched, handler.gets
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_READ_AHEAD with a tiled GeoTIFF read by rows of tiles
+# (exercises ReadMultiRange())
+
+
+@pytest.mark.require_driver("GTiff")
+@pytest.mark.parametrize("read_ahead", [True, False])
+def test_vsicurl_read_ahead_rows_of_tiles(server, tmp_vsimem, read_ahead):
+
+    gdal.VSICurlClearCache()
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 512, 512)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, 512, 512, bytes(i % 253 for i in range(512 * 512))
+    )
+    tmpfilename = str(tmp_vsimem / "test.tif")
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfilename, src_ds, options=["TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"]
+    )
+
+    # Byte range of the tiles of each row of tiles
+    row_ranges = []
+    with gdal.Open(tmpfilename) as ds:
+        band = ds.GetRasterBand(1)
+        for y in range(16):
+            offsets = [
+                int(band.GetMetadataItem(f"BLOCK_OFFSET_{x}_{y}", "TIFF"))
+                for x in range(16)
+            ]
+            sizes = [
+                int(band.GetMetadataItem(f"BLOCK_SIZE_{x}_{y}", "TIFF"))
+                for x in range(16)
+            ]
+            row_ranges.append(
+                (min(offsets), max(o + s for o, s in zip(offsets, sizes)))
+            )
+
+    handler = ReadAheadRecordingHandler(
+        {"/test.tif": gdal.VSIFile(tmpfilename).read()}
+    )
+    options = {
+        "CPL_VSIL_CURL_READ_AHEAD": "YES" if read_ahead else "NO",
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        ds = gdal.Open(f"/vsicurl/http://localhost:{server.port}/test.tif")
+        for y in range(16):
+            handler.current_read = y
+            assert ds.ReadRaster(0, y * 32, 512, 32) == src_ds.ReadRaster(
+                0, y * 32, 512, 32
+            )
+        ds.Close()
+
+    # GET requests, issued while reading a row of tiles, that start in the
+    # data of a later row of tiles
+    prefetched = [
+        (start, end)
+        for start, end, current_read in handler.gets
+        if current_read >= 0
+        and any(
+            row_ranges[y][0] <= start < row_ranges[y][1]
+            for y in range(current_read + 1, 16)
+        )
+    ]
+    if read_ahead:
+        assert prefetched, handler.gets
+    else:
+        assert not prefetched, handler.gets
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    options = {
+        "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path / "cache"),
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+    url = f"/vsicurl/http://localhost:{server.port}/test_disk_cache.bin"
+
+    def read():
+        f = gdal.VSIFOpenL(url, "rb")
+        assert f
+        try:
+            return gdal.VSIFReadL(1, 3, f)
+        finally:
+            gdal.VSIFCloseL(f)
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag1"'},
+    )
+    handler.add("GET", "/test_disk_cache.bin", 200, {}, "foo")
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"foo"
+
+    assert len(gdal.ReadDir(str(tmp_path / "cache"))) == 1
+
+    # Simulate a new process: the content comes from the disk cache
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag1"'},
+    )
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"foo"
+
+    # The remote file has changed: its content is fetched again
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag2"'},
+    )
+    handler.add("GET", "/test_disk_cache.bin", 200, {}, "bar")
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"bar"
+
+    cache_dir = tmp_path / "cache"
+
+    foreign_files = [cache_dir / "foreign.txt", cache_dir / "README"]
+
+    def cache_content():
+        return sorted(
+            f.read_bytes()
+            for f in cache_dir.iterdir()
+            if f.suffix != ".tmp" and f not in foreign_files
+        )
+
+    assert cache_content() == [b"bar", b"foo"]
+
+    # Make "foo" older than "bar", then read it again from the disk cache,
+    # which must make it the most recently used entry.
+    now = time.time()
+    for f in cache_dir.iterdir():
+        age = 100 if f.read_bytes() == b"foo" else 50
+        os.utime(f, (now - age, now - age))
+
+    # Simulate the temporary file of a write in progress by another process
+    tmp_file = cache_dir / "in_progress.12345_1.tmp"
+    tmp_file.write_bytes(b"in progress")
+    os.utime(tmp_file, (now - 1000, now - 1000))
+
+    # Files not created by the cache, in a directory shared with other uses,
+    # must never be removed, even if they are older and larger.
+    for f in foreign_files:
+        f.write_bytes(b"x" * 100)
+        os.utime(f, (now - 1000, now - 1000))
+
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag1"'},
+    )
+    with webserver.install_http_handler(handler), gdal.config_options(options):
+        assert read() == b"foo"
+
+    # Test that the size of the cache is bounded: the least recently used
+    # entry, "bar", is evicted.
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag3"'},
+    )
+    handler.add("GET", "/test_disk_cache.bin", 200, {}, "baz")
+    with webserver.install_http_handler(handler), gdal.config_options(
+        options
+    ), gdaltest.config_option("CPL_VSIL_CURL_DISK_CACHE_SIZE", "6"):
+        assert read() == b"baz"
+
+    assert cache_content() == [b"baz", b"foo"]
+    assert tmp_file.exists()
+    for f in foreign_files:
+        assert f.read_bytes() == b"x" * 100
+
+    # Even if it is larger than the maximum size, the entry that has just
+    # been written is not evicted.
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"etag4"'},
+    )
+    handler.add("GET", "/test_disk_cache.bin", 200, {}, "qux")
+    with webserver.install_http_handler(handler), gdal.config_options(
+        options
+    ), gdaltest.config_option("CPL_VSIL_CURL_DISK_CACHE_SIZE", "1"):
+        assert read() == b"qux"
+
+    assert cache_content() == [b"qux"]
+    assert tmp_file.exists()
+    for f in foreign_files:
+        assert f.read_bytes() == b"x" * 100
+
+    gdal.VSICurlClearCache()
@@ -1375,6 +1375,124 @@ def test_vrt_pixelfn_expression_coordinates_no_geotransform():
         gdal.Open(xml).ReadRaster()
 
 
+###############################################################################
+# Test expressions evaluated on whole lines of pixels
+
+
+def vrt_expression_lines_xml(expression, dialect, propagate_nodata):
+
+    expression = (
+        expression.replace("&", "&amp;").replace("<", "&lt;").replace(">", "&gt;")
+    )
+
+    return f"""
+    <VRTDataset rasterXSize="20" rasterYSize="20">
+      <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+        <NoDataValue>107</NoDataValue>
+        <PixelFunctionType>expression</PixelFunctionType>
+        <PixelFunctionArguments expression="{expression}" dialect="{dialect}"
+                                propagateNoData="{propagate_nodata}" />
+        <SimpleSource name="A">
+           <SourceFilename>data/byte.tif</SourceFilename>
+           <SourceBand>1</SourceBand>
+        </SimpleSource>
+        <SimpleSource name="B">
+           <SourceFilename>data/utmsmall.tif</SourceFilename>
+           <SourceBand>1</SourceBand>
+           <SrcRect xOff="0" yOff="0" xSize="20" ySize="20" />
+           <DstRect xOff="0" yOff="0" xSize="20" ySize="20" />
+        </SimpleSource>
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+
+@pytest.mark.parametrize(
+    "expression,dialects",
+    [
+        ("A * 2 - B / 3 + -A", None),
+        ("(A > 150) * (B - A) + (A <= 150) * abs(A - B)", None),
+        ("min(A, B, 180) + max(A, sqrt(B))", None),
+        ("A > 150 ? B : A - B", ["muparser"]),
+        ("A >= 140 && B != 107 || A == 255", ["muparser"]),
+        ("A == NODATA ? 0 : (A == B ? nan : A)", ["muparser"]),
+    ],
+)
+@pytest.mark.parametrize("dialect", ("exprtk", "muparser"))
+@pytest.mark.parametrize("propagate_nodata", (False, True))
+def test_vrt_pixelfn_expression_lines(expression, dialects, dialect, propagate_nodata):
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    if not gdaltest.gdal_has_vrt_expression_dialect(dialect):
+        pytest.skip(f"Expression dialect {dialect} is not available")
+
+    if dialects and dialect not in dialects:
+        pytest.skip(f"Expression not supported for dialect {dialect}")
+
+    with gdal.Open("data/byte.tif") as ds:
+        a = ds.ReadAsArray().astype(np.float64)
+    with gdal.Open("data/utmsmall.tif") as ds:
+        b = ds.ReadAsArray(0, 0, 20, 20).astype(np.float64)
+
+    with np.errstate(invalid="ignore"):
+        if expression == "A * 2 - B / 3 + -A":
+            expected = a * 2 - b / 3 + -a
+        elif expression == "(A > 150) * (B - A) + (A <= 150) * abs(A - B)":
+            expected = (a > 150) * (b - a) + (a <= 150) * np.abs(a - b)
+        elif expression == "min(A, B, 180) + max(A, sqrt(B))":
+            expected = np.minimum(np.minimum(a, b), 180) + np.maximum(a, np.sqrt(b))
+        elif expression == "A > 150 ? B : A - B":
+            expected = np.where(a > 150, b, a - b)
+        elif expression == "A >= 140 && B != 107 || A == 255":
+            expected = (((a >= 140) & (b != 107)) | (a == 255)).astype(np.float64)
+        else:
+            expected = np.where(a == 107, 0, np.where(a == b, np.nan, a))
+
+    if propagate_nodata:
+        expected[(a == 107) | (b == 107)] = 107
+
+    with gdal.Open(
+        vrt_expression_lines_xml(expression, dialect, propagate_nodata)
+    ) as ds:
+        np.testing.assert_array_equal(ds.ReadAsArray(), expected)
+
+
+###############################################################################
+# Test that deeply nested expressions are left to the regular evaluators
+# instead of exhausting the stack
+
+
+@pytest.mark.parametrize("dialect", ("exprtk", "muparser"))
+def test_vrt_pixelfn_expression_lines_deeply_nested(dialect):
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    if not gdaltest.gdal_has_vrt_expression_dialect(dialect):
+        pytest.skip(f"Expression dialect {dialect} is not available")
+
+    with gdal.Open("data/byte.tif") as ds:
+        a = ds.ReadAsArray().astype(np.float64)
+
+    depth = 1001
+    expression = "-(" * depth + "A" + ")" * depth
+
+    with gdal.Open(vrt_expression_lines_xml(expression, dialect, False)) as ds:
+        if dialect == "muparser":
+            np.testing.assert_array_equal(ds.ReadAsArray(), -a)
+        else:
+            # exprtk may reject the expression as too deep, which is fine as
+            # long as it does not crash
+            with gdal.quiet_errors():
+                try:
+                    data = ds.ReadAsArray()
+                except Exception:
+                    data = None
+            if data is not None:
+                np.testing.assert_array_equal(data, -a)
+
+
 ###############################################################################
 # Test multiplication / summation by a constant factor
 
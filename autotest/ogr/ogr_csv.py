@@ -3606,6 +3606,69 @@ def test_ogr_csv_creation_illegal_layer_name(tmp_vsimem):
         ds.CreateLayer("illegal/with/slash")
 
 
+###############################################################################
+# Test multi-threaded reading
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_csv_multi_threaded_reading(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.csv")
+    N = 20000
+    with gdaltest.vsi_open(filename, "wb") as f:
+        f.write(b"id,x,y,comment\n")
+        for i in range(N):
+            if i % 1000 == 1:
+                f.write(b'%d,%d,%d,"multi\nline, ""quoted"""\n' % (i, i % 100, i))
+            elif i % 1000 == 2:
+                # empty line, skipped
+                f.write(b"\n%d,%d,%d,\n" % (i, i % 100, i))
+            else:
+                f.write(b"%d,%d,%d,foo\n" % (i, i % 100, i))
+
+    with gdaltest.config_option("OGR_CSV_NUM_THREADS", num_threads):
+        ds = gdal.OpenEx(
+            filename,
+            gdal.OF_VECTOR,
+            open_options=["X_POSSIBLE_NAMES=x", "Y_POSSIBLE_NAMES=y"],
+        )
+        lyr = ds.GetLayer(0)
+        for i, f in enumerate(lyr):
+            assert f.GetFID() == i + 1
+            assert f["id"] == str(i)
+            if i % 1000 == 1:
+                assert f["comment"] == 'multi\nline, "quoted"'
+            elif i % 1000 == 2:
+                assert f["comment"] == ""
+            else:
+                assert f["comment"] == "foo"
+            assert f.GetGeometryRef().GetX() == i % 100
+            assert f.GetGeometryRef().GetY() == i
+        assert i == N - 1
+
+        lyr.SetAttributeFilter("id IN ('5', '15001')")
+        assert [f["id"] for f in lyr] == ["5", "15001"]
+        lyr.SetAttributeFilter(None)
+
+        lyr.SetSpatialFilterRect(49.5, 15048.5, 50.5, 15050.5)
+        assert [f.GetFID() for f in lyr] == [15051]
+        lyr.SetSpatialFilter(None)
+
+        assert lyr.GetFeature(15000)["id"] == "14999"
+        lyr.ResetReading()
+        assert lyr.GetNextFeature().GetFID() == 1
+
+        stream = lyr.GetArrowStream()
+        count = 0
+        while True:
+            array = stream.GetNextRecordBatch()
+            if array is None:
+                break
+            count += array.GetLength()
+        assert count == N
+
+
 ###############################################################################
 
 
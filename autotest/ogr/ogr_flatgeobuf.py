@@ -13,6 +13,8 @@
 ###############################################################################
 
 import os
+import re
+import struct
 from http.server import BaseHTTPRequestHandler
 
 import gdaltest
@@ -1150,6 +1152,166 @@ def test_ogr_flatgeobuf_arrow_stream_numpy(layer_creation_options):
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test multi-threaded decoding of geometries in GetArrowStream()
+
+
+@pytest.mark.parametrize(
+    "layer_creation_options",
+    [[], ["SPATIAL_INDEX=NO"]],
+    ids=["regular", "no_spatial_index"],
+)
+@pytest.mark.parametrize("spatial_filter", [False, True])
+def test_ogr_flatgeobuf_arrow_stream_multi_threaded_decoding(
+    tmp_vsimem, layer_creation_options, spatial_filter
+):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer(
+        "test", geom_type=ogr.wkbLineString, options=layer_creation_options
+    )
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        x = i % 37
+        y = i // 37
+        f.SetGeometryDirectly(
+            ogr.CreateGeometryFromWkt(f"LINESTRING({x} {y},{x + 0.5} {y + 0.5})")
+        )
+        lyr.CreateFeature(f)
+    ds = None
+
+    def get_features(num_threads):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        if spatial_filter:
+            lyr.SetSpatialFilterRect(5.1, 5.1, 20.2, 20.2)
+        with gdaltest.config_option("OGR_FLATGEOBUF_NUM_THREADS", str(num_threads)):
+            stream = lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=77"]
+            )
+            ret = []
+            for batch in stream:
+                assert len(batch["id"]) <= 77
+                for fid, id, wkb in zip(
+                    batch["OGC_FID"], batch["id"], batch["wkb_geometry"]
+                ):
+                    ret.append((fid, id, bytes(wkb)))
+        return ret
+
+    expected = get_features(1)
+    assert len(expected) == (16 * 16 if spatial_filter else 1000)
+    assert get_features(4) == expected
+
+
+###############################################################################
+# Test that the features found by a spatial filter on /vsicurl/ are fetched
+# with a few merged range requests
+
+
+class RangeRecordingHandler(webserver.FileHandler):
+    """FileHandler recording the Range of GET requests."""
+
+    def __init__(self, _dict):
+        super().__init__(_dict)
+        self.gets = []
+
+    def do_GET(self, request):
+        res = re.search(r"bytes=(\d+)\-(\d+)", request.headers.get("Range", ""))
+        if res:
+            self.gets.append((int(res.group(1)), int(res.group(2))))
+        super().do_GET(request)
+
+
+def test_ogr_flatgeobuf_spatial_filter_vsicurl_advise_read(server, tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    # 4 clusters of 100 features of about 1 KB each, at the corners of the
+    # extent. In Hilbert order, the lower left cluster comes first and the
+    # lower right one last.
+    for x, y in [(0, 0), (0, 100), (100, 100), (100, 0)]:
+        for i in range(100):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["str"] = "x" * 1000
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT ({x} {y})"))
+            lyr.CreateFeature(f)
+    ds = None
+
+    content = gdal.VSIFile(filename).read()
+
+    # Compute the offset of each feature from the file layout: magic bytes,
+    # header, packed R-tree and size prefixed features
+    (header_size,) = struct.unpack("<I", content[8:12])
+    n = num_nodes = 400
+    while n != 1:
+        n = (n + 15) // 16
+        num_nodes += n
+    features_start = 12 + header_size + num_nodes * 40
+    offsets = []
+    pos = features_start
+    while pos < len(content):
+        offsets.append(pos)
+        (size,) = struct.unpack("<I", content[pos : pos + 4])
+        pos += 4 + size
+    assert len(offsets) == 400
+    offsets.append(len(content))
+
+    def set_filter(lyr):
+        # Select the lower left and lower right clusters
+        lyr.SetSpatialFilterRect(-1, -1, 101, 1)
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    set_filter(lyr)
+    expected_fids = [f.GetFID() for f in lyr]
+    ds = None
+    assert len(expected_fids) == 200
+
+    # Features whose start offsets are less than 64 KB apart are merged
+    expected_ranges = []
+    for fid in expected_fids:
+        if expected_ranges and offsets[fid] - offsets[last_fid] <= 65536:
+            expected_ranges[-1][1] = offsets[fid + 1] - 1
+        else:
+            expected_ranges.append([offsets[fid], offsets[fid + 1] - 1])
+        last_fid = fid
+    expected_ranges = [tuple(x) for x in expected_ranges]
+    assert len(expected_ranges) == 2
+
+    gdal.VSICurlClearCache()
+    handler = RangeRecordingHandler({"/test.fgb": content})
+    options = {
+        "CPL_VSIL_CURL_READ_AHEAD": "NO",
+        "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+    }
+    try:
+        with webserver.install_http_handler(handler), gdal.config_options(options):
+            ds = ogr.Open(f"/vsicurl/http://localhost:{server.port}/test.fgb")
+            lyr = ds.GetLayer(0)
+            set_filter(lyr)
+            assert [f.GetFID() for f in lyr] == expected_fids
+            ds = None
+    finally:
+        gdal.VSICurlClearCache()
+
+    # One request per merged range, and no other request for the features
+    for expected_range in expected_ranges:
+        assert expected_range in handler.gets
+    for start, end in handler.gets:
+        if (start, end) not in expected_ranges:
+            assert not any(
+                range_start <= start <= range_end
+                for range_start, range_end in expected_ranges
+            ), (start, end)
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
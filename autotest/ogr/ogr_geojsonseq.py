@@ -522,3 +522,71 @@ def test_ogr_geojsonseq_WRITE_BBOX(tmp_vsimem):
     gdal.VSIFCloseL(f)
 
     assert b'"bbox": [ 2.0, 49.0, 3.0, 50.0 ]' in data
+
+
+###############################################################################
+# Test multi-threaded reading
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_geojsonseq_multi_threaded_reading(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.geojsonl")
+    ds = gdal.GetDriverByName("GeoJSONSeq").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    for i in range(5000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["val"] = i
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i % 100} {i // 100})"))
+        lyr.CreateFeature(f)
+    ds.Close()
+
+    with gdaltest.config_option("OGR_GEOJSONSEQ_NUM_THREADS", num_threads):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 5000
+        for i, f in enumerate(lyr):
+            assert f.GetFID() == i
+            assert f["val"] == i
+            assert f.GetGeometryRef().ExportToWkt() == f"POINT ({i % 100} {i // 100})"
+        assert i == 4999
+
+        lyr.SetAttributeFilter("val >= 4990")
+        assert [f["val"] for f in lyr] == list(range(4990, 5000))
+
+        lyr.SetAttributeFilter(None)
+        lyr.SetSpatialFilterRect(-0.5, 9.5, 0.5, 10.5)
+        assert [f["val"] for f in lyr] == [1000]
+
+
+###############################################################################
+# Test limiting the first pass
+
+
+@pytest.mark.parametrize(
+    "config_option,config_value",
+    [
+        ("OGR_GEOJSON_MAX_FEATURES_FIRST_PASS", "2"),
+        ("OGR_GEOJSON_MAX_BYTES_FIRST_PASS", "10"),
+    ],
+)
+def test_ogr_geojsonseq_limit_first_pass(tmp_vsimem, config_option, config_value):
+
+    filename = str(tmp_vsimem / "test.geojsonl")
+    gdal.FileFromMemBuffer(
+        filename,
+        """{"type":"Feature","properties":{"a":1},"geometry":null}
+{"type":"Feature","properties":{"a":2},"geometry":null}
+{"type":"Feature","properties":{"a":3,"b":"x"},"geometry":null}
+""",
+    )
+
+    with gdaltest.config_option(config_option, config_value):
+        ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetLayerDefn().GetFieldCount() == 1
+    assert lyr.TestCapability(ogr.OLCFastFeatureCount) == 0
+    assert lyr.GetFeatureCount() == 3
+    assert lyr.TestCapability(ogr.OLCFastFeatureCount) == 1
+    assert [f["a"] for f in lyr] == [1, 2, 3]
@@ -8499,6 +8499,81 @@ def test_ogr_gpkg_arrow_stream_numpy_multi_threading(
     assert i == num_features
 
 
+###############################################################################
+# Test multi-threaded Arrow interface on a table with holes in FID numbering
+
+
+@pytest.mark.parametrize(
+    "num_features,delete_modulo,batch_size,num_threads",
+    [
+        (1000, 3, 100, 1),
+        (1000, 3, 100, 3),
+        (1000, 7, 50, 4),
+        # More than half of the FIDs are missing: not the FID range code path
+        (1000, 1, 100, 3),
+    ],
+)
+def test_ogr_gpkg_arrow_stream_numpy_multi_threading_fid_holes(
+    tmp_vsimem, num_features, delete_modulo, batch_size, num_threads
+):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+
+    ds.StartTransaction()
+    for i in range(num_features):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+    ds.CommitTransaction()
+
+    # Delete the first features and a whole batch to get empty FID ranges
+    expected_fids = []
+    for fid in range(1, num_features + 1):
+        if (
+            fid < 10
+            or (fid > 2 * batch_size and fid <= 3 * batch_size)
+            or (fid % 2 == 0 if delete_modulo == 1 else fid % delete_modulo == 0)
+        ):
+            lyr.DeleteFeature(fid)
+        else:
+            expected_fids.append(fid)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    with gdaltest.config_option("OGR_GPKG_NUM_THREADS", str(num_threads)):
+        stream = lyr.GetArrowStreamAsNumPy(
+            options=["USE_MASKED_ARRAYS=NO", f"MAX_FEATURES_IN_BATCH={batch_size}"]
+        )
+
+    got_msg = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass != gdal.CE_Debug:
+            got_msg.append(msg)
+        return
+
+    with gdaltest.error_handler(my_handler):
+        batches = [batch for batch in stream]
+
+    assert len(got_msg) == 0
+
+    got_fids = []
+    for batch in batches:
+        assert len(batch["fid"]) > 0
+        assert len(batch["fid"]) <= batch_size
+        for fid, wkb in zip(batch["fid"], batch["geom"]):
+            i = fid - 1
+            assert ogr.CreateGeometryFromWkb(wkb).ExportToIsoWkt() == f"POINT ({i} {i})"
+            got_fids.append(fid)
+    assert got_fids == expected_fids
+
+
 ###############################################################################
 # Test Arrow interface with bool fields
 
@@ -27,6 +27,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -546,3 +547,206 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test that the hash join gives the same results as the per-feature queries
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        {"OGR_SQL_JOIN_HASH": "NO"},
+        {"OGR_SQL_JOIN_HASH": "YES"},
+        {"OGR_SQL_JOIN_HASH": "YES", "OGR_SQL_JOIN_HASH_MAX_MEMORY": "0"},
+    ],
+)
+def test_ogr_join_hash(options):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr1 = ds.CreateLayer("lyr1")
+    lyr1.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger))
+    lyr1.CreateField(ogr.FieldDefn("real_key", ogr.OFTReal))
+    lyr1.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    for int_key, real_key, str_key in [
+        (1, 1.0, "a"),
+        (2, 2.5, "B"),
+        (3, None, "c"),
+        (None, 4.0, None),
+        (5, -0.0, "e"),
+    ]:
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        f["int_key"] = int_key
+        f["real_key"] = real_key
+        f["str_key"] = str_key
+        lyr1.CreateFeature(f)
+
+    lyr2 = ds.CreateLayer("lyr2")
+    lyr2.CreateField(ogr.FieldDefn("int64_key", ogr.OFTInteger64))
+    lyr2.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    lyr2.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for int64_key, str_key, val in [
+        (2, "b", "first_2"),
+        (2, "B", "second_2"),
+        (1, "A", "first_1"),
+        (None, None, "null"),
+        (0, "E", "zero"),
+        (4, "x", "four"),
+    ]:
+        f = ogr.Feature(lyr2.GetLayerDefn())
+        f["int64_key"] = int64_key
+        f["str_key"] = str_key
+        f["val"] = val
+        lyr2.CreateFeature(f)
+
+    with gdal.config_options(options):
+        with ds.ExecuteSQL(
+            "SELECT lyr1.int_key, lyr2.val FROM lyr1 "
+            "LEFT JOIN lyr2 ON lyr1.int_key = lyr2.int64_key"
+        ) as sql_lyr:
+            assert [f["val"] for f in sql_lyr] == [
+                "first_1",
+                "first_2",
+                None,
+                None,
+                None,
+            ]
+
+        with ds.ExecuteSQL(
+            "SELECT lyr1.real_key, lyr2.val FROM lyr1 "
+            "LEFT JOIN lyr2 ON lyr2.int64_key = lyr1.real_key"
+        ) as sql_lyr:
+            assert [f["val"] for f in sql_lyr] == [
+                "first_1",
+                None,
+                None,
+                "four",
+                "zero",
+            ]
+
+        with ds.ExecuteSQL(
+            "SELECT lyr1.str_key, lyr2.val FROM lyr1 "
+            "LEFT JOIN lyr2 ON lyr1.str_key = lyr2.str_key"
+        ) as sql_lyr:
+            assert [f["val"] for f in sql_lyr] == [
+                "first_1",
+                "first_2",
+                None,
+                None,
+                "zero",
+            ]
+
+
+###############################################################################
+# Test that the hash join compares strings with the same case sensitivity as
+# the attribute filter of the secondary layer, and that AUTO mode leaves the
+# queries to a database driver.
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("join_hash", ["NO", "YES", "AUTO"])
+def test_ogr_join_hash_gpkg_case_sensitive(tmp_path, join_hash):
+
+    filename = str(tmp_path / "test_ogr_join_hash_gpkg_case_sensitive.gpkg")
+    with ogr.GetDriverByName("GPKG").CreateDataSource(filename) as ds:
+        lyr1 = ds.CreateLayer("lyr1", geom_type=ogr.wkbNone)
+        lyr1.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+        for str_key in ["a", "B", "c"]:
+            f = ogr.Feature(lyr1.GetLayerDefn())
+            f["str_key"] = str_key
+            lyr1.CreateFeature(f)
+
+        lyr2 = ds.CreateLayer("lyr2", geom_type=ogr.wkbNone)
+        lyr2.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+        lyr2.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+        for str_key, val in [("b", "lower_b"), ("B", "upper_b"), ("A", "upper_a")]:
+            f = ogr.Feature(lyr2.GetLayerDefn())
+            f["str_key"] = str_key
+            f["val"] = val
+            lyr2.CreateFeature(f)
+
+    messages = []
+
+    def handler(ecls, ecode, emsg):
+        if "Using hash join" in emsg:
+            messages.append(emsg)
+
+    with ogr.Open(filename) as ds, gdaltest.config_options(
+        {"OGR_SQL_JOIN_HASH": join_hash, "CPL_DEBUG": "ON"}
+    ), gdaltest.error_handler(handler):
+        with ds.ExecuteSQL(
+            "SELECT lyr1.str_key, lyr2.val FROM lyr1 "
+            "LEFT JOIN lyr2 ON lyr1.str_key = lyr2.str_key",
+            dialect="OGRSQL",
+        ) as sql_lyr:
+            # SQLite compares strings case-sensitively
+            assert [f["val"] for f in sql_lyr] == [None, "upper_b", None]
+
+    if join_hash == "YES":
+        assert len(messages) == 1, messages
+    else:
+        assert not messages
+
+
+###############################################################################
+# Test that the hash table is kept from one iteration to the next, and only
+# rebuilt when the secondary layer changes.
+
+
+def test_ogr_join_hash_rebuilt_on_change():
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr1 = ds.CreateLayer("lyr1")
+    lyr1.CreateField(ogr.FieldDefn("key", ogr.OFTInteger))
+    for key in [1, 2]:
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        f["key"] = key
+        lyr1.CreateFeature(f)
+
+    lyr2 = ds.CreateLayer("lyr2")
+    lyr2.CreateField(ogr.FieldDefn("key", ogr.OFTInteger))
+    lyr2.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    f = ogr.Feature(lyr2.GetLayerDefn())
+    f["key"] = 1
+    f["val"] = "one"
+    lyr2.CreateFeature(f)
+
+    messages = []
+
+    def handler(ecls, ecode, emsg):
+        if "hash join" in emsg:
+            messages.append(emsg)
+
+    with gdaltest.config_options(
+        {"OGR_SQL_JOIN_HASH": "AUTO", "CPL_DEBUG": "ON"}
+    ), gdaltest.error_handler(handler):
+        with ds.ExecuteSQL(
+            "SELECT lyr2.val FROM lyr1 LEFT JOIN lyr2 ON lyr1.key = lyr2.key"
+        ) as sql_lyr:
+            assert [f["val"] for f in sql_lyr] == ["one", None]
+            sql_lyr.ResetReading()
+            assert [f["val"] for f in sql_lyr] == ["one", None]
+            assert len(messages) == 1, messages
+
+            # Update of a feature
+            f = lyr2.GetFeature(1)
+            f["val"] = "ONE"
+            lyr2.SetFeature(f)
+            sql_lyr.ResetReading()
+            assert [f["val"] for f in sql_lyr] == ["ONE", None]
+            assert len(messages) == 3, messages
+
+            # Creation of a feature
+            f = ogr.Feature(lyr2.GetLayerDefn())
+            f["key"] = 2
+            f["val"] = "two"
+            lyr2.CreateFeature(f)
+            sql_lyr.ResetReading()
+            assert [f["val"] for f in sql_lyr] == ["ONE", "two"]
+            assert len(messages) == 5, messages
+
+            # Deletion of a feature
+            lyr2.DeleteFeature(1)
+            sql_lyr.ResetReading()
+            assert [f["val"] for f in sql_lyr] == [None, "two"]
+            assert len(messages) == 7, messages
@@ -1377,6 +1377,238 @@ def test_ogr_mem_arrow_stream_pyarrow_geoarrow_metadata():
         assert metadata["crs"]["id"] == {"authority": "EPSG", "code": 32631}
 
 
+###############################################################################
+# Test GEOMETRY_ENCODING=GEOARROW/GEOARROW_INTERLEAVED and writing back
+# GeoArrow native geometry columns with WriteArrowBatch()
+
+
+@pytest.mark.parametrize(
+    "geom_type,wkts",
+    [
+        (ogr.wkbPoint, ["POINT (1 2)", "POINT EMPTY"]),
+        (ogr.wkbLineString25D, ["LINESTRING Z (1 2 3,4 5 6)"]),
+        (
+            ogr.wkbPolygon,
+            ["POLYGON ((0 0,0 1,1 1,0 0),(0.2 0.2,0.2 0.3,0.3 0.3,0.2 0.2))"],
+        ),
+        (ogr.wkbMultiPoint, ["MULTIPOINT ((1 2),(3 4))", "POINT (5 6)"]),
+        (
+            ogr.wkbMultiLineStringM,
+            ["MULTILINESTRING M ((1 2 3,4 5 6),(7 8 9,10 11 12))"],
+        ),
+        (
+            ogr.wkbMultiPolygonZM,
+            ["MULTIPOLYGON ZM (((0 0 1 2,0 1 1 2,1 1 1 2,0 0 1 2)))"],
+        ),
+    ],
+)
+@pytest.mark.parametrize("encoding", ["GEOARROW", "GEOARROW_INTERLEAVED"])
+def test_ogr_mem_arrow_stream_geoarrow_encoding(geom_type, wkts, encoding):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    src_lyr = ds.CreateLayer("src_lyr", geom_type=geom_type)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i, wkt in enumerate(wkts + [None]):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    dst_lyr = ds.CreateLayer("dst_lyr", geom_type=geom_type)
+
+    stream = src_lyr.GetArrowStream(
+        ["INCLUDE_FID=NO", "GEOMETRY_ENCODING=" + encoding]
+    )
+    schema = stream.GetSchema()
+
+    for i in range(schema.GetChildrenCount()):
+        if schema.GetChild(i).GetName() != "wkb_geometry":
+            dst_lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        assert dst_lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+
+    assert dst_lyr.GetFeatureCount() == src_lyr.GetFeatureCount()
+    for src_f, dst_f in zip(src_lyr, dst_lyr):
+        assert dst_f["id"] == src_f["id"]
+        src_g = src_f.GetGeometryRef()
+        dst_g = dst_f.GetGeometryRef()
+        if src_g is None:
+            assert dst_g is None
+        else:
+            expected_g = ogr.ForceTo(src_g.Clone(), geom_type)
+            assert dst_g.ExportToIsoWkt() == expected_g.ExportToIsoWkt()
+
+    check_geoarrow_schema(src_lyr, geom_type, encoding)
+
+
+def get_arrow_formats(pa, field):
+    """Return the Arrow formats of the nested types of a field, from the
+    outermost one."""
+
+    formats = []
+    field_type = getattr(field.type, "storage_type", field.type)
+    while pa.types.is_list(field_type):
+        formats.append("+l")
+        field_type = field_type.value_type
+    if pa.types.is_fixed_size_list(field_type):
+        formats.append(f"+w:{field_type.list_size}")
+    elif pa.types.is_struct(field_type):
+        formats.append("+s")
+    else:
+        formats.append(str(field_type))
+    return formats
+
+
+def get_arrow_extension_name(field):
+    if hasattr(field.type, "extension_name"):
+        return field.type.extension_name
+    return field.metadata[b"ARROW:extension:name"].decode("utf-8")
+
+
+def check_geoarrow_schema(lyr, geom_type, encoding):
+    """Check the schema of the geometry column returned with
+    GEOMETRY_ENCODING=encoding."""
+
+    pa = pytest.importorskip("pyarrow")
+
+    extension_name, list_levels = {
+        ogr.wkbPoint: ("geoarrow.point", 0),
+        ogr.wkbLineString: ("geoarrow.linestring", 1),
+        ogr.wkbPolygon: ("geoarrow.polygon", 2),
+        ogr.wkbMultiPoint: ("geoarrow.multipoint", 1),
+        ogr.wkbMultiLineString: ("geoarrow.multilinestring", 2),
+        ogr.wkbMultiPolygon: ("geoarrow.multipolygon", 3),
+    }[ogr.GT_Flatten(geom_type)]
+    dim = 2
+    if ogr.GT_HasZ(geom_type):
+        dim += 1
+    if ogr.GT_HasM(geom_type):
+        dim += 1
+    expected_formats = ["+l"] * list_levels
+    if encoding == "GEOARROW_INTERLEAVED":
+        expected_formats.append(f"+w:{dim}")
+    else:
+        expected_formats.append("+s")
+
+    stream = lyr.GetArrowStreamAsPyArrow(["GEOMETRY_ENCODING=" + encoding])
+    field = stream.schema.field("wkb_geometry")
+    assert get_arrow_extension_name(field) == extension_name
+    assert get_arrow_formats(pa, field) == expected_formats
+
+
+###############################################################################
+# Test GeoArrow encoding of layers mixing single and multi geometries
+
+
+@pytest.mark.parametrize("encoding", ["GEOARROW", "GEOARROW_INTERLEAVED"])
+@pytest.mark.parametrize(
+    "geom_type,wkts,expected_wkts,expected_warning",
+    [
+        (
+            ogr.wkbPolygon,
+            [
+                "POLYGON ((0 0,0 1,1 1,0 0))",
+                "MULTIPOLYGON (((1 1,1 2,2 2,1 1)))",
+                "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((5 5,5 6,6 6,5 5)))",
+                "MULTIPOLYGON EMPTY",
+            ],
+            [
+                "POLYGON ((0 0,0 1,1 1,0 0))",
+                "POLYGON ((1 1,1 2,2 2,1 1))",
+                None,
+                "POLYGON EMPTY",
+            ],
+            "cannot be converted",
+        ),
+        (
+            ogr.wkbMultiPolygon,
+            [
+                "POLYGON ((0 0,0 1,1 1,0 0))",
+                "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((5 5,5 6,6 6,5 5)))",
+            ],
+            [
+                "MULTIPOLYGON (((0 0,0 1,1 1,0 0)))",
+                "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((5 5,5 6,6 6,5 5)))",
+            ],
+            None,
+        ),
+        (
+            ogr.wkbLineString,
+            [
+                "MULTILINESTRING ((0 0,1 1))",
+                "MULTILINESTRING ((0 0,1 1),(2 2,3 3))",
+                "LINESTRING (2 2,3 3)",
+            ],
+            ["LINESTRING (0 0,1 1)", None, "LINESTRING (2 2,3 3)"],
+            "cannot be converted",
+        ),
+        (
+            ogr.wkbPoint,
+            ["MULTIPOINT ((1 2))", "MULTIPOINT ((1 2),(3 4))", "POINT (5 6)"],
+            ["POINT (1 2)", None, "POINT (5 6)"],
+            "cannot be converted",
+        ),
+        (
+            ogr.wkbLineString,
+            ["LINESTRING (0 0,1 1)", "LINESTRING ZM (0 0 1 2,1 1 3 4)"],
+            ["LINESTRING (0 0,1 1)", "LINESTRING (0 0,1 1)"],
+            "Z and/or M values of at least one geometry have been discarded",
+        ),
+    ],
+)
+def test_ogr_mem_arrow_stream_geoarrow_encoding_mixed_single_multi(
+    geom_type, wkts, expected_wkts, expected_warning, encoding
+):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    src_lyr = ds.CreateLayer("src_lyr", geom_type=geom_type)
+    for wkt in wkts:
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    dst_lyr = ds.CreateLayer("dst_lyr", geom_type=geom_type)
+
+    stream = src_lyr.GetArrowStream(["INCLUDE_FID=NO", "GEOMETRY_ENCODING=" + encoding])
+    schema = stream.GetSchema()
+    gdal.ErrorReset()
+    with gdal.quiet_errors():
+        array = stream.GetNextRecordBatch()
+    if expected_warning:
+        assert expected_warning in gdal.GetLastErrorMsg()
+    else:
+        assert gdal.GetLastErrorMsg() == ""
+    assert dst_lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+    assert stream.GetNextRecordBatch() is None
+
+    got_wkts = [
+        f.GetGeometryRef().ExportToIsoWkt() if f.GetGeometryRef() else None
+        for f in dst_lyr
+    ]
+    assert got_wkts == expected_wkts
+
+    check_geoarrow_schema(src_lyr, geom_type, encoding)
+
+
+###############################################################################
+# Test that geometry types without GeoArrow native encoding are returned as WKB
+
+
+def test_ogr_mem_arrow_stream_geoarrow_encoding_unsupported_type():
+    pa = pytest.importorskip("pyarrow")
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("foo", geom_type=ogr.wkbGeometryCollection)
+    stream = lyr.GetArrowStreamAsPyArrow(["GEOMETRY_ENCODING=GEOARROW"])
+    field_type = stream.schema.field("wkb_geometry").type
+    assert pa.types.is_binary(getattr(field_type, "storage_type", field_type))
+
+
 ###############################################################################
 # Test upserting a feature.
 
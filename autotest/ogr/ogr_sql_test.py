@@ -2234,3 +2234,110 @@ def test_ogr_sql_union_layer_feature_count_add_overflow():
             "select * from test union all select * from test2", dialect="OGRSQL"
         ) as sql_lyr:
             assert sql_lyr.GetFeatureCount() == 0
+
+
+###############################################################################
+# Test that compiled expressions evaluate like the generic evaluator
+
+
+@pytest.fixture(scope="module")
+def ds_for_test_ogr_sql_compile_expression(tmp_path_factory):
+
+    filename = str(tmp_path_factory.mktemp("tmp") / "compile_expression.fgb")
+    ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    values = [
+        (1, 1 << 40, 1.5, "foo", 1),
+        (2, -3, -0.5, "Bar", 0),
+        (None, None, None, None, None),
+        (3, 1 << 40, float("nan"), "", 1),
+        (-1, 0, 2.0, "bar", 0),
+    ]
+    for i, (v_int, v_int64, v_real, v_str, v_bool) in enumerate(values):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int"] = v_int
+        f["int64"] = v_int64
+        f["real"] = v_real
+        f["str"] = v_str
+        f["bool"] = v_bool
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} {i})"))
+        lyr.CreateFeature(f)
+    ds.Close()
+    return filename
+
+
+@pytest.mark.require_driver("FlatGeobuf")
+@pytest.mark.parametrize(
+    "where",
+    [
+        "int = 1",
+        "1 = int",
+        "int <> 1",
+        "int < 2",
+        "2 > int",
+        "int >= 2",
+        "int <= 2.5",
+        "int IN (1, 3)",
+        "int NOT IN (1, 3)",
+        "int BETWEEN 1 AND 2",
+        "int NOT BETWEEN 1 AND 2",
+        "int IS NULL",
+        "int IS NOT NULL",
+        "int64 = 1099511627776",
+        "int64 > 0",
+        "int64 IN (-3, 0)",
+        "real > 0",
+        "real = 1.5",
+        "real < 2",
+        "real BETWEEN -1 AND 1.5",
+        "real IN (2, 1.5)",
+        "str = 'bar'",
+        "str <> 'bar'",
+        "str >= 'c'",
+        "str IN ('foo', '')",
+        "str BETWEEN 'a' AND 'c'",
+        "str LIKE 'b%'",
+        "bool = 1",
+        "bool",
+        "NOT bool",
+        "NOT (int = 1)",
+        "int = 1 OR str = 'bar'",
+        "int > 1 AND real < 10",
+        "NOT (int > 1 AND real IS NOT NULL)",
+        "NOT (int = 1 OR int IS NULL)",
+        "int > 1 AND length(str) = 0",
+        "FID = 2 OR int = 1",
+    ],
+)
+@pytest.mark.parametrize("use_arrow", [False, True])
+def test_ogr_sql_compile_expression(
+    where, use_arrow, ds_for_test_ogr_sql_compile_expression
+):
+
+    if use_arrow:
+        gdaltest.importorskip_gdal_array()
+
+    def get_fids(lyr):
+        if use_arrow:
+            fids = []
+            for batch in lyr.GetArrowStreamAsNumPy():
+                fids += [int(fid) for fid in batch["OGC_FID"]]
+            return fids
+        return [f.GetFID() for f in lyr]
+
+    with ogr.Open(ds_for_test_ogr_sql_compile_expression) as ds:
+        lyr = ds.GetLayer(0)
+
+        with gdal.config_option("OGR_SQL_COMPILE_EXPRESSION", "NO"):
+            lyr.SetAttributeFilter(where)
+        expected_fids = get_fids(lyr)
+
+        lyr.SetAttributeFilter(where)
+        assert get_fids(lyr) == expected_fids
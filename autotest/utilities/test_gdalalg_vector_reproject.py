@@ -11,10 +11,13 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
+
+import gdaltest
 import ogrtest
 import pytest
 
-from osgeo import gdal, ogr
+from osgeo import gdal, ogr, osr
 
 
 def get_reproject_alg():
@@ -110,3 +113,139 @@ def test_gdalalg_vector_reproject_complete_dst_crs():
     )
     assert "4326\\ --" in out
     assert "2193\\ --" not in out  # NZGD2000
+
+
+@pytest.mark.require_driver("GPKG")
+def test_gdalalg_vector_reproject_arrow_stream(tmp_vsimem):
+
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+    with gdal.GetDriverByName("GPKG").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    ) as ds:
+        srs = osr.SpatialReference()
+        srs.ImportFromEPSG(4326)
+        lyr = ds.CreateLayer("test", srs=srs)
+        for wkt in [
+            "POINT (2 49)",
+            None,
+            "LINESTRING Z (2 49 10,3 50 20)",
+            "POLYGON ((2 49,2 50,3 50,2 49))",
+        ]:
+            f = ogr.Feature(lyr.GetLayerDefn())
+            if wkt:
+                f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+            lyr.CreateFeature(f)
+
+    alg = get_reproject_alg()
+    alg["input"] = filename
+    alg["dst-crs"] = "EPSG:32631"
+    alg["output"] = ""
+    alg["output-format"] = "stream"
+    assert alg.Run()
+
+    out_lyr = alg["output"].GetDataset().GetLayer(0)
+    expected = [
+        f.GetGeometryRef().ExportToIsoWkt() if f.GetGeometryRef() else None
+        for f in out_lyr
+    ]
+
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+    stream = out_lyr.GetArrowStreamAsNumPy()
+    got = [
+        ogr.CreateGeometryFromWkb(wkb) if wkb is not None else None
+        for batch in stream
+        for wkb in batch["geom"]
+    ]
+    assert len(got) == len(expected)
+    for got_geom, expected_wkt in zip(got, expected):
+        if expected_wkt is None:
+            assert got_geom is None
+        else:
+            ogrtest.check_feature_geometry(got_geom, expected_wkt)
+
+
+@pytest.mark.require_driver("GPKG")
+def test_gdalalg_vector_reproject_arrow_stream_options(tmp_vsimem):
+
+    pytest.importorskip("pyarrow")
+
+    filename = tmp_vsimem / "test.gpkg"
+    with gdal.GetDriverByName("GPKG").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    ) as ds:
+        srs = osr.SpatialReference()
+        srs.ImportFromEPSG(4326)
+        lyr = ds.CreateLayer("test", srs=srs, geom_type=ogr.wkbPoint)
+        for wkt in ["POINT (2 49)", None, "POINT (3 50)", "POINT (4 51)"]:
+            f = ogr.Feature(lyr.GetLayerDefn())
+            if wkt:
+                f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+            lyr.CreateFeature(f)
+
+    alg = get_reproject_alg()
+    alg["input"] = filename
+    alg["dst-crs"] = "EPSG:32631"
+    alg["output"] = ""
+    alg["output-format"] = "stream"
+    assert alg.Run()
+
+    out_lyr = alg["output"].GetDataset().GetLayer(0)
+    expected = {
+        f.GetFID(): (
+            (f.GetGeometryRef().GetX(), f.GetGeometryRef().GetY())
+            if f.GetGeometryRef()
+            else None
+        )
+        for f in out_lyr
+    }
+
+    # CRS metadata is the one of the reprojected layer
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+    stream = out_lyr.GetArrowStreamAsPyArrow(["GEOMETRY_METADATA_ENCODING=GEOARROW"])
+    md = stream.schema.field("geom").metadata
+    if md and b"ARROW:extension:name" in md:
+        assert md[b"ARROW:extension:name"] == b"geoarrow.wkb"
+        metadata = json.loads(md[b"ARROW:extension:metadata"])
+        assert metadata["crs"]["id"] == {"authority": "EPSG", "code": 32631}
+
+    # GeoArrow native encoding
+    for encoding in ["GEOARROW", "GEOARROW_INTERLEAVED"]:
+        stream = out_lyr.GetArrowStreamAsPyArrow(["GEOMETRY_ENCODING=" + encoding])
+        field = stream.schema.field("geom")
+        md = field.metadata
+        if md and b"ARROW:extension:name" in md:
+            assert md[b"ARROW:extension:name"] == b"geoarrow.point"
+            metadata = json.loads(md[b"ARROW:extension:metadata"])
+            assert metadata["crs"]["id"] == {"authority": "EPSG", "code": 32631}
+        field_type = getattr(field.type, "storage_type", field.type)
+        if encoding == "GEOARROW":
+            assert str(field_type) == "struct<x: double not null, y: double not null>"
+        else:
+            assert str(field_type).startswith("fixed_size_list")
+        got = {}
+        for batch in stream:
+            for fid, geom in zip(batch.field("fid"), batch.field("geom")):
+                geom = geom.as_py()
+                if geom is not None and encoding == "GEOARROW":
+                    geom = (geom["x"], geom["y"])
+                elif geom is not None:
+                    geom = tuple(geom)
+                got[fid.as_py()] = geom
+        assert got.keys() == expected.keys()
+        for fid, xy in expected.items():
+            if xy is None:
+                assert got[fid] is None
+            else:
+                assert got[fid] == pytest.approx(xy)
+
+    # Spatial filter evaluated on reprojected geometries
+    x, y = expected[3]
+    out_lyr.SetSpatialFilterRect(x - 1, y - 1, x + 1, y + 1)
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+    assert [f.GetFID() for f in out_lyr] == [3]
+    stream = out_lyr.GetArrowStreamAsPyArrow()
+    assert [fid.as_py() for batch in stream for fid in batch.field("fid")] == [3]
+    out_lyr.SetSpatialFilter(None)
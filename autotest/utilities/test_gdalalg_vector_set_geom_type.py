@@ -319,6 +319,77 @@ def test_gdalalg_vector_set_geom_type_type_autocomplete():
     assert len(out) == 4
 
 
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("dim", ["XY", "XYZ", "XYM", "XYZM"])
+def test_gdalalg_vector_set_geom_type_arrow_stream(tmp_vsimem, dim):
+
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+    with gdal.GetDriverByName("GPKG").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    ) as ds:
+        lyr = ds.CreateLayer("test")
+        for wkt in [
+            "POINT (1 2)",
+            None,
+            "LINESTRING Z (1 2 3,4 5 6)",
+            "POLYGON M ((0 0 1,0 1 2,1 1 3,0 0 1))",
+            "MULTIPOINT ZM ((1 2 3 4))",
+        ]:
+            f = ogr.Feature(lyr.GetLayerDefn())
+            if wkt:
+                f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+            lyr.CreateFeature(f)
+
+    alg = get_alg()
+    alg["input"] = filename
+    alg["output"] = ""
+    alg["output-format"] = "stream"
+    alg["dim"] = dim
+    assert alg.Run()
+
+    out_lyr = alg["output"].GetDataset().GetLayer(0)
+    expected = [
+        f.GetGeometryRef().ExportToIsoWkt() if f.GetGeometryRef() else None
+        for f in out_lyr
+    ]
+
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+    stream = out_lyr.GetArrowStreamAsNumPy()
+    got = [
+        ogr.CreateGeometryFromWkb(wkb).ExportToIsoWkt() if wkb is not None else None
+        for batch in stream
+        for wkb in batch["geom"]
+    ]
+    assert got == expected
+
+
+@pytest.mark.require_driver("GPKG")
+def test_gdalalg_vector_set_geom_type_arrow_stream_generic(tmp_vsimem):
+
+    filename = tmp_vsimem / "test.gpkg"
+    with gdal.GetDriverByName("GPKG").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    ) as ds:
+        lyr = ds.CreateLayer("test")
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+        lyr.CreateFeature(f)
+
+    # Changes of geometry type cannot be done on WKB
+    alg = get_alg()
+    alg["input"] = filename
+    alg["output"] = ""
+    alg["output-format"] = "stream"
+    alg["multi"] = True
+    assert alg.Run()
+
+    out_lyr = alg["output"].GetDataset().GetLayer(0)
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+
+
 @pytest.mark.require_driver("GDALG")
 def test_gdalalg_vector_set_geom_type_test_ogrsf(tmp_path):
 
@@ -11,6 +11,9 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import gdaltest
+import pytest
+
 from osgeo import gdal, ogr, osr
 
 
@@ -57,3 +60,58 @@ def test_gdalalg_vector_swap_xy():
     assert out_lyr.GetExtent() == (2, 2, 1, 1)
     assert out_lyr.GetFeature(0).GetFID() == 0
     assert out_lyr.GetFeature(-1) is None
+
+
+@pytest.mark.require_driver("GPKG")
+def test_gdalalg_vector_swap_xy_arrow_stream(tmp_vsimem):
+
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+    with gdal.GetDriverByName("GPKG").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    ) as ds:
+        lyr = ds.CreateLayer("test")
+        for wkt in [
+            "POINT (1 2)",
+            None,
+            "LINESTRING Z (1 2 3,4 5 6)",
+            "MULTIPOLYGON (((0 0,0 1,2 1,0 0)))",
+        ]:
+            f = ogr.Feature(lyr.GetLayerDefn())
+            if wkt:
+                f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+            lyr.CreateFeature(f)
+
+    alg = get_alg()
+    alg["input"] = filename
+    alg["output"] = ""
+    alg["output-format"] = "stream"
+    assert alg.Run()
+
+    out_lyr = alg["output"].GetDataset().GetLayer(0)
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+    stream = out_lyr.GetArrowStreamAsNumPy()
+    got = [
+        ogr.CreateGeometryFromWkb(wkb).ExportToIsoWkt() if wkb is not None else None
+        for batch in stream
+        for wkb in batch["geom"]
+    ]
+    assert got == [
+        "POINT (2 1)",
+        None,
+        "LINESTRING Z (2 1 3,5 4 6)",
+        "MULTIPOLYGON (((0 0,1 0,1 2,0 0)))",
+    ]
+
+    # Attribute filters are evaluated by the generic implementation
+    out_lyr.SetAttributeFilter("fid = 1")
+    assert out_lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+    stream = out_lyr.GetArrowStreamAsNumPy()
+    got = [
+        ogr.CreateGeometryFromWkb(wkb).ExportToIsoWkt()
+        for batch in stream
+        for wkb in batch["geom"]
+    ]
+    assert got == ["POINT (2 1)"]
@@ -894,6 +894,54 @@ def test_gdaldem_lib_nodata():
         pytest.fail("Bad checksum")
 
 
+###############################################################################
+# Test that multi-threaded processing gives the same result as single-threaded
+
+
+@pytest.mark.parametrize(
+    "processing,options",
+    [
+        ("hillshade", ""),
+        ("hillshade", "-compute_edges"),
+        ("hillshade", "-alg ZevenbergenThorne"),
+        ("hillshade", "-combined -compute_edges"),
+        ("slope", ""),
+        ("aspect", "-compute_edges"),
+        ("TRI", ""),
+        ("TPI", "-compute_edges"),
+        ("roughness", ""),
+    ],
+)
+@pytest.mark.parametrize("datatype", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdaldem_lib_num_threads(processing, options, datatype):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/n43.tif",
+        format="MEM",
+        width=2000,
+        height=1200,
+        resampleAlg=gdal.GRIORA_Bilinear,
+        outputType=datatype,
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(-9999)
+    src_ds.GetRasterBand(1).WriteRaster(
+        100, 700, 50, 50, struct.pack("h", -9999) * 2500, buf_type=gdal.GDT_Int16
+    )
+
+    ref_ds = gdal.DEMProcessing(
+        "", src_ds, processing, format="MEM", options=options + " -num_threads 1"
+    )
+    ds = gdal.DEMProcessing(
+        "", src_ds, processing, format="MEM", options=options + " -num_threads 4"
+    )
+    assert ds.GetRasterBand(1).ReadRaster() == ref_ds.GetRasterBand(1).ReadRaster()
+
+    with gdal.config_option("GDAL_NUM_THREADS", "ALL_CPUS"):
+        ds = gdal.DEMProcessing("", src_ds, processing, format="MEM", options=options)
+    assert ds.GetRasterBand(1).ReadRaster() == ref_ds.GetRasterBand(1).ReadRaster()
+
+
 ###############################################################################
 # Test option argument handling
 
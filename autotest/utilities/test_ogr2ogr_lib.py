@@ -3289,3 +3289,149 @@ def test_ogr2ogr_lib_progress_huge_feature_count():
         callback=mycallback,
         callback_data=tab,
     )
+
+
+###############################################################################
+# Test that the multi-threaded processing of geometries gives the same result
+# as the single-threaded one
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize(
+    "options",
+    [
+        {"dstSRS": "EPSG:4326"},
+        {"dstSRS": "EPSG:4326", "limit": 1234},
+        {"dstSRS": "EPSG:4326", "preserveFID": True},
+        {"segmentizeMaxDist": 10},
+        pytest.param({"makeValid": True}, marks=pytest.mark.require_geos),
+        pytest.param(
+            {"clipSrc": [450000, 4450000, 550000, 4550000], "dstSRS": "EPSG:4326"},
+            marks=pytest.mark.require_geos,
+        ),
+        pytest.param(
+            {"clipDst": [2, 40, 3, 41], "dstSRS": "EPSG:4326"},
+            marks=pytest.mark.require_geos,
+        ),
+    ],
+)
+def test_ogr2ogr_lib_parallel_pipeline(options):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    src_lyr = src_ds.CreateLayer("test", srs=srs)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(3000):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        x = 400000 + (i % 50) * 4000
+        y = 4400000 + (i // 50) * 4000
+        x2 = x + 1000
+        y2 = y + 1000
+        if i % 7 == 0:
+            # Self-intersecting polygon
+            wkt = f"POLYGON(({x} {y},{x2} {y2},{x2} {y},{x} {y2},{x} {y}))"
+        elif i % 11 != 0:
+            wkt = f"POLYGON(({x} {y},{x} {y2},{x2} {y2},{x2} {y},{x} {y}))"
+        else:
+            wkt = None
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    messages = []
+
+    def handler(ecls, ecode, emsg):
+        if "with 4 threads" in emsg:
+            messages.append(emsg)
+
+    def translate(parallel):
+        # GDAL_NUM_THREADS is honoured even on a single CPU, so that the
+        # parallel pipeline is always exercised.
+        with gdaltest.config_options(
+            {
+                "OGR2OGR_USE_ARROW_API": "NO",
+                "OGR2OGR_USE_PARALLEL_PIPELINE": parallel,
+                "GDAL_NUM_THREADS": "4",
+                "CPL_DEBUG": "ON",
+            }
+        ), gdaltest.error_handler(handler):
+            out_ds = gdal.VectorTranslate("", src_ds, format="MEM", **options)
+        out_lyr = out_ds.GetLayer(0)
+        ret = []
+        for f in out_lyr:
+            g = f.GetGeometryRef()
+            ret.append((f.GetFID(), f["id"], g.ExportToIsoWkt() if g else None))
+            if g:
+                assert g.GetSpatialReference().IsSame(out_lyr.GetSpatialRef())
+        return ret
+
+    expected = translate("NO")
+    assert len(expected) > 0
+    assert not messages
+    assert translate("YES") == expected
+    assert len(messages) == 1, messages
+
+
+###############################################################################
+# Test -clipsrc in Arrow code path
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.require_geos
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize(
+    "options",
+    [
+        {"clipSrc": [2, 2, 8, 8]},
+        {"clipSrc": "POLYGON((2 2,2 8,8 2,2 2))"},
+        {"clipSrc": [2, 2, 8, 8], "where": "id >= 10"},
+        {"clipSrc": [2, 2, 8, 8], "spatFilter": [0, 0, 5, 5]},
+        {"clipSrc": [2, 2, 8, 8], "dstSRS": "EPSG:32631"},
+        {"clipSrc": [100, 100, 101, 101]},
+    ],
+)
+def test_ogr2ogr_lib_clipsrc_arrow(tmp_vsimem, options):
+
+    src_filename = str(tmp_vsimem / "in.gpkg")
+    with gdal.GetDriverByName("GPKG").Create(
+        src_filename, 0, 0, 0, gdal.GDT_Unknown
+    ) as src_ds:
+        srs = osr.SpatialReference()
+        srs.ImportFromEPSG(4326)
+        src_lyr = src_ds.CreateLayer("test", srs=srs, geom_type=ogr.wkbPolygon)
+        src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+        src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        for i in range(100):
+            f = ogr.Feature(src_lyr.GetLayerDefn())
+            f["id"] = i
+            f["str"] = str(i)
+            x = i % 10
+            y = i // 10
+            if i % 13 != 0:
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt(
+                        f"POLYGON(({x} {y},{x} {y + 1},{x + 1} {y + 1},{x + 1} {y},{x} {y}))"
+                    )
+                )
+            src_lyr.CreateFeature(f)
+
+    def translate(use_arrow):
+        got_msg = []
+
+        def my_handler(errorClass, errno, msg):
+            got_msg.append(msg)
+
+        with gdaltest.error_handler(my_handler), gdaltest.config_options(
+            {"CPL_DEBUG": "ON", "OGR2OGR_USE_ARROW_API": use_arrow}
+        ):
+            out_ds = gdal.VectorTranslate("", src_filename, format="MEM", **options)
+        assert ("OGR2OGR: Using WriteArrowBatch()" in got_msg) == (use_arrow == "YES")
+        ret = []
+        for f in out_ds.GetLayer(0):
+            g = f.GetGeometryRef()
+            ret.append((f["id"], f["str"], g.ExportToIsoWkt() if g else None))
+        return ret
+
+    assert translate("YES") == translate("NO")
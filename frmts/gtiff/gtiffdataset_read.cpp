@@ -498,12 +498,53 @@ struct GTiffDecompressJob
         return;
     }
 
+    const int nDTSize = GDALGetDataTypeSizeBytes(psContext->eDT);
+    GByte *pDstPtr = psContext->pabyData +
+                     nYOffsetInData * psContext->nLineSpace +
+                     nXOffsetInData * psContext->nPixelSpace;
+
+    // Request m_nBlockYSize line in the block, except on the bottom-most
+    // tile/strip.
+    const int nBlockReqYSize =
+        (psJob->nYBlock < poDS->m_nBlocksPerColumn - 1)
+            ? poDS->m_nBlockYSize
+        : (poDS->nRasterYSize % poDS->m_nBlockYSize) == 0
+            ? poDS->m_nBlockYSize
+            : poDS->nRasterYSize % poDS->m_nBlockYSize;
+
+    const size_t nReqSize = static_cast<size_t>(poDS->m_nBlockXSize) *
+                            nBlockReqYSize * nBandsPerStrile * nDTSize;
+
+    // If the whole tile/strip is requested, and the layout of the output
+    // buffer is the one of the decoded tile/strip, decode directly into it.
+    GByte *pabyDirectOutput = nullptr;
+    if (psContext->bSkipBlockCache && psContext->eBufType == psContext->eDT &&
+        nXOffsetInBlock == 0 && nYOffsetInBlock == 0 &&
+        nXSize == poDS->m_nBlockXSize && nYSize == nBlockReqYSize &&
+        psContext->nLineSpace ==
+            static_cast<GSpacing>(nDTSize) * nBandsPerStrile * nXSize &&
+        (nBandsPerStrile == 1 ? psContext->nPixelSpace == nDTSize
+                              : psContext->bUseBIPOptim))
+    {
+        pabyDirectOutput =
+            poDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE
+                ? pDstPtr + psJob->iDstBandIdxSeparate * psContext->nBandSpace
+                : pDstPtr;
+    }
+
+    // For uncompressed data, even the decoding step can be skipped.
+    const bool bReadIntoDirectOutput =
+        pabyDirectOutput && poDS->m_nCompression == COMPRESSION_NONE &&
+        !TIFFIsByteSwapped(poDS->m_hTIFF) && psJob->nSize >= nReqSize;
+
     const int nBandsToCache =
         psContext->bCacheAllBands ? poDS->nBands : nBandsToWrite;
     std::vector<GDALRasterBlock *> apoBlocks(nBandsToCache);
     std::vector<bool> abAlreadyLoadedBlocks(nBandsToCache);
     int nAlreadyLoadedBlocks = 0;
     std::vector<GByte> abyInput;
+    GByte *pabyInput = nullptr;
+    size_t nInputSize = 0;
 
     struct FreeBlocks
     {
@@ -562,6 +603,13 @@ struct GTiffDecompressJob
 
     const auto AllocInputBuffer = [&]()
     {
+        if (bReadIntoDirectOutput)
+        {
+            pabyInput = pabyDirectOutput;
+            nInputSize = nReqSize;
+            return true;
+        }
+
         bool bError = false;
 #if SIZEOF_VOIDP == 4
         if (psJob->nSize != static_cast<size_t>(psJob->nSize))
@@ -587,6 +635,8 @@ struct GTiffDecompressJob
                      static_cast<GUIntBig>(psJob->nSize));
             return false;
         }
+        pabyInput = abyInput.data();
+        nInputSize = abyInput.size();
         return true;
     };
 
@@ -615,8 +665,8 @@ struct GTiffDecompressJob
                 psContext->bSuccess = false;
                 return;
             }
-            if (psContext->poHandle->PRead(abyInput.data(), abyInput.size(),
-                                           psJob->nOffset) != abyInput.size())
+            if (psContext->poHandle->PRead(pabyInput, nInputSize,
+                                           psJob->nOffset) != nInputSize)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot read " CPL_FRMT_GUIB
@@ -654,8 +704,7 @@ struct GTiffDecompressJob
                 return;
             }
             if (psContext->poHandle->Seek(psJob->nOffset, SEEK_SET) != 0 ||
-                psContext->poHandle->Read(abyInput.data(), abyInput.size(),
-                                          1) != 1)
+                psContext->poHandle->Read(pabyInput, nInputSize, 1) != 1)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot read " CPL_FRMT_GUIB
@@ -668,10 +717,11 @@ struct GTiffDecompressJob
         }
     }
 
-    const int nDTSize = GDALGetDataTypeSizeBytes(psContext->eDT);
-    GByte *pDstPtr = psContext->pabyData +
-                     nYOffsetInData * psContext->nLineSpace +
-                     nXOffsetInData * psContext->nPixelSpace;
+    if (bReadIntoDirectOutput)
+    {
+        // Nothing more to do
+        return;
+    }
 
     if (nAlreadyLoadedBlocks != nBandsToCache)
     {
@@ -762,23 +812,23 @@ struct GTiffDecompressJob
         poDS->RestoreVolatileParameters(hTIFFTmp);
 
         bool bRet = true;
-        // Request m_nBlockYSize line in the block, except on the bottom-most
-        // tile/strip.
-        const int nBlockReqYSize =
-            (psJob->nYBlock < poDS->m_nBlocksPerColumn - 1)
-                ? poDS->m_nBlockYSize
-            : (poDS->nRasterYSize % poDS->m_nBlockYSize) == 0
-                ? poDS->m_nBlockYSize
-                : poDS->nRasterYSize % poDS->m_nBlockYSize;
-
-        const size_t nReqSize = static_cast<size_t>(poDS->m_nBlockXSize) *
-                                nBlockReqYSize * nBandsPerStrile * nDTSize;
-
         GByte *pabyOutput;
         std::vector<GByte> abyOutput;
-        if (poDS->m_nCompression == COMPRESSION_NONE &&
-            !TIFFIsByteSwapped(poDS->m_hTIFF) && abyInput.size() >= nReqSize &&
-            (psContext->bSkipBlockCache || nBandsPerStrile > 1))
+        if (pabyDirectOutput)
+        {
+            pabyOutput = pabyDirectOutput;
+            if (!TIFFReadFromUserBuffer(hTIFFTmp, 0, abyInput.data(),
+                                        abyInput.size(), pabyOutput,
+                                        nReqSize) &&
+                !poDS->m_bIgnoreReadErrors)
+            {
+                bRet = false;
+            }
+        }
+        else if (poDS->m_nCompression == COMPRESSION_NONE &&
+                 !TIFFIsByteSwapped(poDS->m_hTIFF) &&
+                 abyInput.size() >= nReqSize &&
+                 (psContext->bSkipBlockCache || nBandsPerStrile > 1))
         {
             pabyOutput = abyInput.data();
         }
@@ -812,6 +862,12 @@ struct GTiffDecompressJob
             return;
         }
 
+        if (pabyDirectOutput)
+        {
+            // Data has been decoded in its final location
+            return;
+        }
+
         if (!psContext->bSkipBlockCache && nBandsPerStrile > 1)
         {
             // Copy pixel-interleaved all-band buffer to cached blocks
@@ -1042,12 +1098,30 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     sContext.nPredictor = PREDICTOR_NONE;
     sContext.nBlocksPerRow = m_nBlocksPerRow;
 
+    // Requests on whole tiles/strips, such as reading the whole raster or
+    // iterating over it by windows aligned on the block structure, don't
+    // benefit from the block cache, and tiles/strips may then be decoded
+    // directly into the output buffer.
+    // In update mode, the block cache may hold dirty blocks more recent than
+    // the file content, so only the historical whole raster case is
+    // considered.
+    const bool bWholeRasterRequest = nXOff == 0 && nYOff == 0 &&
+                                     nXSize == nRasterXSize &&
+                                     nYSize == nRasterYSize;
+    const bool bBlockAlignedRequest =
+        bWholeRasterRequest ||
+        (eAccess == GA_ReadOnly && (nXOff % m_nBlockXSize) == 0 &&
+         (nYOff % m_nBlockYSize) == 0 &&
+         ((nXOff + nXSize) % m_nBlockXSize == 0 ||
+          nXOff + nXSize == nRasterXSize) &&
+         ((nYOff + nYSize) % m_nBlockYSize == 0 ||
+          nYOff + nYSize == nRasterYSize));
+
     if (m_bDirectIO)
     {
         sContext.bSkipBlockCache = true;
     }
-    else if (nXOff == 0 && nYOff == 0 && nXSize == nRasterXSize &&
-             nYSize == nRasterYSize)
+    else if (bBlockAlignedRequest)
     {
         if (m_nPlanarConfig == PLANARCONFIG_SEPARATE)
         {
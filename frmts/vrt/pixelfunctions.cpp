@@ -2939,6 +2939,71 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
     if (!padfResults)
         return CE_Failure;
 
+    // Simple expressions can be evaluated on a whole line at once
+    std::unique_ptr<gdal::BatchMathExpression> poBatchExpression;
+    if (!includeCenterCoords && !strstr(pszExpression, "BANDS"))
+    {
+        const std::vector<std::string> aosVariables(aosSourceNames.begin(),
+                                                    aosSourceNames.end());
+        poBatchExpression = gdal::BatchMathExpression::Compile(
+            pszExpression, pszDialect, aosVariables,
+            bHasNoData ? &dfNoData : nullptr);
+    }
+
+    if (poBatchExpression)
+    {
+        std::unique_ptr<double, VSIFreeReleaser> padfSrcValues(
+            static_cast<double *>(
+                VSI_MALLOC3_VERBOSE(nSources, nXSize, sizeof(double))));
+        if (!padfSrcValues)
+            return CE_Failure;
+
+        std::vector<const double *> apadfVariables(nSources);
+        for (int iSrc = 0; iSrc < nSources; iSrc++)
+        {
+            apadfVariables[iSrc] =
+                padfSrcValues.get() + static_cast<size_t>(iSrc) * nXSize;
+        }
+
+        const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+        for (int iLine = 0; iLine < nYSize; ++iLine)
+        {
+            const size_t nSrcOffset = static_cast<size_t>(iLine) * nXSize;
+            for (int iSrc = 0; iSrc < nSources; iSrc++)
+            {
+                GDALCopyWords(static_cast<const GByte *>(papoSources[iSrc]) +
+                                  nSrcOffset * nSrcTypeSize,
+                              eSrcType, nSrcTypeSize,
+                              padfSrcValues.get() +
+                                  static_cast<size_t>(iSrc) * nXSize,
+                              GDT_Float64, sizeof(double), nXSize);
+            }
+
+            poBatchExpression->Evaluate(apadfVariables.data(), nXSize,
+                                        padfResults.get());
+
+            if (bHasNoData && bPropagateNoData)
+            {
+                for (int iSrc = 0; iSrc < nSources; iSrc++)
+                {
+                    const double *padfSrc = apadfVariables[iSrc];
+                    for (int iCol = 0; iCol < nXSize; ++iCol)
+                    {
+                        if (IsNoData(padfSrc[iCol], dfNoData))
+                            padfResults.get()[iCol] = dfNoData;
+                    }
+                }
+            }
+
+            GDALCopyWords(padfResults.get(), GDT_Float64, sizeof(double),
+                          static_cast<GByte *>(pData) +
+                              static_cast<GSpacing>(nLineSpace) * iLine,
+                          eBufType, nPixelSpace, nXSize);
+        }
+
+        return CE_None;
+    }
+
     /* ---- Set pixels ---- */
     size_t ii = 0;
     for (int iLine = 0; iLine < nYSize; ++iLine)
@@ -14,6 +14,8 @@
 
 #include "cpl_error.h"
 
+#include <memory>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -201,6 +203,95 @@ MathExpression::Create([[maybe_unused]] const char *pszExpression,
 
 bool MuParserHasDefineFunUserData();
 
+/**
+ * Class to evaluate an expression on arrays of values at once.
+ *
+ * Only a subset of the syntax of the muparser and exprtk dialects is handled:
+ * numbers, variables, parentheses, the + - * / operators, comparisons and the
+ * abs(), sqrt(), exp(), min() and max() functions. With the muparser dialect,
+ * the && and || operators, the ternary operator, the nan constant and the
+ * isnan() and isnodata() functions are also handled. Compile() returns
+ * nullptr for any other expression, which must then be evaluated with a
+ * MathExpression.
+ *
+ * Results are the same as the ones of the corresponding MathExpression.
+ */
+class BatchMathExpression
+{
+  public:
+    /**
+     * Compile an expression.
+     * @param osExpression The body of the expression, e.g. "X + 3"
+     * @param pszDialect The expression dialect, e.g. "muparser"
+     * @param aosVariables Names of the variables, in the order in which
+     *                     their values are passed to Evaluate().
+     * @param pdfNoData Pointer to the value of the NODATA variable, or nullptr.
+     * @return the compiled expression, or nullptr if it is not handled.
+     */
+    static std::unique_ptr<BatchMathExpression>
+    Compile(std::string_view osExpression, const char *pszDialect,
+            const std::vector<std::string> &aosVariables,
+            const double *pdfNoData);
+
+    ~BatchMathExpression();
+
+    /**
+     * Evaluate the expression on nValues values.
+     * @param papadfVariables Array of pointers to the nValues values of
+     *                        each variable.
+     * @param nValues Number of values.
+     * @param padfResults Array of nValues values receiving the results.
+     */
+    void Evaluate(const double *const *papadfVariables, size_t nValues,
+                  double *padfResults) const;
+
+  private:
+    enum class Op
+    {
+        CONSTANT,
+        VARIABLE,
+        NEG,
+        ADD,
+        SUB,
+        MUL,
+        DIV,
+        LT,
+        LE,
+        GT,
+        GE,
+        EQ,
+        NE,
+        AND,
+        OR,
+        TERNARY,
+        ABS,
+        SQRT,
+        EXP,
+        MIN,
+        MAX,
+        ISNAN,
+        ISNODATA,
+    };
+
+    /** Instruction writing to register nDst, from registers anArgs */
+    struct Instr
+    {
+        Op eOp = Op::CONSTANT;
+        int nDst = 0;
+        int anArgs[3] = {0, 0, 0};
+        double dfConstant = 0;
+        int iVariable = 0;
+    };
+
+    class Parser;
+
+    std::vector<Instr> m_aoInstrs{};
+    int m_nRegisters = 1;
+    double m_dfNoData = 0;
+
+    BatchMathExpression() = default;
+};
+
 /*! @endcond */
 
 }  // namespace gdal
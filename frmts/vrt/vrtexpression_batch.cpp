@@ -0,0 +1,649 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Evaluation of simple expressions on arrays of values.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+#include "cpl_conv.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace gdal
+{
+
+/*! @cond Doxygen_Suppress */
+
+// Maximum number of instructions of a compiled expression. Longer expressions
+// are left to the regular evaluators.
+constexpr int MAX_INSTRUCTIONS = 256;
+
+// Maximum number of registers (i.e. nesting depth) of a compiled expression
+constexpr int MAX_REGISTERS = 32;
+
+// Maximum recursion depth of the parser. Parentheses and unary operators do
+// not use registers, so they are bounded separately to protect the stack.
+constexpr int MAX_PARSER_DEPTH = 256;
+
+// Number of values processed at once by each instruction
+constexpr size_t CHUNK_SIZE = 256;
+
+/************************************************************************/
+/*                   BatchMathExpression::Parser                        */
+/************************************************************************/
+
+// Recursive descent parser, emitting instructions as it goes. The result of
+// each sub-expression is written to the register passed to the Parse*()
+// method, and its operands are computed in the following registers, so that
+// the number of registers needed is the nesting depth of the expression.
+//
+// Precedence, from lowest to highest (muparser order):
+//   ?:  ||  &&  (== != < <= > >=)  (+ -)  (* /)  unary (- +)
+class BatchMathExpression::Parser
+{
+  public:
+    Parser(std::string_view osExpression, bool bMuParser,
+           const std::vector<std::string> &aosVariables,
+           const double *pdfNoData, std::vector<Instr> &aoInstrs)
+        : m_osExpr(osExpression), m_bMuParser(bMuParser),
+          m_aosVariables(aosVariables), m_pdfNoData(pdfNoData),
+          m_aoInstrs(aoInstrs)
+    {
+    }
+
+    bool Parse()
+    {
+        if (!ParseTernary(0))
+            return false;
+        SkipSpaces();
+        return m_nPos == m_osExpr.size();
+    }
+
+    int GetRegisterCount() const
+    {
+        return m_nMaxRegister + 1;
+    }
+
+  private:
+    std::string_view m_osExpr;
+    const bool m_bMuParser;
+    const std::vector<std::string> &m_aosVariables;
+    const double *const m_pdfNoData;
+    std::vector<Instr> &m_aoInstrs;
+    size_t m_nPos = 0;
+    int m_nMaxRegister = 0;
+    int m_nDepth = 0;
+
+    // Tracks the recursion depth of ParseTernary() and ParseUnary()
+    class DepthGuard
+    {
+      public:
+        explicit DepthGuard(int &nDepth) : m_nDepth(nDepth)
+        {
+            ++m_nDepth;
+        }
+
+        ~DepthGuard()
+        {
+            --m_nDepth;
+        }
+
+        bool TooDeep() const
+        {
+            return m_nDepth > MAX_PARSER_DEPTH;
+        }
+
+      private:
+        int &m_nDepth;
+
+        CPL_DISALLOW_COPY_ASSIGN(DepthGuard)
+    };
+
+    void SkipSpaces()
+    {
+        while (m_nPos < m_osExpr.size() &&
+               (m_osExpr[m_nPos] == ' ' || m_osExpr[m_nPos] == '\t' ||
+                m_osExpr[m_nPos] == '\n' || m_osExpr[m_nPos] == '\r'))
+        {
+            ++m_nPos;
+        }
+    }
+
+    // Consume the operator if it is the next token, and is not the prefix
+    // of a longer operator (e.g. "<" when the next token is "<=")
+    bool Accept(std::string_view osOp, std::string_view osNotFollowedBy = {})
+    {
+        SkipSpaces();
+        if (m_osExpr.substr(m_nPos, osOp.size()) != osOp)
+            return false;
+        const size_t nNext = m_nPos + osOp.size();
+        if (nNext < m_osExpr.size() &&
+            osNotFollowedBy.find(m_osExpr[nNext]) != std::string_view::npos)
+        {
+            return false;
+        }
+        m_nPos += osOp.size();
+        return true;
+    }
+
+    bool Emit(Op eOp, int nDst, int nArg0 = 0, int nArg1 = 0, int nArg2 = 0)
+    {
+        if (static_cast<int>(m_aoInstrs.size()) >= MAX_INSTRUCTIONS)
+            return false;
+        Instr oInstr;
+        oInstr.eOp = eOp;
+        oInstr.nDst = nDst;
+        oInstr.anArgs[0] = nArg0;
+        oInstr.anArgs[1] = nArg1;
+        oInstr.anArgs[2] = nArg2;
+        m_aoInstrs.push_back(oInstr);
+        return true;
+    }
+
+    bool EmitConstant(int nDst, double dfVal)
+    {
+        if (!Emit(Op::CONSTANT, nDst))
+            return false;
+        m_aoInstrs.back().dfConstant = dfVal;
+        return true;
+    }
+
+    bool CheckRegister(int nReg)
+    {
+        if (nReg >= MAX_REGISTERS)
+            return false;
+        m_nMaxRegister = std::max(m_nMaxRegister, nReg);
+        return true;
+    }
+
+    bool ParseTernary(int nReg)
+    {
+        const DepthGuard oGuard(m_nDepth);
+        if (oGuard.TooDeep() || !ParseOr(nReg))
+            return false;
+        if (!m_bMuParser || !Accept("?"))
+            return true;
+        if (!CheckRegister(nReg + 2) || !ParseTernary(nReg + 1) ||
+            !Accept(":") || !ParseTernary(nReg + 2))
+        {
+            return false;
+        }
+        return Emit(Op::TERNARY, nReg, nReg, nReg + 1, nReg + 2);
+    }
+
+    bool ParseOr(int nReg)
+    {
+        if (!ParseAnd(nReg))
+            return false;
+        while (m_bMuParser && Accept("||"))
+        {
+            if (!CheckRegister(nReg + 1) || !ParseAnd(nReg + 1) ||
+                !Emit(Op::OR, nReg, nReg, nReg + 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ParseAnd(int nReg)
+    {
+        if (!ParseComparison(nReg))
+            return false;
+        while (m_bMuParser && Accept("&&"))
+        {
+            if (!CheckRegister(nReg + 1) || !ParseComparison(nReg + 1) ||
+                !Emit(Op::AND, nReg, nReg, nReg + 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ParseComparison(int nReg)
+    {
+        if (!ParseAdditive(nReg))
+            return false;
+        while (true)
+        {
+            Op eOp;
+            if (Accept("<="))
+                eOp = Op::LE;
+            else if (Accept(">="))
+                eOp = Op::GE;
+            // exprtk's == and != are tolerance-based comparisons
+            else if (m_bMuParser && Accept("=="))
+                eOp = Op::EQ;
+            else if (m_bMuParser && Accept("!="))
+                eOp = Op::NE;
+            else if (Accept("<", "=>"))
+                eOp = Op::LT;
+            else if (Accept(">", "="))
+                eOp = Op::GT;
+            else
+                return true;
+            if (!CheckRegister(nReg + 1) || !ParseAdditive(nReg + 1) ||
+                !Emit(eOp, nReg, nReg, nReg + 1))
+            {
+                return false;
+            }
+        }
+    }
+
+    bool ParseAdditive(int nReg)
+    {
+        if (!ParseMultiplicative(nReg))
+            return false;
+        while (true)
+        {
+            Op eOp;
+            if (Accept("+", "="))
+                eOp = Op::ADD;
+            else if (Accept("-", "="))
+                eOp = Op::SUB;
+            else
+                return true;
+            if (!CheckRegister(nReg + 1) || !ParseMultiplicative(nReg + 1) ||
+                !Emit(eOp, nReg, nReg, nReg + 1))
+            {
+                return false;
+            }
+        }
+    }
+
+    bool ParseMultiplicative(int nReg)
+    {
+        if (!ParseUnary(nReg))
+            return false;
+        while (true)
+        {
+            Op eOp;
+            if (Accept("*", "=*"))
+                eOp = Op::MUL;
+            else if (Accept("/", "=/*"))
+                eOp = Op::DIV;
+            else
+                return true;
+            if (!CheckRegister(nReg + 1) || !ParseUnary(nReg + 1) ||
+                !Emit(eOp, nReg, nReg, nReg + 1))
+            {
+                return false;
+            }
+        }
+    }
+
+    bool ParseUnary(int nReg)
+    {
+        const DepthGuard oGuard(m_nDepth);
+        if (oGuard.TooDeep())
+            return false;
+        if (Accept("-", "-="))
+        {
+            return ParseUnary(nReg) && Emit(Op::NEG, nReg, nReg);
+        }
+        if (Accept("+", "+="))
+        {
+            return ParseUnary(nReg);
+        }
+        return ParsePrimary(nReg);
+    }
+
+    bool ParseNumber(int nReg)
+    {
+        const size_t nStart = m_nPos;
+        const auto IsDigit = [this]()
+        {
+            return m_nPos < m_osExpr.size() && m_osExpr[m_nPos] >= '0' &&
+                   m_osExpr[m_nPos] <= '9';
+        };
+        bool bHasDigits = false;
+        while (IsDigit())
+        {
+            ++m_nPos;
+            bHasDigits = true;
+        }
+        if (m_nPos < m_osExpr.size() && m_osExpr[m_nPos] == '.')
+        {
+            ++m_nPos;
+            while (IsDigit())
+            {
+                ++m_nPos;
+                bHasDigits = true;
+            }
+        }
+        if (!bHasDigits)
+            return false;
+        if (m_nPos < m_osExpr.size() &&
+            (m_osExpr[m_nPos] == 'e' || m_osExpr[m_nPos] == 'E'))
+        {
+            ++m_nPos;
+            if (m_nPos < m_osExpr.size() &&
+                (m_osExpr[m_nPos] == '+' || m_osExpr[m_nPos] == '-'))
+            {
+                ++m_nPos;
+            }
+            if (!IsDigit())
+                return false;
+            while (IsDigit())
+                ++m_nPos;
+        }
+        // Reject things like "2x" (implicit multiplication in exprtk)
+        if (m_nPos < m_osExpr.size() &&
+            (std::isalnum(static_cast<unsigned char>(m_osExpr[m_nPos])) ||
+             m_osExpr[m_nPos] == '_' || m_osExpr[m_nPos] == '.'))
+        {
+            return false;
+        }
+        const std::string osNumber(m_osExpr.substr(nStart, m_nPos - nStart));
+        return EmitConstant(nReg, CPLAtof(osNumber.c_str()));
+    }
+
+    bool ParseFunction(std::string_view osName, int nReg)
+    {
+        Op eOp;
+        if (osName == "abs")
+            eOp = Op::ABS;
+        else if (osName == "sqrt")
+            eOp = Op::SQRT;
+        else if (osName == "exp")
+            eOp = Op::EXP;
+        else if (osName == "min")
+            eOp = Op::MIN;
+        else if (osName == "max")
+            eOp = Op::MAX;
+        else if (m_bMuParser && osName == "isnan")
+            eOp = Op::ISNAN;
+#if GDAL_VRT_ENABLE_MUPARSER
+        else if (m_bMuParser && osName == "isnodata" && m_pdfNoData &&
+                 MuParserHasDefineFunUserData())
+            eOp = Op::ISNODATA;
+#endif
+        else
+            return false;
+
+        if (!ParseTernary(nReg))
+            return false;
+        if (eOp == Op::MIN || eOp == Op::MAX)
+        {
+            // Same evaluation order as muparser and exprtk:
+            // min(a, b, c) = min(min(a, b), c)
+            if (!CheckRegister(nReg + 1))
+                return false;
+            while (Accept(","))
+            {
+                if (!ParseTernary(nReg + 1) ||
+                    !Emit(eOp, nReg, nReg, nReg + 1))
+                {
+                    return false;
+                }
+            }
+        }
+        else if (!Emit(eOp, nReg, nReg))
+        {
+            return false;
+        }
+        return Accept(")");
+    }
+
+    bool ParsePrimary(int nReg)
+    {
+        SkipSpaces();
+        if (m_nPos == m_osExpr.size())
+            return false;
+
+        const char ch = m_osExpr[m_nPos];
+        if (ch == '(')
+        {
+            ++m_nPos;
+            return ParseTernary(nReg) && Accept(")");
+        }
+        if ((ch >= '0' && ch <= '9') || ch == '.')
+        {
+            return ParseNumber(nReg);
+        }
+        if (!std::isalpha(static_cast<unsigned char>(ch)) && ch != '_')
+        {
+            return false;
+        }
+
+        const size_t nStart = m_nPos;
+        while (m_nPos < m_osExpr.size() &&
+               (std::isalnum(static_cast<unsigned char>(m_osExpr[m_nPos])) ||
+                m_osExpr[m_nPos] == '_'))
+        {
+            ++m_nPos;
+        }
+        const std::string_view osName =
+            m_osExpr.substr(nStart, m_nPos - nStart);
+
+        if (Accept("("))
+        {
+            return ParseFunction(osName, nReg);
+        }
+
+        for (size_t i = 0; i < m_aosVariables.size(); ++i)
+        {
+            if (m_aosVariables[i] == osName)
+            {
+                if (!Emit(Op::VARIABLE, nReg))
+                    return false;
+                m_aoInstrs.back().iVariable = static_cast<int>(i);
+                return true;
+            }
+        }
+        if (m_pdfNoData && osName == "NODATA")
+        {
+            return EmitConstant(nReg, *m_pdfNoData);
+        }
+        if (m_bMuParser && (osName == "nan" || osName == "NaN"))
+        {
+            return EmitConstant(nReg,
+                                std::numeric_limits<double>::quiet_NaN());
+        }
+        return false;
+    }
+};
+
+/************************************************************************/
+/*                   BatchMathExpression::Compile()                     */
+/************************************************************************/
+
+std::unique_ptr<BatchMathExpression>
+BatchMathExpression::Compile(std::string_view osExpression,
+                             const char *pszDialect,
+                             const std::vector<std::string> &aosVariables,
+                             const double *pdfNoData)
+{
+    bool bMuParser;
+    if (EQUAL(pszDialect, "muparser"))
+    {
+#if GDAL_VRT_ENABLE_MUPARSER
+        bMuParser = true;
+#else
+        return nullptr;
+#endif
+    }
+    else if (EQUAL(pszDialect, "exprtk"))
+    {
+#if GDAL_VRT_ENABLE_EXPRTK
+        bMuParser = false;
+#else
+        return nullptr;
+#endif
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    for (const auto &osVariable : aosVariables)
+    {
+        // Ambiguous with the NODATA variable or the muparser constants
+        if (osVariable == "NODATA" || osVariable == "nan" ||
+            osVariable == "NaN")
+        {
+            return nullptr;
+        }
+        // Let the regular evaluators report invalid variable names
+        if (osVariable.empty() ||
+            (!std::isalpha(static_cast<unsigned char>(osVariable[0])) &&
+             osVariable[0] != '_'))
+        {
+            return nullptr;
+        }
+        for (char ch : osVariable)
+        {
+            if (!std::isalnum(static_cast<unsigned char>(ch)) && ch != '_')
+                return nullptr;
+        }
+    }
+
+    std::unique_ptr<BatchMathExpression> poExpr(new BatchMathExpression());
+    Parser oParser(osExpression, bMuParser, aosVariables, pdfNoData,
+                   poExpr->m_aoInstrs);
+    if (!oParser.Parse())
+        return nullptr;
+    poExpr->m_nRegisters = oParser.GetRegisterCount();
+    if (pdfNoData)
+        poExpr->m_dfNoData = *pdfNoData;
+    return poExpr;
+}
+
+/************************************************************************/
+/*                  ~BatchMathExpression()                              */
+/************************************************************************/
+
+BatchMathExpression::~BatchMathExpression() = default;
+
+/************************************************************************/
+/*                   BatchMathExpression::Evaluate()                    */
+/************************************************************************/
+
+void BatchMathExpression::Evaluate(const double *const *papadfVariables,
+                                   size_t nValues, double *padfResults) const
+{
+    // Register 0 is the result, and is directly written into padfResults
+    std::vector<double> adfRegisters(
+        static_cast<size_t>(std::max(m_nRegisters - 1, 0)) * CHUNK_SIZE);
+    std::vector<double *> apadfRegisters(m_nRegisters);
+
+    for (size_t iStart = 0; iStart < nValues; iStart += CHUNK_SIZE)
+    {
+        const size_t n = std::min(CHUNK_SIZE, nValues - iStart);
+        apadfRegisters[0] = padfResults + iStart;
+        for (int i = 1; i < m_nRegisters; ++i)
+            apadfRegisters[i] = adfRegisters.data() + (i - 1) * CHUNK_SIZE;
+
+        for (const Instr &oInstr : m_aoInstrs)
+        {
+            double *const pDst = apadfRegisters[oInstr.nDst];
+            const double *const pA = apadfRegisters[oInstr.anArgs[0]];
+            const double *const pB = apadfRegisters[oInstr.anArgs[1]];
+            const double *const pC = apadfRegisters[oInstr.anArgs[2]];
+
+#define BINARY_OP(expr)                                                        \
+    for (size_t i = 0; i < n; ++i)                                             \
+    {                                                                          \
+        const double a = pA[i];                                                \
+        const double b = pB[i];                                                \
+        pDst[i] = (expr);                                                      \
+    }                                                                          \
+    break
+
+#define UNARY_OP(expr)                                                         \
+    for (size_t i = 0; i < n; ++i)                                             \
+    {                                                                          \
+        const double a = pA[i];                                                \
+        pDst[i] = (expr);                                                      \
+    }                                                                          \
+    break
+
+            switch (oInstr.eOp)
+            {
+                case Op::CONSTANT:
+                    std::fill(pDst, pDst + n, oInstr.dfConstant);
+                    break;
+                case Op::VARIABLE:
+                    memcpy(pDst, papadfVariables[oInstr.iVariable] + iStart,
+                           n * sizeof(double));
+                    break;
+                case Op::NEG:
+                    UNARY_OP(-a);
+                case Op::ABS:
+                    UNARY_OP(std::fabs(a));
+                case Op::SQRT:
+                    UNARY_OP(std::sqrt(a));
+                case Op::EXP:
+                    UNARY_OP(std::exp(a));
+                case Op::ISNAN:
+                    UNARY_OP(std::isnan(a) ? 1.0 : 0.0);
+                case Op::ISNODATA:
+                {
+                    const double dfNoData = m_dfNoData;
+                    if (std::isnan(dfNoData))
+                    {
+                        UNARY_OP(std::isnan(a) ? 1.0 : 0.0);
+                    }
+                    else
+                    {
+                        UNARY_OP(a == dfNoData ? 1.0 : 0.0);
+                    }
+                    break;
+                }
+                case Op::ADD:
+                    BINARY_OP(a + b);
+                case Op::SUB:
+                    BINARY_OP(a - b);
+                case Op::MUL:
+                    BINARY_OP(a * b);
+                case Op::DIV:
+                    BINARY_OP(a / b);
+                case Op::LT:
+                    BINARY_OP(a < b ? 1.0 : 0.0);
+                case Op::LE:
+                    BINARY_OP(a <= b ? 1.0 : 0.0);
+                case Op::GT:
+                    BINARY_OP(a > b ? 1.0 : 0.0);
+                case Op::GE:
+                    BINARY_OP(a >= b ? 1.0 : 0.0);
+                case Op::EQ:
+                    BINARY_OP(a == b ? 1.0 : 0.0);
+                case Op::NE:
+                    BINARY_OP(a != b ? 1.0 : 0.0);
+                case Op::AND:
+                    BINARY_OP((a != 0) & (b != 0) ? 1.0 : 0.0);
+                case Op::OR:
+                    BINARY_OP((a != 0) | (b != 0) ? 1.0 : 0.0);
+                case Op::MIN:
+                    // std::min(a, b) semantics with respect to NaN
+                    BINARY_OP(b < a ? b : a);
+                case Op::MAX:
+                    // std::max(a, b) semantics with respect to NaN
+                    BINARY_OP(a < b ? b : a);
+                case Op::TERNARY:
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        pDst[i] = pA[i] != 0 ? pB[i] : pC[i];
+                    }
+                    break;
+            }
+
+#undef BINARY_OP
+#undef UNARY_OP
+        }
+    }
+}
+
+/*! @endcond */
+
+}  // namespace gdal
@@ -1356,6 +1356,20 @@ CPLErr CPL_DLL CPL_STDCALL GDALDatasetRasterIOEx(
     GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace,
     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 
+/** Callback of GDALDatasetRasterIOAsync(), called with the result of the
+ * request and the user data passed to GDALDatasetRasterIOAsync().
+ * @since GDAL 3.12
+ */
+typedef void (*GDALRasterIOAsyncCompletionFunc)(CPLErr eErr, void *pUserData);
+
+CPLErr CPL_DLL GDALDatasetRasterIOAsync(
+    GDALDatasetH hDS, int nDSXOff, int nDSYOff, int nDSXSize, int nDSYSize,
+    void *pBuffer, int nBXSize, int nBYSize, GDALDataType eBDataType,
+    int nBandCount, const int *panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace,
+    GDALRasterIOExtraArg *psExtraArg,
+    GDALRasterIOAsyncCompletionFunc pfnCompletion, void *pCompletionData);
+
 CPLErr CPL_DLL CPL_STDCALL GDALDatasetAdviseRead(
     GDALDatasetH hDS, int nDSXOff, int nDSYOff, int nDSXSize, int nDSYSize,
     int nBXSize, int nBYSize, GDALDataType eBDataType, int nBandCount,
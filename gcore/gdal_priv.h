@@ -58,6 +58,8 @@ class GDALAlgorithm;
 #include <cmath>
 #include <complex>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -717,6 +719,13 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                const char *const *papszOpenOptions,
                const char *const *papszSiblingFiles);
     friend CPLErr CPL_STDCALL GDALClose(GDALDatasetH hDS);
+    friend CPLErr GDALDatasetRasterIOAsync(
+        GDALDatasetH hDS, int nXOff, int nYOff, int nXSize, int nYSize,
+        void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+        int nBandCount, const int *panBandMap, GSpacing nPixelSpace,
+        GSpacing nLineSpace, GSpacing nBandSpace,
+        GDALRasterIOExtraArg *psExtraArg,
+        GDALRasterIOAsyncCompletionFunc pfnCompletion, void *pCompletionData);
 
     friend class GDALDriver;
     friend class GDALDefaultOverviews;
@@ -727,6 +736,16 @@ class CPL_DLL GDALDataset : public GDALMajorObject
 
     CPL_INTERNAL void UnregisterFromSharedDataset();
 
+    CPL_INTERNAL void CancelAsyncRasterIO();
+
+    CPL_INTERNAL bool QueueRasterIOAsync(
+        int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+        int nBufXSize, int nBufYSize, GDALDataType eBufType, int nBandCount,
+        const int *panBandMap, GSpacing nPixelSpace, GSpacing nLineSpace,
+        GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg,
+        std::function<void(CPLErr)> pfnCompletion,
+        std::future<CPLErr> &oFuture);
+
     CPL_INTERNAL static void ReportErrorV(const char *pszDSName,
                                           CPLErr eErrClass, CPLErrorNum err_no,
                                           const char *fmt, va_list args);
@@ -1072,6 +1091,14 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                     GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 #endif
 
+    std::future<CPLErr>
+    RasterIOAsync(int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+                  int nBufXSize, int nBufYSize, GDALDataType eBufType,
+                  int nBandCount, const int *panBandMap, GSpacing nPixelSpace,
+                  GSpacing nLineSpace, GSpacing nBandSpace,
+                  GDALRasterIOExtraArg *psExtraArg = nullptr,
+                  std::function<void(CPLErr)> pfnCompletion = nullptr);
+
     virtual CPLStringList GetCompressionFormats(int nXOff, int nYOff,
                                                 int nXSize, int nYSize,
                                                 int nBandCount,
@@ -1594,11 +1621,21 @@ class CPL_DLL GDALRasterBlock final
 
     bool bMustDetach = false;
 
+    int nCacheShard = 0;
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
 
     CPL_INTERNAL void RecycleFor(int nXOffIn, int nYOffIn);
 
+    CPL_INTERNAL static bool FlushShardCacheBlock(int iShard,
+                                                  bool bDirtyBlocksOnly,
+                                                  bool bCleanBlocksOnly);
+    CPL_INTERNAL static void EvictFromOtherShards(int iSkipShard,
+                                                  GIntBig nCurCacheMax,
+                                                  GIntBig nMinShardUsage,
+                                                  bool bCleanBlocksOnly);
+
   public:
     GDALRasterBlock(GDALRasterBand *, int, int);
     GDALRasterBlock(int nXOffIn, int nYOffIn); /* only for lookup purpose */
@@ -1707,6 +1744,9 @@ class CPL_DLL GDALRasterBlock final
     static void EnterDisableDirtyBlockFlush();
     static void LeaveDisableDirtyBlockFlush();
 
+    static void GetCacheLockStatistics(GUIntBig *pnLockAcquisitions,
+                                       GUIntBig *pnLockContentions);
+
 #ifdef notdef
     static void CheckNonOrphanedBlocks(GDALRasterBand *poBand);
     void DumpBlock();
@@ -5478,6 +5518,18 @@ int CPL_DLL GDALReadTabFile2(const char *pszBaseFilename,
 void CPL_DLL GDALCopyRasterIOExtraArg(GDALRasterIOExtraArg *psDestArg,
                                       GDALRasterIOExtraArg *psSrcArg);
 
+/** Function reading a chunk of a RasterIO() request, used by
+ * GDALParallelRasterIORead(). pabyChunkData points to the location of the
+ * top-left pixel of the chunk in the buffer of the request. */
+typedef std::function<CPLErr(int nChunkXOff, int nChunkYOff, int nChunkXSize,
+                             int nChunkYSize, GByte *pabyChunkData)>
+    GDALParallelRasterIOChunkFunc;
+
+bool CPL_DLL GDALParallelRasterIORead(
+    int nXOff, int nYOff, int nXSize, int nYSize, int nBlockXSize,
+    int nBlockYSize, void *pData, GSpacing nPixelSpace, GSpacing nLineSpace,
+    const GDALParallelRasterIOChunkFunc &pfnReadChunk, CPLErr &eErr);
+
 void CPL_DLL GDALExpandPackedBitsToByteAt0Or1(
     const GByte *CPL_RESTRICT pabyInput, GByte *CPL_RESTRICT pabyOutput,
     size_t nInputBits);
@@ -0,0 +1,999 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  SSE2 / AVX2 kernels for ComputeStatistics() on Byte and UInt16
+ * Author:   Frank Warmerdam, warmerdam@pobox.com
+ *
+ ******************************************************************************
+ * Copyright (c) 1998, Frank Warmerdam
+ * Copyright (c) 2007-2016, Even Rouault <even dot rouault at spatialys dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDAL_STATISTICS_KERNELS_HPP_INCLUDED
+#define GDAL_STATISTICS_KERNELS_HPP_INCLUDED
+
+// This file is included both by gdalrasterband.cpp, and by
+// gdalrasterband_avx2.cpp which is compiled with AVX2 enabled. Everything is
+// put in an anonymous namespace so that the SSE2 and AVX2 flavors of the
+// kernels are never merged by the linker. For the same reason, the code must
+// not call inline functions of the standard library or of CPL, such as
+// std::min() or std::numeric_limits<>::max(): they would be emitted as weak
+// symbols, and the linker might pick the AVX2 flavor for SSE2 callers.
+
+#include "cpl_port.h"
+#include "cpl_error.h"
+
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__GNUC__) || defined(_MSC_VER))
+#include "gdal_avx2_emulation.hpp"
+#endif
+
+//! @cond Doxygen_Suppress
+
+namespace
+{
+
+template <class T> inline T StatsKernelMin(T a, T b)
+{
+    return a < b ? a : b;
+}
+
+/************************************************************************/
+/*                    ComputeStatisticsInternal()                       */
+/************************************************************************/
+
+// Just to make coverity scan happy w.r.t overflow_before_widen, but otherwise
+// not needed.
+#define static_cast_for_coverity_scan static_cast
+
+// The rationale for below optimizations is detailed in statistics.txt
+
+// Use with T = GByte or GUInt16 only !
+template <class T, bool COMPUTE_OTHER_STATS>
+struct ComputeStatisticsInternalGeneric
+{
+    static void f(int nXCheck, int nBlockXSize, int nYCheck, const T *pData,
+                  bool bHasNoData, GUInt32 nNoDataValue, GUInt32 &nMin,
+                  GUInt32 &nMax, GUIntBig &nSum, GUIntBig &nSumSquare,
+                  GUIntBig &nSampleCount, GUIntBig &nValidCount)
+    {
+        static_assert(std::is_same<T, GByte>::value ||
+                          std::is_same<T, GUInt16>::value,
+                      "bad type for T");
+        if (bHasNoData)
+        {
+            // General case
+            for (int iY = 0; iY < nYCheck; iY++)
+            {
+                for (int iX = 0; iX < nXCheck; iX++)
+                {
+                    const GPtrDiff_t iOffset =
+                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                    const GUInt32 nValue = pData[iOffset];
+                    if (nValue == nNoDataValue)
+                        continue;
+                    if (nValue < nMin)
+                        nMin = nValue;
+                    if (nValue > nMax)
+                        nMax = nValue;
+                    if constexpr (COMPUTE_OTHER_STATS)
+                    {
+                        nValidCount++;
+                        nSum += nValue;
+                        nSumSquare +=
+                            static_cast_for_coverity_scan<GUIntBig>(nValue) *
+                            nValue;
+                    }
+                }
+            }
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+            }
+        }
+        else if (nMin == 0 && nMax == static_cast<T>(~static_cast<T>(0)))
+        {
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                // Optimization when there is no nodata and we know we have already
+                // reached the min and max
+                for (int iY = 0; iY < nYCheck; iY++)
+                {
+                    int iX;
+                    for (iX = 0; iX + 3 < nXCheck; iX += 4)
+                    {
+                        const GPtrDiff_t iOffset =
+                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                        const GUIntBig nValue = pData[iOffset];
+                        const GUIntBig nValue2 = pData[iOffset + 1];
+                        const GUIntBig nValue3 = pData[iOffset + 2];
+                        const GUIntBig nValue4 = pData[iOffset + 3];
+                        nSum += nValue;
+                        nSumSquare += nValue * nValue;
+                        nSum += nValue2;
+                        nSumSquare += nValue2 * nValue2;
+                        nSum += nValue3;
+                        nSumSquare += nValue3 * nValue3;
+                        nSum += nValue4;
+                        nSumSquare += nValue4 * nValue4;
+                    }
+                    for (; iX < nXCheck; ++iX)
+                    {
+                        const GPtrDiff_t iOffset =
+                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                        const GUIntBig nValue = pData[iOffset];
+                        nSum += nValue;
+                        nSumSquare += nValue * nValue;
+                    }
+                }
+                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+            }
+        }
+        else
+        {
+            for (int iY = 0; iY < nYCheck; iY++)
+            {
+                int iX;
+                for (iX = 0; iX + 1 < nXCheck; iX += 2)
+                {
+                    const GPtrDiff_t iOffset =
+                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                    const GUInt32 nValue = pData[iOffset];
+                    const GUInt32 nValue2 = pData[iOffset + 1];
+                    if (nValue < nValue2)
+                    {
+                        if (nValue < nMin)
+                            nMin = nValue;
+                        if (nValue2 > nMax)
+                            nMax = nValue2;
+                    }
+                    else
+                    {
+                        if (nValue2 < nMin)
+                            nMin = nValue2;
+                        if (nValue > nMax)
+                            nMax = nValue;
+                    }
+                    if constexpr (COMPUTE_OTHER_STATS)
+                    {
+                        nSum += nValue;
+                        nSumSquare +=
+                            static_cast_for_coverity_scan<GUIntBig>(nValue) *
+                            nValue;
+                        nSum += nValue2;
+                        nSumSquare +=
+                            static_cast_for_coverity_scan<GUIntBig>(nValue2) *
+                            nValue2;
+                    }
+                }
+                if (iX < nXCheck)
+                {
+                    const GPtrDiff_t iOffset =
+                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                    const GUInt32 nValue = pData[iOffset];
+                    if (nValue < nMin)
+                        nMin = nValue;
+                    if (nValue > nMax)
+                        nMax = nValue;
+                    if (COMPUTE_OTHER_STATS)
+                    {
+                        nSum += nValue;
+                        nSumSquare +=
+                            static_cast_for_coverity_scan<GUIntBig>(nValue) *
+                            nValue;
+                    }
+                }
+            }
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+            }
+        }
+    }
+};
+
+// Specialization for Byte that is mostly 32 bit friendly as it avoids
+// using 64bit accumulators in internal loops. This also slightly helps in
+// 64bit mode.
+template <bool COMPUTE_OTHER_STATS>
+struct ComputeStatisticsInternalGeneric<GByte, COMPUTE_OTHER_STATS>
+{
+    static void f(int nXCheck, int nBlockXSize, int nYCheck, const GByte *pData,
+                  bool bHasNoData, GUInt32 nNoDataValue, GUInt32 &nMin,
+                  GUInt32 &nMax, GUIntBig &nSum, GUIntBig &nSumSquare,
+                  GUIntBig &nSampleCount, GUIntBig &nValidCount)
+    {
+        int nOuterLoops = nXCheck / 65536;
+        if (nXCheck % 65536)
+            nOuterLoops++;
+
+        if (bHasNoData)
+        {
+            // General case
+            for (int iY = 0; iY < nYCheck; iY++)
+            {
+                int iX = 0;
+                for (int k = 0; k < nOuterLoops; k++)
+                {
+                    int iMax = iX + 65536;
+                    if (iMax > nXCheck)
+                        iMax = nXCheck;
+                    GUInt32 nSum32bit = 0;
+                    GUInt32 nSumSquare32bit = 0;
+                    GUInt32 nValidCount32bit = 0;
+                    GUInt32 nSampleCount32bit = 0;
+                    for (; iX < iMax; iX++)
+                    {
+                        const GPtrDiff_t iOffset =
+                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                        const GUInt32 nValue = pData[iOffset];
+
+                        nSampleCount32bit++;
+                        if (nValue == nNoDataValue)
+                            continue;
+                        if (nValue < nMin)
+                            nMin = nValue;
+                        if (nValue > nMax)
+                            nMax = nValue;
+                        if constexpr (COMPUTE_OTHER_STATS)
+                        {
+                            nValidCount32bit++;
+                            nSum32bit += nValue;
+                            nSumSquare32bit += nValue * nValue;
+                        }
+                    }
+                    if constexpr (COMPUTE_OTHER_STATS)
+                    {
+                        nSampleCount += nSampleCount32bit;
+                        nValidCount += nValidCount32bit;
+                        nSum += nSum32bit;
+                        nSumSquare += nSumSquare32bit;
+                    }
+                }
+            }
+        }
+        else if (nMin == 0 && nMax == 255)
+        {
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                // Optimization when there is no nodata and we know we have already
+                // reached the min and max
+                for (int iY = 0; iY < nYCheck; iY++)
+                {
+                    int iX = 0;
+                    for (int k = 0; k < nOuterLoops; k++)
+                    {
+                        int iMax = iX + 65536;
+                        if (iMax > nXCheck)
+                            iMax = nXCheck;
+                        GUInt32 nSum32bit = 0;
+                        GUInt32 nSumSquare32bit = 0;
+                        for (; iX + 3 < iMax; iX += 4)
+                        {
+                            const GPtrDiff_t iOffset =
+                                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                            const GUInt32 nValue = pData[iOffset];
+                            const GUInt32 nValue2 = pData[iOffset + 1];
+                            const GUInt32 nValue3 = pData[iOffset + 2];
+                            const GUInt32 nValue4 = pData[iOffset + 3];
+                            nSum32bit += nValue;
+                            nSumSquare32bit += nValue * nValue;
+                            nSum32bit += nValue2;
+                            nSumSquare32bit += nValue2 * nValue2;
+                            nSum32bit += nValue3;
+                            nSumSquare32bit += nValue3 * nValue3;
+                            nSum32bit += nValue4;
+                            nSumSquare32bit += nValue4 * nValue4;
+                        }
+                        nSum += nSum32bit;
+                        nSumSquare += nSumSquare32bit;
+                    }
+                    for (; iX < nXCheck; ++iX)
+                    {
+                        const GPtrDiff_t iOffset =
+                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                        const GUIntBig nValue = pData[iOffset];
+                        nSum += nValue;
+                        nSumSquare += nValue * nValue;
+                    }
+                }
+                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+            }
+        }
+        else
+        {
+            for (int iY = 0; iY < nYCheck; iY++)
+            {
+                int iX = 0;
+                for (int k = 0; k < nOuterLoops; k++)
+                {
+                    int iMax = iX + 65536;
+                    if (iMax > nXCheck)
+                        iMax = nXCheck;
+                    GUInt32 nSum32bit = 0;
+                    GUInt32 nSumSquare32bit = 0;
+                    for (; iX + 1 < iMax; iX += 2)
+                    {
+                        const GPtrDiff_t iOffset =
+                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                        const GUInt32 nValue = pData[iOffset];
+                        const GUInt32 nValue2 = pData[iOffset + 1];
+                        if (nValue < nValue2)
+                        {
+                            if (nValue < nMin)
+                                nMin = nValue;
+                            if (nValue2 > nMax)
+                                nMax = nValue2;
+                        }
+                        else
+                        {
+                            if (nValue2 < nMin)
+                                nMin = nValue2;
+                            if (nValue > nMax)
+                                nMax = nValue;
+                        }
+                        if constexpr (COMPUTE_OTHER_STATS)
+                        {
+                            nSum32bit += nValue;
+                            nSumSquare32bit += nValue * nValue;
+                            nSum32bit += nValue2;
+                            nSumSquare32bit += nValue2 * nValue2;
+                        }
+                    }
+                    if constexpr (COMPUTE_OTHER_STATS)
+                    {
+                        nSum += nSum32bit;
+                        nSumSquare += nSumSquare32bit;
+                    }
+                }
+                if (iX < nXCheck)
+                {
+                    const GPtrDiff_t iOffset =
+                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                    const GUInt32 nValue = pData[iOffset];
+                    if (nValue < nMin)
+                        nMin = nValue;
+                    if (nValue > nMax)
+                        nMax = nValue;
+                    if constexpr (COMPUTE_OTHER_STATS)
+                    {
+                        nSum += nValue;
+                        nSumSquare +=
+                            static_cast_for_coverity_scan<GUIntBig>(nValue) *
+                            nValue;
+                    }
+                }
+            }
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+            }
+        }
+    }
+};
+
+template <class T, bool COMPUTE_OTHER_STATS> struct ComputeStatisticsInternal
+{
+    static void f(int nXCheck, int nBlockXSize, int nYCheck, const T *pData,
+                  bool bHasNoData, GUInt32 nNoDataValue, GUInt32 &nMin,
+                  GUInt32 &nMax, GUIntBig &nSum, GUIntBig &nSumSquare,
+                  GUIntBig &nSampleCount, GUIntBig &nValidCount)
+    {
+        ComputeStatisticsInternalGeneric<T, COMPUTE_OTHER_STATS>::f(
+            nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue,
+            nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+    }
+};
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__GNUC__) || defined(_MSC_VER))
+
+#define ZERO256 GDALmm256_setzero_si256()
+
+template <bool COMPUTE_MIN, bool COMPUTE_MAX, bool COMPUTE_OTHER_STATS>
+static void
+ComputeStatisticsByteNoNodata(GPtrDiff_t nBlockPixels,
+                              // assumed to be aligned on 256 bits
+                              const GByte *pData, GUInt32 &nMin, GUInt32 &nMax,
+                              GUIntBig &nSum, GUIntBig &nSumSquare,
+                              GUIntBig &nSampleCount, GUIntBig &nValidCount)
+{
+    // 32-byte alignment may not be enforced by linker, so do it at hand
+    GByte
+        aby32ByteUnaligned[32 + 32 + 32 + (COMPUTE_OTHER_STATS ? 32 + 32 : 0)];
+    GByte *paby32ByteAligned =
+        aby32ByteUnaligned +
+        (32 - (reinterpret_cast<GUIntptr_t>(aby32ByteUnaligned) % 32));
+    GByte *pabyMin = paby32ByteAligned;
+    GByte *pabyMax = paby32ByteAligned + 32;
+    GUInt32 *panSum =
+        COMPUTE_OTHER_STATS
+            ? reinterpret_cast<GUInt32 *>(paby32ByteAligned + 32 * 2)
+            : nullptr;
+    GUInt32 *panSumSquare =
+        COMPUTE_OTHER_STATS
+            ? reinterpret_cast<GUInt32 *>(paby32ByteAligned + 32 * 3)
+            : nullptr;
+
+    CPLAssert((reinterpret_cast<uintptr_t>(pData) % 32) == 0);
+
+    GPtrDiff_t i = 0;
+    // Make sure that sumSquare can fit on uint32
+    // * 8 since we can hold 8 sums per vector register
+    const int nMaxIterationsPerInnerLoop =
+        8 * ((UINT32_MAX / (255 * 255)) & ~31);
+    GPtrDiff_t nOuterLoops = nBlockPixels / nMaxIterationsPerInnerLoop;
+    if ((nBlockPixels % nMaxIterationsPerInnerLoop) != 0)
+        nOuterLoops++;
+
+    GDALm256i ymm_min =
+        GDALmm256_load_si256(reinterpret_cast<const GDALm256i *>(pData + i));
+    GDALm256i ymm_max = ymm_min;
+    [[maybe_unused]] const auto ymm_mask_8bits = GDALmm256_set1_epi16(0xFF);
+
+    for (GPtrDiff_t k = 0; k < nOuterLoops; k++)
+    {
+        const auto iMax =
+            StatsKernelMin(nBlockPixels, i + nMaxIterationsPerInnerLoop);
+
+        // holds 4 uint32 sums in [0], [2], [4] and [6]
+        [[maybe_unused]] GDALm256i ymm_sum = ZERO256;
+        [[maybe_unused]] GDALm256i ymm_sumsquare =
+            ZERO256;  // holds 8 uint32 sums
+        for (; i + 31 < iMax; i += 32)
+        {
+            const GDALm256i ymm = GDALmm256_load_si256(
+                reinterpret_cast<const GDALm256i *>(pData + i));
+            if (COMPUTE_MIN)
+            {
+                ymm_min = GDALmm256_min_epu8(ymm_min, ymm);
+            }
+            if (COMPUTE_MAX)
+            {
+                ymm_max = GDALmm256_max_epu8(ymm_max, ymm);
+            }
+
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                // Extract even-8bit values
+                const GDALm256i ymm_even =
+                    GDALmm256_and_si256(ymm, ymm_mask_8bits);
+                // Compute square of those 16 values as 32 bit result
+                // and add adjacent pairs
+                const GDALm256i ymm_even_square =
+                    GDALmm256_madd_epi16(ymm_even, ymm_even);
+                // Add to the sumsquare accumulator
+                ymm_sumsquare =
+                    GDALmm256_add_epi32(ymm_sumsquare, ymm_even_square);
+
+                // Extract odd-8bit values
+                const GDALm256i ymm_odd = GDALmm256_srli_epi16(ymm, 8);
+                const GDALm256i ymm_odd_square =
+                    GDALmm256_madd_epi16(ymm_odd, ymm_odd);
+                ymm_sumsquare =
+                    GDALmm256_add_epi32(ymm_sumsquare, ymm_odd_square);
+
+                // Now compute the sums
+                ymm_sum = GDALmm256_add_epi32(ymm_sum,
+                                              GDALmm256_sad_epu8(ymm, ZERO256));
+            }
+        }
+
+        if constexpr (COMPUTE_OTHER_STATS)
+        {
+            GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(panSum),
+                                  ymm_sum);
+            GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(panSumSquare),
+                                  ymm_sumsquare);
+
+            nSum += panSum[0] + panSum[2] + panSum[4] + panSum[6];
+            nSumSquare += static_cast<GUIntBig>(panSumSquare[0]) +
+                          panSumSquare[1] + panSumSquare[2] + panSumSquare[3] +
+                          panSumSquare[4] + panSumSquare[5] + panSumSquare[6] +
+                          panSumSquare[7];
+        }
+    }
+
+    if constexpr (COMPUTE_MIN)
+    {
+        GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(pabyMin), ymm_min);
+    }
+    if constexpr (COMPUTE_MAX)
+    {
+        GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(pabyMax), ymm_max);
+    }
+    if constexpr (COMPUTE_MIN || COMPUTE_MAX)
+    {
+        for (int j = 0; j < 32; j++)
+        {
+            if constexpr (COMPUTE_MIN)
+            {
+                if (pabyMin[j] < nMin)
+                    nMin = pabyMin[j];
+            }
+            if constexpr (COMPUTE_MAX)
+            {
+                if (pabyMax[j] > nMax)
+                    nMax = pabyMax[j];
+            }
+        }
+    }
+
+    for (; i < nBlockPixels; i++)
+    {
+        const GUInt32 nValue = pData[i];
+        if constexpr (COMPUTE_MIN)
+        {
+            if (nValue < nMin)
+                nMin = nValue;
+        }
+        if constexpr (COMPUTE_MAX)
+        {
+            if (nValue > nMax)
+                nMax = nValue;
+        }
+        if constexpr (COMPUTE_OTHER_STATS)
+        {
+            nSum += nValue;
+            nSumSquare +=
+                static_cast_for_coverity_scan<GUIntBig>(nValue) * nValue;
+        }
+    }
+
+    if constexpr (COMPUTE_OTHER_STATS)
+    {
+        nSampleCount += static_cast<GUIntBig>(nBlockPixels);
+        nValidCount += static_cast<GUIntBig>(nBlockPixels);
+    }
+}
+
+// SSE2/AVX2 optimization for GByte case
+// In pure SSE2, this relies on gdal_avx2_emulation.hpp. There is no
+// penaly in using the emulation, because, given the mm256 intrinsics used here,
+// there are strictly equivalent to 2 parallel SSE2 streams.
+template <bool COMPUTE_OTHER_STATS>
+struct ComputeStatisticsInternal<GByte, COMPUTE_OTHER_STATS>
+{
+    static void f(int nXCheck, int nBlockXSize, int nYCheck,
+                  // assumed to be aligned on 256 bits
+                  const GByte *pData, bool bHasNoData, GUInt32 nNoDataValue,
+                  GUInt32 &nMin, GUInt32 &nMax, GUIntBig &nSum,
+                  GUIntBig &nSumSquare, GUIntBig &nSampleCount,
+                  GUIntBig &nValidCount)
+    {
+        const auto nBlockPixels = static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
+        if (bHasNoData && nXCheck == nBlockXSize && nBlockPixels >= 32 &&
+            nMin <= nMax)
+        {
+            // 32-byte alignment may not be enforced by linker, so do it at hand
+            GByte aby32ByteUnaligned[32 + 32 + 32 + 32 + 32];
+            GByte *paby32ByteAligned =
+                aby32ByteUnaligned +
+                (32 - (reinterpret_cast<GUIntptr_t>(aby32ByteUnaligned) % 32));
+            GByte *pabyMin = paby32ByteAligned;
+            GByte *pabyMax = paby32ByteAligned + 32;
+            GUInt32 *panSum =
+                reinterpret_cast<GUInt32 *>(paby32ByteAligned + 32 * 2);
+            GUInt32 *panSumSquare =
+                reinterpret_cast<GUInt32 *>(paby32ByteAligned + 32 * 3);
+
+            CPLAssert((reinterpret_cast<uintptr_t>(pData) % 32) == 0);
+
+            GPtrDiff_t i = 0;
+            // Make sure that sumSquare can fit on uint32
+            // * 8 since we can hold 8 sums per vector register
+            const int nMaxIterationsPerInnerLoop =
+                8 * ((UINT32_MAX / (255 * 255)) & ~31);
+            auto nOuterLoops = nBlockPixels / nMaxIterationsPerInnerLoop;
+            if ((nBlockPixels % nMaxIterationsPerInnerLoop) != 0)
+                nOuterLoops++;
+
+            const GDALm256i ymm_nodata =
+                GDALmm256_set1_epi8(static_cast<GByte>(nNoDataValue));
+            // any non noData value in [min,max] would do.
+            const GDALm256i ymm_neutral =
+                GDALmm256_set1_epi8(static_cast<GByte>(nMin));
+            GDALm256i ymm_min = ymm_neutral;
+            GDALm256i ymm_max = ymm_neutral;
+            [[maybe_unused]] const auto ymm_mask_8bits =
+                GDALmm256_set1_epi16(0xFF);
+
+            const GUInt32 nMinThreshold = (nNoDataValue == 0) ? 1 : 0;
+            const GUInt32 nMaxThreshold = (nNoDataValue == 255) ? 254 : 255;
+            const bool bComputeMinMax =
+                nMin > nMinThreshold || nMax < nMaxThreshold;
+
+            for (GPtrDiff_t k = 0; k < nOuterLoops; k++)
+            {
+                const auto iMax = StatsKernelMin(
+                    nBlockPixels, i + nMaxIterationsPerInnerLoop);
+
+                // holds 4 uint32 sums in [0], [2], [4] and [6]
+                [[maybe_unused]] GDALm256i ymm_sum = ZERO256;
+                // holds 8 uint32 sums
+                [[maybe_unused]] GDALm256i ymm_sumsquare = ZERO256;
+                // holds 4 uint32 sums in [0], [2], [4] and [6]
+                [[maybe_unused]] GDALm256i ymm_count_nodata_mul_255 = ZERO256;
+                const auto iInit = i;
+                for (; i + 31 < iMax; i += 32)
+                {
+                    const GDALm256i ymm = GDALmm256_load_si256(
+                        reinterpret_cast<const GDALm256i *>(pData + i));
+
+                    // Check which values are nodata
+                    const GDALm256i ymm_eq_nodata =
+                        GDALmm256_cmpeq_epi8(ymm, ymm_nodata);
+                    if constexpr (COMPUTE_OTHER_STATS)
+                    {
+                        // Count how many values are nodata (due to cmpeq
+                        // putting 255 when condition is met, this will actually
+                        // be 255 times the number of nodata value, spread in 4
+                        // 64 bits words). We can use add_epi32 as the counter
+                        // will not overflow uint32
+                        ymm_count_nodata_mul_255 = GDALmm256_add_epi32(
+                            ymm_count_nodata_mul_255,
+                            GDALmm256_sad_epu8(ymm_eq_nodata, ZERO256));
+                    }
+                    // Replace all nodata values by zero for the purpose of sum
+                    // and sumquare.
+                    const GDALm256i ymm_nodata_by_zero =
+                        GDALmm256_andnot_si256(ymm_eq_nodata, ymm);
+                    if (bComputeMinMax)
+                    {
+                        // Replace all nodata values by a neutral value for the
+                        // purpose of min and max.
+                        const GDALm256i ymm_nodata_by_neutral =
+                            GDALmm256_or_si256(
+                                GDALmm256_and_si256(ymm_eq_nodata, ymm_neutral),
+                                ymm_nodata_by_zero);
+
+                        ymm_min =
+                            GDALmm256_min_epu8(ymm_min, ymm_nodata_by_neutral);
+                        ymm_max =
+                            GDALmm256_max_epu8(ymm_max, ymm_nodata_by_neutral);
+                    }
+
+                    if constexpr (COMPUTE_OTHER_STATS)
+                    {
+                        // Extract even-8bit values
+                        const GDALm256i ymm_even = GDALmm256_and_si256(
+                            ymm_nodata_by_zero, ymm_mask_8bits);
+                        // Compute square of those 16 values as 32 bit result
+                        // and add adjacent pairs
+                        const GDALm256i ymm_even_square =
+                            GDALmm256_madd_epi16(ymm_even, ymm_even);
+                        // Add to the sumsquare accumulator
+                        ymm_sumsquare =
+                            GDALmm256_add_epi32(ymm_sumsquare, ymm_even_square);
+
+                        // Extract odd-8bit values
+                        const GDALm256i ymm_odd =
+                            GDALmm256_srli_epi16(ymm_nodata_by_zero, 8);
+                        const GDALm256i ymm_odd_square =
+                            GDALmm256_madd_epi16(ymm_odd, ymm_odd);
+                        ymm_sumsquare =
+                            GDALmm256_add_epi32(ymm_sumsquare, ymm_odd_square);
+
+                        // Now compute the sums
+                        ymm_sum = GDALmm256_add_epi32(
+                            ymm_sum,
+                            GDALmm256_sad_epu8(ymm_nodata_by_zero, ZERO256));
+                    }
+                }
+
+                if constexpr (COMPUTE_OTHER_STATS)
+                {
+                    GUInt32 *panCoutNoDataMul255 = panSum;
+                    GDALmm256_store_si256(
+                        reinterpret_cast<GDALm256i *>(panCoutNoDataMul255),
+                        ymm_count_nodata_mul_255);
+
+                    nSampleCount += (i - iInit);
+
+                    nValidCount +=
+                        (i - iInit) -
+                        (panCoutNoDataMul255[0] + panCoutNoDataMul255[2] +
+                         panCoutNoDataMul255[4] + panCoutNoDataMul255[6]) /
+                            255;
+
+                    GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(panSum),
+                                          ymm_sum);
+                    GDALmm256_store_si256(
+                        reinterpret_cast<GDALm256i *>(panSumSquare),
+                        ymm_sumsquare);
+                    nSum += panSum[0] + panSum[2] + panSum[4] + panSum[6];
+                    nSumSquare += static_cast<GUIntBig>(panSumSquare[0]) +
+                                  panSumSquare[1] + panSumSquare[2] +
+                                  panSumSquare[3] + panSumSquare[4] +
+                                  panSumSquare[5] + panSumSquare[6] +
+                                  panSumSquare[7];
+                }
+            }
+
+            if (bComputeMinMax)
+            {
+                GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(pabyMin),
+                                      ymm_min);
+                GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(pabyMax),
+                                      ymm_max);
+                for (int j = 0; j < 32; j++)
+                {
+                    if (pabyMin[j] < nMin)
+                        nMin = pabyMin[j];
+                    if (pabyMax[j] > nMax)
+                        nMax = pabyMax[j];
+                }
+            }
+
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                nSampleCount += nBlockPixels - i;
+            }
+            for (; i < nBlockPixels; i++)
+            {
+                const GUInt32 nValue = pData[i];
+                if (nValue == nNoDataValue)
+                    continue;
+                if (nValue < nMin)
+                    nMin = nValue;
+                if (nValue > nMax)
+                    nMax = nValue;
+                if constexpr (COMPUTE_OTHER_STATS)
+                {
+                    nValidCount++;
+                    nSum += nValue;
+                    nSumSquare +=
+                        static_cast_for_coverity_scan<GUIntBig>(nValue) *
+                        nValue;
+                }
+            }
+        }
+        else if (!bHasNoData && nXCheck == nBlockXSize && nBlockPixels >= 32)
+        {
+            if (nMin > 0)
+            {
+                if (nMax < 255)
+                {
+                    ComputeStatisticsByteNoNodata<true, true,
+                                                  COMPUTE_OTHER_STATS>(
+                        nBlockPixels, pData, nMin, nMax, nSum, nSumSquare,
+                        nSampleCount, nValidCount);
+                }
+                else
+                {
+                    ComputeStatisticsByteNoNodata<true, false,
+                                                  COMPUTE_OTHER_STATS>(
+                        nBlockPixels, pData, nMin, nMax, nSum, nSumSquare,
+                        nSampleCount, nValidCount);
+                }
+            }
+            else
+            {
+                if (nMax < 255)
+                {
+                    ComputeStatisticsByteNoNodata<false, true,
+                                                  COMPUTE_OTHER_STATS>(
+                        nBlockPixels, pData, nMin, nMax, nSum, nSumSquare,
+                        nSampleCount, nValidCount);
+                }
+                else
+                {
+                    ComputeStatisticsByteNoNodata<false, false,
+                                                  COMPUTE_OTHER_STATS>(
+                        nBlockPixels, pData, nMin, nMax, nSum, nSumSquare,
+                        nSampleCount, nValidCount);
+                }
+            }
+        }
+        else if (!COMPUTE_OTHER_STATS && !bHasNoData && nXCheck >= 32 &&
+                 (nBlockXSize % 32) == 0)
+        {
+            for (int iY = 0; iY < nYCheck; iY++)
+            {
+                ComputeStatisticsByteNoNodata<true, true, COMPUTE_OTHER_STATS>(
+                    nXCheck, pData + static_cast<size_t>(iY) * nBlockXSize,
+                    nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+            }
+        }
+        else
+        {
+            ComputeStatisticsInternalGeneric<GByte, COMPUTE_OTHER_STATS>::f(
+                nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue,
+                nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+        }
+    }
+};
+
+CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW
+static void UnshiftSumSquare(GUIntBig &nSumSquare, GUIntBig nSumThis,
+                             GUIntBig i)
+{
+    nSumSquare += 32768 * (2 * nSumThis - i * 32768);
+}
+
+// AVX2/SSE2 optimization for GUInt16 case
+template <bool COMPUTE_OTHER_STATS>
+struct ComputeStatisticsInternal<GUInt16, COMPUTE_OTHER_STATS>
+{
+    static void f(int nXCheck, int nBlockXSize, int nYCheck,
+                  // assumed to be aligned on 128 bits
+                  const GUInt16 *pData, bool bHasNoData, GUInt32 nNoDataValue,
+                  GUInt32 &nMin, GUInt32 &nMax, GUIntBig &nSum,
+                  GUIntBig &nSumSquare, GUIntBig &nSampleCount,
+                  GUIntBig &nValidCount)
+    {
+        const auto nBlockPixels = static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
+        if (!bHasNoData && nXCheck == nBlockXSize && nBlockPixels >= 16)
+        {
+            CPLAssert((reinterpret_cast<uintptr_t>(pData) % 16) == 0);
+
+            GPtrDiff_t i = 0;
+            // In SSE2, min_epu16 and max_epu16 do not exist, so shift from
+            // UInt16 to SInt16 to be able to use min_epi16 and max_epi16.
+            // Furthermore the shift is also needed to use madd_epi16
+            const GDALm256i ymm_m32768 = GDALmm256_set1_epi16(-32768);
+            GDALm256i ymm_min = GDALmm256_load_si256(
+                reinterpret_cast<const GDALm256i *>(pData + i));
+            ymm_min = GDALmm256_add_epi16(ymm_min, ymm_m32768);
+            GDALm256i ymm_max = ymm_min;
+            [[maybe_unused]] GDALm256i ymm_sumsquare =
+                ZERO256;  // holds 4 uint64 sums
+
+            // Make sure that sum can fit on uint32
+            // * 8 since we can hold 8 sums per vector register
+            const int nMaxIterationsPerInnerLoop =
+                8 * ((UINT32_MAX / 65535) & ~15);
+            GPtrDiff_t nOuterLoops = nBlockPixels / nMaxIterationsPerInnerLoop;
+            if ((nBlockPixels % nMaxIterationsPerInnerLoop) != 0)
+                nOuterLoops++;
+
+            const bool bComputeMinMax = nMin > 0 || nMax < 65535;
+            [[maybe_unused]] const auto ymm_mask_16bits =
+                GDALmm256_set1_epi32(0xFFFF);
+            [[maybe_unused]] const auto ymm_mask_32bits =
+                GDALmm256_set1_epi64x(0xFFFFFFFF);
+
+            GUIntBig nSumThis = 0;
+            for (int k = 0; k < nOuterLoops; k++)
+            {
+                const auto iMax = StatsKernelMin(
+                    nBlockPixels, i + nMaxIterationsPerInnerLoop);
+
+                [[maybe_unused]] GDALm256i ymm_sum =
+                    ZERO256;  // holds 8 uint32 sums
+                for (; i + 15 < iMax; i += 16)
+                {
+                    const GDALm256i ymm = GDALmm256_load_si256(
+                        reinterpret_cast<const GDALm256i *>(pData + i));
+                    const GDALm256i ymm_shifted =
+                        GDALmm256_add_epi16(ymm, ymm_m32768);
+                    if (bComputeMinMax)
+                    {
+                        ymm_min = GDALmm256_min_epi16(ymm_min, ymm_shifted);
+                        ymm_max = GDALmm256_max_epi16(ymm_max, ymm_shifted);
+                    }
+
+                    if constexpr (COMPUTE_OTHER_STATS)
+                    {
+                        // Note: the int32 range can overflow for (0-32768)^2 +
+                        // (0-32768)^2 = 0x80000000, but as we know the result
+                        // is positive, this is OK as we interpret is a uint32.
+                        const GDALm256i ymm_square =
+                            GDALmm256_madd_epi16(ymm_shifted, ymm_shifted);
+                        ymm_sumsquare = GDALmm256_add_epi64(
+                            ymm_sumsquare,
+                            GDALmm256_and_si256(ymm_square, ymm_mask_32bits));
+                        ymm_sumsquare = GDALmm256_add_epi64(
+                            ymm_sumsquare,
+                            GDALmm256_srli_epi64(ymm_square, 32));
+
+                        // Now compute the sums
+                        ymm_sum = GDALmm256_add_epi32(
+                            ymm_sum, GDALmm256_and_si256(ymm, ymm_mask_16bits));
+                        ymm_sum = GDALmm256_add_epi32(
+                            ymm_sum, GDALmm256_srli_epi32(ymm, 16));
+                    }
+                }
+
+                if constexpr (COMPUTE_OTHER_STATS)
+                {
+                    GUInt32 anSum[8];
+                    GDALmm256_storeu_si256(reinterpret_cast<GDALm256i *>(anSum),
+                                           ymm_sum);
+                    nSumThis += static_cast<GUIntBig>(anSum[0]) + anSum[1] +
+                                anSum[2] + anSum[3] + anSum[4] + anSum[5] +
+                                anSum[6] + anSum[7];
+                }
+            }
+
+            if (bComputeMinMax)
+            {
+                GUInt16 anMin[16];
+                GUInt16 anMax[16];
+
+                // Unshift the result
+                ymm_min = GDALmm256_sub_epi16(ymm_min, ymm_m32768);
+                ymm_max = GDALmm256_sub_epi16(ymm_max, ymm_m32768);
+                GDALmm256_storeu_si256(reinterpret_cast<GDALm256i *>(anMin),
+                                       ymm_min);
+                GDALmm256_storeu_si256(reinterpret_cast<GDALm256i *>(anMax),
+                                       ymm_max);
+                for (int j = 0; j < 16; j++)
+                {
+                    if (anMin[j] < nMin)
+                        nMin = anMin[j];
+                    if (anMax[j] > nMax)
+                        nMax = anMax[j];
+                }
+            }
+
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                GUIntBig anSumSquare[4];
+                GDALmm256_storeu_si256(
+                    reinterpret_cast<GDALm256i *>(anSumSquare), ymm_sumsquare);
+                nSumSquare += anSumSquare[0] + anSumSquare[1] + anSumSquare[2] +
+                              anSumSquare[3];
+
+                // Unshift the sum of squares
+                UnshiftSumSquare(nSumSquare, nSumThis,
+                                 static_cast<GUIntBig>(i));
+
+                nSum += nSumThis;
+
+                for (; i < nBlockPixels; i++)
+                {
+                    const GUInt32 nValue = pData[i];
+                    if (nValue < nMin)
+                        nMin = nValue;
+                    if (nValue > nMax)
+                        nMax = nValue;
+                    nSum += nValue;
+                    nSumSquare +=
+                        static_cast_for_coverity_scan<GUIntBig>(nValue) *
+                        nValue;
+                }
+
+                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+            }
+        }
+        else
+        {
+            ComputeStatisticsInternalGeneric<GUInt16, COMPUTE_OTHER_STATS>::f(
+                nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue,
+                nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+        }
+    }
+};
+
+#endif
+// (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) ||
+// defined(_MSC_VER))
+
+}  // namespace
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+// Instantiated in gdalrasterband_avx2.cpp for T = GByte and GUInt16. Must only
+// be called if CPLHaveRuntimeAVX2() is true.
+template <class T, bool COMPUTE_OTHER_STATS>
+void GDALComputeStatisticsInternal_AVX2(
+    int nXCheck, int nBlockXSize, int nYCheck, const T *pData, bool bHasNoData,
+    GUInt32 nNoDataValue, GUInt32 &nMin, GUInt32 &nMax, GUIntBig &nSum,
+    GUIntBig &nSumSquare, GUIntBig &nSampleCount, GUIntBig &nValidCount);
+
+#endif
+
+//! @endcond
+
+#endif  // GDAL_STATISTICS_KERNELS_HPP_INCLUDED
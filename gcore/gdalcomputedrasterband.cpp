@@ -10,11 +10,35 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "memdataset.h"
 #include "vrtdataset.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
+#include <map>
+#include <optional>
+
+/************************************************************************/
+/*                         GDALComputedWindow                           */
+/************************************************************************/
+
+// Window of an expression evaluated in one go, with the values of its leaf
+// bands (the ones that are not computed), read once whatever the number of
+// nodes referencing them.
+struct GDALComputedWindow
+{
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    std::map<GDALRasterBand *, std::vector<GByte>> oMapLeafValues{};
+};
 
 /************************************************************************/
 /*                        GDALComputedDataset                           */
@@ -29,9 +53,24 @@ class GDALComputedDataset final : public GDALDataset
     std::vector<std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>>
         m_bandDS{};
     std::vector<GDALRasterBand *> m_poBands{};
+    // Nodata value of each source, as it was when the source was added
+    std::vector<std::optional<double>> m_aoSourceNoData{};
+    // Whether this is a copy of an expression restricted to a window
+    const bool m_bIsWindowCopy = false;
     VRTDataset m_oVRTDS;
 
     void AddSources(GDALComputedRasterBand *poBand);
+    void AddWindowSources(const GDALComputedDataset &other,
+                          GDALComputedRasterBand *poBand,
+                          GDALComputedWindow &oWindow);
+
+    void CollectLeafBands(std::vector<GDALRasterBand *> &apoLeaves,
+                          size_t &nLeafReferences) const;
+
+    bool FusedRasterIO(int nXOff, int nYOff, int nXSize, int nYSize,
+                       void *pData, GDALDataType eBufType,
+                       GSpacing nPixelSpace, GSpacing nLineSpace,
+                       CPLErr &eErr);
 
     static const char *
     OperationToFunctionName(GDALComputedRasterBand::Operation op);
@@ -43,6 +82,9 @@ class GDALComputedDataset final : public GDALDataset
   public:
     GDALComputedDataset(const GDALComputedDataset &other);
 
+    GDALComputedDataset(const GDALComputedDataset &other,
+                        GDALComputedWindow &oWindow);
+
     GDALComputedDataset(GDALComputedRasterBand *poBand, int nXSize, int nYSize,
                         GDALDataType eDT, int nBlockXSize, int nBlockYSize,
                         GDALComputedRasterBand::Operation op,
@@ -152,6 +194,52 @@ GDALComputedDataset::GDALComputedDataset(const GDALComputedDataset &other)
 /*                        GDALComputedDataset()                         */
 /************************************************************************/
 
+// Copy of the expression restricted to oWindow, whose leaf bands are
+// replaced by MEM bands over the values of oWindow.oMapLeafValues.
+// Such a copy only references objects it owns, and can thus be evaluated
+// in a worker thread.
+GDALComputedDataset::GDALComputedDataset(const GDALComputedDataset &other,
+                                         GDALComputedWindow &oWindow)
+    : GDALDataset(), m_op(other.m_op), m_aosOptions(other.m_aosOptions),
+      m_poBands(other.m_poBands), m_bIsWindowCopy(true),
+      m_oVRTDS(oWindow.nXSize, oWindow.nYSize,
+               std::min(other.m_oVRTDS.GetBlockXSize(), oWindow.nXSize),
+               std::min(other.m_oVRTDS.GetBlockYSize(), oWindow.nYSize))
+{
+    nRasterXSize = oWindow.nXSize;
+    nRasterYSize = oWindow.nYSize;
+
+    auto poBand = new GDALComputedRasterBand(
+        const_cast<const GDALComputedRasterBand &>(
+            *cpl::down_cast<GDALComputedRasterBand *>(
+                const_cast<GDALComputedDataset &>(other).GetRasterBand(1))),
+        true);
+    poBand->nRasterXSize = nRasterXSize;
+    poBand->nRasterYSize = nRasterYSize;
+    poBand->nBlockXSize = std::min(poBand->nBlockXSize, nRasterXSize);
+    poBand->nBlockYSize = std::min(poBand->nBlockYSize, nRasterYSize);
+    SetBand(1, poBand);
+
+    // Shift the geotransform to the window, for pixel functions that use
+    // pixel coordinates.
+    GDALGeoTransform gt;
+    if (const_cast<VRTDataset &>(other.m_oVRTDS).GetGeoTransform(gt) == CE_None)
+    {
+        gt[0] += oWindow.nXOff * gt[1] + oWindow.nYOff * gt[2];
+        gt[3] += oWindow.nXOff * gt[4] + oWindow.nYOff * gt[5];
+        m_oVRTDS.SetGeoTransform(gt);
+    }
+
+    m_oVRTDS.AddBand(other.m_oVRTDS.GetRasterBand(1)->GetRasterDataType(),
+                     m_aosOptions.List());
+
+    AddWindowSources(other, poBand, oWindow);
+}
+
+/************************************************************************/
+/*                        GDALComputedDataset()                         */
+/************************************************************************/
+
 GDALComputedDataset::GDALComputedDataset(
     GDALComputedRasterBand *poBand, int nXSize, int nYSize, GDALDataType eDT,
     int nBlockXSize, int nBlockYSize, GDALComputedRasterBand::Operation op,
@@ -439,10 +527,12 @@ void GDALComputedDataset::AddSources(GDALComputedRasterBand *poBand)
         {
             poSourcedRasterBand->AddComplexSource(band, -1, -1, -1, -1, -1, -1,
                                                   -1, -1, 0, 1, dfNoData);
+            m_aoSourceNoData.push_back(dfNoData);
         }
         else
         {
             poSourcedRasterBand->AddSimpleSource(band);
+            m_aoSourceNoData.push_back(std::nullopt);
         }
         poSourcedRasterBand->m_papoSources.back()->SetName(CPLSPrintf(
             "source%d",
@@ -463,6 +553,241 @@ void GDALComputedDataset::AddSources(GDALComputedRasterBand *poBand)
     }
 }
 
+/************************************************************************/
+/*               GDALComputedDataset::AddWindowSources()                */
+/************************************************************************/
+
+void GDALComputedDataset::AddWindowSources(const GDALComputedDataset &other,
+                                           GDALComputedRasterBand *poBand,
+                                           GDALComputedWindow &oWindow)
+{
+    auto poSourcedRasterBand =
+        cpl::down_cast<VRTSourcedRasterBand *>(m_oVRTDS.GetRasterBand(1));
+
+    for (size_t i = 0; i < m_poBands.size(); ++i)
+    {
+        GDALRasterBand *&band = m_poBands[i];
+        auto poDS = band->GetDataset();
+        if (auto poComputedDS = dynamic_cast<GDALComputedDataset *>(poDS))
+        {
+            auto poComputedDSNew =
+                std::make_unique<GDALComputedDataset>(*poComputedDS, oWindow);
+            band = poComputedDSNew->GetRasterBand(1);
+            m_bandDS.emplace_back(poComputedDSNew.release());
+        }
+        else
+        {
+            const GDALDataType eDT = band->GetRasterDataType();
+            MEMDataset *poMEMDS = MEMDataset::Create(
+                "", oWindow.nXSize, oWindow.nYSize, 0, eDT, nullptr);
+            GDALRasterBandH hMEMBand =
+                MEMCreateRasterBandEx(poMEMDS, 1,
+                                      oWindow.oMapLeafValues[band].data(), eDT,
+                                      0, 0, false);
+            poMEMDS->AddMEMBand(hMEMBand);
+            band = poMEMDS->GetRasterBand(1);
+            m_bandDS.emplace_back(poMEMDS);
+        }
+
+        // Use the nodata values of the copied expression, and not the
+        // current ones of the leaf bands, so that results are the same.
+        const std::optional<double> &oNoData = other.m_aoSourceNoData[i];
+        if (oNoData.has_value())
+        {
+            poSourcedRasterBand->AddComplexSource(band, -1, -1, -1, -1, -1, -1,
+                                                  -1, -1, 0, 1, *oNoData);
+        }
+        else
+        {
+            poSourcedRasterBand->AddSimpleSource(band);
+        }
+        m_aoSourceNoData.push_back(oNoData);
+        poSourcedRasterBand->m_papoSources.back()->SetName(CPLSPrintf(
+            "source%d",
+            static_cast<int>(poSourcedRasterBand->m_papoSources.size())));
+    }
+
+    const auto poOtherBand = cpl::down_cast<const GDALComputedRasterBand *>(
+        const_cast<GDALComputedDataset &>(other).GetRasterBand(1));
+    poBand->m_bHasNoData = poOtherBand->m_bHasNoData;
+    poBand->m_dfNoDataValue = poOtherBand->m_dfNoDataValue;
+    if (poBand->m_bHasNoData)
+        poSourcedRasterBand->SetNoDataValue(poBand->m_dfNoDataValue);
+}
+
+/************************************************************************/
+/*               GDALComputedDataset::CollectLeafBands()                */
+/************************************************************************/
+
+void GDALComputedDataset::CollectLeafBands(
+    std::vector<GDALRasterBand *> &apoLeaves, size_t &nLeafReferences) const
+{
+    for (GDALRasterBand *band : m_poBands)
+    {
+        if (auto poComputedDS =
+                dynamic_cast<GDALComputedDataset *>(band->GetDataset()))
+        {
+            poComputedDS->CollectLeafBands(apoLeaves, nLeafReferences);
+        }
+        else
+        {
+            ++nLeafReferences;
+            if (std::find(apoLeaves.begin(), apoLeaves.end(), band) ==
+                apoLeaves.end())
+            {
+                apoLeaves.push_back(band);
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                 GDALComputedDataset::FusedRasterIO()                 */
+/************************************************************************/
+
+// Evaluate the whole expression by horizontal strips: the leaf bands of
+// a strip are read once in the calling thread, and all the operators are
+// then applied on them, possibly in a worker thread while the next strips
+// are read. Only a few strips are in memory at a time.
+// Returns false if that is not worth it compared to the evaluation node by
+// node, in which case eErr is not set.
+bool GDALComputedDataset::FusedRasterIO(int nXOff, int nYOff, int nXSize,
+                                        int nYSize, void *pData,
+                                        GDALDataType eBufType,
+                                        GSpacing nPixelSpace,
+                                        GSpacing nLineSpace, CPLErr &eErr)
+{
+    constexpr int STRIP_PIXEL_COUNT = 256 * 1024;
+
+    if (m_bIsWindowCopy)
+        return false;
+
+    std::vector<GDALRasterBand *> apoLeaves;
+    size_t nLeafReferences = 0;
+    CollectLeafBands(apoLeaves, nLeafReferences);
+
+    const int nBlockYSize = m_oVRTDS.GetBlockYSize();
+    int nStripYSize = std::max(1, STRIP_PIXEL_COUNT / nXSize);
+    nStripYSize = std::min(
+        nYSize, DIV_ROUND_UP(nStripYSize, nBlockYSize) * nBlockYSize);
+    const int nStrips = DIV_ROUND_UP(nYSize, nStripYSize);
+    const int nThreads =
+        nStrips > 1 ? std::min(VRTDataset::GetNumThreads(nullptr), nStrips)
+                    : 1;
+    // In a single thread, this only saves reading again leaf bands
+    // referenced several times, which is cheap for small windows whose
+    // blocks are in the block cache.
+    if (nThreads <= 1 && (nLeafReferences == apoLeaves.size() ||
+                          static_cast<GIntBig>(nXSize) * nYSize <
+                              STRIP_PIXEL_COUNT / 4))
+    {
+        return false;
+    }
+
+    struct Strip
+    {
+        GDALComputedWindow oWindow{};
+        std::unique_ptr<GDALComputedDataset> poExpr{};
+        std::atomic<bool> bDone{false};
+    };
+
+    const auto PrepareStrip = [&](Strip &oStrip, int iStrip)
+    {
+        auto &oWindow = oStrip.oWindow;
+        oWindow.nXOff = nXOff;
+        oWindow.nYOff = nYOff + iStrip * nStripYSize;
+        oWindow.nXSize = nXSize;
+        oWindow.nYSize = std::min(nStripYSize, nYOff + nYSize - oWindow.nYOff);
+        for (GDALRasterBand *poLeaf : apoLeaves)
+        {
+            const GDALDataType eDT = poLeaf->GetRasterDataType();
+            auto &abyValues = oWindow.oMapLeafValues[poLeaf];
+            try
+            {
+                abyValues.resize(static_cast<size_t>(oWindow.nXSize) *
+                                 oWindow.nYSize *
+                                 GDALGetDataTypeSizeBytes(eDT));
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate buffer for leaf band values");
+                return false;
+            }
+            if (poLeaf->RasterIO(GF_Read, oWindow.nXOff, oWindow.nYOff,
+                                 oWindow.nXSize, oWindow.nYSize,
+                                 abyValues.data(), oWindow.nXSize,
+                                 oWindow.nYSize, eDT, 0, 0,
+                                 nullptr) != CE_None)
+            {
+                return false;
+            }
+        }
+        oStrip.poExpr = std::make_unique<GDALComputedDataset>(*this, oWindow);
+        return true;
+    };
+
+    const auto EvaluateStrip = [&](const Strip &oStrip)
+    {
+        const auto &oWindow = oStrip.oWindow;
+        return oStrip.poExpr->m_oVRTDS.GetRasterBand(1)->RasterIO(
+            GF_Read, 0, 0, oWindow.nXSize, oWindow.nYSize,
+            static_cast<GByte *>(pData) +
+                (oWindow.nYOff - nYOff) * nLineSpace,
+            oWindow.nXSize, oWindow.nYSize, eBufType, nPixelSpace, nLineSpace,
+            nullptr);
+    };
+
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        eErr = CE_None;
+        for (int iStrip = 0; eErr == CE_None && iStrip < nStrips; ++iStrip)
+        {
+            Strip oStrip;
+            eErr = PrepareStrip(oStrip, iStrip) ? EvaluateStrip(oStrip)
+                                                : CE_Failure;
+        }
+        return true;
+    }
+
+    // Read strips in this thread while previous ones are being evaluated,
+    // with at most one strip waiting for a worker thread.
+    CPLErrorAccumulator oErrorAccumulator;
+    std::atomic<bool> bSuccess{true};
+    std::vector<std::unique_ptr<Strip>> apoStrips(nThreads + 1);
+    for (int iStrip = 0; bSuccess && iStrip < nStrips; ++iStrip)
+    {
+        auto &poStrip = apoStrips[iStrip % apoStrips.size()];
+        while (poStrip && !poStrip->bDone && poJobQueue->WaitEvent())
+        {
+        }
+        poStrip = std::make_unique<Strip>();
+        if (!PrepareStrip(*poStrip, iStrip))
+        {
+            bSuccess = false;
+            break;
+        }
+        Strip *poStripToEvaluate = poStrip.get();
+        poJobQueue->SubmitJob(
+            [poStripToEvaluate, &EvaluateStrip, &bSuccess, &oErrorAccumulator]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                if (bSuccess && EvaluateStrip(*poStripToEvaluate) != CE_None)
+                    bSuccess = false;
+                poStripToEvaluate->bDone = true;
+            });
+    }
+    poJobQueue->WaitCompletion();
+    apoStrips.clear();
+    oErrorAccumulator.ReplayErrors();
+
+    eErr = bSuccess ? CE_None : CE_Failure;
+    return true;
+}
+
 /************************************************************************/
 /*                       OperationToFunctionName()                      */
 /************************************************************************/
@@ -798,6 +1123,21 @@ CPLErr GDALComputedRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                                           void *pData)
 {
     auto l_poDS = cpl::down_cast<GDALComputedDataset *>(poDS);
+
+    int nXValid = 0;
+    int nYValid = 0;
+    GetActualBlockSize(nBlockXOff, nBlockYOff, &nXValid, &nYValid);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    CPLErr eErr = CE_None;
+    if (l_poDS->FusedRasterIO(nBlockXOff * nBlockXSize,
+                              nBlockYOff * nBlockYSize, nXValid, nYValid, pData,
+                              eDataType, nDTSize,
+                              static_cast<GSpacing>(nDTSize) * nBlockXSize,
+                              eErr))
+    {
+        return eErr;
+    }
+
     return l_poDS->m_oVRTDS.GetRasterBand(1)->ReadBlock(nBlockXOff, nBlockYOff,
                                                         pData);
 }
@@ -812,6 +1152,15 @@ CPLErr GDALComputedRasterBand::IRasterIO(
     GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
 {
     auto l_poDS = cpl::down_cast<GDALComputedDataset *>(poDS);
+
+    CPLErr eErr = CE_None;
+    if (eRWFlag == GF_Read && nBufXSize == nXSize && nBufYSize == nYSize &&
+        l_poDS->FusedRasterIO(nXOff, nYOff, nXSize, nYSize, pData, eBufType,
+                              nPixelSpace, nLineSpace, eErr))
+    {
+        return eErr;
+    }
+
     return l_poDS->m_oVRTDS.GetRasterBand(1)->RasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nPixelSpace, nLineSpace, psExtraArg);
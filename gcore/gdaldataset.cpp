@@ -18,11 +18,13 @@
 #include <array>
 #include <cassert>
 #include <climits>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <deque>
 #include <map>
 #include <mutex>
 #include <new>
@@ -38,7 +40,9 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_error.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_alg.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_attrind.h"
 #include "ogr_core.h"
@@ -84,6 +88,26 @@ enum class GDALAllowReadWriteMutexState
 const GIntBig TOTAL_FEATURES_NOT_INIT = -2;
 const GIntBig TOTAL_FEATURES_UNKNOWN = -1;
 
+/** State of the RasterIOAsync() requests of a dataset.
+ *
+ * It counts the requests in flight, so that closing the dataset can wait for
+ * them. On a dataset that is not thread-safe, it also holds the queue of the
+ * requests, which are processed one after the other by a worker thread.
+ * It is shared with the worker threads, so that it outlives the dataset.
+ */
+struct GDALAsyncRasterIOQueue
+{
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+    std::deque<std::function<void()>> aoPendingRequests{};
+    bool bProcessing = false;
+    bool bCancelled = false;
+    int nInFlight = 0;
+    // Threads running the completion callback of a request, which may close
+    // the dataset, and must then not wait for their own request.
+    std::vector<GIntBig> anThreadsInCompletion{};
+};
+
 class GDALDataset::Private
 {
     CPL_DISALLOW_COPY_ASSIGN(Private)
@@ -118,6 +142,9 @@ class GDALDataset::Private
     std::vector<int>
         m_anBandMap{};  // used by RasterIO(). Values are 1, 2, etc.
 
+    std::mutex m_oMutexAsyncRasterIOQueue{};
+    std::shared_ptr<GDALAsyncRasterIOQueue> m_poAsyncRasterIOQueue{};
+
     Private() = default;
 };
 
@@ -296,6 +323,8 @@ GDALDataset::~GDALDataset()
             CPLDebug("GDAL", "GDALClose(%s, this=%p)", GetDescription(), this);
     }
 
+    CancelAsyncRasterIO();
+
     GDALDataset::Close();
 
     /* -------------------------------------------------------------------- */
@@ -1815,6 +1844,7 @@ int GDALDataset::ReleaseRef()
     if (Dereference() <= 0)
     {
         nRefCount = 1;
+        CancelAsyncRasterIO();
         delete this;
         return TRUE;
     }
@@ -3151,6 +3181,352 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     return eErr;
 }
 
+/************************************************************************/
+/*                           RasterIOAsync()                            */
+/************************************************************************/
+
+/**
+ * \brief Read a region of image data from multiple bands, asynchronously.
+ *
+ * This method queues a read request equivalent to
+ * RasterIO(GF_Read, ...) and returns immediately. The request is processed by
+ * a worker thread of the global GDAL thread pool, whose size is controlled by
+ * the GDAL_NUM_THREADS configuration option (defaults to ALL_CPUS).
+ *
+ * If the dataset is thread-safe (see IsThreadSafe(), and the
+ * GDAL_OF_THREAD_SAFE open flag), requests are processed concurrently, which
+ * allows for example a tile server to overlap the network fetches and
+ * decoding of many window reads issued from a single thread. Otherwise,
+ * requests are processed sequentially, in their submission order, but still
+ * without blocking the calling thread.
+ *
+ * \warning On a dataset that is not thread-safe, nothing serializes the
+ * queued requests with other uses of the dataset: the caller must not call
+ * any other method of the dataset, or of its bands, such as the synchronous
+ * RasterIO(), until all its requests are completed.
+ *
+ * The buffer pointed by pData must be kept alive, and not accessed, until
+ * the request is completed. Errors are emitted in the worker thread that
+ * processes the request. If RasterIO() or pfnCompletion throw an exception,
+ * an error is emitted and the request completes with CE_Failure.
+ *
+ * Closing the dataset with GDALClose() or ReleaseRef() cancels the requests
+ * that have not started yet, which complete with CE_Failure, and waits for
+ * the completion of the ones being processed. This may be done from a
+ * completion callback. While requests are in flight, the dataset must not be
+ * destroyed with a plain delete, as the destructor of GDALDataset only waits
+ * for them once the destructors of derived classes have run.
+ *
+ * If the parameters are invalid, or if the dataset is being closed, an error
+ * is emitted, pfnCompletion is not called, and the returned future is
+ * immediately ready with CE_Failure.
+ *
+ * Arguments have the same meaning as for RasterIO(). panBandMap and
+ * psExtraArg are copied, and do not need to be kept alive.
+ *
+ * This method is the same as the C function GDALDatasetRasterIOAsync().
+ *
+ * @param pfnCompletion Optional callback, called by the worker thread with
+ * the result of the request, just before the returned future becomes ready.
+ *
+ * @return a future whose value is the result of the request.
+ *
+ * @since GDAL 3.12
+ */
+
+std::future<CPLErr> GDALDataset::RasterIOAsync(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, int nBandCount,
+    const int *panBandMap, GSpacing nPixelSpace, GSpacing nLineSpace,
+    GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg,
+    std::function<void(CPLErr)> pfnCompletion)
+{
+    std::future<CPLErr> oFuture;
+    if (!QueueRasterIOAsync(nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                            nBufYSize, eBufType, nBandCount, panBandMap,
+                            nPixelSpace, nLineSpace, nBandSpace, psExtraArg,
+                            std::move(pfnCompletion), oFuture))
+    {
+        std::promise<CPLErr> oPromise;
+        oFuture = oPromise.get_future();
+        oPromise.set_value(CE_Failure);
+    }
+    return oFuture;
+}
+
+/************************************************************************/
+/*                         QueueRasterIOAsync()                         */
+/************************************************************************/
+
+/** Implementation of RasterIOAsync(), that returns false, without calling
+ * pfnCompletion, if the request could not be queued.
+ */
+bool GDALDataset::QueueRasterIOAsync(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, int nBandCount,
+    const int *panBandMap, GSpacing nPixelSpace, GSpacing nLineSpace,
+    GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg,
+    std::function<void(CPLErr)> pfnCompletion, std::future<CPLErr> &oFuture)
+{
+    int bStopProcessing = FALSE;
+    if (ValidateRasterIOOrAdviseReadParameters(
+            "RasterIOAsync()", &bStopProcessing, nXOff, nYOff, nXSize, nYSize,
+            nBufXSize, nBufYSize, nBandCount, panBandMap) != CE_None)
+    {
+        return false;
+    }
+
+    std::vector<int> anBandMap;
+    for (int i = 0; i < nBandCount; ++i)
+        anBandMap.push_back(panBandMap ? panBandMap[i] : i + 1);
+    GDALRasterIOExtraArg sExtraArg;
+    GDALCopyRasterIOExtraArg(&sExtraArg, psExtraArg);
+
+    std::shared_ptr<GDALAsyncRasterIOQueue> poQueue;
+    if (m_poPrivate)
+    {
+        std::lock_guard oLock(m_poPrivate->m_oMutexAsyncRasterIOQueue);
+        if (!m_poPrivate->m_poAsyncRasterIOQueue)
+            m_poPrivate->m_poAsyncRasterIOQueue =
+                std::make_shared<GDALAsyncRasterIOQueue>();
+        poQueue = m_poPrivate->m_poAsyncRasterIOQueue;
+    }
+    if (poQueue)
+    {
+        std::lock_guard oLock(poQueue->oMutex);
+        if (poQueue->bCancelled)
+        {
+            ReportError(CE_Failure, CPLE_AppDefined,
+                        "RasterIOAsync(): dataset is being closed");
+            return false;
+        }
+        ++poQueue->nInFlight;
+    }
+
+    auto poPromise = std::make_shared<std::promise<CPLErr>>();
+    oFuture = poPromise->get_future();
+    // Once the request is cancelled, or once nInFlight has been decremented,
+    // the dataset may have been destroyed and "this" must not be used.
+    const auto ProcessRequest =
+        [this, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+         eBufType, anBandMap, nPixelSpace, nLineSpace, nBandSpace, sExtraArg,
+         poPromise, pfnCompletion, poQueue]()
+    {
+        bool bCancelled = false;
+        if (poQueue)
+        {
+            std::lock_guard oLock(poQueue->oMutex);
+            bCancelled = poQueue->bCancelled;
+        }
+
+        CPLErr eErr = CE_Failure;
+        if (bCancelled)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "RasterIOAsync(): request cancelled as the dataset is "
+                     "being closed");
+        }
+        else
+        {
+            try
+            {
+                GDALRasterIOExtraArg sRequestExtraArg(sExtraArg);
+                eErr = RasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize, pData,
+                                nBufXSize, nBufYSize, eBufType,
+                                static_cast<int>(anBandMap.size()),
+                                anBandMap.data(), nPixelSpace, nLineSpace,
+                                nBandSpace, &sRequestExtraArg);
+            }
+            catch (const std::exception &e)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "RasterIOAsync(): exception thrown: %s", e.what());
+                eErr = CE_Failure;
+            }
+        }
+
+        if (pfnCompletion)
+        {
+            const GIntBig nThreadId = CPLGetPID();
+            if (poQueue)
+            {
+                std::lock_guard oLock(poQueue->oMutex);
+                poQueue->anThreadsInCompletion.push_back(nThreadId);
+            }
+            try
+            {
+                pfnCompletion(eErr);
+            }
+            catch (const std::exception &e)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "RasterIOAsync(): exception thrown by completion "
+                         "callback: %s",
+                         e.what());
+                eErr = CE_Failure;
+            }
+            if (poQueue)
+            {
+                std::lock_guard oLock(poQueue->oMutex);
+                auto &anThreads = poQueue->anThreadsInCompletion;
+                anThreads.erase(
+                    std::find(anThreads.begin(), anThreads.end(), nThreadId));
+            }
+        }
+        poPromise->set_value(eErr);
+
+        if (poQueue)
+        {
+            std::lock_guard oLock(poQueue->oMutex);
+            --poQueue->nInFlight;
+            poQueue->oCV.notify_all();
+        }
+    };
+
+    const char *pszThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    const int nThreads =
+        std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszThreads)));
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool == nullptr || !poQueue)
+    {
+        ProcessRequest();
+        return true;
+    }
+
+    if (IsThreadSafe(GDAL_OF_RASTER))
+    {
+        if (!poThreadPool->SubmitJob(ProcessRequest))
+            ProcessRequest();
+        return true;
+    }
+
+    bool bStartProcessing;
+    {
+        std::lock_guard oLock(poQueue->oMutex);
+        poQueue->aoPendingRequests.push_back(ProcessRequest);
+        bStartProcessing = !poQueue->bProcessing;
+        poQueue->bProcessing = true;
+    }
+    if (bStartProcessing)
+    {
+        const auto ProcessQueue = [poQueue]()
+        {
+            while (true)
+            {
+                std::function<void()> request;
+                {
+                    std::lock_guard oLock(poQueue->oMutex);
+                    if (poQueue->aoPendingRequests.empty())
+                    {
+                        poQueue->bProcessing = false;
+                        return;
+                    }
+                    request = std::move(poQueue->aoPendingRequests.front());
+                    poQueue->aoPendingRequests.pop_front();
+                }
+                request();
+            }
+        };
+        if (!poThreadPool->SubmitJob(ProcessQueue))
+            ProcessQueue();
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       CancelAsyncRasterIO()                          */
+/************************************************************************/
+
+/** Cancels the RasterIOAsync() requests that have not started yet, and waits
+ * for the completion of the ones being processed.
+ *
+ * Called by GDALClose() and ReleaseRef() before the dataset is closed, and by
+ * the destructor as a last resort. When called from the completion callback
+ * of a request, that request is not waited for.
+ */
+void GDALDataset::CancelAsyncRasterIO()
+{
+    if (m_poPrivate == nullptr)
+        return;
+
+    std::shared_ptr<GDALAsyncRasterIOQueue> poQueue;
+    {
+        std::lock_guard oLock(m_poPrivate->m_oMutexAsyncRasterIOQueue);
+        poQueue = m_poPrivate->m_poAsyncRasterIOQueue;
+    }
+    if (!poQueue)
+        return;
+
+    // Complete the queued requests from this thread, rather than waiting for
+    // the worker thread to do it, as it might be the thread pool job that is
+    // closing the dataset.
+    std::deque<std::function<void()>> aoPendingRequests;
+    {
+        std::lock_guard oLock(poQueue->oMutex);
+        poQueue->bCancelled = true;
+        std::swap(aoPendingRequests, poQueue->aoPendingRequests);
+    }
+    for (auto &request : aoPendingRequests)
+        request();
+
+    std::unique_lock oLock(poQueue->oMutex);
+    const auto &anThreads = poQueue->anThreadsInCompletion;
+    const int nOwnRequests = static_cast<int>(
+        std::count(anThreads.begin(), anThreads.end(), CPLGetPID()));
+    poQueue->oCV.wait(oLock, [&poQueue, nOwnRequests]
+                      { return poQueue->nInFlight == nOwnRequests; });
+}
+
+/************************************************************************/
+/*                      GDALDatasetRasterIOAsync()                      */
+/************************************************************************/
+
+/**
+ * \brief Read a region of image data from multiple bands, asynchronously.
+ *
+ * The request is queued and this function returns immediately. Its result is
+ * passed to pfnCompletion, which is called by the worker thread that
+ * processes the request. If the request could not be queued, for example
+ * because of invalid parameters, pfnCompletion is not called.
+ *
+ * @return CE_None if the request has been queued, CE_Failure otherwise.
+ *
+ * @see GDALDataset::RasterIOAsync()
+ * @since GDAL 3.12
+ */
+
+CPLErr GDALDatasetRasterIOAsync(
+    GDALDatasetH hDS, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, const int *panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace,
+    GDALRasterIOExtraArg *psExtraArg,
+    GDALRasterIOAsyncCompletionFunc pfnCompletion, void *pCompletionData)
+
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetRasterIOAsync", CE_Failure);
+
+    GDALDataset *poDS = GDALDataset::FromHandle(hDS);
+
+    std::function<void(CPLErr)> oCompletion;
+    if (pfnCompletion)
+    {
+        oCompletion = [pfnCompletion, pCompletionData](CPLErr eErr)
+        { pfnCompletion(eErr, pCompletionData); };
+    }
+    std::future<CPLErr> oFuture;
+    return poDS->QueueRasterIOAsync(nXOff, nYOff, nXSize, nYSize, pData,
+                                    nBufXSize, nBufYSize, eBufType, nBandCount,
+                                    panBandMap, nPixelSpace, nLineSpace,
+                                    nBandSpace, psExtraArg,
+                                    std::move(oCompletion), oFuture)
+               ? CE_None
+               : CE_Failure;
+}
+
 /************************************************************************/
 /*                        GDALDatasetRasterIO()                         */
 /************************************************************************/
@@ -4503,6 +4879,7 @@ CPLErr CPL_STDCALL GDALClose(GDALDatasetH hDS)
         if (poDS->Dereference() > 0)
             return CE_None;
 
+        poDS->CancelAsyncRasterIO();
         CPLErr eErr = poDS->Close();
         delete poDS;
 
@@ -4517,6 +4894,7 @@ CPLErr CPL_STDCALL GDALClose(GDALDatasetH hDS)
     /* -------------------------------------------------------------------- */
     /*      This is not shared dataset, so directly delete it.              */
     /* -------------------------------------------------------------------- */
+    poDS->CancelAsyncRasterIO();
     CPLErr eErr = poDS->Close();
     delete poDS;
 
@@ -25,12 +25,18 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
@@ -42,6 +48,7 @@
 #include "gdal_priv_templates.hpp"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_minmax_element.hpp"
+#include "gdal_thread_pool.h"
 #include "gdalmultidim_priv.h"
 
 /************************************************************************/
@@ -4131,6 +4138,234 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
                                       abs(dfVal1 + dfVal2) * ulp;
 }
 
+/************************************************************************/
+/*                    GDALSampledBlockProcessor                         */
+/************************************************************************/
+
+namespace
+{
+
+/** Helper used by GetHistogram(), ComputeStatistics() and
+ * ComputeRasterMinMax() to iterate over the sampled blocks of a band.
+ *
+ * Blocks, and the corresponding mask, are fetched in the calling thread,
+ * since drivers are generally not thread-safe. When the GDAL_NUM_THREADS
+ * configuration option is set to a value greater than 1, their content is
+ * processed by worker threads of the global thread pool.
+ *
+ * The processing function receives a context index, in the
+ * [0, GetContextCount()-1] range, that is not used concurrently by other
+ * threads, so that partial results can be accumulated per context and
+ * merged at the end.
+ */
+class GDALSampledBlockProcessor
+{
+  public:
+    /** Function processing a block. Returns false to stop iterating. */
+    using ProcessFunc = std::function<bool(
+        int iContext, GIntBig iSampledBlock, void *pData,
+        const GByte *pabyMaskData, int nXCheck, int nYCheck)>;
+
+    GDALSampledBlockProcessor(GDALRasterBand *poBand,
+                              GDALRasterBand *poMaskBand, int nSampleRate);
+
+    /** Whether the GDAL_NUM_THREADS configuration option is set. When it
+     * is, callers should make sure that their result does not depend on
+     * the order in which blocks are processed, so that it does not depend
+     * on the number of threads. */
+    bool IsThreadCountSet() const
+    {
+        return m_bThreadCountSet;
+    }
+
+    int GetContextCount() const
+    {
+        return static_cast<int>(m_aabyMaskData.size());
+    }
+
+    GIntBig GetSampledBlockCount() const
+    {
+        return (m_nTotalBlocks + m_nSampleRate - 1) / m_nSampleRate;
+    }
+
+    bool Run(const ProcessFunc &pfnProcess, const char *pszMessage,
+             GDALProgressFunc pfnProgress, void *pProgressData);
+
+  private:
+    GDALRasterBand *const m_poBand;
+    GDALRasterBand *const m_poMaskBand;
+    const int m_nSampleRate;
+    GIntBig m_nTotalBlocks = 0;
+    int m_nBlocksPerRow = 0;
+    int m_nBlockXSize = 0;
+    int m_nBlockYSize = 0;
+    bool m_bThreadCountSet = false;
+    CPLWorkerThreadPool *m_poThreadPool = nullptr;
+    std::vector<std::vector<GByte>> m_aabyMaskData{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALSampledBlockProcessor)
+};
+
+/************************************************************************/
+/*                     GDALSampledBlockProcessor()                      */
+/************************************************************************/
+
+GDALSampledBlockProcessor::GDALSampledBlockProcessor(
+    GDALRasterBand *poBand, GDALRasterBand *poMaskBand, int nSampleRate)
+    : m_poBand(poBand), m_poMaskBand(poMaskBand), m_nSampleRate(nSampleRate)
+{
+    poBand->GetBlockSize(&m_nBlockXSize, &m_nBlockYSize);
+    m_nBlocksPerRow = DIV_ROUND_UP(poBand->GetXSize(), m_nBlockXSize);
+    const int nBlocksPerColumn =
+        DIV_ROUND_UP(poBand->GetYSize(), m_nBlockYSize);
+    m_nTotalBlocks = static_cast<GIntBig>(m_nBlocksPerRow) * nBlocksPerColumn;
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    m_bThreadCountSet = pszThreads != nullptr;
+    int nContexts = 1;
+    if (pszThreads)
+    {
+        const int nThreads = static_cast<int>(std::min<GIntBig>(
+            GetSampledBlockCount(),
+            std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                          ? CPLGetNumCPUs()
+                                          : atoi(pszThreads)))));
+        if (nThreads > 1)
+        {
+            m_poThreadPool = GDALGetGlobalThreadPool(nThreads);
+            // Allow the calling thread to fetch blocks while all worker
+            // threads are busy processing other ones.
+            if (m_poThreadPool)
+                nContexts = 2 * nThreads;
+        }
+    }
+    m_aabyMaskData.resize(nContexts);
+}
+
+/************************************************************************/
+/*                                Run()                                 */
+/************************************************************************/
+
+bool GDALSampledBlockProcessor::Run(const ProcessFunc &pfnProcess,
+                                    const char *pszMessage,
+                                    GDALProgressFunc pfnProgress,
+                                    void *pProgressData)
+{
+    const size_t nMaskSize =
+        m_poMaskBand ? static_cast<size_t>(m_nBlockXSize) * m_nBlockYSize : 0;
+    try
+    {
+        for (auto &abyMaskData : m_aabyMaskData)
+            abyMaskData.resize(nMaskSize);
+    }
+    catch (const std::exception &)
+    {
+        m_poBand->ReportError(CE_Failure, CPLE_OutOfMemory,
+                              "Out of memory in %s", pszMessage);
+        return false;
+    }
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::vector<int> anFreeContexts;
+    for (int i = GetContextCount() - 1; i >= 0; --i)
+        anFreeContexts.push_back(i);
+    std::atomic<bool> bStop{false};
+
+    const auto ProcessBlock = [&pfnProcess, &oMutex, &oCV, &anFreeContexts,
+                               &bStop](int iContext, GIntBig iSampledBlock,
+                                       GDALRasterBlock *poBlock,
+                                       const GByte *pabyMaskData, int nXCheck,
+                                       int nYCheck)
+    {
+        if (!bStop && !pfnProcess(iContext, iSampledBlock,
+                                  poBlock->GetDataRef(), pabyMaskData,
+                                  nXCheck, nYCheck))
+        {
+            bStop = true;
+        }
+        poBlock->DropLock();
+
+        std::lock_guard<std::mutex> oLock(oMutex);
+        anFreeContexts.push_back(iContext);
+        oCV.notify_one();
+    };
+
+    auto poJobQueue = m_poThreadPool ? m_poThreadPool->CreateJobQueue()
+                                     : std::unique_ptr<CPLJobQueue>();
+
+    bool bRet = true;
+    GIntBig iSampledBlock = 0;
+    for (GIntBig iSampleBlock = 0; iSampleBlock < m_nTotalBlocks && !bStop;
+         iSampleBlock += m_nSampleRate, ++iSampledBlock)
+    {
+        if (pfnProgress &&
+            !pfnProgress(static_cast<double>(iSampleBlock) /
+                             static_cast<double>(m_nTotalBlocks),
+                         pszMessage, pProgressData))
+        {
+            m_poBand->ReportError(CE_Failure, CPLE_UserInterrupt,
+                                  "User terminated");
+            bRet = false;
+            break;
+        }
+
+        int iContext;
+        {
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock, [&anFreeContexts]
+                     { return !anFreeContexts.empty(); });
+            iContext = anFreeContexts.back();
+            anFreeContexts.pop_back();
+        }
+
+        const int iYBlock = static_cast<int>(iSampleBlock / m_nBlocksPerRow);
+        const int iXBlock = static_cast<int>(iSampleBlock % m_nBlocksPerRow);
+
+        int nXCheck = 0, nYCheck = 0;
+        m_poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+        GByte *pabyMaskData =
+            m_poMaskBand ? m_aabyMaskData[iContext].data() : nullptr;
+        GDALRasterBlock *poBlock = nullptr;
+        if ((!m_poMaskBand ||
+             m_poMaskBand->RasterIO(GF_Read, iXBlock * m_nBlockXSize,
+                                    iYBlock * m_nBlockYSize, nXCheck, nYCheck,
+                                    pabyMaskData, nXCheck, nYCheck, GDT_Byte,
+                                    0, m_nBlockXSize, nullptr) == CE_None) &&
+            (poBlock = m_poBand->GetLockedBlockRef(iXBlock, iYBlock)) !=
+                nullptr)
+        {
+            if (!poJobQueue ||
+                !poJobQueue->SubmitJob(
+                    [&ProcessBlock, iContext, iSampledBlock, poBlock,
+                     pabyMaskData, nXCheck, nYCheck]()
+                    {
+                        ProcessBlock(iContext, iSampledBlock, poBlock,
+                                     pabyMaskData, nXCheck, nYCheck);
+                    }))
+            {
+                ProcessBlock(iContext, iSampledBlock, poBlock, pabyMaskData,
+                             nXCheck, nYCheck);
+            }
+        }
+        else
+        {
+            std::lock_guard<std::mutex> oLock(oMutex);
+            anFreeContexts.push_back(iContext);
+            bRet = false;
+            break;
+        }
+    }
+
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    return bRet;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                            GetHistogram()                            */
 /************************************************************************/
@@ -4157,6 +4392,10 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
  * in generating histogram based luts for instance.  Generally bApproxOK is
  * much faster than an exactly computed histogram.
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to ALL_CPUS or a number of threads, so that the pixel values of blocks
+ * are processed by several threads.
+ *
  * This method is the same as the C functions GDALGetRasterHistogram() and
  * GDALGetRasterHistogramEx().
  *
@@ -4507,15 +4746,21 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 nSampleRate += 1;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
+        GDALSampledBlockProcessor oProcessor(this, poMaskBand, nSampleRate);
+
+        // Histograms of contexts other than the first one, summed at the end
+        std::vector<std::vector<GUIntBig>> aanContextHistograms;
+        try
         {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
+            aanContextHistograms.resize(oProcessor.GetContextCount() - 1);
+            for (auto &anHistogram : aanContextHistograms)
+                anHistogram.resize(nBuckets);
+        }
+        catch (const std::exception &)
+        {
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory in GetHistogram()");
+            return CE_Failure;
         }
 
         /* --------------------------------------------------------------------
@@ -4523,44 +4768,16 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
         /*      Read the blocks, and add to histogram. */
         /* --------------------------------------------------------------------
          */
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
-        {
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Histogram", pProgressData))
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            void *pData = poBlock->GetDataRef();
+        const auto ProcessBlock =
+            [this, panHistogram, &aanContextHistograms, bSignedByte, dfScale,
+             dfMin, nBuckets, &sNoDataValues,
+             bIncludeOutOfRange](int iContext, GIntBig /* iSampledBlock */,
+                                 void *pData, const GByte *pabyMaskData,
+                                 int nXCheck, int nYCheck)
+        {
+            GUIntBig *const panBlockHistogram =
+                iContext == 0 ? panHistogram
+                              : aanContextHistograms[iContext - 1].data();
 
             // this is a special case for a common situation.
             if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
@@ -4579,12 +4796,11 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                           (pabyData[i] ==
                            static_cast<GByte>(sNoDataValues.dfNoDataValue))))
                     {
-                        panHistogram[pabyData[i]]++;
+                        panBlockHistogram[pabyData[i]]++;
                     }
                 }
 
-                poBlock->DropLock();
-                continue;  // To next sample block.
+                return true;
             }
 
             // This isn't the fastest way to do this, but is easier for now.
@@ -4718,8 +4934,7 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                         case GDT_Unknown:
                         case GDT_TypeCount:
                             CPLAssert(false);
-                            CPLFree(pabyMaskData);
-                            return CE_Failure;
+                            return false;
                     }
 
                     if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
@@ -4735,24 +4950,34 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                     if (dfIndex < 0)
                     {
                         if (bIncludeOutOfRange)
-                            panHistogram[0]++;
+                            panBlockHistogram[0]++;
                     }
                     else if (dfIndex >= nBuckets)
                     {
                         if (bIncludeOutOfRange)
-                            ++panHistogram[nBuckets - 1];
+                            ++panBlockHistogram[nBuckets - 1];
                     }
                     else
                     {
-                        ++panHistogram[static_cast<int>(dfIndex)];
+                        ++panBlockHistogram[static_cast<int>(dfIndex)];
                     }
                 }
             }
 
-            poBlock->DropLock();
+            return true;
+        };
+
+        if (!oProcessor.Run(ProcessBlock, "Compute Histogram", pfnProgress,
+                            pProgressData))
+        {
+            return CE_Failure;
         }
 
-        CPLFree(pabyMaskData);
+        for (const auto &anHistogram : aanContextHistograms)
+        {
+            for (int i = 0; i < nBuckets; ++i)
+                panHistogram[i] += anHistogram[i];
+        }
     }
 
     pfnProgress(1.0, "Compute Histogram", pProgressData);
@@ -5378,1038 +5603,131 @@ class GDALUInt128
 };
 #endif
 
+#include "gdal_statistics_kernels.hpp"
+
+// When not building with -mavx2, use the AVX2 flavor of the kernels built
+// in gdalrasterband_avx2.cpp if the CPU supports it.
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(__AVX2__) &&                \
+    (defined(__x86_64) || defined(_M_X64))
+#define USE_RUNTIME_AVX2_DISPATCH
+#endif
+
 /************************************************************************/
-/*                    ComputeStatisticsInternal()                       */
+/*                 ComputeStatisticsInternalDispatch()                  */
 /************************************************************************/
 
-// Just to make coverity scan happy w.r.t overflow_before_widen, but otherwise
-// not needed.
-#define static_cast_for_coverity_scan static_cast
+template <class T, bool COMPUTE_OTHER_STATS>
+static void ComputeStatisticsInternalDispatch(
+    int nXCheck, int nBlockXSize, int nYCheck, const T *pData, bool bHasNoData,
+    GUInt32 nNoDataValue, GUInt32 &nMin, GUInt32 &nMax, GUIntBig &nSum,
+    GUIntBig &nSumSquare, GUIntBig &nSampleCount, GUIntBig &nValidCount)
+{
+#ifdef USE_RUNTIME_AVX2_DISPATCH
+    if (CPLHaveRuntimeAVX2())
+    {
+        GDALComputeStatisticsInternal_AVX2<T, COMPUTE_OTHER_STATS>(
+            nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue,
+            nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+        return;
+    }
+#endif
+    ComputeStatisticsInternal<T, COMPUTE_OTHER_STATS>::f(
+        nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue, nMin,
+        nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+}
 
-// The rationale for below optimizations is detailed in statistics.txt
+/************************************************************************/
+/*                          GetPixelValue()                             */
+/************************************************************************/
 
-// Use with T = GByte or GUInt16 only !
-template <class T, bool COMPUTE_OTHER_STATS>
-struct ComputeStatisticsInternalGeneric
+static inline double GetPixelValue(GDALDataType eDataType, bool bSignedByte,
+                                   const void *pData, GPtrDiff_t iOffset,
+                                   const GDALNoDataValues &sNoDataValues,
+                                   bool &bValid)
 {
-    static void f(int nXCheck, int nBlockXSize, int nYCheck, const T *pData,
-                  bool bHasNoData, GUInt32 nNoDataValue, GUInt32 &nMin,
-                  GUInt32 &nMax, GUIntBig &nSum, GUIntBig &nSumSquare,
-                  GUIntBig &nSampleCount, GUIntBig &nValidCount)
+    bValid = true;
+    double dfValue = 0;
+    switch (eDataType)
     {
-        static_assert(std::is_same<T, GByte>::value ||
-                          std::is_same<T, GUInt16>::value,
-                      "bad type for T");
-        if (bHasNoData)
+        case GDT_Byte:
         {
-            // General case
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    const GUInt32 nValue = pData[iOffset];
-                    if (nValue == nNoDataValue)
-                        continue;
-                    if (nValue < nMin)
-                        nMin = nValue;
-                    if (nValue > nMax)
-                        nMax = nValue;
-                    if constexpr (COMPUTE_OTHER_STATS)
-                    {
-                        nValidCount++;
-                        nSum += nValue;
-                        nSumSquare +=
-                            static_cast_for_coverity_scan<GUIntBig>(nValue) *
-                            nValue;
-                    }
-                }
-            }
-            if constexpr (COMPUTE_OTHER_STATS)
+            if (bSignedByte)
+                dfValue = static_cast<const signed char *>(pData)[iOffset];
+            else
+                dfValue = static_cast<const GByte *>(pData)[iOffset];
+            break;
+        }
+        case GDT_Int8:
+            dfValue = static_cast<const GInt8 *>(pData)[iOffset];
+            break;
+        case GDT_UInt16:
+            dfValue = static_cast<const GUInt16 *>(pData)[iOffset];
+            break;
+        case GDT_Int16:
+            dfValue = static_cast<const GInt16 *>(pData)[iOffset];
+            break;
+        case GDT_UInt32:
+            dfValue = static_cast<const GUInt32 *>(pData)[iOffset];
+            break;
+        case GDT_Int32:
+            dfValue = static_cast<const GInt32 *>(pData)[iOffset];
+            break;
+        case GDT_UInt64:
+            dfValue = static_cast<double>(
+                static_cast<const std::uint64_t *>(pData)[iOffset]);
+            break;
+        case GDT_Int64:
+            dfValue = static_cast<double>(
+                static_cast<const std::int64_t *>(pData)[iOffset]);
+            break;
+        case GDT_Float16:
+        {
+            using namespace std;
+            const GFloat16 hfValue =
+                static_cast<const GFloat16 *>(pData)[iOffset];
+            if (isnan(hfValue) ||
+                (sNoDataValues.bGotFloat16NoDataValue &&
+                 ARE_REAL_EQUAL(hfValue, sNoDataValues.hfNoDataValue)))
             {
-                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                bValid = false;
+                return 0.0;
             }
+            dfValue = hfValue;
+            return dfValue;
         }
-        else if (nMin == std::numeric_limits<T>::lowest() &&
-                 nMax == std::numeric_limits<T>::max())
+        case GDT_Float32:
         {
-            if constexpr (COMPUTE_OTHER_STATS)
+            const float fValue = static_cast<const float *>(pData)[iOffset];
+            if (std::isnan(fValue) ||
+                (sNoDataValues.bGotFloatNoDataValue &&
+                 ARE_REAL_EQUAL(fValue, sNoDataValues.fNoDataValue)))
             {
-                // Optimization when there is no nodata and we know we have already
-                // reached the min and max
-                for (int iY = 0; iY < nYCheck; iY++)
-                {
-                    int iX;
-                    for (iX = 0; iX + 3 < nXCheck; iX += 4)
-                    {
-                        const GPtrDiff_t iOffset =
-                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                        const GUIntBig nValue = pData[iOffset];
-                        const GUIntBig nValue2 = pData[iOffset + 1];
-                        const GUIntBig nValue3 = pData[iOffset + 2];
-                        const GUIntBig nValue4 = pData[iOffset + 3];
-                        nSum += nValue;
-                        nSumSquare += nValue * nValue;
-                        nSum += nValue2;
-                        nSumSquare += nValue2 * nValue2;
-                        nSum += nValue3;
-                        nSumSquare += nValue3 * nValue3;
-                        nSum += nValue4;
-                        nSumSquare += nValue4 * nValue4;
-                    }
-                    for (; iX < nXCheck; ++iX)
-                    {
-                        const GPtrDiff_t iOffset =
-                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                        const GUIntBig nValue = pData[iOffset];
-                        nSum += nValue;
-                        nSumSquare += nValue * nValue;
-                    }
-                }
-                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                bValid = false;
+                return 0.0;
             }
+            dfValue = double(fValue);
+            return dfValue;
         }
-        else
-        {
-            for (int iY = 0; iY < nYCheck; iY++)
+        case GDT_Float64:
+            dfValue = static_cast<const double *>(pData)[iOffset];
+            if (std::isnan(dfValue))
             {
-                int iX;
-                for (iX = 0; iX + 1 < nXCheck; iX += 2)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    const GUInt32 nValue = pData[iOffset];
-                    const GUInt32 nValue2 = pData[iOffset + 1];
-                    if (nValue < nValue2)
-                    {
-                        if (nValue < nMin)
-                            nMin = nValue;
-                        if (nValue2 > nMax)
-                            nMax = nValue2;
-                    }
-                    else
-                    {
-                        if (nValue2 < nMin)
-                            nMin = nValue2;
-                        if (nValue > nMax)
-                            nMax = nValue;
-                    }
-                    if constexpr (COMPUTE_OTHER_STATS)
-                    {
-                        nSum += nValue;
-                        nSumSquare +=
-                            static_cast_for_coverity_scan<GUIntBig>(nValue) *
-                            nValue;
-                        nSum += nValue2;
-                        nSumSquare +=
-                            static_cast_for_coverity_scan<GUIntBig>(nValue2) *
-                            nValue2;
-                    }
-                }
-                if (iX < nXCheck)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    const GUInt32 nValue = pData[iOffset];
-                    if (nValue < nMin)
-                        nMin = nValue;
-                    if (nValue > nMax)
-                        nMax = nValue;
-                    if (COMPUTE_OTHER_STATS)
-                    {
-                        nSum += nValue;
-                        nSumSquare +=
-                            static_cast_for_coverity_scan<GUIntBig>(nValue) *
-                            nValue;
-                    }
-                }
+                bValid = false;
+                return 0.0;
             }
-            if constexpr (COMPUTE_OTHER_STATS)
+            break;
+        case GDT_CInt16:
+            dfValue = static_cast<const GInt16 *>(pData)[iOffset * 2];
+            break;
+        case GDT_CInt32:
+            dfValue = static_cast<const GInt32 *>(pData)[iOffset * 2];
+            break;
+        case GDT_CFloat16:
+            dfValue = static_cast<const GFloat16 *>(pData)[iOffset * 2];
+            if (std::isnan(dfValue))
             {
-                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-            }
-        }
-    }
-};
-
-// Specialization for Byte that is mostly 32 bit friendly as it avoids
-// using 64bit accumulators in internal loops. This also slightly helps in
-// 64bit mode.
-template <bool COMPUTE_OTHER_STATS>
-struct ComputeStatisticsInternalGeneric<GByte, COMPUTE_OTHER_STATS>
-{
-    static void f(int nXCheck, int nBlockXSize, int nYCheck, const GByte *pData,
-                  bool bHasNoData, GUInt32 nNoDataValue, GUInt32 &nMin,
-                  GUInt32 &nMax, GUIntBig &nSum, GUIntBig &nSumSquare,
-                  GUIntBig &nSampleCount, GUIntBig &nValidCount)
-    {
-        int nOuterLoops = nXCheck / 65536;
-        if (nXCheck % 65536)
-            nOuterLoops++;
-
-        if (bHasNoData)
-        {
-            // General case
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                int iX = 0;
-                for (int k = 0; k < nOuterLoops; k++)
-                {
-                    int iMax = iX + 65536;
-                    if (iMax > nXCheck)
-                        iMax = nXCheck;
-                    GUInt32 nSum32bit = 0;
-                    GUInt32 nSumSquare32bit = 0;
-                    GUInt32 nValidCount32bit = 0;
-                    GUInt32 nSampleCount32bit = 0;
-                    for (; iX < iMax; iX++)
-                    {
-                        const GPtrDiff_t iOffset =
-                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                        const GUInt32 nValue = pData[iOffset];
-
-                        nSampleCount32bit++;
-                        if (nValue == nNoDataValue)
-                            continue;
-                        if (nValue < nMin)
-                            nMin = nValue;
-                        if (nValue > nMax)
-                            nMax = nValue;
-                        if constexpr (COMPUTE_OTHER_STATS)
-                        {
-                            nValidCount32bit++;
-                            nSum32bit += nValue;
-                            nSumSquare32bit += nValue * nValue;
-                        }
-                    }
-                    if constexpr (COMPUTE_OTHER_STATS)
-                    {
-                        nSampleCount += nSampleCount32bit;
-                        nValidCount += nValidCount32bit;
-                        nSum += nSum32bit;
-                        nSumSquare += nSumSquare32bit;
-                    }
-                }
-            }
-        }
-        else if (nMin == 0 && nMax == 255)
-        {
-            if constexpr (COMPUTE_OTHER_STATS)
-            {
-                // Optimization when there is no nodata and we know we have already
-                // reached the min and max
-                for (int iY = 0; iY < nYCheck; iY++)
-                {
-                    int iX = 0;
-                    for (int k = 0; k < nOuterLoops; k++)
-                    {
-                        int iMax = iX + 65536;
-                        if (iMax > nXCheck)
-                            iMax = nXCheck;
-                        GUInt32 nSum32bit = 0;
-                        GUInt32 nSumSquare32bit = 0;
-                        for (; iX + 3 < iMax; iX += 4)
-                        {
-                            const GPtrDiff_t iOffset =
-                                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                            const GUInt32 nValue = pData[iOffset];
-                            const GUInt32 nValue2 = pData[iOffset + 1];
-                            const GUInt32 nValue3 = pData[iOffset + 2];
-                            const GUInt32 nValue4 = pData[iOffset + 3];
-                            nSum32bit += nValue;
-                            nSumSquare32bit += nValue * nValue;
-                            nSum32bit += nValue2;
-                            nSumSquare32bit += nValue2 * nValue2;
-                            nSum32bit += nValue3;
-                            nSumSquare32bit += nValue3 * nValue3;
-                            nSum32bit += nValue4;
-                            nSumSquare32bit += nValue4 * nValue4;
-                        }
-                        nSum += nSum32bit;
-                        nSumSquare += nSumSquare32bit;
-                    }
-                    for (; iX < nXCheck; ++iX)
-                    {
-                        const GPtrDiff_t iOffset =
-                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                        const GUIntBig nValue = pData[iOffset];
-                        nSum += nValue;
-                        nSumSquare += nValue * nValue;
-                    }
-                }
-                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-            }
-        }
-        else
-        {
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                int iX = 0;
-                for (int k = 0; k < nOuterLoops; k++)
-                {
-                    int iMax = iX + 65536;
-                    if (iMax > nXCheck)
-                        iMax = nXCheck;
-                    GUInt32 nSum32bit = 0;
-                    GUInt32 nSumSquare32bit = 0;
-                    for (; iX + 1 < iMax; iX += 2)
-                    {
-                        const GPtrDiff_t iOffset =
-                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                        const GUInt32 nValue = pData[iOffset];
-                        const GUInt32 nValue2 = pData[iOffset + 1];
-                        if (nValue < nValue2)
-                        {
-                            if (nValue < nMin)
-                                nMin = nValue;
-                            if (nValue2 > nMax)
-                                nMax = nValue2;
-                        }
-                        else
-                        {
-                            if (nValue2 < nMin)
-                                nMin = nValue2;
-                            if (nValue > nMax)
-                                nMax = nValue;
-                        }
-                        if constexpr (COMPUTE_OTHER_STATS)
-                        {
-                            nSum32bit += nValue;
-                            nSumSquare32bit += nValue * nValue;
-                            nSum32bit += nValue2;
-                            nSumSquare32bit += nValue2 * nValue2;
-                        }
-                    }
-                    if constexpr (COMPUTE_OTHER_STATS)
-                    {
-                        nSum += nSum32bit;
-                        nSumSquare += nSumSquare32bit;
-                    }
-                }
-                if (iX < nXCheck)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    const GUInt32 nValue = pData[iOffset];
-                    if (nValue < nMin)
-                        nMin = nValue;
-                    if (nValue > nMax)
-                        nMax = nValue;
-                    if constexpr (COMPUTE_OTHER_STATS)
-                    {
-                        nSum += nValue;
-                        nSumSquare +=
-                            static_cast_for_coverity_scan<GUIntBig>(nValue) *
-                            nValue;
-                    }
-                }
-            }
-            if constexpr (COMPUTE_OTHER_STATS)
-            {
-                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-            }
-        }
-    }
-};
-
-template <class T, bool COMPUTE_OTHER_STATS> struct ComputeStatisticsInternal
-{
-    static void f(int nXCheck, int nBlockXSize, int nYCheck, const T *pData,
-                  bool bHasNoData, GUInt32 nNoDataValue, GUInt32 &nMin,
-                  GUInt32 &nMax, GUIntBig &nSum, GUIntBig &nSumSquare,
-                  GUIntBig &nSampleCount, GUIntBig &nValidCount)
-    {
-        ComputeStatisticsInternalGeneric<T, COMPUTE_OTHER_STATS>::f(
-            nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue,
-            nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-    }
-};
-
-#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
-    (defined(__GNUC__) || defined(_MSC_VER))
-
-#include "gdal_avx2_emulation.hpp"
-
-#define ZERO256 GDALmm256_setzero_si256()
-
-template <bool COMPUTE_MIN, bool COMPUTE_MAX, bool COMPUTE_OTHER_STATS>
-static void
-ComputeStatisticsByteNoNodata(GPtrDiff_t nBlockPixels,
-                              // assumed to be aligned on 256 bits
-                              const GByte *pData, GUInt32 &nMin, GUInt32 &nMax,
-                              GUIntBig &nSum, GUIntBig &nSumSquare,
-                              GUIntBig &nSampleCount, GUIntBig &nValidCount)
-{
-    // 32-byte alignment may not be enforced by linker, so do it at hand
-    GByte
-        aby32ByteUnaligned[32 + 32 + 32 + (COMPUTE_OTHER_STATS ? 32 + 32 : 0)];
-    GByte *paby32ByteAligned =
-        aby32ByteUnaligned +
-        (32 - (reinterpret_cast<GUIntptr_t>(aby32ByteUnaligned) % 32));
-    GByte *pabyMin = paby32ByteAligned;
-    GByte *pabyMax = paby32ByteAligned + 32;
-    GUInt32 *panSum =
-        COMPUTE_OTHER_STATS
-            ? reinterpret_cast<GUInt32 *>(paby32ByteAligned + 32 * 2)
-            : nullptr;
-    GUInt32 *panSumSquare =
-        COMPUTE_OTHER_STATS
-            ? reinterpret_cast<GUInt32 *>(paby32ByteAligned + 32 * 3)
-            : nullptr;
-
-    CPLAssert((reinterpret_cast<uintptr_t>(pData) % 32) == 0);
-
-    GPtrDiff_t i = 0;
-    // Make sure that sumSquare can fit on uint32
-    // * 8 since we can hold 8 sums per vector register
-    const int nMaxIterationsPerInnerLoop =
-        8 * ((std::numeric_limits<GUInt32>::max() / (255 * 255)) & ~31);
-    GPtrDiff_t nOuterLoops = nBlockPixels / nMaxIterationsPerInnerLoop;
-    if ((nBlockPixels % nMaxIterationsPerInnerLoop) != 0)
-        nOuterLoops++;
-
-    GDALm256i ymm_min =
-        GDALmm256_load_si256(reinterpret_cast<const GDALm256i *>(pData + i));
-    GDALm256i ymm_max = ymm_min;
-    [[maybe_unused]] const auto ymm_mask_8bits = GDALmm256_set1_epi16(0xFF);
-
-    for (GPtrDiff_t k = 0; k < nOuterLoops; k++)
-    {
-        const auto iMax =
-            std::min(nBlockPixels, i + nMaxIterationsPerInnerLoop);
-
-        // holds 4 uint32 sums in [0], [2], [4] and [6]
-        [[maybe_unused]] GDALm256i ymm_sum = ZERO256;
-        [[maybe_unused]] GDALm256i ymm_sumsquare =
-            ZERO256;  // holds 8 uint32 sums
-        for (; i + 31 < iMax; i += 32)
-        {
-            const GDALm256i ymm = GDALmm256_load_si256(
-                reinterpret_cast<const GDALm256i *>(pData + i));
-            if (COMPUTE_MIN)
-            {
-                ymm_min = GDALmm256_min_epu8(ymm_min, ymm);
-            }
-            if (COMPUTE_MAX)
-            {
-                ymm_max = GDALmm256_max_epu8(ymm_max, ymm);
-            }
-
-            if constexpr (COMPUTE_OTHER_STATS)
-            {
-                // Extract even-8bit values
-                const GDALm256i ymm_even =
-                    GDALmm256_and_si256(ymm, ymm_mask_8bits);
-                // Compute square of those 16 values as 32 bit result
-                // and add adjacent pairs
-                const GDALm256i ymm_even_square =
-                    GDALmm256_madd_epi16(ymm_even, ymm_even);
-                // Add to the sumsquare accumulator
-                ymm_sumsquare =
-                    GDALmm256_add_epi32(ymm_sumsquare, ymm_even_square);
-
-                // Extract odd-8bit values
-                const GDALm256i ymm_odd = GDALmm256_srli_epi16(ymm, 8);
-                const GDALm256i ymm_odd_square =
-                    GDALmm256_madd_epi16(ymm_odd, ymm_odd);
-                ymm_sumsquare =
-                    GDALmm256_add_epi32(ymm_sumsquare, ymm_odd_square);
-
-                // Now compute the sums
-                ymm_sum = GDALmm256_add_epi32(ymm_sum,
-                                              GDALmm256_sad_epu8(ymm, ZERO256));
-            }
-        }
-
-        if constexpr (COMPUTE_OTHER_STATS)
-        {
-            GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(panSum),
-                                  ymm_sum);
-            GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(panSumSquare),
-                                  ymm_sumsquare);
-
-            nSum += panSum[0] + panSum[2] + panSum[4] + panSum[6];
-            nSumSquare += static_cast<GUIntBig>(panSumSquare[0]) +
-                          panSumSquare[1] + panSumSquare[2] + panSumSquare[3] +
-                          panSumSquare[4] + panSumSquare[5] + panSumSquare[6] +
-                          panSumSquare[7];
-        }
-    }
-
-    if constexpr (COMPUTE_MIN)
-    {
-        GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(pabyMin), ymm_min);
-    }
-    if constexpr (COMPUTE_MAX)
-    {
-        GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(pabyMax), ymm_max);
-    }
-    if constexpr (COMPUTE_MIN || COMPUTE_MAX)
-    {
-        for (int j = 0; j < 32; j++)
-        {
-            if constexpr (COMPUTE_MIN)
-            {
-                if (pabyMin[j] < nMin)
-                    nMin = pabyMin[j];
-            }
-            if constexpr (COMPUTE_MAX)
-            {
-                if (pabyMax[j] > nMax)
-                    nMax = pabyMax[j];
-            }
-        }
-    }
-
-    for (; i < nBlockPixels; i++)
-    {
-        const GUInt32 nValue = pData[i];
-        if constexpr (COMPUTE_MIN)
-        {
-            if (nValue < nMin)
-                nMin = nValue;
-        }
-        if constexpr (COMPUTE_MAX)
-        {
-            if (nValue > nMax)
-                nMax = nValue;
-        }
-        if constexpr (COMPUTE_OTHER_STATS)
-        {
-            nSum += nValue;
-            nSumSquare +=
-                static_cast_for_coverity_scan<GUIntBig>(nValue) * nValue;
-        }
-    }
-
-    if constexpr (COMPUTE_OTHER_STATS)
-    {
-        nSampleCount += static_cast<GUIntBig>(nBlockPixels);
-        nValidCount += static_cast<GUIntBig>(nBlockPixels);
-    }
-}
-
-// SSE2/AVX2 optimization for GByte case
-// In pure SSE2, this relies on gdal_avx2_emulation.hpp. There is no
-// penaly in using the emulation, because, given the mm256 intrinsics used here,
-// there are strictly equivalent to 2 parallel SSE2 streams.
-template <bool COMPUTE_OTHER_STATS>
-struct ComputeStatisticsInternal<GByte, COMPUTE_OTHER_STATS>
-{
-    static void f(int nXCheck, int nBlockXSize, int nYCheck,
-                  // assumed to be aligned on 256 bits
-                  const GByte *pData, bool bHasNoData, GUInt32 nNoDataValue,
-                  GUInt32 &nMin, GUInt32 &nMax, GUIntBig &nSum,
-                  GUIntBig &nSumSquare, GUIntBig &nSampleCount,
-                  GUIntBig &nValidCount)
-    {
-        const auto nBlockPixels = static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
-        if (bHasNoData && nXCheck == nBlockXSize && nBlockPixels >= 32 &&
-            nMin <= nMax)
-        {
-            // 32-byte alignment may not be enforced by linker, so do it at hand
-            GByte aby32ByteUnaligned[32 + 32 + 32 + 32 + 32];
-            GByte *paby32ByteAligned =
-                aby32ByteUnaligned +
-                (32 - (reinterpret_cast<GUIntptr_t>(aby32ByteUnaligned) % 32));
-            GByte *pabyMin = paby32ByteAligned;
-            GByte *pabyMax = paby32ByteAligned + 32;
-            GUInt32 *panSum =
-                reinterpret_cast<GUInt32 *>(paby32ByteAligned + 32 * 2);
-            GUInt32 *panSumSquare =
-                reinterpret_cast<GUInt32 *>(paby32ByteAligned + 32 * 3);
-
-            CPLAssert((reinterpret_cast<uintptr_t>(pData) % 32) == 0);
-
-            GPtrDiff_t i = 0;
-            // Make sure that sumSquare can fit on uint32
-            // * 8 since we can hold 8 sums per vector register
-            const int nMaxIterationsPerInnerLoop =
-                8 * ((std::numeric_limits<GUInt32>::max() / (255 * 255)) & ~31);
-            auto nOuterLoops = nBlockPixels / nMaxIterationsPerInnerLoop;
-            if ((nBlockPixels % nMaxIterationsPerInnerLoop) != 0)
-                nOuterLoops++;
-
-            const GDALm256i ymm_nodata =
-                GDALmm256_set1_epi8(static_cast<GByte>(nNoDataValue));
-            // any non noData value in [min,max] would do.
-            const GDALm256i ymm_neutral =
-                GDALmm256_set1_epi8(static_cast<GByte>(nMin));
-            GDALm256i ymm_min = ymm_neutral;
-            GDALm256i ymm_max = ymm_neutral;
-            [[maybe_unused]] const auto ymm_mask_8bits =
-                GDALmm256_set1_epi16(0xFF);
-
-            const GUInt32 nMinThreshold = (nNoDataValue == 0) ? 1 : 0;
-            const GUInt32 nMaxThreshold = (nNoDataValue == 255) ? 254 : 255;
-            const bool bComputeMinMax =
-                nMin > nMinThreshold || nMax < nMaxThreshold;
-
-            for (GPtrDiff_t k = 0; k < nOuterLoops; k++)
-            {
-                const auto iMax =
-                    std::min(nBlockPixels, i + nMaxIterationsPerInnerLoop);
-
-                // holds 4 uint32 sums in [0], [2], [4] and [6]
-                [[maybe_unused]] GDALm256i ymm_sum = ZERO256;
-                // holds 8 uint32 sums
-                [[maybe_unused]] GDALm256i ymm_sumsquare = ZERO256;
-                // holds 4 uint32 sums in [0], [2], [4] and [6]
-                [[maybe_unused]] GDALm256i ymm_count_nodata_mul_255 = ZERO256;
-                const auto iInit = i;
-                for (; i + 31 < iMax; i += 32)
-                {
-                    const GDALm256i ymm = GDALmm256_load_si256(
-                        reinterpret_cast<const GDALm256i *>(pData + i));
-
-                    // Check which values are nodata
-                    const GDALm256i ymm_eq_nodata =
-                        GDALmm256_cmpeq_epi8(ymm, ymm_nodata);
-                    if constexpr (COMPUTE_OTHER_STATS)
-                    {
-                        // Count how many values are nodata (due to cmpeq
-                        // putting 255 when condition is met, this will actually
-                        // be 255 times the number of nodata value, spread in 4
-                        // 64 bits words). We can use add_epi32 as the counter
-                        // will not overflow uint32
-                        ymm_count_nodata_mul_255 = GDALmm256_add_epi32(
-                            ymm_count_nodata_mul_255,
-                            GDALmm256_sad_epu8(ymm_eq_nodata, ZERO256));
-                    }
-                    // Replace all nodata values by zero for the purpose of sum
-                    // and sumquare.
-                    const GDALm256i ymm_nodata_by_zero =
-                        GDALmm256_andnot_si256(ymm_eq_nodata, ymm);
-                    if (bComputeMinMax)
-                    {
-                        // Replace all nodata values by a neutral value for the
-                        // purpose of min and max.
-                        const GDALm256i ymm_nodata_by_neutral =
-                            GDALmm256_or_si256(
-                                GDALmm256_and_si256(ymm_eq_nodata, ymm_neutral),
-                                ymm_nodata_by_zero);
-
-                        ymm_min =
-                            GDALmm256_min_epu8(ymm_min, ymm_nodata_by_neutral);
-                        ymm_max =
-                            GDALmm256_max_epu8(ymm_max, ymm_nodata_by_neutral);
-                    }
-
-                    if constexpr (COMPUTE_OTHER_STATS)
-                    {
-                        // Extract even-8bit values
-                        const GDALm256i ymm_even = GDALmm256_and_si256(
-                            ymm_nodata_by_zero, ymm_mask_8bits);
-                        // Compute square of those 16 values as 32 bit result
-                        // and add adjacent pairs
-                        const GDALm256i ymm_even_square =
-                            GDALmm256_madd_epi16(ymm_even, ymm_even);
-                        // Add to the sumsquare accumulator
-                        ymm_sumsquare =
-                            GDALmm256_add_epi32(ymm_sumsquare, ymm_even_square);
-
-                        // Extract odd-8bit values
-                        const GDALm256i ymm_odd =
-                            GDALmm256_srli_epi16(ymm_nodata_by_zero, 8);
-                        const GDALm256i ymm_odd_square =
-                            GDALmm256_madd_epi16(ymm_odd, ymm_odd);
-                        ymm_sumsquare =
-                            GDALmm256_add_epi32(ymm_sumsquare, ymm_odd_square);
-
-                        // Now compute the sums
-                        ymm_sum = GDALmm256_add_epi32(
-                            ymm_sum,
-                            GDALmm256_sad_epu8(ymm_nodata_by_zero, ZERO256));
-                    }
-                }
-
-                if constexpr (COMPUTE_OTHER_STATS)
-                {
-                    GUInt32 *panCoutNoDataMul255 = panSum;
-                    GDALmm256_store_si256(
-                        reinterpret_cast<GDALm256i *>(panCoutNoDataMul255),
-                        ymm_count_nodata_mul_255);
-
-                    nSampleCount += (i - iInit);
-
-                    nValidCount +=
-                        (i - iInit) -
-                        (panCoutNoDataMul255[0] + panCoutNoDataMul255[2] +
-                         panCoutNoDataMul255[4] + panCoutNoDataMul255[6]) /
-                            255;
-
-                    GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(panSum),
-                                          ymm_sum);
-                    GDALmm256_store_si256(
-                        reinterpret_cast<GDALm256i *>(panSumSquare),
-                        ymm_sumsquare);
-                    nSum += panSum[0] + panSum[2] + panSum[4] + panSum[6];
-                    nSumSquare += static_cast<GUIntBig>(panSumSquare[0]) +
-                                  panSumSquare[1] + panSumSquare[2] +
-                                  panSumSquare[3] + panSumSquare[4] +
-                                  panSumSquare[5] + panSumSquare[6] +
-                                  panSumSquare[7];
-                }
-            }
-
-            if (bComputeMinMax)
-            {
-                GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(pabyMin),
-                                      ymm_min);
-                GDALmm256_store_si256(reinterpret_cast<GDALm256i *>(pabyMax),
-                                      ymm_max);
-                for (int j = 0; j < 32; j++)
-                {
-                    if (pabyMin[j] < nMin)
-                        nMin = pabyMin[j];
-                    if (pabyMax[j] > nMax)
-                        nMax = pabyMax[j];
-                }
-            }
-
-            if constexpr (COMPUTE_OTHER_STATS)
-            {
-                nSampleCount += nBlockPixels - i;
-            }
-            for (; i < nBlockPixels; i++)
-            {
-                const GUInt32 nValue = pData[i];
-                if (nValue == nNoDataValue)
-                    continue;
-                if (nValue < nMin)
-                    nMin = nValue;
-                if (nValue > nMax)
-                    nMax = nValue;
-                if constexpr (COMPUTE_OTHER_STATS)
-                {
-                    nValidCount++;
-                    nSum += nValue;
-                    nSumSquare +=
-                        static_cast_for_coverity_scan<GUIntBig>(nValue) *
-                        nValue;
-                }
-            }
-        }
-        else if (!bHasNoData && nXCheck == nBlockXSize && nBlockPixels >= 32)
-        {
-            if (nMin > 0)
-            {
-                if (nMax < 255)
-                {
-                    ComputeStatisticsByteNoNodata<true, true,
-                                                  COMPUTE_OTHER_STATS>(
-                        nBlockPixels, pData, nMin, nMax, nSum, nSumSquare,
-                        nSampleCount, nValidCount);
-                }
-                else
-                {
-                    ComputeStatisticsByteNoNodata<true, false,
-                                                  COMPUTE_OTHER_STATS>(
-                        nBlockPixels, pData, nMin, nMax, nSum, nSumSquare,
-                        nSampleCount, nValidCount);
-                }
-            }
-            else
-            {
-                if (nMax < 255)
-                {
-                    ComputeStatisticsByteNoNodata<false, true,
-                                                  COMPUTE_OTHER_STATS>(
-                        nBlockPixels, pData, nMin, nMax, nSum, nSumSquare,
-                        nSampleCount, nValidCount);
-                }
-                else
-                {
-                    ComputeStatisticsByteNoNodata<false, false,
-                                                  COMPUTE_OTHER_STATS>(
-                        nBlockPixels, pData, nMin, nMax, nSum, nSumSquare,
-                        nSampleCount, nValidCount);
-                }
-            }
-        }
-        else if (!COMPUTE_OTHER_STATS && !bHasNoData && nXCheck >= 32 &&
-                 (nBlockXSize % 32) == 0)
-        {
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                ComputeStatisticsByteNoNodata<true, true, COMPUTE_OTHER_STATS>(
-                    nXCheck, pData + static_cast<size_t>(iY) * nBlockXSize,
-                    nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-            }
-        }
-        else
-        {
-            ComputeStatisticsInternalGeneric<GByte, COMPUTE_OTHER_STATS>::f(
-                nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue,
-                nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-        }
-    }
-};
-
-CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW
-static void UnshiftSumSquare(GUIntBig &nSumSquare, GUIntBig nSumThis,
-                             GUIntBig i)
-{
-    nSumSquare += 32768 * (2 * nSumThis - i * 32768);
-}
-
-// AVX2/SSE2 optimization for GUInt16 case
-template <bool COMPUTE_OTHER_STATS>
-struct ComputeStatisticsInternal<GUInt16, COMPUTE_OTHER_STATS>
-{
-    static void f(int nXCheck, int nBlockXSize, int nYCheck,
-                  // assumed to be aligned on 128 bits
-                  const GUInt16 *pData, bool bHasNoData, GUInt32 nNoDataValue,
-                  GUInt32 &nMin, GUInt32 &nMax, GUIntBig &nSum,
-                  GUIntBig &nSumSquare, GUIntBig &nSampleCount,
-                  GUIntBig &nValidCount)
-    {
-        const auto nBlockPixels = static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
-        if (!bHasNoData && nXCheck == nBlockXSize && nBlockPixels >= 16)
-        {
-            CPLAssert((reinterpret_cast<uintptr_t>(pData) % 16) == 0);
-
-            GPtrDiff_t i = 0;
-            // In SSE2, min_epu16 and max_epu16 do not exist, so shift from
-            // UInt16 to SInt16 to be able to use min_epi16 and max_epi16.
-            // Furthermore the shift is also needed to use madd_epi16
-            const GDALm256i ymm_m32768 = GDALmm256_set1_epi16(-32768);
-            GDALm256i ymm_min = GDALmm256_load_si256(
-                reinterpret_cast<const GDALm256i *>(pData + i));
-            ymm_min = GDALmm256_add_epi16(ymm_min, ymm_m32768);
-            GDALm256i ymm_max = ymm_min;
-            [[maybe_unused]] GDALm256i ymm_sumsquare =
-                ZERO256;  // holds 4 uint64 sums
-
-            // Make sure that sum can fit on uint32
-            // * 8 since we can hold 8 sums per vector register
-            const int nMaxIterationsPerInnerLoop =
-                8 * ((std::numeric_limits<GUInt32>::max() / 65535) & ~15);
-            GPtrDiff_t nOuterLoops = nBlockPixels / nMaxIterationsPerInnerLoop;
-            if ((nBlockPixels % nMaxIterationsPerInnerLoop) != 0)
-                nOuterLoops++;
-
-            const bool bComputeMinMax = nMin > 0 || nMax < 65535;
-            [[maybe_unused]] const auto ymm_mask_16bits =
-                GDALmm256_set1_epi32(0xFFFF);
-            [[maybe_unused]] const auto ymm_mask_32bits =
-                GDALmm256_set1_epi64x(0xFFFFFFFF);
-
-            GUIntBig nSumThis = 0;
-            for (int k = 0; k < nOuterLoops; k++)
-            {
-                const auto iMax =
-                    std::min(nBlockPixels, i + nMaxIterationsPerInnerLoop);
-
-                [[maybe_unused]] GDALm256i ymm_sum =
-                    ZERO256;  // holds 8 uint32 sums
-                for (; i + 15 < iMax; i += 16)
-                {
-                    const GDALm256i ymm = GDALmm256_load_si256(
-                        reinterpret_cast<const GDALm256i *>(pData + i));
-                    const GDALm256i ymm_shifted =
-                        GDALmm256_add_epi16(ymm, ymm_m32768);
-                    if (bComputeMinMax)
-                    {
-                        ymm_min = GDALmm256_min_epi16(ymm_min, ymm_shifted);
-                        ymm_max = GDALmm256_max_epi16(ymm_max, ymm_shifted);
-                    }
-
-                    if constexpr (COMPUTE_OTHER_STATS)
-                    {
-                        // Note: the int32 range can overflow for (0-32768)^2 +
-                        // (0-32768)^2 = 0x80000000, but as we know the result
-                        // is positive, this is OK as we interpret is a uint32.
-                        const GDALm256i ymm_square =
-                            GDALmm256_madd_epi16(ymm_shifted, ymm_shifted);
-                        ymm_sumsquare = GDALmm256_add_epi64(
-                            ymm_sumsquare,
-                            GDALmm256_and_si256(ymm_square, ymm_mask_32bits));
-                        ymm_sumsquare = GDALmm256_add_epi64(
-                            ymm_sumsquare,
-                            GDALmm256_srli_epi64(ymm_square, 32));
-
-                        // Now compute the sums
-                        ymm_sum = GDALmm256_add_epi32(
-                            ymm_sum, GDALmm256_and_si256(ymm, ymm_mask_16bits));
-                        ymm_sum = GDALmm256_add_epi32(
-                            ymm_sum, GDALmm256_srli_epi32(ymm, 16));
-                    }
-                }
-
-                if constexpr (COMPUTE_OTHER_STATS)
-                {
-                    GUInt32 anSum[8];
-                    GDALmm256_storeu_si256(reinterpret_cast<GDALm256i *>(anSum),
-                                           ymm_sum);
-                    nSumThis += static_cast<GUIntBig>(anSum[0]) + anSum[1] +
-                                anSum[2] + anSum[3] + anSum[4] + anSum[5] +
-                                anSum[6] + anSum[7];
-                }
-            }
-
-            if (bComputeMinMax)
-            {
-                GUInt16 anMin[16];
-                GUInt16 anMax[16];
-
-                // Unshift the result
-                ymm_min = GDALmm256_sub_epi16(ymm_min, ymm_m32768);
-                ymm_max = GDALmm256_sub_epi16(ymm_max, ymm_m32768);
-                GDALmm256_storeu_si256(reinterpret_cast<GDALm256i *>(anMin),
-                                       ymm_min);
-                GDALmm256_storeu_si256(reinterpret_cast<GDALm256i *>(anMax),
-                                       ymm_max);
-                for (int j = 0; j < 16; j++)
-                {
-                    if (anMin[j] < nMin)
-                        nMin = anMin[j];
-                    if (anMax[j] > nMax)
-                        nMax = anMax[j];
-                }
-            }
-
-            if constexpr (COMPUTE_OTHER_STATS)
-            {
-                GUIntBig anSumSquare[4];
-                GDALmm256_storeu_si256(
-                    reinterpret_cast<GDALm256i *>(anSumSquare), ymm_sumsquare);
-                nSumSquare += anSumSquare[0] + anSumSquare[1] + anSumSquare[2] +
-                              anSumSquare[3];
-
-                // Unshift the sum of squares
-                UnshiftSumSquare(nSumSquare, nSumThis,
-                                 static_cast<GUIntBig>(i));
-
-                nSum += nSumThis;
-
-                for (; i < nBlockPixels; i++)
-                {
-                    const GUInt32 nValue = pData[i];
-                    if (nValue < nMin)
-                        nMin = nValue;
-                    if (nValue > nMax)
-                        nMax = nValue;
-                    nSum += nValue;
-                    nSumSquare +=
-                        static_cast_for_coverity_scan<GUIntBig>(nValue) *
-                        nValue;
-                }
-
-                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-                nValidCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-            }
-        }
-        else
-        {
-            ComputeStatisticsInternalGeneric<GUInt16, COMPUTE_OTHER_STATS>::f(
-                nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue,
-                nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-        }
-    }
-};
-
-#endif
-// (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) ||
-// defined(_MSC_VER))
-
-/************************************************************************/
-/*                          GetPixelValue()                             */
-/************************************************************************/
-
-static inline double GetPixelValue(GDALDataType eDataType, bool bSignedByte,
-                                   const void *pData, GPtrDiff_t iOffset,
-                                   const GDALNoDataValues &sNoDataValues,
-                                   bool &bValid)
-{
-    bValid = true;
-    double dfValue = 0;
-    switch (eDataType)
-    {
-        case GDT_Byte:
-        {
-            if (bSignedByte)
-                dfValue = static_cast<const signed char *>(pData)[iOffset];
-            else
-                dfValue = static_cast<const GByte *>(pData)[iOffset];
-            break;
-        }
-        case GDT_Int8:
-            dfValue = static_cast<const GInt8 *>(pData)[iOffset];
-            break;
-        case GDT_UInt16:
-            dfValue = static_cast<const GUInt16 *>(pData)[iOffset];
-            break;
-        case GDT_Int16:
-            dfValue = static_cast<const GInt16 *>(pData)[iOffset];
-            break;
-        case GDT_UInt32:
-            dfValue = static_cast<const GUInt32 *>(pData)[iOffset];
-            break;
-        case GDT_Int32:
-            dfValue = static_cast<const GInt32 *>(pData)[iOffset];
-            break;
-        case GDT_UInt64:
-            dfValue = static_cast<double>(
-                static_cast<const std::uint64_t *>(pData)[iOffset]);
-            break;
-        case GDT_Int64:
-            dfValue = static_cast<double>(
-                static_cast<const std::int64_t *>(pData)[iOffset]);
-            break;
-        case GDT_Float16:
-        {
-            using namespace std;
-            const GFloat16 hfValue =
-                static_cast<const GFloat16 *>(pData)[iOffset];
-            if (isnan(hfValue) ||
-                (sNoDataValues.bGotFloat16NoDataValue &&
-                 ARE_REAL_EQUAL(hfValue, sNoDataValues.hfNoDataValue)))
-            {
-                bValid = false;
-                return 0.0;
-            }
-            dfValue = hfValue;
-            return dfValue;
-        }
-        case GDT_Float32:
-        {
-            const float fValue = static_cast<const float *>(pData)[iOffset];
-            if (std::isnan(fValue) ||
-                (sNoDataValues.bGotFloatNoDataValue &&
-                 ARE_REAL_EQUAL(fValue, sNoDataValues.fNoDataValue)))
-            {
-                bValid = false;
-                return 0.0;
-            }
-            dfValue = double(fValue);
-            return dfValue;
-        }
-        case GDT_Float64:
-            dfValue = static_cast<const double *>(pData)[iOffset];
-            if (std::isnan(dfValue))
-            {
-                bValid = false;
-                return 0.0;
-            }
-            break;
-        case GDT_CInt16:
-            dfValue = static_cast<const GInt16 *>(pData)[iOffset * 2];
-            break;
-        case GDT_CInt32:
-            dfValue = static_cast<const GInt32 *>(pData)[iOffset * 2];
-            break;
-        case GDT_CFloat16:
-            dfValue = static_cast<const GFloat16 *>(pData)[iOffset * 2];
-            if (std::isnan(dfValue))
-            {
-                bValid = false;
-                return 0.0;
+                bValid = false;
+                return 0.0;
             }
             break;
         case GDT_CFloat32:
@@ -6493,6 +5811,67 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
 
 //! @endcond
 
+/************************************************************************/
+/*                       GDALWelfordAccumulator                         */
+/************************************************************************/
+
+// Using Welford algorithm:
+// http://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+// to compute standard deviation in a more numerically robust way than
+// the difference of the sum of square values with the square of the sum.
+// dfMean and dfM2 are updated at each sample.
+// dfM2 is the sum of square of differences to the current mean.
+struct GDALWelfordAccumulator
+{
+    double dfMin = std::numeric_limits<double>::infinity();
+    double dfMax = -std::numeric_limits<double>::infinity();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;
+    GUIntBig nValidCount = 0;
+
+    inline void Insert(double dfValue)
+    {
+        dfMin = std::min(dfMin, dfValue);
+        dfMax = std::max(dfMax, dfValue);
+
+        nValidCount++;
+        if (dfMin == dfMax)
+        {
+            if (nValidCount == 1)
+                dfMean = dfMin;
+        }
+        else
+        {
+            const double dfDelta = dfValue - dfMean;
+            dfMean += dfDelta / static_cast<double>(nValidCount);
+            dfM2 += dfDelta * (dfValue - dfMean);
+        }
+    }
+
+    // Combine with the statistics of another set of samples, using the
+    // pairwise formula of Chan et al.
+    void Merge(const GDALWelfordAccumulator &other)
+    {
+        if (other.nValidCount == 0)
+            return;
+        if (nValidCount == 0)
+        {
+            *this = other;
+            return;
+        }
+        dfMin = std::min(dfMin, other.dfMin);
+        dfMax = std::max(dfMax, other.dfMax);
+        const double dfCount = static_cast<double>(nValidCount);
+        const double dfOtherCount = static_cast<double>(other.nValidCount);
+        const double dfNewCount = dfCount + dfOtherCount;
+        const double dfDelta = other.dfMean - dfMean;
+        dfMean += dfDelta * (dfOtherCount / dfNewCount);
+        dfM2 += other.dfM2 +
+                dfDelta * dfDelta * (dfCount * dfOtherCount / dfNewCount);
+        nValidCount += other.nValidCount;
+    }
+};
+
 /************************************************************************/
 /*                         ComputeStatistics()                          */
 /************************************************************************/
@@ -6510,6 +5889,12 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to ALL_CPUS or a number of threads, so that the pixel values of blocks
+ * are processed by several threads. When this option is set, statistics are
+ * computed per block and combined in block order, so that the result does
+ * not depend on the number of threads.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -6586,16 +5971,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     /* -------------------------------------------------------------------- */
     /*      Read actual data and compute statistics.                        */
     /* -------------------------------------------------------------------- */
-    // Using Welford algorithm:
-    // http://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
-    // to compute standard deviation in a more numerically robust way than
-    // the difference of the sum of square values with the square of the sum.
-    // dfMean and dfM2 are updated at each sample.
-    // dfM2 is the sum of square of differences to the current mean.
-    double dfMin = std::numeric_limits<double>::infinity();
-    double dfMax = -std::numeric_limits<double>::infinity();
-    double dfMean = 0.0;
-    double dfM2 = 0.0;
+    GDALWelfordAccumulator oStats;
 
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
@@ -6699,21 +6075,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 if (!bValid)
                     continue;
 
-                dfMin = std::min(dfMin, dfValue);
-                dfMax = std::max(dfMax, dfValue);
-
-                nValidCount++;
-                if (dfMin == dfMax)
-                {
-                    if (nValidCount == 1)
-                        dfMean = dfMin;
-                }
-                else
-                {
-                    const double dfDelta = dfValue - dfMean;
-                    dfMean += dfDelta / nValidCount;
-                    dfM2 += dfDelta * (dfValue - dfMean);
-                }
+                oStats.Insert(dfValue);
             }
         }
 
@@ -6768,10 +6130,6 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                       static_cast<GUInt64>(nBlockYSize))))
         {
             const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
-            GUInt32 nMin = nMaxValueType;
-            GUInt32 nMax = 0;
-            GUIntBig nSum = 0;
-            GUIntBig nSumSquare = 0;
             // If no valid nodata, map to invalid value (256 for Byte)
             const GUInt32 nNoDataValue =
                 (sNoDataValues.bGotNoDataValue &&
@@ -6783,56 +6141,75 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     ? static_cast<GUInt32>(sNoDataValues.dfNoDataValue + 1e-10)
                     : nMaxValueType + 1;
 
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            // Integer accumulators, per processing context. Their merging
+            // does not depend on the order in which blocks are processed.
+            struct IntegerStats
             {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
+                GUInt32 nMin;
+                GUInt32 nMax = 0;
+                GUIntBig nSum = 0;
+                GUIntBig nSumSquare = 0;
+                GUIntBig nSampleCount = 0;
+                GUIntBig nValidCount = 0;
+
+                explicit IntegerStats(GUInt32 nMinIn) : nMin(nMinIn)
+                {
+                }
+            };
 
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+            GDALSampledBlockProcessor oProcessor(this, nullptr, nSampleRate);
+            std::vector<IntegerStats> aoContextStats(
+                oProcessor.GetContextCount(), IntegerStats(nMaxValueType));
 
+            const auto ProcessBlock =
+                [this, nMaxValueType, nNoDataValue, &aoContextStats](
+                    int iContext, GIntBig /* iSampledBlock */, void *pData,
+                    const GByte * /* pabyMaskData */, int nXCheck, int nYCheck)
+            {
+                auto &oIntStats = aoContextStats[iContext];
                 if (eDataType == GDT_Byte)
                 {
-                    ComputeStatisticsInternal<
-                        GByte, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                    ComputeStatisticsInternalDispatch<
+                        GByte, /* COMPUTE_OTHER_STATS = */ true>(
+                        nXCheck, nBlockXSize, nYCheck,
+                        static_cast<const GByte *>(pData),
+                        nNoDataValue <= nMaxValueType, nNoDataValue,
+                        oIntStats.nMin, oIntStats.nMax, oIntStats.nSum,
+                        oIntStats.nSumSquare, oIntStats.nSampleCount,
+                        oIntStats.nValidCount);
                 }
                 else
                 {
-                    ComputeStatisticsInternal<
-                        GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                    ComputeStatisticsInternalDispatch<
+                        GUInt16, /* COMPUTE_OTHER_STATS = */ true>(
+                        nXCheck, nBlockXSize, nYCheck,
+                        static_cast<const GUInt16 *>(pData),
+                        nNoDataValue <= nMaxValueType, nNoDataValue,
+                        oIntStats.nMin, oIntStats.nMax, oIntStats.nSum,
+                        oIntStats.nSumSquare, oIntStats.nSampleCount,
+                        oIntStats.nValidCount);
                 }
+                return true;
+            };
 
-                poBlock->DropLock();
+            if (!oProcessor.Run(ProcessBlock, "Compute Statistics",
+                                pfnProgress, pProgressData))
+            {
+                return CE_Failure;
+            }
 
-                if (!pfnProgress(static_cast<double>(iSampleBlock) /
-                                     (static_cast<double>(nBlocksPerRow) *
-                                      nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
-                {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
-                    return CE_Failure;
-                }
+            GUInt32 nMin = nMaxValueType;
+            GUInt32 nMax = 0;
+            GUIntBig nSum = 0;
+            GUIntBig nSumSquare = 0;
+            for (const auto &oContextStats : aoContextStats)
+            {
+                nMin = std::min(nMin, oContextStats.nMin);
+                nMax = std::max(nMax, oContextStats.nMax);
+                nSum += oContextStats.nSum;
+                nSumSquare += oContextStats.nSumSquare;
+                nSampleCount += oContextStats.nSampleCount;
+                nValidCount += oContextStats.nValidCount;
             }
 
             if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -6846,6 +6223,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             /*      Save computed information. */
             /* --------------------------------------------------------------------
              */
+            double dfMean = 0.0;
             if (nValidCount)
                 dfMean = static_cast<double>(nSum) / nValidCount;
 
@@ -6900,47 +6278,41 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             return CE_Failure;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
-        }
+        GDALSampledBlockProcessor oProcessor(this, poMaskBand, nSampleRate);
 
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        // When the number of threads is configured, statistics are computed
+        // per block and merged in block order, so that the result does not
+        // depend on the number of threads.
+        const bool bPerBlockStats = oProcessor.IsThreadCountSet();
+        CPLAssert(bPerBlockStats || oProcessor.GetContextCount() == 1);
+        std::vector<GDALWelfordAccumulator> aoBlockStats;
+        std::vector<GUIntBig> anContextSampleCount(
+            oProcessor.GetContextCount());
+        if (bPerBlockStats)
         {
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+            try
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                aoBlockStats.resize(
+                    static_cast<size_t>(oProcessor.GetSampledBlockCount()));
             }
-
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
+            catch (const std::exception &)
             {
-                CPLFree(pabyMaskData);
+                ReportError(CE_Failure, CPLE_OutOfMemory,
+                            "Out of memory in ComputeStatistics()");
                 return CE_Failure;
             }
+        }
 
-            void *const pData = poBlock->GetDataRef();
+        const auto ProcessBlock =
+            [this, bSignedByte, &sNoDataValues, bPerBlockStats, &aoBlockStats,
+             &oStats, &anContextSampleCount](
+                int iContext, GIntBig iSampledBlock, void *pData,
+                const GByte *pabyMaskData, int nXCheck, int nYCheck)
+        {
+            auto &oBlockStats =
+                bPerBlockStats
+                    ? aoBlockStats[static_cast<size_t>(iSampledBlock)]
+                    : oStats;
 
             // This isn't the fastest way to do this, but is easier for now.
             for (int iY = 0; iY < nYCheck; iY++)
@@ -6960,40 +6332,25 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     if (!bValid)
                         continue;
 
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
-
-                    nValidCount++;
-                    if (dfMin == dfMax)
-                    {
-                        if (nValidCount == 1)
-                            dfMean = dfMin;
-                    }
-                    else
-                    {
-                        const double dfDelta = dfValue - dfMean;
-                        dfMean += dfDelta / nValidCount;
-                        dfM2 += dfDelta * (dfValue - dfMean);
-                    }
+                    oBlockStats.Insert(dfValue);
                 }
             }
 
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-
-            poBlock->DropLock();
+            anContextSampleCount[iContext] +=
+                static_cast<GUIntBig>(nXCheck) * nYCheck;
+            return true;
+        };
 
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
-            {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
+        if (!oProcessor.Run(ProcessBlock, "Compute Statistics", pfnProgress,
+                            pProgressData))
+        {
+            return CE_Failure;
         }
 
-        CPLFree(pabyMaskData);
+        for (const auto &oBlockStats : aoBlockStats)
+            oStats.Merge(oBlockStats);
+        for (const GUIntBig nContextSampleCount : anContextSampleCount)
+            nSampleCount += nContextSampleCount;
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -7005,7 +6362,12 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     /* -------------------------------------------------------------------- */
     /*      Save computed information.                                      */
     /* -------------------------------------------------------------------- */
-    const double dfStdDev = nValidCount > 0 ? sqrt(dfM2 / nValidCount) : 0.0;
+    nValidCount = oStats.nValidCount;
+    double dfMin = oStats.dfMin;
+    double dfMax = oStats.dfMax;
+    const double dfMean = oStats.dfMean;
+    const double dfStdDev =
+        nValidCount > 0 ? sqrt(oStats.dfM2 / nValidCount) : 0.0;
 
     if (nValidCount > 0)
     {
@@ -7327,61 +6689,38 @@ static void ComputeMinMaxGeneric(const void *pData, GDALDataType eDataType,
 
 static bool ComputeMinMaxGenericIterBlocks(
     GDALRasterBand *poBand, GDALDataType eDataType, bool bSignedByte,
-    GIntBig nTotalBlocks, int nSampleRate, int nBlocksPerRow,
-    const GDALNoDataValues &sNoDataValues, GDALRasterBand *poMaskBand,
-    double &dfMin, double &dfMax)
+    int nSampleRate, const GDALNoDataValues &sNoDataValues,
+    GDALRasterBand *poMaskBand, double &dfMin, double &dfMax)
 
 {
-    GByte *pabyMaskData = nullptr;
     int nBlockXSize, nBlockYSize;
     poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
 
-    if (poMaskBand)
-    {
-        pabyMaskData =
-            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-        if (!pabyMaskData)
-        {
-            return false;
-        }
-    }
+    GDALSampledBlockProcessor oProcessor(poBand, poMaskBand, nSampleRate);
+    std::vector<std::pair<double, double>> aoContextMinMax(
+        oProcessor.GetContextCount(), std::pair(dfMin, dfMax));
 
-    for (GIntBig iSampleBlock = 0; iSampleBlock < nTotalBlocks;
-         iSampleBlock += nSampleRate)
+    const auto ProcessBlock =
+        [eDataType, bSignedByte, nBlockXSize, &sNoDataValues,
+         &aoContextMinMax](int iContext, GIntBig /* iSampledBlock */,
+                           void *pData, const GByte *pabyMaskData,
+                           int nXCheck, int nYCheck)
     {
-        const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-        const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-        int nXCheck = 0, nYCheck = 0;
-        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-        if (poMaskBand &&
-            poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                 iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                 pabyMaskData, nXCheck, nYCheck, GDT_Byte, 0,
-                                 nBlockXSize, nullptr) != CE_None)
-        {
-            CPLFree(pabyMaskData);
-            return false;
-        }
-
-        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(iXBlock, iYBlock);
-        if (poBlock == nullptr)
-        {
-            CPLFree(pabyMaskData);
-            return false;
-        }
-
-        void *const pData = poBlock->GetDataRef();
-
+        auto &oMinMax = aoContextMinMax[iContext];
         ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck, nYCheck,
-                             nBlockXSize, sNoDataValues, pabyMaskData, dfMin,
-                             dfMax);
+                             nBlockXSize, sNoDataValues, pabyMaskData,
+                             oMinMax.first, oMinMax.second);
+        return true;
+    };
 
-        poBlock->DropLock();
-    }
+    if (!oProcessor.Run(ProcessBlock, "Compute Min/Max", nullptr, nullptr))
+        return false;
 
-    CPLFree(pabyMaskData);
+    for (const auto &oMinMax : aoContextMinMax)
+    {
+        dfMin = std::min(dfMin, oMinMax.first);
+        dfMax = std::max(dfMax, oMinMax.second);
+    }
     return true;
 }
 
@@ -7396,6 +6735,10 @@ static bool ComputeMinMaxGenericIterBlocks(
  * If bApprox is FALSE, then all pixels will be read and used to compute
  * an exact range.
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to ALL_CPUS or a number of threads, so that the pixel values of blocks
+ * are processed by several threads.
+ *
  * This method is the same as the C function GDALComputeRasterMinMax().
  *
  * @param bApproxOK TRUE if an approximate (faster) answer is OK, otherwise
@@ -7469,14 +6812,22 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
 
-    GUInt32 nMin = (eDataType == GDT_Byte)
-                       ? 255
-                       : 65535;  // used for GByte & GUInt16 cases
-    GUInt32 nMax = 0;            // used for GByte & GUInt16 cases
-    GInt16 nMinInt16 =
-        std::numeric_limits<GInt16>::max();  // used for GInt16 case
-    GInt16 nMaxInt16 =
-        std::numeric_limits<GInt16>::lowest();  // used for GInt16 case
+    struct IntegerMinMax
+    {
+        GUInt32 nMin;      // used for GByte & GUInt16 cases
+        GUInt32 nMax = 0;  // used for GByte & GUInt16 cases
+        GInt16 nMinInt16 =
+            std::numeric_limits<GInt16>::max();  // used for GInt16 case
+        GInt16 nMaxInt16 =
+            std::numeric_limits<GInt16>::lowest();  // used for GInt16 case
+
+        explicit IntegerMinMax(GUInt32 nMinIn) : nMin(nMinIn)
+        {
+        }
+    };
+
+    const IntegerMinMax oInitIntMinMax((eDataType == GDT_Byte) ? 255 : 65535);
+    IntegerMinMax oIntMinMax(oInitIntMinMax);
     double dfMin =
         std::numeric_limits<double>::infinity();  // used for generic code path
     double dfMax =
@@ -7486,9 +6837,9 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                         eDataType == GDT_Int16 || eDataType == GDT_UInt16);
 
     const auto ComputeMinMaxForBlock =
-        [this, bSignedByte, &sNoDataValues, &nMin, &nMax, &nMinInt16,
-         &nMaxInt16](const void *pData, int nXCheck, int nBufferWidth,
-                     int nYCheck)
+        [this, bSignedByte, &sNoDataValues](IntegerMinMax &oMinMax,
+                                            const void *pData, int nXCheck,
+                                            int nBufferWidth, int nYCheck)
     {
         if (eDataType == GDT_Byte && !bSignedByte)
         {
@@ -7501,11 +6852,12 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 bHasNoData ? static_cast<GByte>(sNoDataValues.dfNoDataValue)
                            : 0;
             GUIntBig nSum, nSumSquare, nSampleCount, nValidCount;  // unused
-            ComputeStatisticsInternal<GByte,
-                                      /* COMPUTE_OTHER_STATS = */ false>::
-                f(nXCheck, nBufferWidth, nYCheck,
-                  static_cast<const GByte *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+            ComputeStatisticsInternalDispatch<
+                GByte, /* COMPUTE_OTHER_STATS = */ false>(
+                nXCheck, nBufferWidth, nYCheck,
+                static_cast<const GByte *>(pData), bHasNoData, nNoDataValue,
+                oMinMax.nMin, oMinMax.nMax, nSum, nSumSquare, nSampleCount,
+                nValidCount);
         }
         else if (eDataType == GDT_UInt16)
         {
@@ -7518,11 +6870,12 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 bHasNoData ? static_cast<GUInt16>(sNoDataValues.dfNoDataValue)
                            : 0;
             GUIntBig nSum, nSumSquare, nSampleCount, nValidCount;  // unused
-            ComputeStatisticsInternal<GUInt16,
-                                      /* COMPUTE_OTHER_STATS = */ false>::
-                f(nXCheck, nBufferWidth, nYCheck,
-                  static_cast<const GUInt16 *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+            ComputeStatisticsInternalDispatch<
+                GUInt16, /* COMPUTE_OTHER_STATS = */ false>(
+                nXCheck, nBufferWidth, nYCheck,
+                static_cast<const GUInt16 *>(pData), bHasNoData, nNoDataValue,
+                oMinMax.nMin, oMinMax.nMax, nSum, nSumSquare, nSampleCount,
+                nValidCount);
         }
         else if (eDataType == GDT_Int16)
         {
@@ -7540,7 +6893,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, true>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, nNoDataValue, &nMinInt16, &nMaxInt16);
+                        nXCheck, nNoDataValue, &oMinMax.nMinInt16,
+                        &oMinMax.nMaxInt16);
                 }
             }
             else
@@ -7550,7 +6904,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, false>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, 0, &nMinInt16, &nMaxInt16);
+                        nXCheck, 0, &oMinMax.nMinInt16,
+                        &oMinMax.nMaxInt16);
                 }
             }
         }
@@ -7616,7 +6971,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(oIntMinMax, pData, nXReduced, nXReduced,
+                                  nYReduced);
         }
         else
         {
@@ -7656,41 +7012,44 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
-            {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-                GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
+            GDALSampledBlockProcessor oProcessor(this, nullptr, nSampleRate);
+            std::vector<IntegerMinMax> aoContextMinMax(
+                oProcessor.GetContextCount(), oInitIntMinMax);
 
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
-
-                poBlock->DropLock();
+            const auto ProcessBlock =
+                [this, bSignedByte, &ComputeMinMaxForBlock, &aoContextMinMax](
+                    int iContext, GIntBig /* iSampledBlock */, void *pData,
+                    const GByte * /* pabyMaskData */, int nXCheck, int nYCheck)
+            {
+                auto &oMinMax = aoContextMinMax[iContext];
+                ComputeMinMaxForBlock(oMinMax, pData, nXCheck, nBlockXSize,
+                                      nYCheck);
+                // Stop as soon as the full range of values has been found
+                return !(eDataType == GDT_Byte && !bSignedByte &&
+                         oMinMax.nMin == 0 && oMinMax.nMax == 255);
+            };
+
+            if (!oProcessor.Run(ProcessBlock, "Compute Min/Max", nullptr,
+                                nullptr))
+            {
+                return CE_Failure;
+            }
 
-                if (eDataType == GDT_Byte && !bSignedByte && nMin == 0 &&
-                    nMax == 255)
-                    break;
+            for (const auto &oMinMax : aoContextMinMax)
+            {
+                oIntMinMax.nMin = std::min(oIntMinMax.nMin, oMinMax.nMin);
+                oIntMinMax.nMax = std::max(oIntMinMax.nMax, oMinMax.nMax);
+                oIntMinMax.nMinInt16 =
+                    std::min(oIntMinMax.nMinInt16, oMinMax.nMinInt16);
+                oIntMinMax.nMaxInt16 =
+                    std::max(oIntMinMax.nMaxInt16, oMinMax.nMaxInt16);
             }
         }
         else
         {
-            const GIntBig nTotalBlocks =
-                static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-            if (!ComputeMinMaxGenericIterBlocks(
-                    this, eDataType, bSignedByte, nTotalBlocks, nSampleRate,
-                    nBlocksPerRow, sNoDataValues, poMaskBand, dfMin, dfMax))
+            if (!ComputeMinMaxGenericIterBlocks(this, eDataType, bSignedByte,
+                                                nSampleRate, sNoDataValues,
+                                                poMaskBand, dfMin, dfMax))
             {
                 return CE_Failure;
             }
@@ -7701,13 +7060,13 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
     {
         if ((eDataType == GDT_Byte && !bSignedByte) || eDataType == GDT_UInt16)
         {
-            dfMin = nMin;
-            dfMax = nMax;
+            dfMin = oIntMinMax.nMin;
+            dfMax = oIntMinMax.nMax;
         }
         else if (eDataType == GDT_Int16)
         {
-            dfMin = nMinInt16;
-            dfMax = nMaxInt16;
+            dfMin = oIntMinMax.nMinInt16;
+            dfMax = oIntMinMax.nMaxInt16;
         }
     }
 
@@ -0,0 +1,46 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of ComputeStatistics() kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+#include "gdal_statistics_kernels.hpp"
+
+/************************************************************************/
+/*                 GDALComputeStatisticsInternal_AVX2()                 */
+/************************************************************************/
+
+template <class T, bool COMPUTE_OTHER_STATS>
+void GDALComputeStatisticsInternal_AVX2(
+    int nXCheck, int nBlockXSize, int nYCheck, const T *pData, bool bHasNoData,
+    GUInt32 nNoDataValue, GUInt32 &nMin, GUInt32 &nMax, GUIntBig &nSum,
+    GUIntBig &nSumSquare, GUIntBig &nSampleCount, GUIntBig &nValidCount)
+{
+    ComputeStatisticsInternal<T, COMPUTE_OTHER_STATS>::f(
+        nXCheck, nBlockXSize, nYCheck, pData, bHasNoData, nNoDataValue, nMin,
+        nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+}
+
+template void GDALComputeStatisticsInternal_AVX2<GByte, true>(
+    int, int, int, const GByte *, bool, GUInt32, GUInt32 &, GUInt32 &,
+    GUIntBig &, GUIntBig &, GUIntBig &, GUIntBig &);
+template void GDALComputeStatisticsInternal_AVX2<GByte, false>(
+    int, int, int, const GByte *, bool, GUInt32, GUInt32 &, GUInt32 &,
+    GUIntBig &, GUIntBig &, GUIntBig &, GUIntBig &);
+template void GDALComputeStatisticsInternal_AVX2<GUInt16, true>(
+    int, int, int, const GUInt16 *, bool, GUInt32, GUInt32 &, GUInt32 &,
+    GUIntBig &, GUIntBig &, GUIntBig &, GUIntBig &);
+template void GDALComputeStatisticsInternal_AVX2<GUInt16, false>(
+    int, int, int, const GUInt16 *, bool, GUInt32, GUInt32 &, GUInt32 &,
+    GUIntBig &, GUIntBig &, GUIntBig &, GUIntBig &);
+
+#endif
@@ -17,7 +17,9 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
+#include <cstdint>
 #include <cstring>
 #include <mutex>
 
@@ -30,23 +32,44 @@
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
-
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
+static bool bCountLockContention = false;
+
+// Maximum value accepted for GDAL_RB_CACHE_SHARDS
+constexpr int MAX_CACHE_SHARDS = 64;
+
+namespace
+{
+/************************************************************************/
+/*                          GDALRBCacheShard                            */
+/************************************************************************/
+
+/** Partition of the global block cache.
+ *
+ * Each shard has its own lock and LRU list, so that blocks of unrelated
+ * datasets do not contend on a single lock. The GDAL_CACHEMAX budget
+ * remains global, and is accounted by the nCacheUsed global variable.
+ */
+struct alignas(64) GDALRBCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    std::atomic<GIntBig> nCacheUsed{0};
+
+    // Contention statistics, only maintained if bCountLockContention
+    std::atomic<int> nHolders{0};
+    std::atomic<GUIntBig> nLockAcquisitions{0};
+    std::atomic<GUIntBig> nLockContentions{0};
+};
+}  // namespace
+
+static GDALRBCacheShard asShards[MAX_CACHE_SHARDS];
 
 static CPLLockType GetLockType()
 {
@@ -75,13 +98,118 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+/************************************************************************/
+/*                           GetShardCount()                            */
+/************************************************************************/
 
-#endif
+static int GetShardCount()
+{
+    static const int nShardCount = []()
+    {
+        const char *pszShards =
+            CPLGetConfigOption("GDAL_RB_CACHE_SHARDS", "1");
+        int nShards = EQUAL(pszShards, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                    : atoi(pszShards);
+        if (nShards < 1 || nShards > MAX_CACHE_SHARDS)
+        {
+            const int nClamped =
+                std::clamp(nShards, 1, static_cast<int>(MAX_CACHE_SHARDS));
+            if (!EQUAL(pszShards, "ALL_CPUS"))
+            {
+                CPLError(CE_Warning, CPLE_IllegalArg,
+                         "GDAL_RB_CACHE_SHARDS=%s out of range. Using %d",
+                         pszShards, nClamped);
+            }
+            nShards = nClamped;
+        }
+        if (nShards > 1)
+            CPLDebug("GDAL", "Using %d block cache shards", nShards);
+        return nShards;
+    }();
+    return nShardCount;
+}
+
+/************************************************************************/
+/*                           GetShardIndex()                            */
+/************************************************************************/
+
+// Blocks of a same dataset go to the same shard, so that the eviction
+// heuristics of Internalize() regarding dirty blocks of the dataset being
+// accessed keep working within a shard.
+static int GetShardIndex(GDALRasterBand *poBand)
+{
+    const int nShards = GetShardCount();
+    if (nShards == 1)
+        return 0;
+    GDALDataset *poDS = poBand->GetDataset();
+    const void *pKey = poDS ? static_cast<const void *>(poDS)
+                            : static_cast<const void *>(poBand);
+    // Fibonacci hashing, to spread heap addresses evenly
+    const uint64_t nHash =
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pKey)) *
+        UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<int>((nHash >> 32) % static_cast<unsigned>(nShards));
+}
+
+/************************************************************************/
+/*                        InitializeShardLocks()                        */
+/************************************************************************/
+
+static void InitializeShardLocks()
+{
+    const int nShards = GetShardCount();
+    const CPLLockType eLockType = GetLockType();
+    bCountLockContention = nShards > 1 || bDebugContention;
+    for (int i = 0; i < nShards; ++i)
+    {
+        CPLLockHolderD(&asShards[i].hLock, eLockType);
+        CPLLockSetDebugPerf(asShards[i].hLock, bDebugContention);
+    }
+}
+
+namespace
+{
+/************************************************************************/
+/*                       GDALRBShardLockHolder                          */
+/************************************************************************/
+
+/** Holds the lock of a shard. This is a no-op if the lock has not been
+ * created yet. */
+class GDALRBShardLockHolder
+{
+    GDALRBCacheShard &m_oShard;
+    bool m_bCountContention = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRBShardLockHolder)
+
+  public:
+    explicit GDALRBShardLockHolder(GDALRBCacheShard &oShard)
+        : m_oShard(oShard), m_bCountContention(bCountLockContention)
+    {
+        if (!m_oShard.hLock)
+            return;
+        if (m_bCountContention)
+        {
+            m_oShard.nLockAcquisitions.fetch_add(1, std::memory_order_relaxed);
+            if (m_oShard.nHolders.fetch_add(1, std::memory_order_relaxed) > 0)
+                m_oShard.nLockContentions.fetch_add(1,
+                                                    std::memory_order_relaxed);
+        }
+        CPLAcquireLock(m_oShard.hLock);
+    }
+
+    ~GDALRBShardLockHolder()
+    {
+        if (!m_oShard.hLock)
+            return;
+        CPLReleaseLock(m_oShard.hLock);
+        if (m_bCountContention)
+            m_oShard.nHolders.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+}  // namespace
+
+#define TAKE_SHARD_LOCK(oShard) GDALRBShardLockHolder oHolder(oShard)
 
 // #define ENABLE_DEBUG
 
@@ -221,9 +349,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
-            {
-                INITIALIZE_LOCK;
-            }
+            InitializeShardLocks();
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
 
@@ -272,14 +398,15 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
-    if (nCacheUsed > INT_MAX)
+    const GIntBig nCurCacheUsed = nCacheUsed;
+    if (nCurCacheUsed > INT_MAX)
     {
         CPLErrorOnce(CE_Warning, CPLE_AppDefined,
                      "Cache used value doesn't fit on a 32 bit integer. "
                      "Call GDALGetCacheUsed64() instead");
         return INT_MAX;
     }
-    return static_cast<int>(nCacheUsed);
+    return static_cast<int>(nCurCacheUsed);
 }
 
 /************************************************************************/
@@ -377,16 +504,51 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
+    const int nShards = GetShardCount();
+    if (nShards == 1)
+        return FlushShardCacheBlock(0, CPL_TO_BOOL(bDirtyBlocksOnly), false);
+
+    // Rotate the starting shard, so that repeated calls do not always
+    // drain the same shard.
+    static std::atomic<unsigned> nNextShard{0};
+    const unsigned nStart = nNextShard.fetch_add(1, std::memory_order_relaxed);
+    for (int i = 0; i < nShards; ++i)
+    {
+        const int iShard = static_cast<int>((nStart + i) % nShards);
+        if (FlushShardCacheBlock(iShard, CPL_TO_BOOL(bDirtyBlocksOnly), false))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/************************************************************************/
+/*                        FlushShardCacheBlock()                        */
+/************************************************************************/
+
+/** Attempt to flush the least recently used flushable block of a shard.
+ *
+ * @param iShard Shard index.
+ * @param bDirtyBlocksOnly Only flushes dirty blocks.
+ * @param bCleanBlocksOnly Only flushes clean blocks.
+ * @return true if a block has been flushed.
+ */
+bool GDALRasterBlock::FlushShardCacheBlock(int iShard, bool bDirtyBlocksOnly,
+                                           bool bCleanBlocksOnly)
+{
+    GDALRBCacheShard &oShard = asShards[iShard];
     GDALRasterBlock *poTarget;
 
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        TAKE_SHARD_LOCK(oShard);
+        poTarget = oShard.poOldest;
 
         while (poTarget != nullptr)
         {
-            if (!bDirtyBlocksOnly ||
-                (poTarget->GetDirty() && nDisableDirtyBlockFlushCounter == 0))
+            if (bCleanBlocksOnly
+                    ? !poTarget->GetDirty()
+                    : (!bDirtyBlocksOnly ||
+                       (poTarget->GetDirty() &&
+                        nDisableDirtyBlockFlushCounter == 0)))
             {
                 if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0, -1))
                     break;
@@ -395,7 +557,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            return false;
 #ifndef __COVERITY__
         // Disabled to avoid complains about sleeping under locks, that
         // are only true for debug/testing code
@@ -438,7 +600,91 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
     poTarget->pData = nullptr;
     poTarget->GetBand()->AddBlockToFreeList(poTarget);
 
-    return TRUE;
+    return true;
+}
+
+/************************************************************************/
+/*                        EvictFromOtherShards()                        */
+/************************************************************************/
+
+/** Flush blocks of shards other than iSkipShard, starting with the ones
+ * using the most memory, until the cache usage is below nCurCacheMax.
+ *
+ * Only shards whose memory usage exceeds nMinShardUsage are considered.
+ * Clean blocks are evicted in priority over dirty ones, which are not
+ * considered at all if bCleanBlocksOnly is set.
+ */
+void GDALRasterBlock::EvictFromOtherShards(int iSkipShard,
+                                           GIntBig nCurCacheMax,
+                                           GIntBig nMinShardUsage,
+                                           bool bCleanBlocksOnly)
+{
+    const int nShards = GetShardCount();
+    const int nPasses = bCleanBlocksOnly ? 1 : 2;
+    for (int iPass = 0; iPass < nPasses && nCacheUsed > nCurCacheMax; ++iPass)
+    {
+        const bool bCleanBlocksOnlyThisPass = iPass == 0;
+        if (!bCleanBlocksOnlyThisPass && nDisableDirtyBlockFlushCounter != 0)
+            break;
+
+        uint64_t nExhaustedShards = uint64_t(1) << iSkipShard;
+        while (nCacheUsed > nCurCacheMax)
+        {
+            int iBestShard = -1;
+            GIntBig nBestUsage = nMinShardUsage;
+            for (int i = 0; i < nShards; ++i)
+            {
+                const GIntBig nUsage =
+                    asShards[i].nCacheUsed.load(std::memory_order_relaxed);
+                if (((nExhaustedShards >> i) & 1) == 0 && nUsage > nBestUsage)
+                {
+                    iBestShard = i;
+                    nBestUsage = nUsage;
+                }
+            }
+            if (iBestShard < 0)
+                break;
+            if (!FlushShardCacheBlock(iBestShard, false,
+                                      bCleanBlocksOnlyThisPass))
+                nExhaustedShards |= uint64_t(1) << iBestShard;
+        }
+    }
+}
+
+/************************************************************************/
+/*                       GetCacheLockStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Return statistics on the locks of the block cache.
+ *
+ * Those statistics are only collected when the block cache is sharded
+ * (GDAL_RB_CACHE_SHARDS configuration option greater than 1), or when
+ * the GDAL_RB_LOCK_DEBUG_CONTENTION configuration option is set to YES.
+ *
+ * @param[out] pnLockAcquisitions Pointer to the total number of lock
+ *             acquisitions, or nullptr.
+ * @param[out] pnLockContentions Pointer to the number of lock acquisitions
+ *             where the lock was already held or waited for by another
+ *             thread, or nullptr.
+ * @since GDAL 3.12
+ */
+void GDALRasterBlock::GetCacheLockStatistics(GUIntBig *pnLockAcquisitions,
+                                             GUIntBig *pnLockContentions)
+{
+    GUIntBig nLockAcquisitions = 0;
+    GUIntBig nLockContentions = 0;
+    for (const auto &oShard : asShards)
+    {
+        nLockAcquisitions +=
+            oShard.nLockAcquisitions.load(std::memory_order_relaxed);
+        nLockContentions +=
+            oShard.nLockContentions.load(std::memory_order_relaxed);
+    }
+    if (pnLockAcquisitions)
+        *pnLockAcquisitions = nLockAcquisitions;
+    if (pnLockContentions)
+        *pnLockContentions = nLockContentions;
 }
 
 /************************************************************************/
@@ -535,15 +781,16 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
     : eType(poBandIn->GetRasterDataType()), nXOff(nXOffIn), nYOff(nYOffIn),
       poBand(poBandIn), bMustDetach(true)
 {
-    if (!hRBLock)
+    if (!asShards[0].hLock)
     {
         // Needed for scenarios where GDALAllRegister() is called after
         // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
+        InitializeShardLocks();
     }
 
     CPLAssert(poBandIn != nullptr);
     poBand->GetBlockSize(&nXSize, &nYSize);
+    nCacheShard = GetShardIndex(poBand);
 }
 
 /************************************************************************/
@@ -654,19 +901,20 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_SHARD_LOCK(asShards[nCacheShard]);
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    GDALRBCacheShard &oShard = asShards[nCacheShard];
+    if (oShard.poOldest == this)
+        oShard.poOldest = poPrevious;
 
-    if (poNewest == this)
+    if (oShard.poNewest == this)
     {
-        poNewest = poNext;
+        oShard.poNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -680,7 +928,12 @@ void GDALRasterBlock::Detach_unlocked()
     bMustDetach = false;
 
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+    {
+        const GIntBig nEffectiveBlockSize =
+            GetEffectiveBlockSize(GetBlockSize());
+        nCacheUsed -= nEffectiveBlockSize;
+        oShard.nCacheUsed -= nEffectiveBlockSize;
+    }
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -700,26 +953,31 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int i = 0; i < GetShardCount(); ++i)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        GDALRBCacheShard &oShard = asShards[i];
+        TAKE_SHARD_LOCK(oShard);
+
+        CPLAssert(
+            (oShard.poNewest == nullptr && oShard.poOldest == nullptr) ||
+            (oShard.poNewest != nullptr && oShard.poOldest != nullptr));
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        if (oShard.poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(oShard.poNewest->poPrevious == nullptr);
+            CPLAssert(oShard.poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            for (GDALRasterBlock *poBlock = oShard.poNewest;
+                 poBlock != nullptr; poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+
+                poLast = poBlock;
+            }
 
-        CPLAssert(poOldest == poLast);
+            CPLAssert(oShard.poOldest == poLast);
+        }
     }
 }
 
@@ -732,8 +990,9 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+    GDALRBCacheShard &oShard = asShards[GetShardIndex(poBand)];
+    TAKE_SHARD_LOCK(oShard);
+    for (GDALRasterBlock *poBlock = oShard.poNewest; poBlock != nullptr;
          poBlock = poBlock->poNext)
     {
         if (poBlock->GetBand() == poBand)
@@ -806,32 +1065,36 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    GDALRBCacheShard &oShard = asShards[nCacheShard];
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (oShard.poNewest == this)
         return;
 
-    TAKE_LOCK;
+    TAKE_SHARD_LOCK(oShard);
     Touch_unlocked();
 }
 
 void GDALRasterBlock::Touch_unlocked()
 
 {
+    GDALRBCacheShard &oShard = asShards[nCacheShard];
+
     // Could happen even if tested in Touch() before taking the lock
     // Scenario would be :
     // 0. this is the second block (the one pointed by poNewest->poNext)
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    if (oShard.poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    if (oShard.poOldest == this)
+        oShard.poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -840,19 +1103,19 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = oShard.poNewest;
 
-    if (poNewest != nullptr)
+    if (oShard.poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(oShard.poNewest->poPrevious == nullptr);
+        oShard.poNewest->poPrevious = this;
     }
-    poNewest = this;
+    oShard.poNewest = this;
 
-    if (poOldest == nullptr)
+    if (oShard.poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        oShard.poOldest = this;
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -881,17 +1144,31 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the block cache locks. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
 
+    const int nShards = GetShardCount();
+    GDALRBCacheShard &oShard = asShards[nCacheShard];
+    const GIntBig nEffectiveBlockSize = GetEffectiveBlockSize(nSizeInBytes);
+    nCacheUsed += nEffectiveBlockSize;
+    oShard.nCacheUsed += nEffectiveBlockSize;
+
+    // With a sharded cache, first evict clean blocks from the shards that
+    // use more than their share of the budget, so that a dataset with few
+    // cached blocks does not evict its own blocks in favor of older ones
+    // of other datasets. Flushing dirty blocks of other datasets remains the
+    // last resort, done below.
+    if (nShards > 1 && nCacheUsed > nCurCacheMax)
+        EvictFromOtherShards(nCacheShard, nCurCacheMax, nCurCacheMax / nShards,
+                             /* bCleanBlocksOnly = */ true);
+
     /* -------------------------------------------------------------------- */
     /*      Flush old blocks if we are nearing our memory limit.            */
     /* -------------------------------------------------------------------- */
-    bool bFirstIter = true;
     bool bLoopAgain = false;
     GDALDataset *poThisDS = poBand->GetDataset();
     do
@@ -900,11 +1177,9 @@ CPLErr GDALRasterBlock::Internalize()
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
         {
-            TAKE_LOCK;
+            TAKE_SHARD_LOCK(oShard);
 
-            if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
+            GDALRasterBlock *poTarget = oShard.poOldest;
             while (nCacheUsed > nCurCacheMax)
             {
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
@@ -951,7 +1226,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = oShard.poOldest;
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -1018,8 +1293,6 @@ CPLErr GDALRasterBlock::Internalize()
                 Touch_unlocked();
         }
 
-        bFirstIter = false;
-
         // Now free blocks we have detached and removed from their band.
         for (int i = 0; i < nBlocksToFree; ++i)
         {
@@ -1065,6 +1338,11 @@ CPLErr GDALRasterBlock::Internalize()
         }
     } while (bLoopAgain);
 
+    // Our shard could not release enough memory: take it from the others.
+    if (nShards > 1 && nCacheUsed > nCurCacheMax)
+        EvictFromOtherShards(nCacheShard, nCurCacheMax, 0,
+                             /* bCleanBlocksOnly = */ false);
+
     if (pNewData == nullptr)
     {
         pNewData = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSizeInBytes);
@@ -1126,9 +1404,22 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    if (bDebugContention && bCountLockContention)
+    {
+        GUIntBig nLockAcquisitions = 0;
+        GUIntBig nLockContentions = 0;
+        GetCacheLockStatistics(&nLockAcquisitions, &nLockContentions);
+        CPLDebug("LOCK",
+                 "Block cache: " CPL_FRMT_GUIB
+                 " lock acquisitions, " CPL_FRMT_GUIB " contended",
+                 nLockAcquisitions, nLockContentions);
+    }
+    for (auto &oShard : asShards)
+    {
+        if (oShard.hLock != nullptr)
+            CPLDestroyLock(oShard.hLock);
+        oShard.hLock = nullptr;
+    }
 }
 
 /*! @endcond */
@@ -1211,7 +1502,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_SHARD_LOCK(asShards[nCacheShard]);
 
     return FALSE;
 }
@@ -1220,14 +1511,17 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( int iShard = 0; iShard < GetShardCount(); ++iShard )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( GDALRasterBlock *poBlock = asShards[iShard].poNewest;
+             poBlock != nullptr;
+             poBlock = poBlock->poNext )
+        {
+            printf("Block %d\n", iBlock);/*ok*/
+            poBlock->DumpBlock();
+            printf("\n");/*ok*/
+            iBlock++;
+        }
     }
 }
 
@@ -236,6 +236,13 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
     }
 
   protected:
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     GDALDataset *RefUnderlyingDataset() const override;
 
     void
@@ -382,6 +389,12 @@ class GDALThreadSafeRasterBand final : public GDALProxyRasterBand
     }
 
   protected:
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     GDALRasterBand *RefUnderlyingRasterBand(bool bForceOpen) const override;
     void UnrefUnderlyingRasterBand(
         GDALRasterBand *poUnderlyingRasterBand) const override;
@@ -514,6 +527,25 @@ bool GDALThreadLocalDatasetCacheIsInDestruction()
     return GDALThreadLocalDatasetCache::IsInDestruction();
 }
 
+/************************************************************************/
+/*                  IsEligibleForParallelRasterIORead()                 */
+/************************************************************************/
+
+/** Returns whether a RasterIO() request can be split into chunks that are
+ * read concurrently from several threads, each one of them using its own
+ * thread-local dataset.
+ */
+static bool IsEligibleForParallelRasterIORead(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    int nBufXSize, int nBufYSize, const GDALRasterIOExtraArg *psExtraArg)
+{
+    return eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+           psExtraArg->pfnProgress == nullptr &&
+           (!psExtraArg->bFloatingPointWindowValidity ||
+            (psExtraArg->dfXOff == nXOff && psExtraArg->dfYOff == nYOff &&
+             psExtraArg->dfXSize == nXSize && psExtraArg->dfYSize == nYSize));
+}
+
 /************************************************************************/
 /*                     GDALThreadSafeDataset()                          */
 /************************************************************************/
@@ -843,6 +875,57 @@ void GDALThreadSafeDataset::UnrefUnderlyingDataset(
     poCache->m_oMapReferencedDS.erase(oIter);
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+/** Overrides GDALProxyDataset::IRasterIO() so that full resolution read
+ * requests spanning several blocks are processed concurrently by the worker
+ * threads of the global thread pool, when GDAL_NUM_THREADS is set.
+ */
+CPLErr GDALThreadSafeDataset::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (nBandCount > 0 &&
+        IsEligibleForParallelRasterIORead(eRWFlag, nXOff, nYOff, nXSize,
+                                          nYSize, nBufXSize, nBufYSize,
+                                          psExtraArg))
+    {
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        GetRasterBand(panBandMap[0])->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+        const auto ReadChunk =
+            [this, eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace,
+             nBandSpace](int nChunkXOff, int nChunkYOff, int nChunkXSize,
+                         int nChunkYSize, GByte *pabyChunkData)
+        {
+            GDALRasterIOExtraArg sChunkExtraArg;
+            INIT_RASTERIO_EXTRA_ARG(sChunkExtraArg);
+            return GDALProxyDataset::IRasterIO(
+                GF_Read, nChunkXOff, nChunkYOff, nChunkXSize, nChunkYSize,
+                pabyChunkData, nChunkXSize, nChunkYSize, eBufType, nBandCount,
+                panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+                &sChunkExtraArg);
+        };
+        CPLErr eErr = CE_None;
+        if (GDALParallelRasterIORead(nXOff, nYOff, nXSize, nYSize, nBlockXSize,
+                                     nBlockYSize, pData, nPixelSpace,
+                                     nLineSpace, ReadChunk, eErr))
+        {
+            return eErr;
+        }
+    }
+
+    return GDALProxyDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
 /************************************************************************/
 /*                      GDALThreadSafeRasterBand()                      */
 /************************************************************************/
@@ -893,6 +976,49 @@ GDALThreadSafeRasterBand::GDALThreadSafeRasterBand(
     }
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+/** Overrides GDALProxyRasterBand::IRasterIO() so that full resolution read
+ * requests spanning several blocks are processed concurrently by the worker
+ * threads of the global thread pool, when GDAL_NUM_THREADS is set.
+ */
+CPLErr GDALThreadSafeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (IsEligibleForParallelRasterIORead(eRWFlag, nXOff, nYOff, nXSize,
+                                          nYSize, nBufXSize, nBufYSize,
+                                          psExtraArg))
+    {
+        const auto ReadChunk =
+            [this, eBufType, nPixelSpace,
+             nLineSpace](int nChunkXOff, int nChunkYOff, int nChunkXSize,
+                         int nChunkYSize, GByte *pabyChunkData)
+        {
+            GDALRasterIOExtraArg sChunkExtraArg;
+            INIT_RASTERIO_EXTRA_ARG(sChunkExtraArg);
+            return GDALProxyRasterBand::IRasterIO(
+                GF_Read, nChunkXOff, nChunkYOff, nChunkXSize, nChunkYSize,
+                pabyChunkData, nChunkXSize, nChunkYSize, eBufType, nPixelSpace,
+                nLineSpace, &sChunkExtraArg);
+        };
+        CPLErr eErr = CE_None;
+        if (GDALParallelRasterIORead(nXOff, nYOff, nXSize, nYSize, nBlockXSize,
+                                     nBlockYSize, pData, nPixelSpace,
+                                     nLineSpace, ReadChunk, eErr))
+        {
+            return eErr;
+        }
+    }
+
+    return GDALProxyRasterBand::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nPixelSpace, nLineSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                      RefUnderlyingRasterBand()                       */
 /************************************************************************/
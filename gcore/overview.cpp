@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
@@ -38,6 +39,7 @@
 #include "gdalwarper.h"
 #include "gdal_vrt.h"
 #include "vrtdataset.h"
+#include "overview_avx2.h"
 
 #ifdef USE_NEON_OPTIMIZATIONS
 #include "include_sse2neon.h"
@@ -346,863 +348,126 @@ inline GUInt16 ComputeIntegerRMS_4values<GUInt16, double>(double sumSquares)
 }
 
 #ifdef USE_SSE2
+#include "overview_kernels.hpp"
 
-/************************************************************************/
-/*                   QuadraticMeanByteSSE2OrAVX2()                      */
-/************************************************************************/
-
-#if defined(__SSE4_1__) || defined(__AVX__) || defined(USE_NEON_OPTIMIZATIONS)
-#define sse2_packus_epi32 _mm_packus_epi32
-#else
-inline __m128i sse2_packus_epi32(__m128i a, __m128i b)
-{
-    const auto minus32768_32 = _mm_set1_epi32(-32768);
-    const auto minus32768_16 = _mm_set1_epi16(-32768);
-    a = _mm_add_epi32(a, minus32768_32);
-    b = _mm_add_epi32(b, minus32768_32);
-    a = _mm_packs_epi32(a, b);
-    a = _mm_sub_epi16(a, minus32768_16);
-    return a;
-}
+// When not building with -mavx2, use the AVX2 flavor of the kernels built
+// in overview_avx2.cpp if the CPU supports it.
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(__AVX2__) &&                \
+    (defined(__x86_64) || defined(_M_X64))
+#define USE_RUNTIME_AVX2_DISPATCH
 #endif
 
-#if defined(__SSSE3__) || defined(USE_NEON_OPTIMIZATIONS)
-#define sse2_hadd_epi16 _mm_hadd_epi16
-#else
-inline __m128i sse2_hadd_epi16(__m128i a, __m128i b)
-{
-    // Horizontal addition of adjacent pairs
-    const auto mask = _mm_set1_epi32(0xFFFF);
-    const auto horizLo =
-        _mm_add_epi32(_mm_and_si128(a, mask), _mm_srli_epi32(a, 16));
-    const auto horizHi =
-        _mm_add_epi32(_mm_and_si128(b, mask), _mm_srli_epi32(b, 16));
-
-    // Recombine low and high parts
-    return _mm_packs_epi32(horizLo, horizHi);
-}
-#endif
-
-#ifdef __AVX2__
-
-#define set1_epi16 _mm256_set1_epi16
-#define set1_epi32 _mm256_set1_epi32
-#define setzero _mm256_setzero_si256
-#define set1_ps _mm256_set1_ps
-#define loadu_int(x) _mm256_loadu_si256(reinterpret_cast<__m256i const *>(x))
-#define unpacklo_epi8 _mm256_unpacklo_epi8
-#define unpackhi_epi8 _mm256_unpackhi_epi8
-#define madd_epi16 _mm256_madd_epi16
-#define add_epi32 _mm256_add_epi32
-#define mul_ps _mm256_mul_ps
-#define cvtepi32_ps _mm256_cvtepi32_ps
-#define sqrt_ps _mm256_sqrt_ps
-#define cvttps_epi32 _mm256_cvttps_epi32
-#define packs_epi32 _mm256_packs_epi32
-#define packus_epi32 _mm256_packus_epi32
-#define srli_epi32 _mm256_srli_epi32
-#define mullo_epi16 _mm256_mullo_epi16
-#define srli_epi16 _mm256_srli_epi16
-#define cmpgt_epi16 _mm256_cmpgt_epi16
-#define add_epi16 _mm256_add_epi16
-#define sub_epi16 _mm256_sub_epi16
-#define packus_epi16 _mm256_packus_epi16
-
-/* AVX2 operates on 2 separate 128-bit lanes, so we have to do shuffling */
-/* to get the lower 128-bit bits of what would be a true 256-bit vector register
- */
-
-inline __m256i FIXUP_LANES(__m256i x)
-{
-    return _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 1, 2, 0));
-}
-
-#define store_lo(x, y)                                                         \
-    _mm_storeu_si128(reinterpret_cast<__m128i *>(x),                           \
-                     _mm256_extracti128_si256(FIXUP_LANES(y), 0))
-#define storeu_int(x, y)                                                       \
-    _mm256_storeu_si256(reinterpret_cast<__m256i *>(x), FIXUP_LANES(y))
-#define hadd_epi16 _mm256_hadd_epi16
-#else
-#define set1_epi16 _mm_set1_epi16
-#define set1_epi32 _mm_set1_epi32
-#define setzero _mm_setzero_si128
-#define set1_ps _mm_set1_ps
-#define loadu_int(x) _mm_loadu_si128(reinterpret_cast<__m128i const *>(x))
-#define unpacklo_epi8 _mm_unpacklo_epi8
-#define unpackhi_epi8 _mm_unpackhi_epi8
-#define madd_epi16 _mm_madd_epi16
-#define add_epi32 _mm_add_epi32
-#define mul_ps _mm_mul_ps
-#define cvtepi32_ps _mm_cvtepi32_ps
-#define sqrt_ps _mm_sqrt_ps
-#define cvttps_epi32 _mm_cvttps_epi32
-#define packs_epi32 _mm_packs_epi32
-#define packus_epi32 sse2_packus_epi32
-#define srli_epi32 _mm_srli_epi32
-#define mullo_epi16 _mm_mullo_epi16
-#define srli_epi16 _mm_srli_epi16
-#define cmpgt_epi16 _mm_cmpgt_epi16
-#define add_epi16 _mm_add_epi16
-#define sub_epi16 _mm_sub_epi16
-#define packus_epi16 _mm_packus_epi16
-#define store_lo(x, y) _mm_storel_epi64(reinterpret_cast<__m128i *>(x), (y))
-#define storeu_int(x, y) _mm_storeu_si128(reinterpret_cast<__m128i *>(x), (y))
-#define hadd_epi16 sse2_hadd_epi16
-#endif
-
-template <class T>
-static int
-#if defined(__GNUC__)
-    __attribute__((noinline))
-#endif
-    QuadraticMeanByteSSE2OrAVX2(int nDstXWidth, int nChunkXSize,
-                                const T *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                                T *CPL_RESTRICT pDstScanline)
-{
-    // Optimized implementation for RMS on Byte by
-    // processing by group of 8 output pixels, so as to use
-    // a single _mm_sqrt_ps() call for 4 output pixels
-    const T *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto one16 = set1_epi16(1);
-    const auto one32 = set1_epi32(1);
-    const auto zero = setzero();
-    const auto minus32768 = set1_epi16(-32768);
-
-    constexpr int DEST_ELTS = static_cast<int>(sizeof(zero)) / 2;
-    for (; iDstPixel < nDstXWidth - (DEST_ELTS - 1); iDstPixel += DEST_ELTS)
-    {
-        // Load 2 * DEST_ELTS bytes from each line
-        auto firstLine = loadu_int(pSrcScanlineShifted);
-        auto secondLine = loadu_int(pSrcScanlineShifted + nChunkXSize);
-        // Extend those Bytes as UInt16s
-        auto firstLineLo = unpacklo_epi8(firstLine, zero);
-        auto firstLineHi = unpackhi_epi8(firstLine, zero);
-        auto secondLineLo = unpacklo_epi8(secondLine, zero);
-        auto secondLineHi = unpackhi_epi8(secondLine, zero);
-
-        // Multiplication of 16 bit values and horizontal
-        // addition of 32 bit results
-        // [ src[2*i+0]^2 + src[2*i+1]^2 for i in range(4) ]
-        firstLineLo = madd_epi16(firstLineLo, firstLineLo);
-        firstLineHi = madd_epi16(firstLineHi, firstLineHi);
-        secondLineLo = madd_epi16(secondLineLo, secondLineLo);
-        secondLineHi = madd_epi16(secondLineHi, secondLineHi);
-
-        // Vertical addition
-        const auto sumSquaresLo = add_epi32(firstLineLo, secondLineLo);
-        const auto sumSquaresHi = add_epi32(firstLineHi, secondLineHi);
-
-        const auto sumSquaresPlusOneDiv4Lo =
-            srli_epi32(add_epi32(sumSquaresLo, one32), 2);
-        const auto sumSquaresPlusOneDiv4Hi =
-            srli_epi32(add_epi32(sumSquaresHi, one32), 2);
-
-        // Take square root and truncate/floor to int32
-        const auto rmsLo =
-            cvttps_epi32(sqrt_ps(cvtepi32_ps(sumSquaresPlusOneDiv4Lo)));
-        const auto rmsHi =
-            cvttps_epi32(sqrt_ps(cvtepi32_ps(sumSquaresPlusOneDiv4Hi)));
-
-        // Merge back low and high registers with each RMS value
-        // as a 16 bit value.
-        auto rms = packs_epi32(rmsLo, rmsHi);
-
-        // Round to upper value if it minimizes the
-        // error |rms^2 - sumSquares/4|
-        // if( 2 * (2 * rms * (rms + 1) + 1) < sumSquares )
-        //    rms += 1;
-        // which is equivalent to:
-        // if( rms * (rms + 1) < (sumSquares+1) / 4 )
-        //    rms += 1;
-        // And both left and right parts fit on 16 (unsigned) bits
-        const auto sumSquaresPlusOneDiv4 =
-            packus_epi32(sumSquaresPlusOneDiv4Lo, sumSquaresPlusOneDiv4Hi);
-        // cmpgt_epi16 operates on signed int16, but here
-        // we have unsigned values, so shift them by -32768 before
-        const auto mask = cmpgt_epi16(
-            add_epi16(sumSquaresPlusOneDiv4, minus32768),
-            add_epi16(mullo_epi16(rms, add_epi16(rms, one16)), minus32768));
-        // The value of the mask will be -1 when the correction needs to be
-        // applied
-        rms = sub_epi16(rms, mask);
-
-        // Pack each 16 bit RMS value to 8 bits
-        rms = packus_epi16(rms, rms /* could be anything */);
-        store_lo(&pDstScanline[iDstPixel], rms);
-        pSrcScanlineShifted += 2 * DEST_ELTS;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
-}
-
 /************************************************************************/
-/*                      AverageByteSSE2OrAVX2()                         */
+/*                       QuadraticMeanByteSIMD()                        */
 /************************************************************************/
 
-static int
-AverageByteSSE2OrAVX2(int nDstXWidth, int nChunkXSize,
-                      const GByte *&CPL_RESTRICT pSrcScanlineShiftedInOut,
+static inline int
+QuadraticMeanByteSIMD(int nDstXWidth, int nChunkXSize,
+                      const GByte *&CPL_RESTRICT pSrcScanlineShifted,
                       GByte *CPL_RESTRICT pDstScanline)
 {
-    // Optimized implementation for average on Byte by
-    // processing by group of 16 output pixels for SSE2, or 32 for AVX2
-
-    const auto zero = setzero();
-    const auto two16 = set1_epi16(2);
-    const GByte *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    constexpr int DEST_ELTS = static_cast<int>(sizeof(zero)) / 2;
-    int iDstPixel = 0;
-    for (; iDstPixel < nDstXWidth - (2 * DEST_ELTS - 1);
-         iDstPixel += 2 * DEST_ELTS)
-    {
-        decltype(setzero()) average0;
-        {
-            // Load 2 * DEST_ELTS bytes from each line
-            const auto firstLine = loadu_int(pSrcScanlineShifted);
-            const auto secondLine =
-                loadu_int(pSrcScanlineShifted + nChunkXSize);
-            // Extend those Bytes as UInt16s
-            const auto firstLineLo = unpacklo_epi8(firstLine, zero);
-            const auto firstLineHi = unpackhi_epi8(firstLine, zero);
-            const auto secondLineLo = unpacklo_epi8(secondLine, zero);
-            const auto secondLineHi = unpackhi_epi8(secondLine, zero);
-
-            // Vertical addition
-            const auto sumLo = add_epi16(firstLineLo, secondLineLo);
-            const auto sumHi = add_epi16(firstLineHi, secondLineHi);
-
-            // Horizontal addition of adjacent pairs, and recombine low and high
-            // parts
-            const auto sum = hadd_epi16(sumLo, sumHi);
-
-            // average = (sum + 2) / 4
-            average0 = srli_epi16(add_epi16(sum, two16), 2);
-
-            pSrcScanlineShifted += 2 * DEST_ELTS;
-        }
-
-        decltype(setzero()) average1;
-        {
-            // Load 2 * DEST_ELTS bytes from each line
-            const auto firstLine = loadu_int(pSrcScanlineShifted);
-            const auto secondLine =
-                loadu_int(pSrcScanlineShifted + nChunkXSize);
-            // Extend those Bytes as UInt16s
-            const auto firstLineLo = unpacklo_epi8(firstLine, zero);
-            const auto firstLineHi = unpackhi_epi8(firstLine, zero);
-            const auto secondLineLo = unpacklo_epi8(secondLine, zero);
-            const auto secondLineHi = unpackhi_epi8(secondLine, zero);
-
-            // Vertical addition
-            const auto sumLo = add_epi16(firstLineLo, secondLineLo);
-            const auto sumHi = add_epi16(firstLineHi, secondLineHi);
-
-            // Horizontal addition of adjacent pairs, and recombine low and high
-            // parts
-            const auto sum = hadd_epi16(sumLo, sumHi);
-
-            // average = (sum + 2) / 4
-            average1 = srli_epi16(add_epi16(sum, two16), 2);
-
-            pSrcScanlineShifted += 2 * DEST_ELTS;
-        }
-
-        // Pack each 16 bit average value to 8 bits
-        const auto average = packus_epi16(average0, average1);
-        storeu_int(&pDstScanline[iDstPixel], average);
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
+#ifdef USE_RUNTIME_AVX2_DISPATCH
+    if (CPLHaveRuntimeAVX2())
+        return GDALQuadraticMeanByte_AVX2(nDstXWidth, nChunkXSize,
+                                          pSrcScanlineShifted, pDstScanline);
+#endif
+    return QuadraticMeanByteSSE2OrAVX2(nDstXWidth, nChunkXSize,
+                                       pSrcScanlineShifted, pDstScanline);
 }
 
 /************************************************************************/
-/*                     QuadraticMeanUInt16SSE2()                        */
+/*                          AverageByteSIMD()                           */
 /************************************************************************/
 
-#ifdef __SSE3__
-#define sse2_hadd_pd _mm_hadd_pd
-#else
-inline __m128d sse2_hadd_pd(__m128d a, __m128d b)
-{
-    auto aLo_bLo =
-        _mm_castps_pd(_mm_movelh_ps(_mm_castpd_ps(a), _mm_castpd_ps(b)));
-    auto aHi_bHi =
-        _mm_castps_pd(_mm_movehl_ps(_mm_castpd_ps(b), _mm_castpd_ps(a)));
-    return _mm_add_pd(aLo_bLo, aHi_bHi);  // (aLo + aHi, bLo + bHi)
-}
-#endif
-
-inline __m128d SQUARE_PD(__m128d x)
-{
-    return _mm_mul_pd(x, x);
-}
-
-#ifdef __AVX2__
-
-inline __m256d SQUARE_PD(__m256d x)
-{
-    return _mm256_mul_pd(x, x);
-}
-
-inline __m256d FIXUP_LANES(__m256d x)
-{
-    return _mm256_permute4x64_pd(x, _MM_SHUFFLE(3, 1, 2, 0));
-}
-
-inline __m256 FIXUP_LANES(__m256 x)
-{
-    return _mm256_castpd_ps(FIXUP_LANES(_mm256_castps_pd(x)));
-}
-
-#endif
-
-static int
-QuadraticMeanUInt16SSE2(int nDstXWidth, int nChunkXSize,
-                        const uint16_t *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                        uint16_t *CPL_RESTRICT pDstScanline)
+static inline int
+AverageByteSIMD(int nDstXWidth, int nChunkXSize,
+                const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                GByte *CPL_RESTRICT pDstScanline)
 {
-    // Optimized implementation for RMS on UInt16 by
-    // processing by group of 4 output pixels.
-    const uint16_t *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto zero = _mm_setzero_si128();
-
-#ifdef __AVX2__
-    const auto zeroDot25 = _mm256_set1_pd(0.25);
-    const auto zeroDot5 = _mm256_set1_pd(0.5);
-
-    // The first four 0's could be anything, as we only take the bottom
-    // 128 bits.
-    const auto permutation = _mm256_set_epi32(0, 0, 0, 0, 6, 4, 2, 0);
-#else
-    const auto zeroDot25 = _mm_set1_pd(0.25);
-    const auto zeroDot5 = _mm_set1_pd(0.5);
-#endif
-
-    constexpr int DEST_ELTS =
-        static_cast<int>(sizeof(zero) / sizeof(uint16_t)) / 2;
-    for (; iDstPixel < nDstXWidth - (DEST_ELTS - 1); iDstPixel += DEST_ELTS)
-    {
-        // Load 8 UInt16 from each line
-        const auto firstLine = _mm_loadu_si128(
-            reinterpret_cast<__m128i const *>(pSrcScanlineShifted));
-        const auto secondLine =
-            _mm_loadu_si128(reinterpret_cast<__m128i const *>(
-                pSrcScanlineShifted + nChunkXSize));
-
-        // Detect if all of the source values fit in 14 bits.
-        // because if x < 2^14, then 4 * x^2 < 2^30 which fits in a signed int32
-        // and we can do a much faster implementation.
-        const auto maskTmp =
-            _mm_srli_epi16(_mm_or_si128(firstLine, secondLine), 14);
-#if defined(__i386__) || defined(_M_IX86)
-        uint64_t nMaskFitsIn14Bits = 0;
-        _mm_storel_epi64(
-            reinterpret_cast<__m128i *>(&nMaskFitsIn14Bits),
-            _mm_packus_epi16(maskTmp, maskTmp /* could be anything */));
-#else
-        const auto nMaskFitsIn14Bits = _mm_cvtsi128_si64(
-            _mm_packus_epi16(maskTmp, maskTmp /* could be anything */));
+#ifdef USE_RUNTIME_AVX2_DISPATCH
+    if (CPLHaveRuntimeAVX2())
+        return GDALAverageByte_AVX2(nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
 #endif
-        if (nMaskFitsIn14Bits == 0)
-        {
-            // Multiplication of 16 bit values and horizontal
-            // addition of 32 bit results
-            const auto firstLineHSumSquare =
-                _mm_madd_epi16(firstLine, firstLine);
-            const auto secondLineHSumSquare =
-                _mm_madd_epi16(secondLine, secondLine);
-            // Vertical addition
-            const auto sumSquares =
-                _mm_add_epi32(firstLineHSumSquare, secondLineHSumSquare);
-            // In theory we should take sqrt(sumSquares * 0.25f)
-            // but given the rounding we do, this is equivalent to
-            // sqrt((sumSquares + 1)/4). This has been verified exhaustively for
-            // sumSquares <= 4 * 16383^2
-            const auto one32 = _mm_set1_epi32(1);
-            const auto sumSquaresPlusOneDiv4 =
-                _mm_srli_epi32(_mm_add_epi32(sumSquares, one32), 2);
-            // Take square root and truncate/floor to int32
-            auto rms = _mm_cvttps_epi32(
-                _mm_sqrt_ps(_mm_cvtepi32_ps(sumSquaresPlusOneDiv4)));
-
-            // Round to upper value if it minimizes the
-            // error |rms^2 - sumSquares/4|
-            // if( 2 * (2 * rms * (rms + 1) + 1) < sumSquares )
-            //    rms += 1;
-            // which is equivalent to:
-            // if( rms * rms + rms < (sumSquares+1) / 4 )
-            //    rms += 1;
-            auto mask =
-                _mm_cmpgt_epi32(sumSquaresPlusOneDiv4,
-                                _mm_add_epi32(_mm_madd_epi16(rms, rms), rms));
-            rms = _mm_sub_epi32(rms, mask);
-            // Pack each 32 bit RMS value to 16 bits
-            rms = _mm_packs_epi32(rms, rms /* could be anything */);
-            _mm_storel_epi64(
-                reinterpret_cast<__m128i *>(&pDstScanline[iDstPixel]), rms);
-            pSrcScanlineShifted += 2 * DEST_ELTS;
-            continue;
-        }
-
-        // An approach using _mm_mullo_epi16, _mm_mulhi_epu16 before extending
-        // to 32 bit would result in 4 multiplications instead of 8, but
-        // mullo/mulhi have a worse throughput than mul_pd.
-
-        // Extend those UInt16s as UInt32s
-        const auto firstLineLo = _mm_unpacklo_epi16(firstLine, zero);
-        const auto firstLineHi = _mm_unpackhi_epi16(firstLine, zero);
-        const auto secondLineLo = _mm_unpacklo_epi16(secondLine, zero);
-        const auto secondLineHi = _mm_unpackhi_epi16(secondLine, zero);
-
-#ifdef __AVX2__
-        // Multiplication of 32 bit values previously converted to 64 bit double
-        const auto firstLineLoDbl = SQUARE_PD(_mm256_cvtepi32_pd(firstLineLo));
-        const auto firstLineHiDbl = SQUARE_PD(_mm256_cvtepi32_pd(firstLineHi));
-        const auto secondLineLoDbl =
-            SQUARE_PD(_mm256_cvtepi32_pd(secondLineLo));
-        const auto secondLineHiDbl =
-            SQUARE_PD(_mm256_cvtepi32_pd(secondLineHi));
-
-        // Vertical addition of squares
-        const auto sumSquaresLo =
-            _mm256_add_pd(firstLineLoDbl, secondLineLoDbl);
-        const auto sumSquaresHi =
-            _mm256_add_pd(firstLineHiDbl, secondLineHiDbl);
-
-        // Horizontal addition of squares
-        const auto sumSquares =
-            FIXUP_LANES(_mm256_hadd_pd(sumSquaresLo, sumSquaresHi));
-
-        const auto sumDivWeight = _mm256_mul_pd(sumSquares, zeroDot25);
-
-        // Take square root and truncate/floor to int32
-        auto rms = _mm256_cvttpd_epi32(_mm256_sqrt_pd(sumDivWeight));
-        const auto rmsDouble = _mm256_cvtepi32_pd(rms);
-        const auto right = _mm256_sub_pd(
-            sumDivWeight, _mm256_add_pd(SQUARE_PD(rmsDouble), rmsDouble));
-
-        auto mask =
-            _mm256_castpd_ps(_mm256_cmp_pd(zeroDot5, right, _CMP_LT_OS));
-        // Extract 32-bit from each of the 4 64-bit masks
-        // mask = FIXUP_LANES(_mm256_shuffle_ps(mask, mask,
-        // _MM_SHUFFLE(2,0,2,0)));
-        mask = _mm256_permutevar8x32_ps(mask, permutation);
-        const auto maskI = _mm_castps_si128(_mm256_extractf128_ps(mask, 0));
-
-        // Apply the correction
-        rms = _mm_sub_epi32(rms, maskI);
-
-        // Pack each 32 bit RMS value to 16 bits
-        rms = _mm_packus_epi32(rms, rms /* could be anything */);
-#else
-        // Multiplication of 32 bit values previously converted to 64 bit double
-        const auto firstLineLoLo = SQUARE_PD(_mm_cvtepi32_pd(firstLineLo));
-        const auto firstLineLoHi =
-            SQUARE_PD(_mm_cvtepi32_pd(_mm_srli_si128(firstLineLo, 8)));
-        const auto firstLineHiLo = SQUARE_PD(_mm_cvtepi32_pd(firstLineHi));
-        const auto firstLineHiHi =
-            SQUARE_PD(_mm_cvtepi32_pd(_mm_srli_si128(firstLineHi, 8)));
-
-        const auto secondLineLoLo = SQUARE_PD(_mm_cvtepi32_pd(secondLineLo));
-        const auto secondLineLoHi =
-            SQUARE_PD(_mm_cvtepi32_pd(_mm_srli_si128(secondLineLo, 8)));
-        const auto secondLineHiLo = SQUARE_PD(_mm_cvtepi32_pd(secondLineHi));
-        const auto secondLineHiHi =
-            SQUARE_PD(_mm_cvtepi32_pd(_mm_srli_si128(secondLineHi, 8)));
-
-        // Vertical addition of squares
-        const auto sumSquaresLoLo = _mm_add_pd(firstLineLoLo, secondLineLoLo);
-        const auto sumSquaresLoHi = _mm_add_pd(firstLineLoHi, secondLineLoHi);
-        const auto sumSquaresHiLo = _mm_add_pd(firstLineHiLo, secondLineHiLo);
-        const auto sumSquaresHiHi = _mm_add_pd(firstLineHiHi, secondLineHiHi);
-
-        // Horizontal addition of squares
-        const auto sumSquaresLo = sse2_hadd_pd(sumSquaresLoLo, sumSquaresLoHi);
-        const auto sumSquaresHi = sse2_hadd_pd(sumSquaresHiLo, sumSquaresHiHi);
-
-        const auto sumDivWeightLo = _mm_mul_pd(sumSquaresLo, zeroDot25);
-        const auto sumDivWeightHi = _mm_mul_pd(sumSquaresHi, zeroDot25);
-        // Take square root and truncate/floor to int32
-        const auto rmsLo = _mm_cvttpd_epi32(_mm_sqrt_pd(sumDivWeightLo));
-        const auto rmsHi = _mm_cvttpd_epi32(_mm_sqrt_pd(sumDivWeightHi));
-
-        // Correctly round rms to minimize | rms^2 - sumSquares / 4 |
-        // if( 0.5 < sumDivWeight - (rms * rms + rms) )
-        //     rms += 1;
-        const auto rmsLoDouble = _mm_cvtepi32_pd(rmsLo);
-        const auto rmsHiDouble = _mm_cvtepi32_pd(rmsHi);
-        const auto rightLo = _mm_sub_pd(
-            sumDivWeightLo, _mm_add_pd(SQUARE_PD(rmsLoDouble), rmsLoDouble));
-        const auto rightHi = _mm_sub_pd(
-            sumDivWeightHi, _mm_add_pd(SQUARE_PD(rmsHiDouble), rmsHiDouble));
-
-        const auto maskLo = _mm_castpd_ps(_mm_cmplt_pd(zeroDot5, rightLo));
-        const auto maskHi = _mm_castpd_ps(_mm_cmplt_pd(zeroDot5, rightHi));
-        // The value of the mask will be -1 when the correction needs to be
-        // applied
-        const auto mask = _mm_castps_si128(_mm_shuffle_ps(
-            maskLo, maskHi, (0 << 0) | (2 << 2) | (0 << 4) | (2 << 6)));
-
-        auto rms = _mm_castps_si128(
-            _mm_movelh_ps(_mm_castsi128_ps(rmsLo), _mm_castsi128_ps(rmsHi)));
-        // Apply the correction
-        rms = _mm_sub_epi32(rms, mask);
-
-        // Pack each 32 bit RMS value to 16 bits
-        rms = sse2_packus_epi32(rms, rms /* could be anything */);
-#endif
-
-        _mm_storel_epi64(reinterpret_cast<__m128i *>(&pDstScanline[iDstPixel]),
-                         rms);
-        pSrcScanlineShifted += 2 * DEST_ELTS;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
+    return AverageByteSSE2OrAVX2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                 pDstScanline);
 }
 
 /************************************************************************/
-/*                         AverageUInt16SSE2()                          */
+/*                      QuadraticMeanUInt16SIMD()                       */
 /************************************************************************/
 
-static int
-AverageUInt16SSE2(int nDstXWidth, int nChunkXSize,
-                  const uint16_t *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                  uint16_t *CPL_RESTRICT pDstScanline)
+static inline int
+QuadraticMeanUInt16SIMD(int nDstXWidth, int nChunkXSize,
+                        const GUInt16 *&CPL_RESTRICT pSrcScanlineShifted,
+                        GUInt16 *CPL_RESTRICT pDstScanline)
 {
-    // Optimized implementation for average on UInt16 by
-    // processing by group of 8 output pixels.
-
-    const auto mask = _mm_set1_epi32(0xFFFF);
-    const auto two = _mm_set1_epi32(2);
-    const uint16_t *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    constexpr int DEST_ELTS = static_cast<int>(sizeof(mask) / sizeof(uint16_t));
-    for (; iDstPixel < nDstXWidth - (DEST_ELTS - 1); iDstPixel += DEST_ELTS)
-    {
-        __m128i averageLow;
-        // Load 8 UInt16 from each line
-        {
-            const auto firstLine = _mm_loadu_si128(
-                reinterpret_cast<__m128i const *>(pSrcScanlineShifted));
-            const auto secondLine =
-                _mm_loadu_si128(reinterpret_cast<__m128i const *>(
-                    pSrcScanlineShifted + nChunkXSize));
-
-            // Horizontal addition and extension to 32 bit
-            const auto horizAddFirstLine = _mm_add_epi32(
-                _mm_and_si128(firstLine, mask), _mm_srli_epi32(firstLine, 16));
-            const auto horizAddSecondLine =
-                _mm_add_epi32(_mm_and_si128(secondLine, mask),
-                              _mm_srli_epi32(secondLine, 16));
-
-            // Vertical addition and average computation
-            // average = (sum + 2) >> 2
-            const auto sum = _mm_add_epi32(
-                _mm_add_epi32(horizAddFirstLine, horizAddSecondLine), two);
-            averageLow = _mm_srli_epi32(sum, 2);
-        }
-        // Load 8 UInt16 from each line
-        __m128i averageHigh;
-        {
-            const auto firstLine =
-                _mm_loadu_si128(reinterpret_cast<__m128i const *>(
-                    pSrcScanlineShifted + DEST_ELTS));
-            const auto secondLine =
-                _mm_loadu_si128(reinterpret_cast<__m128i const *>(
-                    pSrcScanlineShifted + DEST_ELTS + nChunkXSize));
-
-            // Horizontal addition and extension to 32 bit
-            const auto horizAddFirstLine = _mm_add_epi32(
-                _mm_and_si128(firstLine, mask), _mm_srli_epi32(firstLine, 16));
-            const auto horizAddSecondLine =
-                _mm_add_epi32(_mm_and_si128(secondLine, mask),
-                              _mm_srli_epi32(secondLine, 16));
-
-            // Vertical addition and average computation
-            // average = (sum + 2) >> 2
-            const auto sum = _mm_add_epi32(
-                _mm_add_epi32(horizAddFirstLine, horizAddSecondLine), two);
-            averageHigh = _mm_srli_epi32(sum, 2);
-        }
-
-        // Pack each 32 bit average value to 16 bits
-        auto average = sse2_packus_epi32(averageLow, averageHigh);
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(&pDstScanline[iDstPixel]),
-                         average);
-        pSrcScanlineShifted += 2 * DEST_ELTS;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
+#ifdef USE_RUNTIME_AVX2_DISPATCH
+    if (CPLHaveRuntimeAVX2())
+        return GDALQuadraticMeanUInt16_AVX2(nDstXWidth, nChunkXSize,
+                                            pSrcScanlineShifted, pDstScanline);
+#endif
+    return QuadraticMeanUInt16SSE2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                   pDstScanline);
 }
 
 /************************************************************************/
-/*                      QuadraticMeanFloatSSE2()                        */
+/*                         AverageUInt16SIMD()                          */
 /************************************************************************/
 
-#if !defined(ARM_V7)
-
-#ifdef __SSE3__
-#define sse2_hadd_ps _mm_hadd_ps
-#else
-inline __m128 sse2_hadd_ps(__m128 a, __m128 b)
-{
-    auto aEven_bEven = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
-    auto aOdd_bOdd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
-    return _mm_add_ps(aEven_bEven, aOdd_bOdd);  // (aEven + aOdd, bEven + bOdd)
-}
-#endif
-
-#ifdef __AVX2__
-#define set1_ps _mm256_set1_ps
-#define loadu_ps _mm256_loadu_ps
-#define andnot_ps _mm256_andnot_ps
-#define and_ps _mm256_and_ps
-#define max_ps _mm256_max_ps
-#define shuffle_ps _mm256_shuffle_ps
-#define div_ps _mm256_div_ps
-#define cmpeq_ps(x, y) _mm256_cmp_ps(x, y, _CMP_EQ_OQ)
-#define mul_ps _mm256_mul_ps
-#define add_ps _mm256_add_ps
-#define hadd_ps _mm256_hadd_ps
-#define sqrt_ps _mm256_sqrt_ps
-#define or_ps _mm256_or_ps
-#define unpacklo_ps _mm256_unpacklo_ps
-#define unpackhi_ps _mm256_unpackhi_ps
-#define storeu_ps _mm256_storeu_ps
-#define blendv_ps _mm256_blendv_ps
-
-inline __m256 SQUARE_PS(__m256 x)
+static inline int
+AverageUInt16SIMD(int nDstXWidth, int nChunkXSize,
+                  const GUInt16 *&CPL_RESTRICT pSrcScanlineShifted,
+                  GUInt16 *CPL_RESTRICT pDstScanline)
 {
-    return _mm256_mul_ps(x, x);
+    return AverageUInt16SSE2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                             pDstScanline);
 }
 
-#else
-
-#define set1_ps _mm_set1_ps
-#define loadu_ps _mm_loadu_ps
-#define andnot_ps _mm_andnot_ps
-#define and_ps _mm_and_ps
-#define max_ps _mm_max_ps
-#define shuffle_ps _mm_shuffle_ps
-#define div_ps _mm_div_ps
-#define cmpeq_ps _mm_cmpeq_ps
-#define mul_ps _mm_mul_ps
-#define add_ps _mm_add_ps
-#define hadd_ps sse2_hadd_ps
-#define sqrt_ps _mm_sqrt_ps
-#define or_ps _mm_or_ps
-#define unpacklo_ps _mm_unpacklo_ps
-#define unpackhi_ps _mm_unpackhi_ps
-#define storeu_ps _mm_storeu_ps
-
-inline __m128 blendv_ps(__m128 a, __m128 b, __m128 mask)
-{
-#if defined(__SSE4_1__) || defined(__AVX__) || defined(USE_NEON_OPTIMIZATIONS)
-    return _mm_blendv_ps(a, b, mask);
-#else
-    return _mm_or_ps(_mm_andnot_ps(mask, a), _mm_and_ps(mask, b));
-#endif
-}
+#if !defined(ARM_V7)
 
-inline __m128 SQUARE_PS(__m128 x)
-{
-    return _mm_mul_ps(x, x);
-}
+/************************************************************************/
+/*                       QuadraticMeanFloatSIMD()                       */
+/************************************************************************/
 
-inline __m128 FIXUP_LANES(__m128 x)
+static inline int
+QuadraticMeanFloatSIMD(int nDstXWidth, int nChunkXSize,
+                       const float *&CPL_RESTRICT pSrcScanlineShifted,
+                       float *CPL_RESTRICT pDstScanline)
 {
-    return x;
-}
-
-#endif
-
-static int
-#if defined(__GNUC__)
-    __attribute__((noinline))
+#ifdef USE_RUNTIME_AVX2_DISPATCH
+    if (CPLHaveRuntimeAVX2())
+        return GDALQuadraticMeanFloat_AVX2(nDstXWidth, nChunkXSize,
+                                           pSrcScanlineShifted, pDstScanline);
 #endif
-    QuadraticMeanFloatSSE2(int nDstXWidth, int nChunkXSize,
-                           const float *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                           float *CPL_RESTRICT pDstScanline)
-{
-    // Optimized implementation for RMS on Float32 by
-    // processing by group of output pixels.
-    const float *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto minus_zero = set1_ps(-0.0f);
-    const auto zeroDot25 = set1_ps(0.25f);
-    const auto one = set1_ps(1.0f);
-    const auto infv = set1_ps(std::numeric_limits<float>::infinity());
-    constexpr int DEST_ELTS = static_cast<int>(sizeof(one) / sizeof(float));
-
-    for (; iDstPixel < nDstXWidth - (DEST_ELTS - 1); iDstPixel += DEST_ELTS)
-    {
-        // Load 2*DEST_ELTS Float32 from each line
-        auto firstLineLo = loadu_ps(pSrcScanlineShifted);
-        auto firstLineHi = loadu_ps(pSrcScanlineShifted + DEST_ELTS);
-        auto secondLineLo = loadu_ps(pSrcScanlineShifted + nChunkXSize);
-        auto secondLineHi =
-            loadu_ps(pSrcScanlineShifted + DEST_ELTS + nChunkXSize);
-
-        // Take the absolute value
-        firstLineLo = andnot_ps(minus_zero, firstLineLo);
-        firstLineHi = andnot_ps(minus_zero, firstLineHi);
-        secondLineLo = andnot_ps(minus_zero, secondLineLo);
-        secondLineHi = andnot_ps(minus_zero, secondLineHi);
-
-        auto firstLineEven =
-            shuffle_ps(firstLineLo, firstLineHi, _MM_SHUFFLE(2, 0, 2, 0));
-        auto firstLineOdd =
-            shuffle_ps(firstLineLo, firstLineHi, _MM_SHUFFLE(3, 1, 3, 1));
-        auto secondLineEven =
-            shuffle_ps(secondLineLo, secondLineHi, _MM_SHUFFLE(2, 0, 2, 0));
-        auto secondLineOdd =
-            shuffle_ps(secondLineLo, secondLineHi, _MM_SHUFFLE(3, 1, 3, 1));
-
-        // Compute the maximum of each DEST_ELTS value to RMS-average
-        const auto maxV = max_ps(max_ps(firstLineEven, firstLineOdd),
-                                 max_ps(secondLineEven, secondLineEven));
-
-        // Normalize each value by the maximum of the DEST_ELTS ones.
-        // This step is important to avoid that the square evaluates to infinity
-        // for sufficiently big input.
-        auto invMax = div_ps(one, maxV);
-        // Deal with 0 being the maximum to correct division by zero
-        // note: comparing to -0 leads to identical results as to comparing with
-        // 0
-        invMax = andnot_ps(cmpeq_ps(maxV, minus_zero), invMax);
-
-        firstLineEven = mul_ps(firstLineEven, invMax);
-        firstLineOdd = mul_ps(firstLineOdd, invMax);
-        secondLineEven = mul_ps(secondLineEven, invMax);
-        secondLineOdd = mul_ps(secondLineOdd, invMax);
-
-        // Compute squares
-        firstLineEven = SQUARE_PS(firstLineEven);
-        firstLineOdd = SQUARE_PS(firstLineOdd);
-        secondLineEven = SQUARE_PS(secondLineEven);
-        secondLineOdd = SQUARE_PS(secondLineOdd);
-
-        const auto sumSquares = add_ps(add_ps(firstLineEven, firstLineOdd),
-                                       add_ps(secondLineEven, secondLineOdd));
-
-        auto rms = mul_ps(maxV, sqrt_ps(mul_ps(sumSquares, zeroDot25)));
-
-        // Deal with infinity being the maximum
-        const auto maskIsInf = cmpeq_ps(maxV, infv);
-        rms = blendv_ps(rms, infv, maskIsInf);
-
-        rms = FIXUP_LANES(rms);
-
-        storeu_ps(&pDstScanline[iDstPixel], rms);
-        pSrcScanlineShifted += DEST_ELTS * 2;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
+    return QuadraticMeanFloatSSE2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                  pDstScanline);
 }
 
 /************************************************************************/
-/*                        AverageFloatSSE2()                            */
+/*                          AverageFloatSIMD()                          */
 /************************************************************************/
 
-static int AverageFloatSSE2(int nDstXWidth, int nChunkXSize,
-                            const float *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                            float *CPL_RESTRICT pDstScanline)
+static inline int
+AverageFloatSIMD(int nDstXWidth, int nChunkXSize,
+                 const float *&CPL_RESTRICT pSrcScanlineShifted,
+                 float *CPL_RESTRICT pDstScanline)
 {
-    // Optimized implementation for average on Float32 by
-    // processing by group of output pixels.
-    const float *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto zeroDot25 = _mm_set1_ps(0.25f);
-    constexpr int DEST_ELTS =
-        static_cast<int>(sizeof(zeroDot25) / sizeof(float));
-
-    for (; iDstPixel < nDstXWidth - (DEST_ELTS - 1); iDstPixel += DEST_ELTS)
-    {
-        // Load 2 * DEST_ELTS Float32 from each line
-        const auto firstLineLo =
-            _mm_mul_ps(_mm_loadu_ps(pSrcScanlineShifted), zeroDot25);
-        const auto firstLineHi = _mm_mul_ps(
-            _mm_loadu_ps(pSrcScanlineShifted + DEST_ELTS), zeroDot25);
-        const auto secondLineLo = _mm_mul_ps(
-            _mm_loadu_ps(pSrcScanlineShifted + nChunkXSize), zeroDot25);
-        const auto secondLineHi = _mm_mul_ps(
-            _mm_loadu_ps(pSrcScanlineShifted + DEST_ELTS + nChunkXSize),
-            zeroDot25);
-
-        // Vertical addition
-        const auto tmpLo = _mm_add_ps(firstLineLo, secondLineLo);
-        const auto tmpHi = _mm_add_ps(firstLineHi, secondLineHi);
-
-        // Horizontal addition
-        const auto average = sse2_hadd_ps(tmpLo, tmpHi);
-
-        _mm_storeu_ps(&pDstScanline[iDstPixel], average);
-        pSrcScanlineShifted += DEST_ELTS * 2;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
+    return AverageFloatSSE2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                            pDstScanline);
 }
 
 /************************************************************************/
-/*                        AverageDoubleSSE2()                           */
+/*                         AverageDoubleSIMD()                          */
 /************************************************************************/
 
-static int
-AverageDoubleSSE2(int nDstXWidth, int nChunkXSize,
-                  const double *&CPL_RESTRICT pSrcScanlineShiftedInOut,
+static inline int
+AverageDoubleSIMD(int nDstXWidth, int nChunkXSize,
+                  const double *&CPL_RESTRICT pSrcScanlineShifted,
                   double *CPL_RESTRICT pDstScanline)
 {
-    // Optimized implementation for average on Float64 by
-    // processing by group of output pixels.
-    const double *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto zeroDot25 = _mm_set1_pd(0.25);
-    constexpr int DEST_ELTS =
-        static_cast<int>(sizeof(zeroDot25) / sizeof(double));
-
-    for (; iDstPixel < nDstXWidth - (DEST_ELTS - 1); iDstPixel += DEST_ELTS)
-    {
-        // Load 4 * DEST_ELTS Float64 from each line
-        const auto firstLine0 = _mm_mul_pd(
-            _mm_loadu_pd(pSrcScanlineShifted + 0 * DEST_ELTS), zeroDot25);
-        const auto firstLine1 = _mm_mul_pd(
-            _mm_loadu_pd(pSrcScanlineShifted + 1 * DEST_ELTS), zeroDot25);
-        const auto secondLine0 = _mm_mul_pd(
-            _mm_loadu_pd(pSrcScanlineShifted + 0 * DEST_ELTS + nChunkXSize),
-            zeroDot25);
-        const auto secondLine1 = _mm_mul_pd(
-            _mm_loadu_pd(pSrcScanlineShifted + 1 * DEST_ELTS + nChunkXSize),
-            zeroDot25);
-
-        // Vertical addition
-        const auto tmp0 = _mm_add_pd(firstLine0, secondLine0);
-        const auto tmp1 = _mm_add_pd(firstLine1, secondLine1);
-
-        // Horizontal addition
-        const auto average0 = sse2_hadd_pd(tmp0, tmp1);
-
-        _mm_storeu_pd(&pDstScanline[iDstPixel + 0], average0);
-        pSrcScanlineShifted += DEST_ELTS * 2;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
+    return AverageDoubleSSE2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                             pDstScanline);
 }
 
 #endif
@@ -1395,13 +660,13 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
                     {
                         if constexpr (bQuadraticMean)
                         {
-                            iDstPixel = QuadraticMeanByteSSE2OrAVX2(
+                            iDstPixel = QuadraticMeanByteSIMD(
                                 nDstXWidth, nChunkXSize, pSrcScanlineShifted,
                                 pDstScanline);
                         }
                         else
                         {
-                            iDstPixel = AverageByteSSE2OrAVX2(
+                            iDstPixel = AverageByteSIMD(
                                 nDstXWidth, nChunkXSize, pSrcScanlineShifted,
                                 pDstScanline);
                         }
@@ -1411,13 +676,13 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
                         static_assert(eWrkDataType == GDT_UInt16);
                         if constexpr (bQuadraticMean)
                         {
-                            iDstPixel = QuadraticMeanUInt16SSE2(
+                            iDstPixel = QuadraticMeanUInt16SIMD(
                                 nDstXWidth, nChunkXSize, pSrcScanlineShifted,
                                 pDstScanline);
                         }
                         else
                         {
-                            iDstPixel = AverageUInt16SSE2(
+                            iDstPixel = AverageUInt16SIMD(
                                 nDstXWidth, nChunkXSize, pSrcScanlineShifted,
                                 pDstScanline);
                         }
@@ -1469,13 +734,13 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
                         static_assert(std::is_same_v<T, float>);
                         if constexpr (bQuadraticMean)
                         {
-                            iDstPixel = QuadraticMeanFloatSSE2(
+                            iDstPixel = QuadraticMeanFloatSIMD(
                                 nDstXWidth, nChunkXSize, pSrcScanlineShifted,
                                 pDstScanline);
                         }
                         else
                         {
-                            iDstPixel = AverageFloatSSE2(
+                            iDstPixel = AverageFloatSIMD(
                                 nDstXWidth, nChunkXSize, pSrcScanlineShifted,
                                 pDstScanline);
                         }
@@ -1484,7 +749,7 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
                     {
                         if constexpr (!bQuadraticMean)
                         {
-                            iDstPixel = AverageDoubleSSE2(
+                            iDstPixel = AverageDoubleSIMD(
                                 nDstXWidth, nChunkXSize, pSrcScanlineShifted,
                                 pDstScanline);
                         }
@@ -5533,6 +4798,11 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  * Starting with GDAL 3.2, the GDAL_NUM_THREADS configuration option can be set
  * to "ALL_CPUS" or a integer value to specify the number of threads to use for
  * overview computation.
+ * Starting with GDAL 3.12, when several threads are used, the computation of
+ * an overview level starts as soon as the rows it needs from the previous
+ * level have been written, instead of waiting for the previous level to be
+ * completed. This can be disabled by setting the GDAL_OVR_PIPELINE
+ * configuration option to NO.
  *
  * @param nBands the number of bands, size of papoSrcBands and size of
  *               first dimension of papapoOverviewBands
@@ -5728,8 +4998,559 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         return 100 * 1024 * 1024;
     }();
 
-    // Second pass to do the real job.
+    // Structure describing a resampling job
+    struct OvrJob
+    {
+        // Buffers to free when job is finished
+        std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
+        std::unique_ptr<PointerHolder> oSrcBufferHolder{};
+        std::unique_ptr<PointerHolder> oDstBufferHolder{};
+
+        GDALRasterBand *poDstBand = nullptr;
+        int iOverview = 0;
+
+        // Input parameters of pfnResampleFn
+        GDALResampleFunction pfnResampleFn = nullptr;
+        GDALOverviewResampleArgs args{};
+        const void *pChunk = nullptr;
+
+        // Output values of resampling function
+        CPLErr eErr = CE_Failure;
+        void *pDstBuffer = nullptr;
+        GDALDataType eDstBufferDataType = GDT_Unknown;
+
+        void NotifyFinished()
+        {
+            std::lock_guard guard(mutex);
+            bFinished = true;
+            cv.notify_one();
+        }
+
+        bool IsFinished()
+        {
+            std::lock_guard guard(mutex);
+            return bFinished;
+        }
+
+        void WaitFinished()
+        {
+            std::unique_lock oGuard(mutex);
+            while (!bFinished)
+            {
+                cv.wait(oGuard);
+            }
+        }
+
+      private:
+        // Synchronization
+        bool bFinished = false;
+        std::mutex mutex{};
+        std::condition_variable cv{};
+    };
+
+    // Thread function to resample
+    const auto JobResampleFunc = [](void *pData)
+    {
+        OvrJob *poJob = static_cast<OvrJob *>(pData);
+
+        poJob->eErr = poJob->pfnResampleFn(poJob->args, poJob->pChunk,
+                                           &(poJob->pDstBuffer),
+                                           &(poJob->eDstBufferDataType));
+
+        poJob->oDstBufferHolder.reset(new PointerHolder(poJob->pDstBuffer));
+
+        poJob->NotifyFinished();
+    };
+
+    // Function to write resample data to target band
+    const auto WriteJobData = [](const OvrJob *poJob)
+    {
+        return poJob->poDstBand->RasterIO(
+            GF_Write, poJob->args.nDstXOff, poJob->args.nDstYOff,
+            poJob->args.nDstXOff2 - poJob->args.nDstXOff,
+            poJob->args.nDstYOff2 - poJob->args.nDstYOff, poJob->pDstBuffer,
+            poJob->args.nDstXOff2 - poJob->args.nDstXOff,
+            poJob->args.nDstYOff2 - poJob->args.nDstYOff,
+            poJob->eDstBufferDataType, 0, 0, nullptr);
+    };
+
+    // State of an overview level that is computed directly from its source,
+    // by chunks of destination rows.
+    struct OvrLevel
+    {
+        int iOverview = 0;
+        int iSrcOverview = -1;  // -1 means the source bands.
+        int nSrcWidth = 0;
+        int nSrcHeight = 0;
+        int nDstTotalWidth = 0;
+        int nDstTotalHeight = 0;
+        int nDstXOffStart = 0;
+        int nDstXOffEnd = 0;
+        int nDstYOffStart = 0;
+        int nDstYOffEnd = 0;
+        double dfXRatioDstToSrc = 0;
+        double dfYRatioDstToSrc = 0;
+        int nOvrFactor = 1;
+        int nDstChunkXSize = 0;
+        int nDstChunkYSize = 0;
+        int nFullResXChunk = 0;
+        int nFullResYChunk = 0;
+        int nFullResXChunkQueried = 0;
+        int nFullResYChunkQueried = 0;
+
+        // First destination row of the next chunk to process.
+        int nDstYOff = 0;
+        // Number of submitted jobs whose result has not been written yet.
+        int nPendingJobs = 0;
+        // Index of the first block row of the overview bands that has not
+        // been flushed yet.
+        int nYBlockNotFlushed = 0;
+
+        std::vector<std::unique_ptr<void, VSIFreeReleaser>> apaChunk{};
+        std::vector<std::unique_ptr<GByte, VSIFreeReleaser>>
+            apabyChunkNoDataMask{};
+
+        bool IsDone() const
+        {
+            return nDstYOff >= nDstYOffEnd;
+        }
+    };
+
+    // When using several threads, the generation of an overview level that
+    // is computed from the previous one can start as soon as the rows it
+    // needs from the previous level have been written, instead of waiting
+    // for the whole previous level to be completed. This keeps the thread
+    // pool busy across levels, and avoids re-reading the previous level
+    // from storage once it has been evicted from the block cache.
+    const bool bPipelineLevels =
+        poJobQueue != nullptr &&
+        CPLTestBool(CPLGetConfigOption("GDAL_OVR_PIPELINE", "YES"));
+
+    // Levels whose generation is in progress.
+    std::vector<std::unique_ptr<OvrLevel>> apoPendingLevels;
+
+    // Queue of jobs, in submission order, possibly for several levels.
+    std::list<std::unique_ptr<OvrJob>> jobList;
+
+    const auto GetPendingLevel = [&apoPendingLevels](int iOverview)
+    {
+        for (auto &poLevel : apoPendingLevels)
+        {
+            if (poLevel->iOverview == iOverview)
+                return poLevel.get();
+        }
+        return static_cast<OvrLevel *>(nullptr);
+    };
+
+    // Write the result of the oldest job, and remove it from the queue
+    const auto FinalizeOldestJob = [&jobList, &GetPendingLevel, WriteJobData]()
+    {
+        auto poOldestJob = jobList.front().get();
+        CPLErr l_eErr = poOldestJob->eErr;
+        if (l_eErr == CE_None)
+        {
+            l_eErr = WriteJobData(poOldestJob);
+        }
+        auto poLevel = GetPendingLevel(poOldestJob->iOverview);
+        CPLAssert(poLevel);
+        if (poLevel)
+            --poLevel->nPendingJobs;
+
+        jobList.pop_front();
+        return l_eErr;
+    };
+
+    // Wait for completion of oldest job and serialize it
+    const auto WaitAndFinalizeOldestJob = [&jobList, &FinalizeOldestJob]()
+    {
+        jobList.front()->WaitFinished();
+        return FinalizeOldestJob();
+    };
+
+    // Return the source rows needed to compute the destination row chunk
+    // starting at nDstYOff.
+    const auto GetChunkRows = [nKernelRadius](const OvrLevel &oLevel,
+                                              int nDstYOff, int &nDstYCount,
+                                              int &nChunkYOffQueried,
+                                              int &nChunkYSizeQueried)
+    {
+        nDstYCount =
+            std::min(oLevel.nDstChunkYSize, oLevel.nDstYOffEnd - nDstYOff);
+
+        const int nChunkYOff =
+            static_cast<int>(nDstYOff * oLevel.dfYRatioDstToSrc);
+        int nChunkYOff2 = static_cast<int>(
+            ceil((nDstYOff + nDstYCount) * oLevel.dfYRatioDstToSrc));
+        if (nChunkYOff2 > oLevel.nSrcHeight ||
+            nDstYOff + nDstYCount == oLevel.nDstTotalHeight)
+            nChunkYOff2 = oLevel.nSrcHeight;
+        const int nYCount = nChunkYOff2 - nChunkYOff;
+        CPLAssert(nYCount <= oLevel.nFullResYChunk);
+
+        nChunkYOffQueried = nChunkYOff - nKernelRadius * oLevel.nOvrFactor;
+        nChunkYSizeQueried =
+            nYCount + RADIUS_TO_DIAMETER * nKernelRadius * oLevel.nOvrFactor;
+        if (nChunkYOffQueried < 0)
+        {
+            nChunkYSizeQueried += nChunkYOffQueried;
+            nChunkYOffQueried = 0;
+        }
+        if (nChunkYSizeQueried + nChunkYOffQueried > oLevel.nSrcHeight)
+            nChunkYSizeQueried = oLevel.nSrcHeight - nChunkYOffQueried;
+        CPLAssert(nChunkYSizeQueried <= oLevel.nFullResYChunkQueried);
+    };
+
+    // Flush the blocks of a level whose rows have all been written, and
+    // return the number of rows that can be read back from it. Flushing
+    // makes sure that the next level reads the same values as if the
+    // levels had been generated one after the other, even with a lossy
+    // compression method.
+    const auto FlushWrittenRows =
+        [nBands, papapoOverviewBands, &jobList](OvrLevel &oLevel, int &nRows)
+    {
+        int nWrittenRowsEnd = oLevel.nDstYOff;
+        if (oLevel.nPendingJobs > 0)
+        {
+            // Jobs of a given level are written in submission order, so the
+            // oldest pending one is the first row not yet written.
+            for (const auto &poJob : jobList)
+            {
+                if (poJob->iOverview == oLevel.iOverview)
+                {
+                    nWrittenRowsEnd = poJob->args.nDstYOff;
+                    break;
+                }
+            }
+        }
+        const bool bAllWritten = oLevel.nPendingJobs == 0 && oLevel.IsDone();
+
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        papapoOverviewBands[0][oLevel.iOverview]->GetBlockSize(&nBlockXSize,
+                                                               &nBlockYSize);
+        const int nYBlockEnd =
+            bAllWritten ? DIV_ROUND_UP(oLevel.nDstYOffEnd, nBlockYSize)
+                        : nWrittenRowsEnd / nBlockYSize;
+        const int nXBlockStart = oLevel.nDstXOffStart / nBlockXSize;
+        const int nXBlockEnd = DIV_ROUND_UP(oLevel.nDstXOffEnd, nBlockXSize);
+        for (; oLevel.nYBlockNotFlushed < nYBlockEnd;
+             ++oLevel.nYBlockNotFlushed)
+        {
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                auto poOvrBand = papapoOverviewBands[iBand][oLevel.iOverview];
+                for (int iXBlock = nXBlockStart; iXBlock < nXBlockEnd;
+                     ++iXBlock)
+                {
+                    // FlushBlock() fails silently if the band has no block
+                    // cache.
+                    const auto nErrorCounter = CPLGetErrorCounter();
+                    if (poOvrBand->FlushBlock(iXBlock,
+                                              oLevel.nYBlockNotFlushed) !=
+                            CE_None &&
+                        CPLGetErrorCounter() != nErrorCounter)
+                    {
+                        return CE_Failure;
+                    }
+                }
+            }
+        }
+
+        nRows = bAllWritten ? oLevel.nDstTotalHeight
+                            : oLevel.nYBlockNotFlushed * nBlockYSize;
+        return CE_None;
+    };
+
+    // Whether the source rows of the next chunk of a level are available
+    const auto IsSourceReady =
+        [&GetPendingLevel, &GetChunkRows, &FlushWrittenRows](
+            const OvrLevel &oLevel, CPLErr &eErrOut)
+    {
+        auto poSrcLevel = oLevel.iSrcOverview >= 0
+                              ? GetPendingLevel(oLevel.iSrcOverview)
+                              : nullptr;
+        if (!poSrcLevel)
+            return true;
+        int nDstYCount = 0;
+        int nChunkYOffQueried = 0;
+        int nChunkYSizeQueried = 0;
+        GetChunkRows(oLevel, oLevel.nDstYOff, nDstYCount, nChunkYOffQueried,
+                     nChunkYSizeQueried);
+        int nReadableRows = 0;
+        eErrOut = FlushWrittenRows(*poSrcLevel, nReadableRows);
+        return eErrOut == CE_None &&
+               nChunkYOffQueried + nChunkYSizeQueried <= nReadableRows;
+    };
+
     double dfCurPixelCount = 0;
+
+    // Read the source data of the next row chunk of a level, and submit
+    // the resampling jobs for it.
+    const auto ProcessNextRowChunk = [&](OvrLevel &oLevel)
+    {
+        CPLErr l_eErr = CE_None;
+        const int nDstYOff = oLevel.nDstYOff;
+        int nDstYCount = 0;
+        int nChunkYOffQueried = 0;
+        int nChunkYSizeQueried = 0;
+        GetChunkRows(oLevel, nDstYOff, nDstYCount, nChunkYOffQueried,
+                     nChunkYSizeQueried);
+        oLevel.nDstYOff += nDstYCount;
+
+        if (!pfnProgress(std::min(1.0, dfCurPixelCount / dfTotalPixelCount),
+                         nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            l_eErr = CE_Failure;
+        }
+
+        // Iterate on destination overview, block by block.
+        for (int nDstXOff = oLevel.nDstXOffStart;
+             nDstXOff < oLevel.nDstXOffEnd && l_eErr == CE_None;
+             nDstXOff += oLevel.nDstChunkXSize)
+        {
+            int nDstXCount = 0;
+            if (nDstXOff + oLevel.nDstChunkXSize <= oLevel.nDstXOffEnd)
+                nDstXCount = oLevel.nDstChunkXSize;
+            else
+                nDstXCount = oLevel.nDstXOffEnd - nDstXOff;
+
+            dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
+
+            int nChunkXOff =
+                static_cast<int>(nDstXOff * oLevel.dfXRatioDstToSrc);
+            int nChunkXOff2 = static_cast<int>(
+                ceil((nDstXOff + nDstXCount) * oLevel.dfXRatioDstToSrc));
+            if (nChunkXOff2 > oLevel.nSrcWidth ||
+                nDstXOff + nDstXCount == oLevel.nDstTotalWidth)
+                nChunkXOff2 = oLevel.nSrcWidth;
+            const int nXCount = nChunkXOff2 - nChunkXOff;
+            CPLAssert(nXCount <= oLevel.nFullResXChunk);
+
+            int nChunkXOffQueried =
+                nChunkXOff - nKernelRadius * oLevel.nOvrFactor;
+            int nChunkXSizeQueried =
+                nXCount +
+                RADIUS_TO_DIAMETER * nKernelRadius * oLevel.nOvrFactor;
+            if (nChunkXOffQueried < 0)
+            {
+                nChunkXSizeQueried += nChunkXOffQueried;
+                nChunkXOffQueried = 0;
+            }
+            if (nChunkXSizeQueried + nChunkXOffQueried > oLevel.nSrcWidth)
+                nChunkXSizeQueried = oLevel.nSrcWidth - nChunkXOffQueried;
+            CPLAssert(nChunkXSizeQueried <= oLevel.nFullResXChunkQueried);
+#if DEBUG_VERBOSE
+            CPLDebug("GDAL",
+                     "Reading (%dx%d -> %dx%d) for output (%dx%d -> %dx%d)",
+                     nChunkXOffQueried, nChunkYOffQueried, nChunkXSizeQueried,
+                     nChunkYSizeQueried, nDstXOff, nDstYOff, nDstXCount,
+                     nDstYCount);
+#endif
+
+            // Avoid accumulating too many tasks and exhaust RAM
+
+            // Try to complete already finished jobs
+            while (l_eErr == CE_None && !jobList.empty() &&
+                   jobList.front()->IsFinished())
+            {
+                l_eErr = FinalizeOldestJob();
+            }
+
+            // And in case we have saturated the number of threads,
+            // wait for completion of tasks to go below the threshold.
+            while (l_eErr == CE_None &&
+                   jobList.size() >= static_cast<size_t>(nThreads))
+            {
+                l_eErr = WaitAndFinalizeOldestJob();
+            }
+
+            // Read the source buffers for all the bands.
+            for (int iBand = 0; iBand < nBands && l_eErr == CE_None; ++iBand)
+            {
+                // (Re)allocate buffers if needed
+                auto &paChunk = oLevel.apaChunk[iBand];
+                auto &pabyChunkNoDataMask = oLevel.apabyChunkNoDataMask[iBand];
+                if (paChunk == nullptr)
+                {
+                    paChunk.reset(VSI_MALLOC3_VERBOSE(
+                        oLevel.nFullResXChunkQueried,
+                        oLevel.nFullResYChunkQueried, nWrkDataTypeSize));
+                    if (paChunk == nullptr)
+                    {
+                        l_eErr = CE_Failure;
+                    }
+                }
+                if (bUseNoDataMask && pabyChunkNoDataMask == nullptr)
+                {
+                    pabyChunkNoDataMask.reset(
+                        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                            oLevel.nFullResXChunkQueried,
+                            oLevel.nFullResYChunkQueried)));
+                    if (pabyChunkNoDataMask == nullptr)
+                    {
+                        l_eErr = CE_Failure;
+                    }
+                }
+
+                if (l_eErr == CE_None)
+                {
+                    GDALRasterBand *poSrcBand = nullptr;
+                    if (oLevel.iSrcOverview == -1)
+                        poSrcBand = papoSrcBands[iBand];
+                    else
+                        poSrcBand =
+                            papapoOverviewBands[iBand][oLevel.iSrcOverview];
+                    l_eErr = poSrcBand->RasterIO(
+                        GF_Read, nChunkXOffQueried, nChunkYOffQueried,
+                        nChunkXSizeQueried, nChunkYSizeQueried, paChunk.get(),
+                        nChunkXSizeQueried, nChunkYSizeQueried, eWrkDataType,
+                        0, 0, nullptr);
+
+                    if (bUseNoDataMask && l_eErr == CE_None)
+                    {
+                        auto poMaskBand = poSrcBand->IsMaskBand()
+                                              ? poSrcBand
+                                              : poSrcBand->GetMaskBand();
+                        l_eErr = poMaskBand->RasterIO(
+                            GF_Read, nChunkXOffQueried, nChunkYOffQueried,
+                            nChunkXSizeQueried, nChunkYSizeQueried,
+                            pabyChunkNoDataMask.get(), nChunkXSizeQueried,
+                            nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
+                    }
+                }
+            }
+
+            // Compute the resulting overview block.
+            for (int iBand = 0; iBand < nBands && l_eErr == CE_None; ++iBand)
+            {
+                auto poJob = std::make_unique<OvrJob>();
+                poJob->pfnResampleFn = pfnResampleFn;
+                poJob->iOverview = oLevel.iOverview;
+                poJob->poDstBand = papapoOverviewBands[iBand][oLevel.iOverview];
+                poJob->args.eOvrDataType =
+                    poJob->poDstBand->GetRasterDataType();
+                poJob->args.nOvrXSize = poJob->poDstBand->GetXSize();
+                poJob->args.nOvrYSize = poJob->poDstBand->GetYSize();
+                const char *pszNBITS = poJob->poDstBand->GetMetadataItem(
+                    "NBITS", "IMAGE_STRUCTURE");
+                poJob->args.nOvrNBITS = pszNBITS ? atoi(pszNBITS) : 0;
+                poJob->args.dfXRatioDstToSrc = oLevel.dfXRatioDstToSrc;
+                poJob->args.dfYRatioDstToSrc = oLevel.dfYRatioDstToSrc;
+                poJob->args.eWrkDataType = eWrkDataType;
+                poJob->pChunk = oLevel.apaChunk[iBand].get();
+                poJob->args.pabyChunkNodataMask =
+                    oLevel.apabyChunkNoDataMask[iBand].get();
+                poJob->args.nChunkXOff = nChunkXOffQueried;
+                poJob->args.nChunkXSize = nChunkXSizeQueried;
+                poJob->args.nChunkYOff = nChunkYOffQueried;
+                poJob->args.nChunkYSize = nChunkYSizeQueried;
+                poJob->args.nDstXOff = nDstXOff;
+                poJob->args.nDstXOff2 = nDstXOff + nDstXCount;
+                poJob->args.nDstYOff = nDstYOff;
+                poJob->args.nDstYOff2 = nDstYOff + nDstYCount;
+                poJob->args.pszResampling = pszResampling;
+                poJob->args.bHasNoData = abHasNoData[iBand];
+                poJob->args.dfNoDataValue = adfNoDataValue[iBand];
+                poJob->args.eSrcDataType = eDataType;
+                poJob->args.bPropagateNoData = bPropagateNoData;
+
+                if (poJobQueue)
+                {
+                    poJob->oSrcMaskBufferHolder.reset(new PointerHolder(
+                        oLevel.apabyChunkNoDataMask[iBand].release()));
+
+                    poJob->oSrcBufferHolder.reset(
+                        new PointerHolder(oLevel.apaChunk[iBand].release()));
+
+                    poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
+                    ++oLevel.nPendingJobs;
+                    jobList.emplace_back(std::move(poJob));
+                }
+                else
+                {
+                    JobResampleFunc(poJob.get());
+                    l_eErr = poJob->eErr;
+                    if (l_eErr == CE_None)
+                    {
+                        l_eErr = WriteJobData(poJob.get());
+                    }
+                }
+            }
+        }
+
+        return l_eErr;
+    };
+
+    // Generate the pending levels. When several of them are pending, always
+    // advance the smallest one whose source rows are available, so that
+    // the amount of data in flight stays bounded.
+    const auto GeneratePendingLevels = [&]()
+    {
+        CPLErr l_eErr = CE_None;
+        while (l_eErr == CE_None)
+        {
+            OvrLevel *poLevelToProcess = nullptr;
+            bool bAllDone = true;
+            for (auto iter = apoPendingLevels.rbegin();
+                 iter != apoPendingLevels.rend() && l_eErr == CE_None; ++iter)
+            {
+                auto &poLevel = *iter;
+                if (poLevel->IsDone())
+                    continue;
+                bAllDone = false;
+                if (IsSourceReady(*poLevel, l_eErr))
+                {
+                    poLevelToProcess = poLevel.get();
+                    break;
+                }
+            }
+            if (bAllDone || l_eErr != CE_None)
+                break;
+
+            if (poLevelToProcess)
+            {
+                l_eErr = ProcessNextRowChunk(*poLevelToProcess);
+            }
+            else if (!jobList.empty())
+            {
+                l_eErr = WaitAndFinalizeOldestJob();
+            }
+            else
+            {
+                // Should not happen: the first level only depends on levels
+                // already generated.
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "GDALRegenerateOverviewsMultiBand(): cannot "
+                         "schedule overview generation");
+                l_eErr = CE_Failure;
+            }
+        }
+
+        // Wait for all pending jobs to complete
+        while (!jobList.empty())
+        {
+            const auto l_eErr2 = WaitAndFinalizeOldestJob();
+            if (l_eErr2 != CE_None && l_eErr == CE_None)
+                l_eErr = l_eErr2;
+        }
+
+        // Flush the data to overviews.
+        for (const auto &poLevel : apoPendingLevels)
+        {
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                if (papapoOverviewBands[iBand][poLevel->iOverview]->FlushCache(
+                        false) != CE_None)
+                    l_eErr = CE_Failure;
+            }
+        }
+        apoPendingLevels.clear();
+
+        return l_eErr;
+    };
+
+    // Second pass to do the real job.
     CPLErr eErr = CE_None;
     for (int iOverview = 0; iOverview < nOverviews && eErr == CE_None;
          ++iOverview)
@@ -5873,6 +5694,12 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         if (bOverflowFullResXChunkYChunkQueried ||
             nMemRequirement > nChunkMaxSizeForTempFile)
         {
+            // The temporary dataset reads the previous overview levels
+            // by itself, so they must have been completed first.
+            eErr = GeneratePendingLevels();
+            if (eErr != CE_None)
+                return eErr;
+
             const auto nDTSize =
                 std::max(1, GDALGetDataTypeSizeBytes(eDataType));
             const bool bTmpDSMemRequirementOverflow =
@@ -6226,338 +6053,40 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             continue;
         }
 
-        // Structure describing a resampling job
-        struct OvrJob
-        {
-            // Buffers to free when job is finished
-            std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
-            std::unique_ptr<PointerHolder> oSrcBufferHolder{};
-            std::unique_ptr<PointerHolder> oDstBufferHolder{};
-
-            GDALRasterBand *poDstBand = nullptr;
-
-            // Input parameters of pfnResampleFn
-            GDALResampleFunction pfnResampleFn = nullptr;
-            GDALOverviewResampleArgs args{};
-            const void *pChunk = nullptr;
-
-            // Output values of resampling function
-            CPLErr eErr = CE_Failure;
-            void *pDstBuffer = nullptr;
-            GDALDataType eDstBufferDataType = GDT_Unknown;
-
-            void NotifyFinished()
-            {
-                std::lock_guard guard(mutex);
-                bFinished = true;
-                cv.notify_one();
-            }
-
-            bool IsFinished()
-            {
-                std::lock_guard guard(mutex);
-                return bFinished;
-            }
-
-            void WaitFinished()
-            {
-                std::unique_lock oGuard(mutex);
-                while (!bFinished)
-                {
-                    cv.wait(oGuard);
-                }
-            }
-
-          private:
-            // Synchronization
-            bool bFinished = false;
-            std::mutex mutex{};
-            std::condition_variable cv{};
-        };
-
-        // Thread function to resample
-        const auto JobResampleFunc = [](void *pData)
-        {
-            OvrJob *poJob = static_cast<OvrJob *>(pData);
-
-            poJob->eErr = poJob->pfnResampleFn(poJob->args, poJob->pChunk,
-                                               &(poJob->pDstBuffer),
-                                               &(poJob->eDstBufferDataType));
-
-            poJob->oDstBufferHolder.reset(new PointerHolder(poJob->pDstBuffer));
-
-            poJob->NotifyFinished();
-        };
-
-        // Function to write resample data to target band
-        const auto WriteJobData = [](const OvrJob *poJob)
-        {
-            return poJob->poDstBand->RasterIO(
-                GF_Write, poJob->args.nDstXOff, poJob->args.nDstYOff,
-                poJob->args.nDstXOff2 - poJob->args.nDstXOff,
-                poJob->args.nDstYOff2 - poJob->args.nDstYOff, poJob->pDstBuffer,
-                poJob->args.nDstXOff2 - poJob->args.nDstXOff,
-                poJob->args.nDstYOff2 - poJob->args.nDstYOff,
-                poJob->eDstBufferDataType, 0, 0, nullptr);
-        };
-
-        // Wait for completion of oldest job and serialize it
-        const auto WaitAndFinalizeOldestJob =
-            [WriteJobData](std::list<std::unique_ptr<OvrJob>> &jobList)
-        {
-            auto poOldestJob = jobList.front().get();
-            poOldestJob->WaitFinished();
-            CPLErr l_eErr = poOldestJob->eErr;
-            if (l_eErr == CE_None)
-            {
-                l_eErr = WriteJobData(poOldestJob);
-            }
-
-            jobList.pop_front();
-            return l_eErr;
-        };
-
-        // Queue of jobs
-        std::list<std::unique_ptr<OvrJob>> jobList;
-
-        std::vector<std::unique_ptr<void, VSIFreeReleaser>> apaChunk(nBands);
-        std::vector<std::unique_ptr<GByte, VSIFreeReleaser>>
-            apabyChunkNoDataMask(nBands);
-
-        // Iterate on destination overview, block by block.
-        for (int nDstYOff = nDstYOffStart;
-             nDstYOff < nDstYOffEnd && eErr == CE_None;
-             nDstYOff += nDstChunkYSize)
-        {
-            int nDstYCount;
-            if (nDstYOff + nDstChunkYSize <= nDstYOffEnd)
-                nDstYCount = nDstChunkYSize;
-            else
-                nDstYCount = nDstYOffEnd - nDstYOff;
-
-            int nChunkYOff = static_cast<int>(nDstYOff * dfYRatioDstToSrc);
-            int nChunkYOff2 = static_cast<int>(
-                ceil((nDstYOff + nDstYCount) * dfYRatioDstToSrc));
-            if (nChunkYOff2 > nSrcHeight ||
-                nDstYOff + nDstYCount == nDstTotalHeight)
-                nChunkYOff2 = nSrcHeight;
-            int nYCount = nChunkYOff2 - nChunkYOff;
-            CPLAssert(nYCount <= nFullResYChunk);
-
-            int nChunkYOffQueried = nChunkYOff - nKernelRadius * nOvrFactor;
-            int nChunkYSizeQueried =
-                nYCount + RADIUS_TO_DIAMETER * nKernelRadius * nOvrFactor;
-            if (nChunkYOffQueried < 0)
-            {
-                nChunkYSizeQueried += nChunkYOffQueried;
-                nChunkYOffQueried = 0;
-            }
-            if (nChunkYSizeQueried + nChunkYOffQueried > nSrcHeight)
-                nChunkYSizeQueried = nSrcHeight - nChunkYOffQueried;
-            CPLAssert(nChunkYSizeQueried <= nFullResYChunkQueried);
-
-            if (!pfnProgress(std::min(1.0, dfCurPixelCount / dfTotalPixelCount),
-                             nullptr, pProgressData))
-            {
-                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                eErr = CE_Failure;
-            }
-
-            // Iterate on destination overview, block by block.
-            for (int nDstXOff = nDstXOffStart;
-                 nDstXOff < nDstXOffEnd && eErr == CE_None;
-                 nDstXOff += nDstChunkXSize)
-            {
-                int nDstXCount = 0;
-                if (nDstXOff + nDstChunkXSize <= nDstXOffEnd)
-                    nDstXCount = nDstChunkXSize;
-                else
-                    nDstXCount = nDstXOffEnd - nDstXOff;
-
-                dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
-
-                int nChunkXOff = static_cast<int>(nDstXOff * dfXRatioDstToSrc);
-                int nChunkXOff2 = static_cast<int>(
-                    ceil((nDstXOff + nDstXCount) * dfXRatioDstToSrc));
-                if (nChunkXOff2 > nSrcWidth ||
-                    nDstXOff + nDstXCount == nDstTotalWidth)
-                    nChunkXOff2 = nSrcWidth;
-                const int nXCount = nChunkXOff2 - nChunkXOff;
-                CPLAssert(nXCount <= nFullResXChunk);
-
-                int nChunkXOffQueried = nChunkXOff - nKernelRadius * nOvrFactor;
-                int nChunkXSizeQueried =
-                    nXCount + RADIUS_TO_DIAMETER * nKernelRadius * nOvrFactor;
-                if (nChunkXOffQueried < 0)
-                {
-                    nChunkXSizeQueried += nChunkXOffQueried;
-                    nChunkXOffQueried = 0;
-                }
-                if (nChunkXSizeQueried + nChunkXOffQueried > nSrcWidth)
-                    nChunkXSizeQueried = nSrcWidth - nChunkXOffQueried;
-                CPLAssert(nChunkXSizeQueried <= nFullResXChunkQueried);
-#if DEBUG_VERBOSE
-                CPLDebug("GDAL",
-                         "Reading (%dx%d -> %dx%d) for output (%dx%d -> %dx%d)",
-                         nChunkXOffQueried, nChunkYOffQueried,
-                         nChunkXSizeQueried, nChunkYSizeQueried, nDstXOff,
-                         nDstYOff, nDstXCount, nDstYCount);
-#endif
-
-                // Avoid accumulating too many tasks and exhaust RAM
-
-                // Try to complete already finished jobs
-                while (eErr == CE_None && !jobList.empty())
-                {
-                    auto poOldestJob = jobList.front().get();
-                    if (!poOldestJob->IsFinished())
-                        break;
-                    eErr = poOldestJob->eErr;
-                    if (eErr == CE_None)
-                    {
-                        eErr = WriteJobData(poOldestJob);
-                    }
-
-                    jobList.pop_front();
-                }
-
-                // And in case we have saturated the number of threads,
-                // wait for completion of tasks to go below the threshold.
-                while (eErr == CE_None &&
-                       jobList.size() >= static_cast<size_t>(nThreads))
-                {
-                    eErr = WaitAndFinalizeOldestJob(jobList);
-                }
-
-                // Read the source buffers for all the bands.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
-                {
-                    // (Re)allocate buffers if needed
-                    if (apaChunk[iBand] == nullptr)
-                    {
-                        apaChunk[iBand].reset(VSI_MALLOC3_VERBOSE(
-                            nFullResXChunkQueried, nFullResYChunkQueried,
-                            nWrkDataTypeSize));
-                        if (apaChunk[iBand] == nullptr)
-                        {
-                            eErr = CE_Failure;
-                        }
-                    }
-                    if (bUseNoDataMask &&
-                        apabyChunkNoDataMask[iBand] == nullptr)
-                    {
-                        apabyChunkNoDataMask[iBand].reset(
-                            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                                nFullResXChunkQueried, nFullResYChunkQueried)));
-                        if (apabyChunkNoDataMask[iBand] == nullptr)
-                        {
-                            eErr = CE_Failure;
-                        }
-                    }
-
-                    if (eErr == CE_None)
-                    {
-                        GDALRasterBand *poSrcBand = nullptr;
-                        if (iSrcOverview == -1)
-                            poSrcBand = papoSrcBands[iBand];
-                        else
-                            poSrcBand =
-                                papapoOverviewBands[iBand][iSrcOverview];
-                        eErr = poSrcBand->RasterIO(
-                            GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                            nChunkXSizeQueried, nChunkYSizeQueried,
-                            apaChunk[iBand].get(), nChunkXSizeQueried,
-                            nChunkYSizeQueried, eWrkDataType, 0, 0, nullptr);
-
-                        if (bUseNoDataMask && eErr == CE_None)
-                        {
-                            auto poMaskBand = poSrcBand->IsMaskBand()
-                                                  ? poSrcBand
-                                                  : poSrcBand->GetMaskBand();
-                            eErr = poMaskBand->RasterIO(
-                                GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                                nChunkXSizeQueried, nChunkYSizeQueried,
-                                apabyChunkNoDataMask[iBand].get(),
-                                nChunkXSizeQueried, nChunkYSizeQueried,
-                                GDT_Byte, 0, 0, nullptr);
-                        }
-                    }
-                }
-
-                // Compute the resulting overview block.
-                for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
-                {
-                    auto poJob = std::make_unique<OvrJob>();
-                    poJob->pfnResampleFn = pfnResampleFn;
-                    poJob->poDstBand = papapoOverviewBands[iBand][iOverview];
-                    poJob->args.eOvrDataType =
-                        poJob->poDstBand->GetRasterDataType();
-                    poJob->args.nOvrXSize = poJob->poDstBand->GetXSize();
-                    poJob->args.nOvrYSize = poJob->poDstBand->GetYSize();
-                    const char *pszNBITS = poJob->poDstBand->GetMetadataItem(
-                        "NBITS", "IMAGE_STRUCTURE");
-                    poJob->args.nOvrNBITS = pszNBITS ? atoi(pszNBITS) : 0;
-                    poJob->args.dfXRatioDstToSrc = dfXRatioDstToSrc;
-                    poJob->args.dfYRatioDstToSrc = dfYRatioDstToSrc;
-                    poJob->args.eWrkDataType = eWrkDataType;
-                    poJob->pChunk = apaChunk[iBand].get();
-                    poJob->args.pabyChunkNodataMask =
-                        apabyChunkNoDataMask[iBand].get();
-                    poJob->args.nChunkXOff = nChunkXOffQueried;
-                    poJob->args.nChunkXSize = nChunkXSizeQueried;
-                    poJob->args.nChunkYOff = nChunkYOffQueried;
-                    poJob->args.nChunkYSize = nChunkYSizeQueried;
-                    poJob->args.nDstXOff = nDstXOff;
-                    poJob->args.nDstXOff2 = nDstXOff + nDstXCount;
-                    poJob->args.nDstYOff = nDstYOff;
-                    poJob->args.nDstYOff2 = nDstYOff + nDstYCount;
-                    poJob->args.pszResampling = pszResampling;
-                    poJob->args.bHasNoData = abHasNoData[iBand];
-                    poJob->args.dfNoDataValue = adfNoDataValue[iBand];
-                    poJob->args.eSrcDataType = eDataType;
-                    poJob->args.bPropagateNoData = bPropagateNoData;
-
-                    if (poJobQueue)
-                    {
-                        poJob->oSrcMaskBufferHolder.reset(new PointerHolder(
-                            apabyChunkNoDataMask[iBand].release()));
-
-                        poJob->oSrcBufferHolder.reset(
-                            new PointerHolder(apaChunk[iBand].release()));
-
-                        poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
-                        jobList.emplace_back(std::move(poJob));
-                    }
-                    else
-                    {
-                        JobResampleFunc(poJob.get());
-                        eErr = poJob->eErr;
-                        if (eErr == CE_None)
-                        {
-                            eErr = WriteJobData(poJob.get());
-                        }
-                    }
-                }
-            }
-        }
-
-        // Wait for all pending jobs to complete
-        while (!jobList.empty())
-        {
-            const auto l_eErr = WaitAndFinalizeOldestJob(jobList);
-            if (l_eErr != CE_None && eErr == CE_None)
-                eErr = l_eErr;
-        }
-
-        // Flush the data to overviews.
-        for (int iBand = 0; iBand < nBands; ++iBand)
-        {
-            if (papapoOverviewBands[iBand][iOverview]->FlushCache(false) !=
-                CE_None)
-                eErr = CE_Failure;
-        }
+        auto poLevel = std::make_unique<OvrLevel>();
+        poLevel->iOverview = iOverview;
+        poLevel->iSrcOverview = iSrcOverview;
+        poLevel->nSrcWidth = nSrcWidth;
+        poLevel->nSrcHeight = nSrcHeight;
+        poLevel->nDstTotalWidth = nDstTotalWidth;
+        poLevel->nDstTotalHeight = nDstTotalHeight;
+        poLevel->nDstXOffStart = nDstXOffStart;
+        poLevel->nDstXOffEnd = nDstXOffEnd;
+        poLevel->nDstYOffStart = nDstYOffStart;
+        poLevel->nDstYOffEnd = nDstYOffEnd;
+        poLevel->dfXRatioDstToSrc = dfXRatioDstToSrc;
+        poLevel->dfYRatioDstToSrc = dfYRatioDstToSrc;
+        poLevel->nOvrFactor = nOvrFactor;
+        poLevel->nDstChunkXSize = nDstChunkXSize;
+        poLevel->nDstChunkYSize = nDstChunkYSize;
+        poLevel->nFullResXChunk = nFullResXChunk;
+        poLevel->nFullResYChunk = nFullResYChunk;
+        poLevel->nFullResXChunkQueried = nFullResXChunkQueried;
+        poLevel->nFullResYChunkQueried = nFullResYChunkQueried;
+        poLevel->nDstYOff = nDstYOffStart;
+        // nDstChunkYSize is the block height of the overview bands
+        poLevel->nYBlockNotFlushed = nDstYOffStart / nDstChunkYSize;
+        poLevel->apaChunk.resize(nBands);
+        poLevel->apabyChunkNoDataMask.resize(nBands);
+        apoPendingLevels.push_back(std::move(poLevel));
+
+        if (!bPipelineLevels)
+            eErr = GeneratePendingLevels();
     }
 
+    if (eErr == CE_None)
+        eErr = GeneratePendingLevels();
+
     if (eErr == CE_None)
         pfnProgress(1.0, nullptr, pProgressData);
 
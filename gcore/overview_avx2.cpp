@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of overview kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+#include "overview_avx2.h"
+
+#include <immintrin.h>
+
+#include "overview_kernels.hpp"
+
+/************************************************************************/
+/*                      GDALQuadraticMeanByte_AVX2()                    */
+/************************************************************************/
+
+int GDALQuadraticMeanByte_AVX2(int nDstXWidth, int nChunkXSize,
+                               const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                               GByte *CPL_RESTRICT pDstScanline)
+{
+    return QuadraticMeanByteSSE2OrAVX2(nDstXWidth, nChunkXSize,
+                                       pSrcScanlineShifted, pDstScanline);
+}
+
+/************************************************************************/
+/*                        GDALAverageByte_AVX2()                        */
+/************************************************************************/
+
+int GDALAverageByte_AVX2(int nDstXWidth, int nChunkXSize,
+                         const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                         GByte *CPL_RESTRICT pDstScanline)
+{
+    return AverageByteSSE2OrAVX2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                 pDstScanline);
+}
+
+/************************************************************************/
+/*                    GDALQuadraticMeanUInt16_AVX2()                    */
+/************************************************************************/
+
+int GDALQuadraticMeanUInt16_AVX2(
+    int nDstXWidth, int nChunkXSize,
+    const GUInt16 *&CPL_RESTRICT pSrcScanlineShifted,
+    GUInt16 *CPL_RESTRICT pDstScanline)
+{
+    return QuadraticMeanUInt16SSE2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                   pDstScanline);
+}
+
+/************************************************************************/
+/*                     GDALQuadraticMeanFloat_AVX2()                    */
+/************************************************************************/
+
+int GDALQuadraticMeanFloat_AVX2(int nDstXWidth, int nChunkXSize,
+                                const float *&CPL_RESTRICT pSrcScanlineShifted,
+                                float *CPL_RESTRICT pDstScanline)
+{
+    return QuadraticMeanFloatSSE2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                  pDstScanline);
+}
+
+#endif
@@ -0,0 +1,48 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of overview kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OVERVIEW_AVX2_H_INCLUDED
+#define OVERVIEW_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+//! @cond Doxygen_Suppress
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+// Those functions must only be called if CPLHaveRuntimeAVX2() is true.
+// The kernels for which AVX2 brings nothing but the VEX encoding of the SSE2
+// code, such as the averaging of UInt16, Float32 and Float64, are not
+// provided. They process the largest multiple of the vector width that fits in
+// nDstXWidth, and return the number of destination pixels computed.
+
+int GDALQuadraticMeanByte_AVX2(int nDstXWidth, int nChunkXSize,
+                               const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                               GByte *CPL_RESTRICT pDstScanline);
+
+int GDALAverageByte_AVX2(int nDstXWidth, int nChunkXSize,
+                         const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                         GByte *CPL_RESTRICT pDstScanline);
+
+int GDALQuadraticMeanUInt16_AVX2(
+    int nDstXWidth, int nChunkXSize,
+    const GUInt16 *&CPL_RESTRICT pSrcScanlineShifted,
+    GUInt16 *CPL_RESTRICT pDstScanline);
+
+int GDALQuadraticMeanFloat_AVX2(int nDstXWidth, int nChunkXSize,
+                                const float *&CPL_RESTRICT pSrcScanlineShifted,
+                                float *CPL_RESTRICT pDstScanline);
+
+#endif
+
+//! @endcond
+
+#endif /* OVERVIEW_AVX2_H_INCLUDED */
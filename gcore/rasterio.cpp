@@ -25,6 +25,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -32,11 +33,14 @@
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_vrt.h"
 #include "gdalwarper.h"
 #include "memdataset.h"
@@ -4436,6 +4440,121 @@ static int GDALDatasetGetBestOverviewLevel(GDALDataset *poDS, int &nXOff,
                                          psExtraArg);
 }
 
+/************************************************************************/
+/*                      GDALParallelRasterIORead()                      */
+/************************************************************************/
+
+/** Process a RasterIO() read request, at full resolution, by chunks aligned
+ * on the block structure, that are read concurrently by worker threads of
+ * the global thread pool.
+ *
+ * This is only enabled when the GDAL_NUM_THREADS configuration option is set
+ * to a value greater than 1, and the request intersects several chunks.
+ *
+ * pfnReadChunk() is called from several threads at the same time, for
+ * non-overlapping chunks, so this function must only be used by datasets
+ * whose raster read methods are thread-safe, that is the ones opened with
+ * GDAL_OF_THREAD_SAFE (see GDALThreadSafeDataset).
+ *
+ * @return true if the request has been processed, in which case eErr is set,
+ * or false if it should be processed in the usual (sequential) way.
+ */
+bool GDALParallelRasterIORead(int nXOff, int nYOff, int nXSize, int nYSize,
+                              int nBlockXSize, int nBlockYSize, void *pData,
+                              GSpacing nPixelSpace, GSpacing nLineSpace,
+                              const GDALParallelRasterIOChunkFunc &pfnReadChunk,
+                              CPLErr &eErr)
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (!pszThreads || nXSize <= 0 || nYSize <= 0 || nBlockXSize <= 0 ||
+        nBlockYSize <= 0)
+        return false;
+    int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                                 ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads)));
+    if (nThreads <= 1)
+        return false;
+
+    // Group blocks in chunks of at least MIN_PIXELS_PER_CHUNK pixels, so that
+    // the overhead of job scheduling stays negligible for small blocks
+    // (typically single-line strips)
+    constexpr int MIN_PIXELS_PER_CHUNK = 65536;
+    const int nChunkYBlocks = static_cast<int>(std::max<GIntBig>(
+        1, MIN_PIXELS_PER_CHUNK / (static_cast<GIntBig>(nBlockXSize) *
+                                   nBlockYSize)));
+    const int nChunkYSize = static_cast<int>(
+        std::min<GIntBig>(static_cast<GIntBig>(nChunkYBlocks) * nBlockYSize,
+                          std::numeric_limits<int>::max()));
+
+    const int nXBlockStart = nXOff / nBlockXSize;
+    const int nXBlockEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nYChunkStart = nYOff / nChunkYSize;
+    const int nYChunkEnd = (nYOff + nYSize - 1) / nChunkYSize;
+    const GIntBig nChunks =
+        static_cast<GIntBig>(nXBlockEnd - nXBlockStart + 1) *
+        (nYChunkEnd - nYChunkStart + 1);
+    if (nChunks <= 1)
+        return false;
+    nThreads = static_cast<int>(std::min<GIntBig>(nThreads, nChunks));
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>();
+    if (!poJobQueue)
+        return false;
+
+    CPLDebug("GDAL",
+             "GDALParallelRasterIORead(): reading " CPL_FRMT_GIB
+             " chunks with %d threads",
+             nChunks, nThreads);
+
+    std::atomic<bool> bSuccess{true};
+    CPLErrorAccumulator oErrorAccumulator;
+    for (int iYChunk = nYChunkStart; iYChunk <= nYChunkEnd; ++iYChunk)
+    {
+        const int nChunkYOff =
+            std::max(nYOff, static_cast<int>(static_cast<GIntBig>(iYChunk) *
+                                             nChunkYSize));
+        const int nChunkYOff2 = static_cast<int>(std::min<GIntBig>(
+            nYOff + nYSize, static_cast<GIntBig>(iYChunk + 1) * nChunkYSize));
+        for (int iXBlock = nXBlockStart; iXBlock <= nXBlockEnd; ++iXBlock)
+        {
+            const int nChunkXOff = std::max(nXOff, iXBlock * nBlockXSize);
+            const int nChunkXOff2 = static_cast<int>(
+                std::min<GIntBig>(nXOff + nXSize,
+                                  static_cast<GIntBig>(iXBlock + 1) *
+                                      nBlockXSize));
+            GByte *pabyChunkData =
+                static_cast<GByte *>(pData) +
+                static_cast<GPtrDiff_t>(nChunkXOff - nXOff) * nPixelSpace +
+                static_cast<GPtrDiff_t>(nChunkYOff - nYOff) * nLineSpace;
+
+            poJobQueue->SubmitJob(
+                [&pfnReadChunk, &bSuccess, &oErrorAccumulator, nChunkXOff,
+                 nChunkYOff, nChunkXOff2, nChunkYOff2, pabyChunkData]()
+                {
+                    if (!bSuccess)
+                        return;
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    if (pfnReadChunk(nChunkXOff, nChunkYOff,
+                                     nChunkXOff2 - nChunkXOff,
+                                     nChunkYOff2 - nChunkYOff,
+                                     pabyChunkData) != CE_None)
+                    {
+                        bSuccess = false;
+                    }
+                });
+        }
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    eErr = bSuccess ? CE_None : CE_Failure;
+    return true;
+}
+
 /************************************************************************/
 /*                         BlockBasedRasterIO()                         */
 /*                                                                      */
@@ -1980,6 +1980,9 @@ class OGRLayer;
 class swq_expr_node;
 class swq_custom_func_registrar;
 struct swq_evaluation_context;
+class swq_compiled_expr;
+struct ArrowSchema;
+struct ArrowArray;
 
 class CPL_DLL OGRFeatureQuery
 {
@@ -1987,6 +1990,7 @@ class CPL_DLL OGRFeatureQuery
     const OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    std::unique_ptr<swq_compiled_expr> m_poCompiledExpr{};
 
     char **FieldCollector(void *, char **);
 
@@ -2011,6 +2015,10 @@ class CPL_DLL OGRFeatureQuery
                    swq_custom_func_registrar *poCustomFuncRegistrar = nullptr);
     int Evaluate(OGRFeature *);
 
+    bool EvaluateOnArrowArray(const struct ArrowSchema *,
+                              const struct ArrowArray *,
+                              std::vector<bool> &abResult);
+
     GIntBig *EvaluateAgainstIndices(OGRLayer *, OGRErr *);
 
     int CanUseIndex(OGRLayer *);
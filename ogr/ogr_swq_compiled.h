@@ -0,0 +1,137 @@
+/******************************************************************************
+ *
+ * Component: OGR SQL Engine
+ * Purpose: Compiled form of OGR SQL WHERE expressions.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGR_SWQ_COMPILED_H_INCLUDED
+#define OGR_SWQ_COMPILED_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogr_swq.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class OGRFeature;
+class OGRFeatureDefn;
+struct ArrowSchema;
+struct ArrowArray;
+
+/************************************************************************/
+/*                          swq_compiled_expr                           */
+/************************************************************************/
+
+/** Flattened form of a WHERE expression, evaluated without allocating
+ * intermediate swq_expr_node objects.
+ *
+ * Comparisons, IN and BETWEEN between a column and constants, IS NULL, AND,
+ * OR and NOT are compiled. Other sub-expressions are evaluated with
+ * swq_expr_node::Evaluate(). The result is the same as the one of
+ * swq_expr_node::Evaluate() on the whole expression.
+ *
+ * When all sub-expressions are compiled, the expression can also be
+ * evaluated column-wise on an Arrow array.
+ */
+class swq_compiled_expr
+{
+  public:
+    static std::unique_ptr<swq_compiled_expr>
+    Compile(const swq_expr_node *poExpr, const OGRFeatureDefn *poDefn);
+
+    bool Evaluate(OGRFeature *poFeature, swq_field_fetcher pfnFetcher,
+                  const swq_evaluation_context &sContext) const;
+
+    bool EvaluateOnArrowArray(const struct ArrowSchema *schema,
+                              const struct ArrowArray *array,
+                              std::vector<bool> &abResult) const;
+
+  private:
+    enum class OpCode
+    {
+        COMPARE,
+        IN,
+        BETWEEN,
+        IS_NULL,
+        AND,
+        OR,
+        NOT,
+        GENERIC
+    };
+
+    enum class ValueType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    struct Instr
+    {
+        OpCode eOpCode = OpCode::GENERIC;
+        // Whether the nullness of the result is needed by the parent
+        bool bNeedNull = true;
+
+        // COMPARE, IN, BETWEEN, IS_NULL
+        swq_op eOp = SWQ_EQ;  // only for COMPARE
+        int iField = -1;      // index for OGRFeature::GetFieldAsXXX()
+        bool bRegularField = false;
+        std::string osFieldName{};
+        swq_field_type eFieldType = SWQ_INTEGER;
+        ValueType eValueType = ValueType::INTEGER;
+        std::vector<GIntBig> anValues{};
+        std::vector<double> adfValues{};
+        std::vector<std::string> aosValues{};
+
+        // AND, OR, NOT
+        int iFirst = -1;
+        int iSecond = -1;
+
+        // GENERIC
+        swq_expr_node *poNode = nullptr;
+    };
+
+    struct Value
+    {
+        bool bValue = false;
+        bool bNull = false;
+    };
+
+    std::unique_ptr<swq_expr_node> m_poExpr{};
+    std::vector<Instr> m_aoInstrs{};
+    int m_iRoot = -1;
+    bool m_bHasGeneric = false;
+
+    swq_compiled_expr() = default;
+
+    static void SetColumn(Instr &sInstr, const swq_expr_node *poColumn,
+                          const OGRFeatureDefn *poDefn);
+    int CompileNode(swq_expr_node *poNode, const OGRFeatureDefn *poDefn,
+                    bool bNeedNull);
+    bool CompileColumnPredicate(swq_expr_node *poNode,
+                                const OGRFeatureDefn *poDefn, Instr &sInstr);
+
+    Value EvaluateInstr(int iInstr, OGRFeature *poFeature,
+                        swq_field_fetcher pfnFetcher,
+                        const swq_evaluation_context &sContext,
+                        bool &bError) const;
+
+    bool EvaluateInstrOnArrowArray(int iInstr,
+                                   const struct ArrowSchema *schema,
+                                   const struct ArrowArray *array,
+                                   std::vector<GByte> &abyValue,
+                                   std::vector<GByte> &abyNull) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(swq_compiled_expr)
+};
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif /* OGR_SWQ_COMPILED_H_INCLUDED */
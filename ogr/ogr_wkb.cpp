@@ -1409,6 +1409,213 @@ bool OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
 #endif
 }
 
+/************************************************************************/
+/*                           OGRWKBSwapXY()                             */
+/************************************************************************/
+
+/** Swap the X and Y coordinates of all points of a WKB geometry, in place.
+ */
+bool OGRWKBSwapXY(GByte *pabyWkb, size_t nWKBSize)
+{
+    struct OGRWKBPointUpdaterSwapXY final : public OGRWKBPointUpdater
+    {
+        OGRWKBPointUpdaterSwapXY() = default;
+
+        bool update(bool /* bNeedSwap */, void *x, void *y, void * /* z */,
+                    void * /* m */) override
+        {
+            // Byte order does not matter when exchanging raw values
+            GByte abyTmp[sizeof(double)];
+            memcpy(abyTmp, x, sizeof(double));
+            memcpy(x, y, sizeof(double));
+            memcpy(y, abyTmp, sizeof(double));
+            return true;
+        }
+    };
+
+    OGRWKBPointUpdaterSwapXY oUpdater;
+    return OGRWKBUpdatePoints(pabyWkb, nWKBSize, oUpdater);
+}
+
+/************************************************************************/
+/*                  OGRWKBSetCoordinateDimension()                      */
+/************************************************************************/
+
+namespace
+{
+struct OGRWKBDimensionSetter
+{
+    const GByte *const m_pabyIn;
+    const size_t m_nSize;
+    const bool m_bOutHasZ;
+    const bool m_bOutHasM;
+    std::vector<GByte> &m_abyOut;
+
+    void AppendUInt32(uint32_t nVal, bool bNeedSwap)
+    {
+        if (bNeedSwap)
+            CPL_SWAP32PTR(&nVal);
+        const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+        m_abyOut.insert(m_abyOut.end(), pabyVal, pabyVal + sizeof(nVal));
+    }
+
+    void AppendFloat64(double dfVal, bool bNeedSwap)
+    {
+        if (bNeedSwap)
+            CPL_SWAP64PTR(&dfVal);
+        const GByte *pabyVal = reinterpret_cast<const GByte *>(&dfVal);
+        m_abyOut.insert(m_abyOut.end(), pabyVal, pabyVal + sizeof(dfVal));
+    }
+
+    bool AppendPoints(uint32_t nPoints, bool bHasZ, bool bHasM,
+                      OGRwkbByteOrder eByteOrder, size_t &iOffset)
+    {
+        const int nDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+        if (nPoints > (m_nSize - iOffset) / (nDim * sizeof(double)))
+            return false;
+        const bool bNeedSwap = OGR_SWAP(eByteOrder);
+        for (uint32_t i = 0; i < nPoints; ++i)
+        {
+            const GByte *pabyPoint = m_pabyIn + iOffset;
+            m_abyOut.insert(m_abyOut.end(), pabyPoint,
+                            pabyPoint + 2 * sizeof(double));
+            // An empty point has X=Y=NaN: keep it empty
+            const bool bEmpty =
+                std::isnan(OGRWKBReadFloat64(pabyPoint, bNeedSwap)) &&
+                std::isnan(
+                    OGRWKBReadFloat64(pabyPoint + sizeof(double), bNeedSwap));
+            const double dfNew =
+                bEmpty ? std::numeric_limits<double>::quiet_NaN() : 0.0;
+            if (m_bOutHasZ)
+            {
+                if (bHasZ)
+                    m_abyOut.insert(m_abyOut.end(),
+                                    pabyPoint + 2 * sizeof(double),
+                                    pabyPoint + 3 * sizeof(double));
+                else
+                    AppendFloat64(dfNew, bNeedSwap);
+            }
+            if (m_bOutHasM)
+            {
+                if (bHasM)
+                {
+                    const GByte *pabyM =
+                        pabyPoint + (bHasZ ? 3 : 2) * sizeof(double);
+                    m_abyOut.insert(m_abyOut.end(), pabyM,
+                                    pabyM + sizeof(double));
+                }
+                else
+                    AppendFloat64(dfNew, bNeedSwap);
+            }
+            iOffset += nDim * sizeof(double);
+        }
+        return true;
+    }
+
+    bool Process(size_t &iOffset, int nRec)
+    {
+        if (m_nSize - iOffset < MIN_WKB_SIZE)
+            return false;
+        const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(m_pabyIn[iOffset]);
+        if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+            return false;
+        const OGRwkbByteOrder eByteOrder =
+            static_cast<OGRwkbByteOrder>(nByteOrder);
+        const bool bNeedSwap = OGR_SWAP(eByteOrder);
+
+        OGRwkbGeometryType eGeometryType = wkbUnknown;
+        if (OGRReadWKBGeometryType(m_pabyIn + iOffset, wkbVariantIso,
+                                   &eGeometryType) != OGRERR_NONE)
+            return false;
+        iOffset += WKB_PREFIX_SIZE;
+        const auto eFlatType = wkbFlatten(eGeometryType);
+        const bool bHasZ = OGR_GT_HasZ(eGeometryType);
+        const bool bHasM = OGR_GT_HasM(eGeometryType);
+
+        m_abyOut.push_back(static_cast<GByte>(eByteOrder));
+        // ISO WKB geometry type codes
+        AppendUInt32(static_cast<uint32_t>(eFlatType) +
+                         (m_bOutHasZ ? 1000 : 0) + (m_bOutHasM ? 2000 : 0),
+                     bNeedSwap);
+
+        if (eFlatType == wkbPoint)
+        {
+            return AppendPoints(1, bHasZ, bHasM, eByteOrder, iOffset);
+        }
+
+        const uint32_t nCount =
+            OGRWKBReadUInt32AtOffset(m_pabyIn, eByteOrder, iOffset);
+        AppendUInt32(nCount, bNeedSwap);
+
+        if (eFlatType == wkbLineString || eFlatType == wkbCircularString)
+        {
+            return AppendPoints(nCount, bHasZ, bHasM, eByteOrder, iOffset);
+        }
+
+        if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+        {
+            if (nCount > (m_nSize - iOffset) / sizeof(uint32_t))
+                return false;
+            for (uint32_t i = 0; i < nCount; ++i)
+            {
+                if (iOffset + sizeof(uint32_t) > m_nSize)
+                    return false;
+                const uint32_t nPoints =
+                    OGRWKBReadUInt32AtOffset(m_pabyIn, eByteOrder, iOffset);
+                AppendUInt32(nPoints, bNeedSwap);
+                if (!AppendPoints(nPoints, bHasZ, bHasM, eByteOrder, iOffset))
+                    return false;
+            }
+            return true;
+        }
+
+        if (eFlatType == wkbGeometryCollection ||
+            eFlatType == wkbCompoundCurve || eFlatType == wkbCurvePolygon ||
+            eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+            eFlatType == wkbMultiPolygon || eFlatType == wkbMultiCurve ||
+            eFlatType == wkbMultiSurface || eFlatType == wkbPolyhedralSurface ||
+            eFlatType == wkbTIN)
+        {
+            if (nRec == 128)
+                return false;
+            if (nCount > (m_nSize - iOffset) / MIN_WKB_SIZE)
+                return false;
+            for (uint32_t i = 0; i < nCount; ++i)
+            {
+                if (!Process(iOffset, nRec + 1))
+                    return false;
+            }
+            return true;
+        }
+
+        CPLDebug("OGR", "Unknown WKB geometry type");
+        return false;
+    }
+};
+}  // namespace
+
+/** Append to abyOut a version of a WKB geometry whose coordinate dimension
+ * is set to XY, XYZ, XYM or XYZM.
+ *
+ * Missing Z and M values are set to 0, and dropped ones are discarded. The
+ * output uses ISO WKB geometry type codes, and the byte order of the input.
+ * On failure, abyOut is left at its initial size.
+ */
+bool OGRWKBSetCoordinateDimension(const GByte *pabyWkb, size_t nWKBSize,
+                                  bool bHasZ, bool bHasM,
+                                  std::vector<GByte> &abyOut)
+{
+    const size_t nInitialSize = abyOut.size();
+    OGRWKBDimensionSetter oSetter{pabyWkb, nWKBSize, bHasZ, bHasM, abyOut};
+    size_t iOffset = 0;
+    if (!oSetter.Process(iOffset, /* nRec = */ 0))
+    {
+        abyOut.resize(nInitialSize);
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                         OGRAppendBuffer()                            */
 /************************************************************************/
@@ -90,6 +90,13 @@ bool CPL_DLL OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
                              OGRWKBTransformCache &oCache,
                              OGREnvelope3D &sEnvelope);
 
+bool CPL_DLL OGRWKBSwapXY(GByte *pabyWkb, size_t nWKBSize);
+
+bool CPL_DLL OGRWKBSetCoordinateDimension(const GByte *pabyWkb,
+                                          size_t nWKBSize, bool bHasZ,
+                                          bool bHasM,
+                                          std::vector<GByte> &abyOut);
+
 /************************************************************************/
 /*                       OGRAppendBuffer                                */
 /************************************************************************/
@@ -25,6 +25,7 @@
 #include "ogr_attrind.h"
 #include "ogr_core.h"
 #include "ogr_p.h"
+#include "ogr_swq_compiled.h"
 #include "ogrsf_frmts.h"
 
 //! @cond Doxygen_Suppress
@@ -100,6 +101,7 @@ OGRFeatureQuery::Compile(const OGRLayer *poLayer, const OGRFeatureDefn *poDefn,
                          swq_custom_func_registrar *poCustomFuncRegistrar)
 {
     // Clear any existing expression.
+    m_poCompiledExpr.reset();
     if (pSWQExpr != nullptr)
     {
         delete static_cast<swq_expr_node *>(pSWQExpr);
@@ -228,6 +230,14 @@ OGRFeatureQuery::Compile(const OGRLayer *poLayer, const OGRFeatureDefn *poDefn,
         eErr = OGRERR_CORRUPT_DATA;
         pSWQExpr = nullptr;
     }
+    else if (bCheck && CPLTestBool(CPLGetConfigOption(
+                           "OGR_SQL_COMPILE_EXPRESSION", "YES")))
+    {
+        // Flattened form of the expression used by Evaluate(), that avoids
+        // allocating a swq_expr_node for each column value and operation.
+        m_poCompiledExpr = swq_compiled_expr::Compile(
+            static_cast<const swq_expr_node *>(pSWQExpr), poDefn);
+    }
 
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
@@ -314,6 +324,10 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    if (m_poCompiledExpr)
+        return m_poCompiledExpr->Evaluate(poFeature, OGRFeatureFetcher,
+                                          *m_psContext);
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
@@ -331,6 +345,28 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     return bLogicalResult;
 }
 
+/************************************************************************/
+/*                        EvaluateOnArrowArray()                        */
+/************************************************************************/
+
+/** Evaluate the query column-wise on the rows of an Arrow array, whose
+ * top-level columns are named after the fields of the layer.
+ *
+ * abResult must have array->length elements. Elements corresponding to rows
+ * that do not match the query are set to false.
+ *
+ * Returns false, without modifying abResult, if the query cannot be
+ * evaluated in that mode, in which case Evaluate() must be used on each
+ * feature.
+ */
+bool OGRFeatureQuery::EvaluateOnArrowArray(const struct ArrowSchema *schema,
+                                           const struct ArrowArray *array,
+                                           std::vector<bool> &abResult)
+{
+    return m_poCompiledExpr &&
+           m_poCompiledExpr->EvaluateOnArrowArray(schema, array, abResult);
+}
+
 /************************************************************************/
 /*                            CanUseIndex()                             */
 /************************************************************************/
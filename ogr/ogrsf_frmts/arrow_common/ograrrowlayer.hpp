@@ -5485,6 +5485,29 @@ inline bool OGRArrowLayer::UseRecordBatchBaseImplementation() const
         }
     }
 
+    bool bInterleaved = false;
+    if (OGRIsGeoArrowGeometryEncodingRequested(
+            m_aosArrowArrayStreamOptions.List(), bInterleaved))
+    {
+        // Native GeoArrow columns are returned as such if they have the
+        // requested layout. Otherwise the generic implementation converts
+        // WKB to GeoArrow.
+        const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
+        for (int i = 0; i < nGeomFieldCount; i++)
+        {
+            const auto eEncoding = m_aeGeomEncoding[i];
+            if (!m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored() &&
+                (eEncoding == OGRArrowGeomEncoding::WKB ||
+                 eEncoding == OGRArrowGeomEncoding::WKT ||
+                 OGRArrowIsGeoArrowStruct(eEncoding) == bInterleaved))
+            {
+                CPLDebug("ARROW", "Geometry encoding not compatible of fast "
+                                  "Arrow implementation");
+                return true;
+            }
+        }
+    }
+
     if (m_bIgnoredFields)
     {
         std::vector<int> ignoredState(m_anMapFieldIndexToArrowColumn.size(),
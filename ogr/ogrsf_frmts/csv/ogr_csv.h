@@ -16,7 +16,11 @@
 
 #include "ogrsf_frmts.h"
 
+#include <atomic>
+#include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 typedef enum
 {
@@ -82,6 +86,16 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     bool bHasFieldNames = false;
 
     OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *TranslateTokens(char **papszTokens, int64_t nFID);
+    void AssignNextFID(OGRFeature *poFeature);
+
+    // Multi-threaded reading
+    int m_nNumThreads = 1;
+    std::vector<std::string> m_aosBatchRecords{};
+    std::vector<std::unique_ptr<OGRFeature>> m_apoBatchFeatures{};
+    size_t m_iNextBatchFeature = 0;
+
+    bool ReadFeatureBatch();
 
     bool bNew = false;
     bool bInWriteMode = false;
@@ -122,7 +136,8 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     char **AutodetectFieldTypes(CSLConstList papszOpenOptions, int nFieldCount);
 
-    bool bWarningBadTypeOrWidth = false;
+    // Atomic as it may be set by worker threads
+    std::atomic<bool> bWarningBadTypeOrWidth{false};
     bool bKeepSourceColumns = false;
     bool bKeepGeomColumns = true;
 
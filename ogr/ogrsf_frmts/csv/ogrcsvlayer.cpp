@@ -29,9 +29,12 @@
 #include "cpl_conv.h"
 #include "cpl_csv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -65,6 +68,15 @@ OGRCSVLayer::OGRCSVLayer(GDALDataset *poDS, const char *pszLayerNameIn,
     SetDescription(poFeatureDefn->GetName());
     poFeatureDefn->Reference();
     poFeatureDefn->SetGeomType(wkbNone);
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("OGR_CSV_NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        m_nNumThreads = std::min(4, CPLGetNumCPUs());
+    else if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        m_nNumThreads = CPLGetNumCPUs();
+    else
+        m_nNumThreads = std::max(1, atoi(pszNumThreads));
 }
 
 /************************************************************************/
@@ -1275,6 +1287,10 @@ void OGRCSVLayer::ResetReading()
     bNeedRewindBeforeRead = false;
 
     m_nNextFID = FID_INITIAL_VALUE;
+
+    m_aosBatchRecords.clear();
+    m_apoBatchFeatures.clear();
+    m_iNextBatchFeature = 0;
 }
 
 /************************************************************************/
@@ -1310,8 +1326,11 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 {
     if (nFID < FID_INITIAL_VALUE || fpCSV == nullptr)
         return nullptr;
-    if (nFID < m_nNextFID || bNeedRewindBeforeRead)
+    if (nFID < m_nNextFID || bNeedRewindBeforeRead ||
+        !m_apoBatchFeatures.empty())
+    {
         ResetReading();
+    }
     while (m_nNextFID < nFID)
     {
         char **papszTokens = GetNextLineTokens();
@@ -1338,6 +1357,40 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (papszTokens == nullptr)
         return nullptr;
 
+    OGRFeature *poFeature = TranslateTokens(papszTokens, m_nNextFID);
+    CSLDestroy(papszTokens);
+
+    AssignNextFID(poFeature);
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                           AssignNextFID()                            */
+/************************************************************************/
+
+void OGRCSVLayer::AssignNextFID(OGRFeature *poFeature)
+{
+    if ((m_nNextFID % 100000) == 0)
+    {
+        CPLDebug("CSV", "FID = %" PRId64 ", file offset = %" PRIu64, m_nNextFID,
+                 static_cast<uint64_t>(fpCSV->Tell()));
+    }
+
+    // Translate the record id.
+    poFeature->SetFID(m_nNextFID++);
+
+    m_nFeaturesRead++;
+}
+
+/************************************************************************/
+/*                          TranslateTokens()                           */
+/************************************************************************/
+
+// Build a feature from the fields of a record. nFID is only used in
+// warning messages. May be called concurrently from several threads.
+OGRFeature *OGRCSVLayer::TranslateTokens(char **papszTokens, int64_t nFID)
+{
     // Create the OGR feature.
     OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
 
@@ -1444,29 +1497,27 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         const OGRFieldType eFieldType = poFieldDefn->GetType();
         const OGRFieldSubType eFieldSubType = poFieldDefn->GetSubType();
 
-        const auto WarnOnceBadValue = [this, poFieldDefn]()
+        const auto WarnOnceBadValue = [this, poFieldDefn, nFID]()
         {
-            if (!bWarningBadTypeOrWidth)
+            if (!bWarningBadTypeOrWidth.exchange(true))
             {
-                bWarningBadTypeOrWidth = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Invalid value type found in record %" PRId64
                          " for field %s. "
                          "This warning will no longer be emitted",
-                         m_nNextFID, poFieldDefn->GetNameRef());
+                         nFID, poFieldDefn->GetNameRef());
             };
         };
 
-        const auto WarnTooLargeWidth = [this, poFieldDefn]()
+        const auto WarnTooLargeWidth = [this, poFieldDefn, nFID]()
         {
-            if (!bWarningBadTypeOrWidth)
+            if (!bWarningBadTypeOrWidth.exchange(true))
             {
-                bWarningBadTypeOrWidth = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Value with a width greater than field width "
                          "found in record %" PRId64 " for field %s. "
                          "This warning will no longer be emitted",
-                         m_nNextFID, poFieldDefn->GetNameRef());
+                         nFID, poFieldDefn->GetNameRef());
             };
         };
 
@@ -1544,15 +1595,15 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                             pszDot != nullptr
                                 ? static_cast<int>(strlen(pszDot + 1))
                                 : 0;
-                        if (nPrecision > poFieldDefn->GetPrecision())
+                        if (nPrecision > poFieldDefn->GetPrecision() &&
+                            !bWarningBadTypeOrWidth.exchange(true))
                         {
-                            bWarningBadTypeOrWidth = true;
                             CPLError(CE_Warning, CPLE_AppDefined,
                                      "Value with a precision greater than "
                                      "field precision found in record %" PRId64
                                      " for field %s. "
                                      "This warning will no longer be emitted",
-                                     m_nNextFID, poFieldDefn->GetNameRef());
+                                     nFID, poFieldDefn->GetNameRef());
                         }
                     }
                 }
@@ -1712,20 +1763,100 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         }
     }
 
-    CSLDestroy(papszTokens);
+    return poFeature;
+}
 
-    if ((m_nNextFID % 100000) == 0)
+/************************************************************************/
+/*                          ReadFeatureBatch()                          */
+/************************************************************************/
+
+// Read a batch of records from the file, and split and translate them to
+// features in the global thread pool. Records are delimited in the calling
+// thread, which takes care of quoted strings spanning several lines.
+// Features are stored in m_apoBatchFeatures in file order, without FID.
+bool OGRCSVLayer::ReadFeatureBatch()
+{
+    m_apoBatchFeatures.clear();
+    m_iNextBatchFeature = 0;
+
+    // Bounds the memory used by a batch, while giving enough work to each
+    // thread to amortize the synchronization cost.
+    constexpr size_t RECORDS_PER_THREAD = 10000;
+    constexpr size_t BYTES_PER_THREAD = 4 * 1024 * 1024;
+    const size_t nMaxRecords = RECORDS_PER_THREAD * m_nNumThreads;
+    const size_t nMaxBytes = BYTES_PER_THREAD * m_nNumThreads;
+    if (m_aosBatchRecords.size() < nMaxRecords)
+        m_aosBatchRecords.resize(nMaxRecords);
+    size_t nRecords = 0;
+    size_t nBatchBytes = 0;
+    while (nRecords < nMaxRecords && nBatchBytes < nMaxBytes &&
+           CSVReadRecordL(fpCSV, m_nMaxLineSize, szDelimiter, bHonourStrings,
+                          true,  // bSkipBOM
+                          m_aosBatchRecords[nRecords]))
     {
-        CPLDebug("CSV", "FID = %" PRId64 ", file offset = %" PRIu64, m_nNextFID,
-                 static_cast<uint64_t>(fpCSV->Tell()));
+        // Skip empty lines, as GetNextLineTokens() does
+        if (!m_aosBatchRecords[nRecords].empty())
+        {
+            nBatchBytes += m_aosBatchRecords[nRecords].size();
+            ++nRecords;
+        }
     }
+    if (nRecords == 0)
+        return false;
 
-    // Translate the record id.
-    poFeature->SetFID(m_nNextFID++);
+    m_apoBatchFeatures.resize(nRecords);
 
-    m_nFeaturesRead++;
+    const int64_t nFirstFID = m_nNextFID;
+    const auto ProcessRecords = [this, nFirstFID](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            char **papszTokens = CSVSplitRecord(
+                m_aosBatchRecords[i].c_str(), szDelimiter, bHonourStrings,
+                false,  // bKeepLeadingAndClosingQuotes
+                bMergeDelimiter);
+            if (papszTokens[0] != nullptr)
+            {
+                m_apoBatchFeatures[i].reset(TranslateTokens(
+                    papszTokens, nFirstFID + static_cast<int64_t>(i)));
+            }
+            CSLDestroy(papszTokens);
+        }
+    };
 
-    return poFeature;
+    constexpr size_t MIN_RECORDS_PER_JOB = 1000;
+    const int nJobs = static_cast<int>(
+        std::min<size_t>(m_nNumThreads, (nRecords + MIN_RECORDS_PER_JOB - 1) /
+                                            MIN_RECORDS_PER_JOB));
+    CPLWorkerThreadPool *poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>();
+    if (!poJobQueue)
+    {
+        ProcessRecords(0, nRecords);
+    }
+    else
+    {
+        CPLErrorAccumulator oErrorAccumulator;
+        const size_t nRecordsPerJob = (nRecords + nJobs - 1) / nJobs;
+        for (size_t iStart = 0; iStart < nRecords; iStart += nRecordsPerJob)
+        {
+            const size_t iEnd = std::min(nRecords, iStart + nRecordsPerJob);
+            poJobQueue->SubmitJob(
+                [&ProcessRecords, &oErrorAccumulator, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    ProcessRecords(iStart, iEnd);
+                });
+        }
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+
+    return true;
 }
 
 /************************************************************************/
@@ -1740,11 +1871,32 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
 
     // Read features till we find one that satisfies our current
     // spatial criteria.
+    // The first records are read sequentially, so that small files, and
+    // callers only fetching a few features, do not pay for batching.
+    constexpr int64_t SEQUENTIAL_RECORDS = 1000;
+
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
-        if (poFeature == nullptr)
-            return nullptr;
+        OGRFeature *poFeature = nullptr;
+        if (m_nNumThreads > 1 && fpCSV != nullptr &&
+            m_nNextFID >= FID_INITIAL_VALUE + SEQUENTIAL_RECORDS)
+        {
+            if (m_iNextBatchFeature == m_apoBatchFeatures.size() &&
+                !ReadFeatureBatch())
+            {
+                return nullptr;
+            }
+            poFeature = m_apoBatchFeatures[m_iNextBatchFeature++].release();
+            if (poFeature == nullptr)
+                continue;
+            AssignNextFID(poFeature);
+        }
+        else
+        {
+            poFeature = GetNextUnfilteredFeature();
+            if (poFeature == nullptr)
+                return nullptr;
+        }
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
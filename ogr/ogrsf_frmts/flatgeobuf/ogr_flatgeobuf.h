@@ -32,6 +32,8 @@
 
 #include <deque>
 #include <limits>
+#include <memory>
+#include <vector>
 
 class OGRFlatGeobufDataset;
 
@@ -91,6 +93,7 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     uint64_t m_offsetFeatures = 0;  // offset of feature data
     std::vector<FlatGeobuf::SearchResultItem>
         m_foundItems;  // found node items in spatial index search
+    size_t m_foundItemsAdvisedEnd = 0;  // end of items passed to AdviseRead()
     bool m_queriedSpatialIndex = false;
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
@@ -127,6 +130,23 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     void readColumns();
     OGRErr readIndex();
     OGRErr readFeatureOffset(uint64_t index, uint64_t &featureOffset);
+    void adviseReadFoundItems(size_t startPos);
+
+    // Feature read ahead by GetNextArrowArray(), whose geometry is decoded
+    // in a worker thread
+    struct ArrowChunkItem
+    {
+        GIntBig fid = 0;
+        uint64_t offset = 0;  // file offset of the feature size prefix
+        size_t offsetInBuffer = 0;
+        uint32_t size = 0;
+        bool verificationFailed = false;
+        std::unique_ptr<OGRGeometry> geometry{};
+    };
+
+    OGRErr readArrowChunk(size_t maxFeatures, int nThreads,
+                          std::vector<GByte> &buffer,
+                          std::vector<ArrowChunkItem> &items);
 
     // serialize
     bool CreateFinalFile();
@@ -16,6 +16,8 @@
 #include "cpl_json.h"
 #include "cpl_http.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_p.h"
 #include "ograrrowarrayhelper.h"
 #include "ogrlayerarrow.h"
@@ -840,12 +842,14 @@ OGRErr OGRFlatGeobufLayer::readFeatureOffset(uint64_t index,
 {
     try
     {
-        const auto treeSize =
-            PackedRTree::size(m_featuresCount, m_indexNodeSize);
+        // Use the total number of features, and not m_featuresCount which
+        // is the number of features returned by a spatial index query.
+        const auto featuresCount = m_poHeader->features_count();
+        const auto treeSize = PackedRTree::size(featuresCount, m_indexNodeSize);
         const auto levelBounds =
-            PackedRTree::generateLevelBounds(m_featuresCount, m_indexNodeSize);
+            PackedRTree::generateLevelBounds(featuresCount, m_indexNodeSize);
         const auto bottomLevelOffset =
-            m_offset - treeSize +
+            m_offsetFeatures - treeSize +
             (levelBounds.front().first * sizeof(NodeItem));
         const auto nodeItemOffset =
             bottomLevelOffset + (index * sizeof(NodeItem));
@@ -867,6 +871,97 @@ OGRErr OGRFlatGeobufLayer::readFeatureOffset(uint64_t index,
     }
 }
 
+/************************************************************************/
+/*                        adviseReadFoundItems()                        */
+/************************************************************************/
+
+/** Pass to AdviseRead() the file ranges of the features found by the spatial
+ * index query, starting at position startPos, so that file systems such as
+ * /vsicurl/ fetch them with a few merged range requests, instead of one
+ * request per feature.
+ */
+void OGRFlatGeobufLayer::adviseReadFoundItems(size_t startPos)
+{
+    m_foundItemsAdvisedEnd = m_foundItems.size();
+    const size_t nLimit = m_poFp->GetAdviseReadTotalBytesLimit();
+    if (nLimit == 0)
+        return;
+
+    // Features whose start offsets are closer than that are fetched together
+    // with the features between them.
+    constexpr uint64_t MAX_DISTANCE_TO_MERGE = 64 * 1024;
+
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    size_t nTotalSize = 0;
+    size_t i = startPos;
+    while (i < m_foundItems.size())
+    {
+        size_t j = i;
+        while (j + 1 < m_foundItems.size() &&
+               m_foundItems[j + 1].offset >= m_foundItems[j].offset &&
+               m_foundItems[j + 1].offset - m_foundItems[j].offset <=
+                   MAX_DISTANCE_TO_MERGE)
+        {
+            ++j;
+        }
+
+        // Find the end offset of the last feature of the range, that is the
+        // start offset of the next feature in the file.
+        const auto &lastItem = m_foundItems[j];
+        uint64_t endOffset = 0;
+        if (j + 1 < m_foundItems.size() &&
+            m_foundItems[j + 1].index == lastItem.index + 1)
+        {
+            endOffset = m_foundItems[j + 1].offset;
+        }
+        else if (lastItem.index + 1 < m_poHeader->features_count())
+        {
+            if (readFeatureOffset(lastItem.index + 1, endOffset) !=
+                OGRERR_NONE)
+                break;
+        }
+        else
+        {
+            if (m_nFileSize == 0)
+            {
+                VSIStatBufL sStatBuf;
+                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                    m_nFileSize = sStatBuf.st_size;
+            }
+            if (m_nFileSize <= m_offsetFeatures)
+                break;
+            endOffset = m_nFileSize - m_offsetFeatures;
+        }
+        if (endOffset <= m_foundItems[i].offset ||
+            endOffset - m_foundItems[i].offset > nLimit - nTotalSize)
+        {
+            if (anOffsets.empty())
+                i = j + 1;
+            break;
+        }
+
+        const size_t nSize =
+            static_cast<size_t>(endOffset - m_foundItems[i].offset);
+        anOffsets.push_back(m_offsetFeatures + m_foundItems[i].offset);
+        anSizes.push_back(nSize);
+        nTotalSize += nSize;
+        i = j + 1;
+    }
+    m_foundItemsAdvisedEnd = i;
+
+    if (!anOffsets.empty())
+    {
+        CPLDebugOnly("FlatGeobuf",
+                     "AdviseRead() of %d ranges for features %lu to %lu",
+                     static_cast<int>(anOffsets.size()),
+                     static_cast<long unsigned int>(startPos),
+                     static_cast<long unsigned int>(i));
+        m_poFp->AdviseRead(static_cast<int>(anOffsets.size()),
+                           anOffsets.data(), anSizes.data());
+    }
+}
+
 OGRFeature *OGRFlatGeobufLayer::GetFeature(GIntBig nFeatureId)
 {
     if (m_indexNodeSize == 0)
@@ -950,6 +1045,7 @@ OGRErr OGRFlatGeobufLayer::readIndex()
             m_foundItems = PackedRTree::streamSearch(
                 featuresCount, indexNodeSize, n, readNode);
             m_featuresCount = m_foundItems.size();
+            m_foundItemsAdvisedEnd = 0;
             CPLDebugOnly("FlatGeobuf",
                          "%lu features found in spatial index search",
                          static_cast<long unsigned int>(m_featuresCount));
@@ -1070,6 +1166,8 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     auto seek = false;
     if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
     {
+        if (m_featuresPos >= m_foundItemsAdvisedEnd)
+            adviseReadFoundItems(m_featuresPos);
         const auto item = m_foundItems[m_featuresPos];
         m_offset = m_offsetFeatures + item.offset;
         fid = item.index;
@@ -1443,6 +1541,172 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                    GetArrowDecodingThreadCount()                     */
+/************************************************************************/
+
+static int GetArrowDecodingThreadCount()
+{
+    const char *pszMaxThreads =
+        CPLGetConfigOption("OGR_FLATGEOBUF_NUM_THREADS", nullptr);
+    if (pszMaxThreads == nullptr)
+        return std::min(4, CPLGetNumCPUs());
+    else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    else
+        return std::max(1, atoi(pszMaxThreads));
+}
+
+/************************************************************************/
+/*                          readArrowChunk()                            */
+/************************************************************************/
+
+/** Read up to maxFeatures features from the current position, and decode
+ * their geometry using nThreads threads.
+ *
+ * This does not update the iteration state (m_featuresPos, m_offset), which
+ * is done by the caller when consuming the items.
+ */
+OGRErr OGRFlatGeobufLayer::readArrowChunk(size_t maxFeatures, int nThreads,
+                                          std::vector<GByte> &buffer,
+                                          std::vector<ArrowChunkItem> &items)
+{
+    buffer.clear();
+    items.clear();
+
+    // Limit the amount of raw data read ahead
+    constexpr size_t MAX_CHUNK_SIZE = 64 * 1024 * 1024;
+
+    const bool useSpatialIndex =
+        m_queriedSpatialIndex && !m_ignoreSpatialFilter;
+    size_t pos = m_featuresPos;
+    uint64_t offset = m_offset;
+    bool seek = true;
+    while (items.size() < maxFeatures && buffer.size() < MAX_CHUNK_SIZE)
+    {
+        if (m_featuresCount > 0 && pos >= m_featuresCount)
+            break;
+
+        ArrowChunkItem item;
+        if (useSpatialIndex)
+        {
+            if (pos >= m_foundItemsAdvisedEnd)
+                adviseReadFoundItems(pos);
+            const auto &foundItem = m_foundItems[pos];
+            offset = m_offsetFeatures + foundItem.offset;
+            item.fid = foundItem.index;
+            seek = true;
+        }
+        else
+        {
+            item.fid = pos;
+        }
+        item.offset = offset;
+
+        if (seek && VSIFSeekL(m_poFp, offset, SEEK_SET) == -1)
+            break;
+        seek = false;
+
+        uint32_t featureSize;
+        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
+        {
+            if (VSIFEofL(m_poFp))
+                break;
+            return CPLErrorIO("reading feature size");
+        }
+        CPL_LSBPTR32(&featureSize);
+
+        // Sanity check to avoid allocated huge amount of memory on corrupted
+        // feature
+        if (featureSize > 100 * 1024 * 1024)
+        {
+            if (featureSize > feature_max_buffer_size)
+                return CPLErrorInvalidSize("feature");
+
+            if (m_nFileSize == 0)
+            {
+                VSIStatBufL sStatBuf;
+                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                {
+                    m_nFileSize = sStatBuf.st_size;
+                }
+            }
+            if (offset + featureSize > m_nFileSize)
+                return CPLErrorIO("reading feature size");
+        }
+
+        item.offsetInBuffer = buffer.size();
+        item.size = featureSize;
+        try
+        {
+            buffer.resize(buffer.size() + featureSize);
+        }
+        catch (const std::exception &)
+        {
+            return CPLErrorMemoryAllocation("feature buffer resize");
+        }
+        if (VSIFReadL(buffer.data() + item.offsetInBuffer, 1, featureSize,
+                      m_poFp) != featureSize)
+            return CPLErrorIO("reading feature");
+        offset += featureSize + sizeof(featureSize);
+        ++pos;
+        items.push_back(std::move(item));
+    }
+
+    const auto decode = [this, &buffer, &items](size_t iStart, size_t iEnd)
+    {
+        // Errors are reported by the caller
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            auto &item = items[i];
+            const GByte *data = buffer.data() + item.offsetInBuffer;
+            if (m_bVerifyBuffers)
+            {
+                Verifier v(data, item.size);
+                if (!VerifyFeatureBuffer(v))
+                {
+                    item.verificationFailed = true;
+                    continue;
+                }
+            }
+            const auto geometry = GetRoot<Feature>(data)->geometry();
+            if (geometry != nullptr)
+            {
+                auto geometryType = m_geometryType;
+                if (geometryType == GeometryType::Unknown)
+                    geometryType = geometry->type();
+                item.geometry.reset(
+                    GeometryReader(geometry, geometryType, m_hasZ, m_hasM)
+                        .read());
+            }
+        }
+    };
+
+    auto poThreadPool = nThreads > 1 && items.size() > 1
+                            ? GDALGetGlobalThreadPool(nThreads)
+                            : nullptr;
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        const size_t itemsPerJob =
+            DIV_ROUND_UP(items.size(), static_cast<size_t>(nThreads));
+        for (size_t iStart = 0; iStart < items.size(); iStart += itemsPerJob)
+        {
+            const size_t iEnd = std::min(items.size(), iStart + itemsPerJob);
+            poJobQueue->SubmitJob([&decode, iStart, iEnd]()
+                                  { decode(iStart, iEnd); });
+        }
+        poJobQueue->WaitCompletion();
+    }
+    else
+    {
+        decode(0, items.size());
+    }
+
+    return OGRERR_NONE;
+}
+
 /************************************************************************/
 /*                      GetNextArrowArray()                             */
 /************************************************************************/
@@ -1500,6 +1764,17 @@ begin:
         GAS_OPT_DATETIME_AS_STRING, false);
 
     const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    // When geometries must be decoded, read features ahead by chunks, and
+    // decode their geometries in worker threads.
+    const int nThreads = m_poFeatureDefn->IsGeometryIgnored()
+                             ? 1
+                             : GetArrowDecodingThreadCount();
+    const bool bUseChunks = nThreads > 1;
+    std::vector<GByte> abyChunkBuffer;
+    std::vector<ArrowChunkItem> aoChunkItems;
+    size_t iChunkItem = 0;
+
     while (iFeat < sHelper.m_nMaxBatchSize)
     {
         bEOFOrError = true;
@@ -1511,101 +1786,144 @@ begin:
         }
 
         GIntBig fid;
-        auto seek = false;
-        if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
+        const GByte *featureBuf = nullptr;
+        ArrowChunkItem *chunkItem = nullptr;
+        if (bUseChunks)
         {
-            const auto item = m_foundItems[m_featuresPos];
-            m_offset = m_offsetFeatures + item.offset;
-            fid = item.index;
-            seek = true;
+            if (iChunkItem == aoChunkItems.size())
+            {
+                iChunkItem = 0;
+                const size_t nMaxChunkFeatures = std::min(
+                    static_cast<size_t>(sHelper.m_nMaxBatchSize - iFeat),
+                    static_cast<size_t>(1024) * nThreads);
+                if (readArrowChunk(nMaxChunkFeatures, nThreads, abyChunkBuffer,
+                                   aoChunkItems) != OGRERR_NONE)
+                    goto error;
+                if (aoChunkItems.empty())
+                    break;
+            }
+            chunkItem = &aoChunkItems[iChunkItem];
+            fid = chunkItem->fid;
+            featureBuf = abyChunkBuffer.data() + chunkItem->offsetInBuffer;
+            m_offset = chunkItem->offset + chunkItem->size + sizeof(uint32_t);
+            if (chunkItem->verificationFailed)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Buffer verification failed");
+                goto error;
+            }
         }
         else
         {
-            fid = m_featuresPos;
-        }
-
-        if (sHelper.m_panFIDValues)
-            sHelper.m_panFIDValues[iFeat] = fid;
+            auto seek = false;
+            if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
+            {
+                if (m_featuresPos >= m_foundItemsAdvisedEnd)
+                    adviseReadFoundItems(m_featuresPos);
+                const auto item = m_foundItems[m_featuresPos];
+                m_offset = m_offsetFeatures + item.offset;
+                fid = item.index;
+                seek = true;
+            }
+            else
+            {
+                fid = m_featuresPos;
+            }
 
-        if (m_featuresPos == 0)
-            seek = true;
+            if (m_featuresPos == 0)
+                seek = true;
 
-        if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
-        {
-            break;
-        }
-        uint32_t featureSize;
-        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
-        {
-            if (VSIFEofL(m_poFp))
+            if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+            {
                 break;
-            CPLErrorIO("reading feature size");
-            goto error;
-        }
-        CPL_LSBPTR32(&featureSize);
-
-        // Sanity check to avoid allocated huge amount of memory on corrupted
-        // feature
-        if (featureSize > 100 * 1024 * 1024)
-        {
-            if (featureSize > feature_max_buffer_size)
+            }
+            uint32_t featureSize;
+            if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
             {
-                CPLErrorInvalidSize("feature");
+                if (VSIFEofL(m_poFp))
+                    break;
+                CPLErrorIO("reading feature size");
                 goto error;
             }
+            CPL_LSBPTR32(&featureSize);
 
-            if (m_nFileSize == 0)
+            // Sanity check to avoid allocated huge amount of memory on
+            // corrupted feature
+            if (featureSize > 100 * 1024 * 1024)
             {
-                VSIStatBufL sStatBuf;
-                if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                if (featureSize > feature_max_buffer_size)
                 {
-                    m_nFileSize = sStatBuf.st_size;
+                    CPLErrorInvalidSize("feature");
+                    goto error;
+                }
+
+                if (m_nFileSize == 0)
+                {
+                    VSIStatBufL sStatBuf;
+                    if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0)
+                    {
+                        m_nFileSize = sStatBuf.st_size;
+                    }
+                }
+                if (m_offset + featureSize > m_nFileSize)
+                {
+                    CPLErrorIO("reading feature size");
+                    goto error;
                 }
             }
-            if (m_offset + featureSize > m_nFileSize)
+
+            const auto err = ensureFeatureBuf(featureSize);
+            if (err != OGRERR_NONE)
+                goto error;
+            if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
             {
-                CPLErrorIO("reading feature size");
+                CPLErrorIO("reading feature");
                 goto error;
             }
-        }
-
-        const auto err = ensureFeatureBuf(featureSize);
-        if (err != OGRERR_NONE)
-            goto error;
-        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        {
-            CPLErrorIO("reading feature");
-            goto error;
-        }
-        m_offset += featureSize + sizeof(featureSize);
+            m_offset += featureSize + sizeof(featureSize);
 
-        if (m_bVerifyBuffers)
-        {
-            Verifier v(m_featureBuf, featureSize);
-            const auto ok = VerifyFeatureBuffer(v);
-            if (!ok)
+            if (m_bVerifyBuffers)
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Buffer verification failed");
-                CPLDebugOnly("FlatGeobuf", "m_offset: %lu",
-                             static_cast<long unsigned int>(m_offset));
-                CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu",
-                             static_cast<long unsigned int>(m_featuresPos));
-                CPLDebugOnly("FlatGeobuf", "featureSize: %d", featureSize);
-                goto error;
+                Verifier v(m_featureBuf, featureSize);
+                const auto ok = VerifyFeatureBuffer(v);
+                if (!ok)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Buffer verification failed");
+                    CPLDebugOnly("FlatGeobuf", "m_offset: %lu",
+                                 static_cast<long unsigned int>(m_offset));
+                    CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu",
+                                 static_cast<long unsigned int>(m_featuresPos));
+                    CPLDebugOnly("FlatGeobuf", "featureSize: %d", featureSize);
+                    goto error;
+                }
             }
+
+            featureBuf = m_featureBuf;
         }
 
-        const auto feature = GetRoot<Feature>(m_featureBuf);
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = fid;
+
+        const auto feature = GetRoot<Feature>(featureBuf);
         const auto geometry = feature->geometry();
         const auto properties = feature->properties();
         if (!m_poFeatureDefn->IsGeometryIgnored() && geometry != nullptr)
         {
-            auto geometryType = m_geometryType;
-            if (geometryType == GeometryType::Unknown)
-                geometryType = geometry->type();
-            auto poOGRGeometry = std::unique_ptr<OGRGeometry>(
-                GeometryReader(geometry, geometryType, m_hasZ, m_hasM).read());
+            std::unique_ptr<OGRGeometry> poOGRGeometry;
+            if (chunkItem)
+            {
+                poOGRGeometry = std::move(chunkItem->geometry);
+            }
+            else
+            {
+                auto geometryType = m_geometryType;
+                if (geometryType == GeometryType::Unknown)
+                    geometryType = geometry->type();
+                poOGRGeometry.reset(
+                    GeometryReader(geometry, geometryType, m_hasZ, m_hasM)
+                        .read());
+            }
             if (poOGRGeometry == nullptr)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -1989,7 +2307,11 @@ begin:
 
     end_of_loop:
 
-        if (VSIFEofL(m_poFp) || VSIFErrorL(m_poFp))
+        if (bUseChunks)
+        {
+            ++iChunkItem;
+        }
+        else if (VSIFEofL(m_poFp) || VSIFErrorL(m_poFp))
         {
             CPLDebug("FlatGeobuf", "GetNextFeature: iteration end due to EOF");
             break;
@@ -1999,6 +2321,13 @@ begin:
         bEOFOrError = false;
     }
 after_loop:
+    if (iChunkItem < aoChunkItems.size())
+    {
+        // Rewind to the first feature read ahead that has not been consumed
+        m_offset = aoChunkItems[iChunkItem].offset;
+        VSIFSeekL(m_poFp, m_offset, SEEK_SET);
+    }
+
     if (bEOFOrError)
         m_bEOF = true;
 
@@ -2451,6 +2780,7 @@ void OGRFlatGeobufLayer::ResetReading()
     m_bEOF = false;
     m_featuresPos = 0;
     m_foundItems.clear();
+    m_foundItemsAdvisedEnd = 0;
     m_featuresCount = m_poHeader ? m_poHeader->features_count() : 0;
     m_queriedSpatialIndex = false;
     m_ignoreSpatialFilter = false;
@@ -14,15 +14,20 @@
 #include "ogr_swq.h"
 #include "ogr_p.h"
 #include "ogr_gensql.h"
+#include "ogr_attrind.h"
 #include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
 #include "ogr_api.h"
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
+#include "ogrlayer_private.h"
 #include "cpl_time.h"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -605,6 +610,9 @@ void OGRGenSQLResultsLayer::ResetReading()
     m_nNextIndexFID = psSelectInfo->offset;
     m_nIteratedFeatures = -1;
     m_bEOF = false;
+
+    // Check at the next iteration whether the secondary layers have changed
+    m_bJoinHashTablesPrepared = false;
 }
 
 /************************************************************************/
@@ -1482,6 +1490,605 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                        OGRGenSQLJoinHashTable                        */
+/************************************************************************/
+
+/* Features of the secondary layer of a "primary.field = secondary.field"
+ * JOIN, indexed by the value of the join key, so that the secondary feature
+ * matching a primary feature can be found without querying the secondary
+ * layer. Features are serialized in a memory buffer, which is spilled to a
+ * temporary file once OGR_SQL_JOIN_HASH_MAX_MEMORY is reached. The index
+ * itself remains in memory.
+ */
+struct OGRGenSQLJoinHashTable
+{
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    struct Location
+    {
+        vsi_l_offset nOffset = 0;
+        size_t nSize = 0;
+    };
+
+    KeyType m_eKeyType = KeyType::INTEGER;
+    bool m_bCaseSensitive = false;
+    int m_iPrimaryField = -1;
+    int m_iSecondaryField = -1;
+    const OGRFeatureDefn *m_poSecondaryDefn = nullptr;
+
+    // State of the secondary layer when the table was built
+    GIntBig m_nLayerModificationCounter = 0;
+    GIntBig m_nLayerFeatureCount = -1;
+
+    std::unordered_map<GIntBig, Location> m_oMapInteger{};
+    std::unordered_map<double, Location> m_oMapReal{};
+    std::unordered_map<std::string, Location> m_oMapString{};
+
+    GIntBig m_nMaxMemory = 0;
+    size_t m_nIndexMemory = 0;
+    std::vector<GByte> m_abyData{};
+    std::string m_osSpillFilename{};
+    VSIVirtualHandleUniquePtr m_fpSpill{};
+    vsi_l_offset m_nSpillSize = 0;
+    std::vector<GByte> m_abyTmp{};
+
+    OGRGenSQLJoinHashTable() = default;
+    ~OGRGenSQLJoinHashTable();
+
+    static std::unique_ptr<OGRGenSQLJoinHashTable>
+    Create(const swq_join_def *psJoinInfo, const OGRFeatureDefn *poSrcDefn,
+           const OGRFeatureDefn *poJoinDefn);
+
+    bool Build(OGRLayer *poJoinLayer, GIntBig nMaxMemory);
+    bool IsUpToDate(OGRLayer *poJoinLayer) const;
+    std::unique_ptr<OGRFeature> Lookup(const OGRFeature *poSrcFeat);
+
+  private:
+    std::string GetStringKey(const OGRFeature *poFeature, int iField) const;
+    static GIntBig GetFeatureCountIfFast(OGRLayer *poJoinLayer);
+
+    bool Store(const std::vector<GByte> &abyFeature, Location &sLocation);
+    bool HasKey(const OGRFeature *poFeature, int iField) const;
+    const Location *Find(const OGRFeature *poFeature, int iField) const;
+    void Insert(const OGRFeature *poFeature, int iField,
+                const Location &sLocation);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLJoinHashTable)
+};
+
+/************************************************************************/
+/*                      ~OGRGenSQLJoinHashTable()                       */
+/************************************************************************/
+
+OGRGenSQLJoinHashTable::~OGRGenSQLJoinHashTable()
+{
+    if (m_fpSpill)
+    {
+        m_fpSpill.reset();
+        VSIUnlink(m_osSpillFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/*                                                                      */
+/*      Returns nullptr if the join expression is not a simple equality */
+/*      between compatible regular fields of the primary and secondary */
+/*      tables.                                                         */
+/************************************************************************/
+
+std::unique_ptr<OGRGenSQLJoinHashTable>
+OGRGenSQLJoinHashTable::Create(const swq_join_def *psJoinInfo,
+                               const OGRFeatureDefn *poSrcDefn,
+                               const OGRFeatureDefn *poJoinDefn)
+{
+    const swq_expr_node *poExpr = psJoinInfo->poExpr;
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nOperation != SWQ_EQ ||
+        poExpr->nSubExprCount != 2 ||
+        poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+        poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+    {
+        return nullptr;
+    }
+
+    const swq_expr_node *poPrimaryColumn = poExpr->papoSubExpr[0];
+    const swq_expr_node *poSecondaryColumn = poExpr->papoSubExpr[1];
+    if (poPrimaryColumn->table_index != 0)
+        std::swap(poPrimaryColumn, poSecondaryColumn);
+    if (poPrimaryColumn->table_index != 0 ||
+        poSecondaryColumn->table_index != psJoinInfo->secondary_table)
+    {
+        return nullptr;
+    }
+
+    // Special fields are not handled.
+    const int iPrimaryField = poPrimaryColumn->field_index;
+    const int iSecondaryField = poSecondaryColumn->field_index;
+    if (iPrimaryField < 0 || iPrimaryField >= poSrcDefn->GetFieldCount() ||
+        iSecondaryField < 0 || iSecondaryField >= poJoinDefn->GetFieldCount())
+    {
+        return nullptr;
+    }
+
+    // Only pick field types for which the comparison made by the OGR SQL
+    // engine can be emulated.
+    const auto IsInteger = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+    const auto IsNumeric = [&IsInteger](OGRFieldType eType)
+    { return IsInteger(eType) || eType == OFTReal; };
+
+    const OGRFieldType ePrimaryType =
+        poSrcDefn->GetFieldDefn(iPrimaryField)->GetType();
+    const OGRFieldType eSecondaryType =
+        poJoinDefn->GetFieldDefn(iSecondaryField)->GetType();
+    KeyType eKeyType;
+    if (IsInteger(ePrimaryType) && IsInteger(eSecondaryType))
+        eKeyType = KeyType::INTEGER;
+    else if (IsNumeric(ePrimaryType) && IsNumeric(eSecondaryType))
+        eKeyType = KeyType::REAL;
+    else if (ePrimaryType == OFTString && eSecondaryType == OFTString)
+        eKeyType = KeyType::STRING;
+    else
+        return nullptr;
+
+    auto poHashTable = std::make_unique<OGRGenSQLJoinHashTable>();
+    poHashTable->m_eKeyType = eKeyType;
+    poHashTable->m_iPrimaryField = iPrimaryField;
+    poHashTable->m_iSecondaryField = iSecondaryField;
+    poHashTable->m_poSecondaryDefn = poJoinDefn;
+    return poHashTable;
+}
+
+/************************************************************************/
+/*                               HasKey()                               */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::HasKey(const OGRFeature *poFeature,
+                                    int iField) const
+{
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+    // NaN never compares equal to anything
+    return m_eKeyType != KeyType::REAL ||
+           !std::isnan(poFeature->GetFieldAsDouble(iField));
+}
+
+/************************************************************************/
+/*                            GetStringKey()                            */
+/************************************************************************/
+
+std::string OGRGenSQLJoinHashTable::GetStringKey(const OGRFeature *poFeature,
+                                                 int iField) const
+{
+    if (m_bCaseSensitive)
+        return poFeature->GetFieldAsString(iField);
+    return CPLString(poFeature->GetFieldAsString(iField)).toupper();
+}
+
+/************************************************************************/
+/*                                Find()                                */
+/************************************************************************/
+
+const OGRGenSQLJoinHashTable::Location *
+OGRGenSQLJoinHashTable::Find(const OGRFeature *poFeature, int iField) const
+{
+    if (!HasKey(poFeature, iField))
+        return nullptr;
+
+    switch (m_eKeyType)
+    {
+        case KeyType::INTEGER:
+        {
+            const auto oIter =
+                m_oMapInteger.find(poFeature->GetFieldAsInteger64(iField));
+            return oIter == m_oMapInteger.end() ? nullptr : &(oIter->second);
+        }
+
+        case KeyType::REAL:
+        {
+            const double dfKey = poFeature->GetFieldAsDouble(iField);
+            // Normalize -0.0 to 0.0
+            const auto oIter = m_oMapReal.find(dfKey == 0 ? 0.0 : dfKey);
+            return oIter == m_oMapReal.end() ? nullptr : &(oIter->second);
+        }
+
+        case KeyType::STRING:
+        {
+            const auto oIter =
+                m_oMapString.find(GetStringKey(poFeature, iField));
+            return oIter == m_oMapString.end() ? nullptr : &(oIter->second);
+        }
+    }
+
+    return nullptr;
+}
+
+/************************************************************************/
+/*                               Insert()                               */
+/************************************************************************/
+
+void OGRGenSQLJoinHashTable::Insert(const OGRFeature *poFeature, int iField,
+                                    const Location &sLocation)
+{
+    // Rough estimate of the memory used by an entry of an unordered_map
+    constexpr size_t ENTRY_OVERHEAD = 4 * sizeof(void *);
+
+    switch (m_eKeyType)
+    {
+        case KeyType::INTEGER:
+            m_oMapInteger[poFeature->GetFieldAsInteger64(iField)] = sLocation;
+            m_nIndexMemory +=
+                ENTRY_OVERHEAD + sizeof(GIntBig) + sizeof(Location);
+            break;
+
+        case KeyType::REAL:
+        {
+            const double dfKey = poFeature->GetFieldAsDouble(iField);
+            m_oMapReal[dfKey == 0 ? 0.0 : dfKey] = sLocation;
+            m_nIndexMemory +=
+                ENTRY_OVERHEAD + sizeof(double) + sizeof(Location);
+            break;
+        }
+
+        case KeyType::STRING:
+        {
+            std::string osKey = GetStringKey(poFeature, iField);
+            m_nIndexMemory += ENTRY_OVERHEAD + sizeof(std::string) +
+                              osKey.size() + sizeof(Location);
+            m_oMapString[std::move(osKey)] = sLocation;
+            break;
+        }
+    }
+}
+
+/************************************************************************/
+/*                               Store()                                */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::Store(const std::vector<GByte> &abyFeature,
+                                   Location &sLocation)
+{
+    if (!m_fpSpill &&
+        static_cast<GIntBig>(m_nIndexMemory + m_abyData.size() +
+                             abyFeature.size()) > m_nMaxMemory)
+    {
+        m_osSpillFilename = CPLGenerateTempFilenameSafe("ogr_sql_join");
+        m_fpSpill.reset(VSIFOpenL(m_osSpillFilename.c_str(), "wb+"));
+        if (!m_fpSpill)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     m_osSpillFilename.c_str());
+            return false;
+        }
+        CPLDebug("GenSQL", "Spilling JOIN hash table to %s",
+                 m_osSpillFilename.c_str());
+        if (!m_abyData.empty() &&
+            m_fpSpill->Write(m_abyData.data(), m_abyData.size(), 1) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write to %s",
+                     m_osSpillFilename.c_str());
+            return false;
+        }
+        m_nSpillSize = m_abyData.size();
+        m_abyData.clear();
+        m_abyData.shrink_to_fit();
+    }
+
+    sLocation.nSize = abyFeature.size();
+    if (m_fpSpill)
+    {
+        sLocation.nOffset = m_nSpillSize;
+        if (m_fpSpill->Seek(m_nSpillSize, SEEK_SET) != 0 ||
+            m_fpSpill->Write(abyFeature.data(), abyFeature.size(), 1) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write to %s",
+                     m_osSpillFilename.c_str());
+            return false;
+        }
+        m_nSpillSize += abyFeature.size();
+    }
+    else
+    {
+        sLocation.nOffset = m_abyData.size();
+        m_abyData.insert(m_abyData.end(), abyFeature.begin(),
+                         abyFeature.end());
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::Build(OGRLayer *poJoinLayer, GIntBig nMaxMemory)
+{
+    m_nMaxMemory = nMaxMemory;
+
+    poJoinLayer->SetAttributeFilter("");
+    poJoinLayer->ResetReading();
+    m_nLayerModificationCounter =
+        poJoinLayer->m_poPrivate->m_nModificationCounter;
+    m_nLayerFeatureCount = GetFeatureCountIfFast(poJoinLayer);
+
+    bool bRet = true;
+    std::vector<GByte> abyFeature;
+    while (auto poFeature =
+               std::unique_ptr<OGRFeature>(poJoinLayer->GetNextFeature()))
+    {
+        // Only the first matching secondary feature is used
+        if (!HasKey(poFeature.get(), m_iSecondaryField) ||
+            Find(poFeature.get(), m_iSecondaryField) != nullptr)
+        {
+            continue;
+        }
+
+        Location sLocation;
+        if (!poFeature->SerializeToBinary(abyFeature) ||
+            !Store(abyFeature, sLocation))
+        {
+            bRet = false;
+            break;
+        }
+        Insert(poFeature.get(), m_iSecondaryField, sLocation);
+    }
+
+    poJoinLayer->ResetReading();
+    return bRet;
+}
+
+/************************************************************************/
+/*                       GetFeatureCountIfFast()                        */
+/************************************************************************/
+
+GIntBig OGRGenSQLJoinHashTable::GetFeatureCountIfFast(OGRLayer *poJoinLayer)
+{
+    return poJoinLayer->TestCapability(OLCFastFeatureCount)
+               ? poJoinLayer->GetFeatureCount(FALSE)
+               : -1;
+}
+
+/************************************************************************/
+/*                             IsUpToDate()                             */
+/*                                                                      */
+/*      Features created or updated through the OGRLayer API are        */
+/*      detected with the modification counter of the layer, and        */
+/*      deleted ones with its feature count, when it is cheap to get.   */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::IsUpToDate(OGRLayer *poJoinLayer) const
+{
+    if (poJoinLayer->m_poPrivate->m_nModificationCounter !=
+        m_nLayerModificationCounter)
+    {
+        return false;
+    }
+    poJoinLayer->SetAttributeFilter("");
+    return GetFeatureCountIfFast(poJoinLayer) == m_nLayerFeatureCount;
+}
+
+/************************************************************************/
+/*                               Lookup()                               */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLJoinHashTable::Lookup(const OGRFeature *poSrcFeat)
+{
+    const Location *psLocation = Find(poSrcFeat, m_iPrimaryField);
+    if (psLocation == nullptr)
+        return nullptr;
+
+    const GByte *pabyFeature;
+    if (m_fpSpill)
+    {
+        m_abyTmp.resize(psLocation->nSize);
+        if (m_fpSpill->Seek(psLocation->nOffset, SEEK_SET) != 0 ||
+            m_fpSpill->Read(m_abyTmp.data(), m_abyTmp.size(), 1) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+                     m_osSpillFilename.c_str());
+            return nullptr;
+        }
+        pabyFeature = m_abyTmp.data();
+    }
+    else
+    {
+        pabyFeature = m_abyData.data() + psLocation->nOffset;
+    }
+
+    auto poFeature = std::make_unique<OGRFeature>(m_poSecondaryDefn);
+    if (!poFeature->DeserializeFromBinary(pabyFeature, psLocation->nSize))
+        return nullptr;
+    return poFeature;
+}
+
+/************************************************************************/
+/*                        HasNativeSQLEngine()                          */
+/*                                                                      */
+/*      Whether the attribute filters of the layer are translated to    */
+/*      the SQL dialect of a database, which may use its own indexes.   */
+/************************************************************************/
+
+static bool HasNativeSQLEngine(OGRLayer *poLayer)
+{
+    GDALDataset *poDS = poLayer->GetDataset();
+    GDALDriver *poDriver = poDS ? poDS->GetDriver() : nullptr;
+    if (poDriver == nullptr)
+        return false;
+    if (EQUAL(poDriver->GetDescription(), "SQLite"))
+        return true;
+    const CPLStringList aosDialects(CSLTokenizeString(
+        poDriver->GetMetadataItem(GDAL_DMD_SUPPORTED_SQL_DIALECTS)));
+    return aosDialects.FindString("NATIVE") >= 0;
+}
+
+/************************************************************************/
+/*                     IsJoinFilterCaseSensitive()                      */
+/*                                                                      */
+/*      Whether the attribute filter that GetFilterForJoin() builds     */
+/*      compares strings case-sensitively. This depends on the driver   */
+/*      of the secondary layer: the OGR SQL engine compares them        */
+/*      case-insensitively, while most databases do not. This is found  */
+/*      out by querying the secondary layer once, with a value of the   */
+/*      join key whose letters have their case swapped.                 */
+/************************************************************************/
+
+static bool IsJoinFilterCaseSensitive(const swq_join_def *psJoinInfo,
+                                      OGRLayer *poSrcLayer,
+                                      OGRLayer *poJoinLayer,
+                                      int iPrimaryField, int iSecondaryField)
+{
+    std::string osValue;
+    poJoinLayer->SetAttributeFilter("");
+    poJoinLayer->ResetReading();
+    while (auto poFeature =
+               std::unique_ptr<OGRFeature>(poJoinLayer->GetNextFeature()))
+    {
+        if (!poFeature->IsFieldSetAndNotNull(iSecondaryField))
+            continue;
+        const char *pszValue = poFeature->GetFieldAsString(iSecondaryField);
+        const auto IsLetter = [](char ch)
+        { return isalpha(static_cast<unsigned char>(ch)) != 0; };
+        if (std::any_of(pszValue, pszValue + strlen(pszValue), IsLetter))
+        {
+            osValue = pszValue;
+            break;
+        }
+    }
+    // No value with a letter: case sensitivity does not matter
+    if (osValue.empty())
+        return true;
+
+    std::string osSwapped(osValue);
+    for (char &ch : osSwapped)
+    {
+        const int nCh = static_cast<unsigned char>(ch);
+        if (islower(nCh))
+            ch = static_cast<char>(toupper(nCh));
+        else if (isupper(nCh))
+            ch = static_cast<char>(tolower(nCh));
+    }
+
+    OGRFeature oProbeFeature(poSrcLayer->GetLayerDefn());
+    oProbeFeature.SetField(iPrimaryField, osSwapped.c_str());
+    const std::string osFilter =
+        GetFilterForJoin(psJoinInfo->poExpr, &oProbeFeature, poJoinLayer,
+                         psJoinInfo->secondary_table);
+
+    bool bCaseSensitive = true;
+    poJoinLayer->ResetReading();
+    if (!osFilter.empty() &&
+        poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE)
+    {
+        while (auto poFeature =
+                   std::unique_ptr<OGRFeature>(poJoinLayer->GetNextFeature()))
+        {
+            if (strcmp(poFeature->GetFieldAsString(iSecondaryField),
+                       osSwapped.c_str()) != 0)
+            {
+                bCaseSensitive = false;
+                break;
+            }
+        }
+    }
+    poJoinLayer->SetAttributeFilter("");
+    poJoinLayer->ResetReading();
+    return bCaseSensitive;
+}
+
+/************************************************************************/
+/*                       PrepareJoinHashTables()                        */
+/*                                                                      */
+/*      Decide for each JOIN whether it is evaluated with a hash table  */
+/*      of the secondary layer, or by querying the secondary layer with */
+/*      an attribute filter for each primary feature. Hash tables are   */
+/*      kept from one iteration to the next, unless the secondary layer */
+/*      has changed.                                                    */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::PrepareJoinHashTables()
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+
+    m_bJoinHashTablesPrepared = true;
+    m_apoJoinHashTables.resize(psSelectInfo->join_count);
+
+    const char *pszJoinHash = CPLGetConfigOption("OGR_SQL_JOIN_HASH", "AUTO");
+    const bool bAuto = EQUAL(pszJoinHash, "AUTO");
+    GIntBig nMaxMemory = 0;
+    if ((!bAuto && !CPLTestBool(pszJoinHash)) ||
+        CPLParseMemorySize(
+            CPLGetConfigOption("OGR_SQL_JOIN_HASH_MAX_MEMORY", "10%"),
+            &nMaxMemory, nullptr) != CE_None)
+    {
+        for (auto &poHashTable : m_apoJoinHashTables)
+            poHashTable.reset();
+        return;
+    }
+
+    const OGRFeatureDefn *poSrcDefn = m_poSrcLayer->GetLayerDefn();
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+
+        if (m_apoJoinHashTables[iJoin])
+        {
+            if (m_apoJoinHashTables[iJoin]->IsUpToDate(poJoinLayer))
+                continue;
+            CPLDebug("GenSQL", "Layer '%s' has changed: rebuilding hash join",
+                     poJoinLayer->GetName());
+            m_apoJoinHashTables[iJoin].reset();
+        }
+
+        // Reading the whole secondary layer would disturb the reading of
+        // the primary one in a self-join.
+        if (poJoinLayer == m_poSrcLayer)
+            continue;
+
+        auto poHashTable = OGRGenSQLJoinHashTable::Create(
+            psJoinInfo, poSrcDefn, poJoinLayer->GetLayerDefn());
+        if (!poHashTable)
+            continue;
+
+        if (bAuto)
+        {
+            // An attribute index makes the per-feature queries cheap.
+            OGRLayerAttrIndex *poAttrIndex = poJoinLayer->GetIndex();
+            if (poAttrIndex != nullptr &&
+                poAttrIndex->GetFieldIndex(poHashTable->m_iSecondaryField) !=
+                    nullptr)
+            {
+                continue;
+            }
+
+            // So do the indexes of a database, which cannot be detected
+            // in a generic way, so leave the queries to it.
+            if (HasNativeSQLEngine(poJoinLayer))
+                continue;
+        }
+
+        if (poHashTable->m_eKeyType == OGRGenSQLJoinHashTable::KeyType::STRING)
+        {
+            poHashTable->m_bCaseSensitive = IsJoinFilterCaseSensitive(
+                psJoinInfo, m_poSrcLayer, poJoinLayer,
+                poHashTable->m_iPrimaryField, poHashTable->m_iSecondaryField);
+        }
+
+        if (poHashTable->Build(poJoinLayer, nMaxMemory))
+        {
+            CPLDebug("GenSQL", "Using hash join on layer '%s'",
+                     poJoinLayer->GetName());
+            m_apoJoinHashTables[iJoin] = std::move(poHashTable);
+        }
+    }
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1501,6 +2108,9 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
     apoFeatures.push_back(std::move(poSrcFeatUniquePtr));
     auto poSrcFeat = apoFeatures.front().get();
 
+    if (psSelectInfo->join_count > 0 && !m_bJoinHashTablesPrepared)
+        PrepareJoinHashTables();
+
     /* -------------------------------------------------------------------- */
     /*      Fetch the corresponding features from any jointed tables.       */
     /* -------------------------------------------------------------------- */
@@ -1513,6 +2123,13 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        if (m_apoJoinHashTables[iJoin])
+        {
+            apoFeatures.push_back(
+                m_apoJoinHashTables[iJoin]->Lookup(poSrcFeat));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
@@ -2867,7 +3484,10 @@ struct OGRGenSQLResultsLayerArrowStreamPrivateData
 bool OGRGenSQLResultsLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
                                            CSLConstList papszOptions)
 {
+    bool bGeoArrowInterleaved = false;
     if (!TestCapability(OLCFastGetArrowStream) ||
+        OGRIsGeoArrowGeometryEncodingRequested(papszOptions,
+                                               bGeoArrowInterleaved) ||
         CPLTestBool(CPLGetConfigOption("OGR_GENSQL_STREAM_BASE_IMPL", "NO")))
     {
         CPLStringList aosOptions(papszOptions);
@@ -19,6 +19,7 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -39,6 +40,7 @@
 /************************************************************************/
 
 class swq_select;
+struct OGRGenSQLJoinHashTable;
 
 class OGRGenSQLResultsLayer final : public OGRLayer
 {
@@ -73,9 +75,15 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // One entry per JOIN. nullptr when the join is evaluated by querying
+    // the secondary layer for each primary feature.
+    std::vector<std::unique_ptr<OGRGenSQLJoinHashTable>> m_apoJoinHashTables{};
+    bool m_bJoinHashTablesPrepared = false;
+
     bool PrepareSummary() const;
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
+    void PrepareJoinHashTables();
     void CreateOrderByIndex();
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
@@ -956,6 +956,7 @@ OGRErr OGRLayer::SetFeature(OGRFeature *poFeature)
 
 {
     ConvertGeomsIfNecessary(poFeature);
+    ++m_poPrivate->m_nModificationCounter;
     return ISetFeature(poFeature);
 }
 
@@ -996,6 +997,7 @@ OGRErr OGRLayer::CreateFeature(OGRFeature *poFeature)
 
 {
     ConvertGeomsIfNecessary(poFeature);
+    ++m_poPrivate->m_nModificationCounter;
     return ICreateFeature(poFeature);
 }
 
@@ -1036,6 +1038,7 @@ OGRErr OGRLayer::UpsertFeature(OGRFeature *poFeature)
 
 {
     ConvertGeomsIfNecessary(poFeature);
+    ++m_poPrivate->m_nModificationCounter;
     return IUpsertFeature(poFeature);
 }
 
@@ -1079,6 +1082,7 @@ OGRErr OGRLayer::UpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
 
 {
     ConvertGeomsIfNecessary(poFeature);
+    ++m_poPrivate->m_nModificationCounter;
     const int nFieldCount = GetLayerDefn()->GetFieldCount();
     for (int i = 0; i < nUpdatedFieldsCount; ++i)
     {
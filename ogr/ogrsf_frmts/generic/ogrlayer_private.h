@@ -40,6 +40,11 @@ struct OGRLayer::Private
 
     //! Whether OGRGeometry::SetPrecision() should be applied. Only valid after ConvertGeomsIfNecessary() has been called.
     bool m_bApplyGeomSetPrecision = false;
+
+    //! Incremented each time a feature is created or updated through the
+    //! OGRLayer API. Used by OGRGenSQLResultsLayer to detect changes of the
+    //! secondary layers of a JOIN.
+    GIntBig m_nModificationCounter = 0;
 };
 
 //! @endcond
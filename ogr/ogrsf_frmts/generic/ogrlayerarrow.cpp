@@ -711,62 +711,50 @@ int OGRLayer::GetArrowSchema(struct ArrowArrayStream *,
 }
 
 /************************************************************************/
-/*                  CreateSchemaForWKBGeometryColumn()                  */
+/*                    GetGeoArrowExtensionMetadata()                    */
 /************************************************************************/
 
-/** Return a ArrowSchema* corresponding to the WKB encoding of a geometry
- * column.
+/** Return the value of ARROW:extension:metadata for a GeoArrow geometry
+ * column, that is {"crs": PROJJSON} or an empty string if the field has no
+ * CRS.
  */
-
-/* static */
-struct ArrowSchema *
-OGRLayer::CreateSchemaForWKBGeometryColumn(const OGRGeomFieldDefn *poFieldDefn,
-                                           const char *pszArrowFormat,
-                                           const char *pszExtensionName)
+static std::string
+GetGeoArrowExtensionMetadata(const OGRGeomFieldDefn *poFieldDefn)
 {
-    CPLAssert(strcmp(pszArrowFormat, "z") == 0 ||
-              strcmp(pszArrowFormat, "Z") == 0);
-    if (!EQUAL(pszExtensionName, EXTENSION_NAME_OGC_WKB) &&
-        !EQUAL(pszExtensionName, EXTENSION_NAME_GEOARROW_WKB))
-    {
-        CPLError(CE_Failure, CPLE_NotSupported,
-                 "Unsupported extension name '%s'. Defaulting to '%s'",
-                 pszExtensionName, EXTENSION_NAME_OGC_WKB);
-        pszExtensionName = EXTENSION_NAME_OGC_WKB;
-    }
-    auto psSchema = static_cast<struct ArrowSchema *>(
-        CPLCalloc(1, sizeof(struct ArrowSchema)));
-    psSchema->release = OGRLayer::ReleaseSchema;
-    const char *pszGeomFieldName = poFieldDefn->GetNameRef();
-    if (pszGeomFieldName[0] == '\0')
-        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
-    psSchema->name = CPLStrdup(pszGeomFieldName);
-    if (poFieldDefn->IsNullable())
-        psSchema->flags = ARROW_FLAG_NULLABLE;
-    psSchema->format = strcmp(pszArrowFormat, "z") == 0 ? "z" : "Z";
     std::string osExtensionMetadata;
-    if (EQUAL(pszExtensionName, EXTENSION_NAME_GEOARROW_WKB))
+    const auto poSRS = poFieldDefn->GetSpatialRef();
+    if (poSRS)
     {
-        const auto poSRS = poFieldDefn->GetSpatialRef();
-        if (poSRS)
+        char *pszPROJJSON = nullptr;
+        poSRS->exportToPROJJSON(&pszPROJJSON, nullptr);
+        if (pszPROJJSON)
         {
-            char *pszPROJJSON = nullptr;
-            poSRS->exportToPROJJSON(&pszPROJJSON, nullptr);
-            if (pszPROJJSON)
-            {
-                osExtensionMetadata = "{\"crs\":";
-                osExtensionMetadata += pszPROJJSON;
-                osExtensionMetadata += '}';
-                CPLFree(pszPROJJSON);
-            }
-            else
-            {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "Cannot export CRS of geometry field %s to PROJJSON",
-                         poFieldDefn->GetNameRef());
-            }
+            osExtensionMetadata = "{\"crs\":";
+            osExtensionMetadata += pszPROJJSON;
+            osExtensionMetadata += '}';
+            CPLFree(pszPROJJSON);
+        }
+        else
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Cannot export CRS of geometry field %s to PROJJSON",
+                     poFieldDefn->GetNameRef());
         }
     }
+    return osExtensionMetadata;
+}
+
+/************************************************************************/
+/*                      CreateExtensionMetadata()                       */
+/************************************************************************/
+
+/** Return the ArrowSchema::metadata of a geometry column, with
+ * ARROW:extension:name and, if not empty, ARROW:extension:metadata.
+ * The returned value must be freed with CPLFree().
+ */
+static char *CreateExtensionMetadata(const char *pszExtensionName,
+                                     const std::string &osExtensionMetadata)
+{
     size_t nLen = sizeof(int32_t) + sizeof(int32_t) +
                   strlen(ARROW_EXTENSION_NAME_KEY) + sizeof(int32_t) +
                   strlen(pszExtensionName);
@@ -776,7 +764,6 @@ OGRLayer::CreateSchemaForWKBGeometryColumn(const OGRGeomFieldDefn *poFieldDefn,
                 sizeof(int32_t) + osExtensionMetadata.size();
     }
     char *pszMetadata = static_cast<char *>(CPLMalloc(nLen));
-    psSchema->metadata = pszMetadata;
     size_t offsetMD = 0;
     *reinterpret_cast<int32_t *>(pszMetadata + offsetMD) =
         osExtensionMetadata.empty() ? 1 : 2;
@@ -809,6 +796,50 @@ OGRLayer::CreateSchemaForWKBGeometryColumn(const OGRGeomFieldDefn *poFieldDefn,
     }
     CPLAssert(offsetMD == nLen);
     CPL_IGNORE_RET_VAL(offsetMD);
+    return pszMetadata;
+}
+
+/************************************************************************/
+/*                  CreateSchemaForWKBGeometryColumn()                  */
+/************************************************************************/
+
+/** Return a ArrowSchema* corresponding to the WKB encoding of a geometry
+ * column.
+ */
+
+/* static */
+struct ArrowSchema *
+OGRLayer::CreateSchemaForWKBGeometryColumn(const OGRGeomFieldDefn *poFieldDefn,
+                                           const char *pszArrowFormat,
+                                           const char *pszExtensionName)
+{
+    CPLAssert(strcmp(pszArrowFormat, "z") == 0 ||
+              strcmp(pszArrowFormat, "Z") == 0);
+    if (!EQUAL(pszExtensionName, EXTENSION_NAME_OGC_WKB) &&
+        !EQUAL(pszExtensionName, EXTENSION_NAME_GEOARROW_WKB))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported extension name '%s'. Defaulting to '%s'",
+                 pszExtensionName, EXTENSION_NAME_OGC_WKB);
+        pszExtensionName = EXTENSION_NAME_OGC_WKB;
+    }
+    auto psSchema = static_cast<struct ArrowSchema *>(
+        CPLCalloc(1, sizeof(struct ArrowSchema)));
+    psSchema->release = OGRLayer::ReleaseSchema;
+    const char *pszGeomFieldName = poFieldDefn->GetNameRef();
+    if (pszGeomFieldName[0] == '\0')
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+    psSchema->name = CPLStrdup(pszGeomFieldName);
+    if (poFieldDefn->IsNullable())
+        psSchema->flags = ARROW_FLAG_NULLABLE;
+    psSchema->format = strcmp(pszArrowFormat, "z") == 0 ? "z" : "Z";
+    std::string osExtensionMetadata;
+    if (EQUAL(pszExtensionName, EXTENSION_NAME_GEOARROW_WKB))
+    {
+        osExtensionMetadata = GetGeoArrowExtensionMetadata(poFieldDefn);
+    }
+    psSchema->metadata =
+        CreateExtensionMetadata(pszExtensionName, osExtensionMetadata);
     return psSchema;
 }
 
@@ -835,7 +866,13 @@ int OGRLayer::StaticGetArrowSchema(struct ArrowArrayStream *stream,
                  "Calling get_schema() on a freed OGRLayer is not supported");
         return EINVAL;
     }
-    return poLayer->GetArrowSchema(stream, out_schema);
+    const int ret = poLayer->GetArrowSchema(stream, out_schema);
+    if (ret == 0 && !poLayer->ConvertArrowSchemaToGeoArrow(out_schema))
+    {
+        out_schema->release(out_schema);
+        return EIO;
+    }
+    return ret;
 }
 
 /************************************************************************/
@@ -2392,9 +2429,169 @@ int OGRLayer::StaticGetNextArrowArray(struct ArrowArrayStream *stream,
                  "Calling get_next() on a freed OGRLayer is not supported");
         return EINVAL;
     }
-    return poLayer->GetNextArrowArray(stream, out_array);
+    const int ret = poLayer->GetNextArrowArray(stream, out_array);
+    if (ret == 0 && out_array->release &&
+        !poLayer->ConvertArrowArrayToGeoArrow(stream, out_array))
+    {
+        out_array->release(out_array);
+        return EIO;
+    }
+    return ret;
+}
+
+/************************************************************************/
+/*                         GetGeoArrowColumns()                         */
+/************************************************************************/
+
+/** Return the (Arrow column index, OGR geometry field index) of the WKB
+ * columns of schema that must be converted to GeoArrow.
+ */
+static std::vector<std::pair<int, int>>
+GetGeoArrowColumns(const OGRFeatureDefn *poLayerDefn,
+                   const struct ArrowSchema *schema)
+{
+    std::vector<std::pair<int, int>> anRet;
+    const int nGeomFieldCount = poLayerDefn->GetGeomFieldCount();
+    for (int i = 0; i < nGeomFieldCount; ++i)
+    {
+        const auto poGeomFieldDefn = poLayerDefn->GetGeomFieldDefn(i);
+        if (poGeomFieldDefn->IsIgnored() ||
+            !OGRGeoArrowIsSupportedGeometryType(poGeomFieldDefn->GetType()))
+        {
+            continue;
+        }
+        // Columns already in a native encoding, as returned by the
+        // Arrow/Parquet drivers, are not found here and are left unchanged.
+        const int iCol =
+            OGRArrowGetWKBColumnIndex(schema, poGeomFieldDefn->GetNameRef());
+        if (iCol >= 0)
+            anRet.emplace_back(iCol, i);
+    }
+    return anRet;
+}
+
+/************************************************************************/
+/*                   ConvertArrowSchemaToGeoArrow()                     */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Replace in schema the WKB geometry columns by GeoArrow native ones,
+ * if required by the GEOMETRY_ENCODING option of GetArrowStream().
+ */
+bool OGRLayer::ConvertArrowSchemaToGeoArrow(struct ArrowSchema *schema)
+{
+    bool bInterleaved = false;
+    if (!OGRIsGeoArrowGeometryEncodingRequested(
+            m_aosArrowArrayStreamOptions.List(), bInterleaved))
+    {
+        return true;
+    }
+
+    const auto poLayerDefn = GetLayerDefn();
+    auto &poShared = m_poSharedArrowArrayStreamPrivateData;
+    if (!poShared->m_psWKBSchema)
+    {
+        auto psWKBSchema = static_cast<struct ArrowSchema *>(
+            CPLCalloc(1, sizeof(struct ArrowSchema)));
+        if (!OGRCloneArrowSchema(schema, psWKBSchema))
+        {
+            CPLFree(psWKBSchema);
+            return false;
+        }
+        poShared->m_psWKBSchema = psWKBSchema;
+        poShared->m_anGeoArrowColumns = GetGeoArrowColumns(poLayerDefn, schema);
+    }
+
+    for (const auto &[iCol, iGeomField] : poShared->m_anGeoArrowColumns)
+    {
+        const auto poGeomFieldDefn = poLayerDefn->GetGeomFieldDefn(iGeomField);
+        auto psOldSchema = schema->children[iCol];
+        auto psNewSchema = OGRCreateGeoArrowSchema(
+            psOldSchema->name, poGeomFieldDefn->GetType(), bInterleaved,
+            (psOldSchema->flags & ARROW_FLAG_NULLABLE) != 0,
+            GetGeoArrowExtensionMetadata(poGeomFieldDefn));
+        psOldSchema->release(psOldSchema);
+        memcpy(psOldSchema, psNewSchema, sizeof(*psNewSchema));
+        CPLFree(psNewSchema);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    ConvertArrowArrayToGeoArrow()                     */
+/************************************************************************/
+
+/** Replace in array the WKB geometry columns by GeoArrow native ones,
+ * if required by the GEOMETRY_ENCODING option of GetArrowStream().
+ */
+bool OGRLayer::ConvertArrowArrayToGeoArrow(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *array)
+{
+    bool bInterleaved = false;
+    if (!OGRIsGeoArrowGeometryEncodingRequested(
+            m_aosArrowArrayStreamOptions.List(), bInterleaved))
+    {
+        return true;
+    }
+
+    auto &poShared = m_poSharedArrowArrayStreamPrivateData;
+    if (!poShared->m_psWKBSchema)
+    {
+        // get_schema() has not been called yet: the WKB schema is needed
+        // by OGRArrowWKBColumnToGeoArrow()
+        auto psWKBSchema = static_cast<struct ArrowSchema *>(
+            CPLCalloc(1, sizeof(struct ArrowSchema)));
+        if (GetArrowSchema(stream, psWKBSchema) != 0)
+        {
+            CPLFree(psWKBSchema);
+            return false;
+        }
+        poShared->m_psWKBSchema = psWKBSchema;
+        poShared->m_anGeoArrowColumns =
+            GetGeoArrowColumns(GetLayerDefn(), psWKBSchema);
+    }
+
+    const auto poLayerDefn = GetLayerDefn();
+    for (const auto &[iCol, iGeomField] : poShared->m_anGeoArrowColumns)
+    {
+        if (!OGRArrowWKBColumnToGeoArrow(
+                poShared->m_psWKBSchema, array, iCol,
+                poLayerDefn->GetGeomFieldDefn(iGeomField)->GetType(),
+                bInterleaved))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   ~ArrowArrayStreamPrivateData()                     */
+/************************************************************************/
+
+OGRLayer::ArrowArrayStreamPrivateData::~ArrowArrayStreamPrivateData()
+{
+    ResetGeoArrowColumns();
+}
+
+/************************************************************************/
+/*                        ResetGeoArrowColumns()                        */
+/************************************************************************/
+
+void OGRLayer::ArrowArrayStreamPrivateData::ResetGeoArrowColumns()
+{
+    if (m_psWKBSchema)
+    {
+        if (m_psWKBSchema->release)
+            m_psWKBSchema->release(m_psWKBSchema);
+        CPLFree(m_psWKBSchema);
+        m_psWKBSchema = nullptr;
+    }
+    m_anGeoArrowColumns.clear();
 }
 
+//! @endcond
+
 /************************************************************************/
 /*                            ReleaseStream()                           */
 /************************************************************************/
@@ -2565,6 +2762,21 @@ From OGR using the Arrow C Stream data interface</a> tutorial.
  *     ARROW:extension:name=geoarrow.wkb and
  *     ARROW:extension:metadata={"crs": &lt;projjson CRS representation>&gt; are set.
  * </li>
+ * <li>GEOMETRY_ENCODING=GEOARROW/GEOARROW_INTERLEAVED (GDAL >= 3.12).
+ *     Return geometry fields of type Point, LineString, Polygon, MultiPoint,
+ *     MultiLineString and MultiPolygon (possibly with Z and/or M) using the
+ *     native GeoArrow encoding (geoarrow.point, etc. extensions), with
+ *     coordinates stored as a struct of x/y/z/m arrays (GEOARROW) or as a
+ *     fixed size list of interleaved values (GEOARROW_INTERLEAVED).
+ *     Single geometries found in a multi geometry field are promoted, and
+ *     multi geometries with a single part found in a single geometry field
+ *     are demoted. Other geometries that cannot be represented without loss
+ *     of information, such as multi geometries with several parts in a
+ *     single geometry field, are returned as null, with a warning. Z/M
+ *     values not in the geometry type of the field are discarded, with a
+ *     warning.
+ *     Fields of other geometry types are returned as WKB.
+ * </li>
  * </ul>
  *
  * The Arrow/Parquet drivers recognize the following option:
@@ -2607,6 +2819,7 @@ bool OGRLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
         m_poSharedArrowArrayStreamPrivateData->m_poLayer = this;
     }
     m_poSharedArrowArrayStreamPrivateData->m_bArrowArrayStreamInProgress = true;
+    m_poSharedArrowArrayStreamPrivateData->ResetGeoArrowColumns();
 
     // Special case for "FID = constant", or "FID IN (constant1, ...., constantN)"
     m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.clear();
@@ -2771,6 +2984,21 @@ YES.</li>
  *     ARROW:extension:name=geoarrow.wkb and
  *     ARROW:extension:metadata={"crs": &lt;projjson CRS representation>&gt; are set.
  * </li>
+ * <li>GEOMETRY_ENCODING=GEOARROW/GEOARROW_INTERLEAVED (GDAL >= 3.12).
+ *     Return geometry fields of type Point, LineString, Polygon, MultiPoint,
+ *     MultiLineString and MultiPolygon (possibly with Z and/or M) using the
+ *     native GeoArrow encoding (geoarrow.point, etc. extensions), with
+ *     coordinates stored as a struct of x/y/z/m arrays (GEOARROW) or as a
+ *     fixed size list of interleaved values (GEOARROW_INTERLEAVED).
+ *     Single geometries found in a multi geometry field are promoted, and
+ *     multi geometries with a single part found in a single geometry field
+ *     are demoted. Other geometries that cannot be represented without loss
+ *     of information, such as multi geometries with several parts in a
+ *     single geometry field, are returned as null, with a warning. Z/M
+ *     values not in the geometry type of the field are discarded, with a
+ *     warning.
+ *     Fields of other geometry types are returned as WKB.
+ * </li>
  * </ul>
  *
  * The Arrow/Parquet drivers recognize the following option:
@@ -4853,6 +5081,16 @@ static size_t FillValidityArrayFromAttrQuery(
     const struct ArrowSchema *schema, struct ArrowArray *array,
     std::vector<bool> &abyValidityFromFilters, CSLConstList papszOptions)
 {
+    // Column-wise evaluation, when the query only consists of simple
+    // predicates on top-level columns.
+    if (poAttrQuery->EvaluateOnArrowArray(schema, array,
+                                          abyValidityFromFilters))
+    {
+        return static_cast<size_t>(std::count(abyValidityFromFilters.begin(),
+                                              abyValidityFromFilters.end(),
+                                              true));
+    }
+
     size_t nCountIntersecting = 0;
     auto poFeatureDefn = const_cast<OGRLayer *>(poLayer)->GetLayerDefn();
     OGRFeature oFeature(poFeatureDefn);
@@ -5329,74 +5567,1612 @@ void OGRLayer::PostFilterArrowArray(const struct ArrowSchema *schema,
 }
 
 /************************************************************************/
-/*                          OGRCloneArrowArray                          */
+/*                        OGRCompactArrowArray()                        */
 /************************************************************************/
 
-static bool OGRCloneArrowArray(const struct ArrowSchema *schema,
-                               const struct ArrowArray *src_array,
-                               struct ArrowArray *out_array,
-                               size_t nParentOffset)
-{
-    memset(out_array, 0, sizeof(*out_array));
-    const size_t nLength =
-        static_cast<size_t>(src_array->length) - nParentOffset;
-    out_array->length = nLength;
-    out_array->null_count = src_array->null_count;
-    out_array->release = OGRLayerDefaultReleaseArray;
+/** Remove the rows of a struct array for which abyKeep[] is false.
+ *
+ * The buffers of the array are modified in place, so this must only be used
+ * on an array owned by the caller, typically one returned by
+ * OGRCloneArrowArray().
+ *
+ * @param schema Schema of the array.
+ * @param array Array to compact. Released in case of error.
+ * @param abyKeep Array of array->length values.
+ * @return true in case of success.
+ */
+bool OGRCompactArrowArray(const struct ArrowSchema *schema,
+                          struct ArrowArray *array,
+                          const std::vector<bool> &abyKeep)
+{
+    CPLAssert(abyKeep.size() == static_cast<size_t>(array->length));
+    const size_t nKept =
+        static_cast<size_t>(std::count(abyKeep.begin(), abyKeep.end(), true));
+    if (nKept == abyKeep.size())
+        return true;
 
-    bool bRet = true;
+    if (nKept == 0)
+    {
+        array->length = 0;
+    }
+    else if (!CompactStructArray(schema, array, 0, abyKeep, nKept))
+    {
+        array->release(array);
+        memset(array, 0, sizeof(*array));
+        return false;
+    }
+    return true;
+}
 
-    out_array->n_buffers = src_array->n_buffers;
-    out_array->buffers = static_cast<const void **>(CPLCalloc(
-        static_cast<size_t>(src_array->n_buffers), sizeof(const void *)));
-    CPLAssert(static_cast<size_t>(src_array->length) >= nParentOffset);
-    const char *format = schema->format;
-    const auto nOffset = static_cast<size_t>(src_array->offset) + nParentOffset;
-    for (int64_t i = 0; i < src_array->n_buffers; ++i)
+/************************************************************************/
+/*                     OGRArrowGetWKBColumnIndex()                      */
+/************************************************************************/
+
+/** Return the index of the WKB encoded column of a geometry field in the
+ * schema of a struct array, or -1 if there is none.
+ *
+ * @param schema Schema of a struct array. Must *NOT* be NULL.
+ * @param pszGeomFieldName Name of the geometry field.
+ * @return column index or -1.
+ */
+int OGRArrowGetWKBColumnIndex(const struct ArrowSchema *schema,
+                              const char *pszGeomFieldName)
+{
+    if (pszGeomFieldName[0] == '\0')
+        pszGeomFieldName = OGRLayer::DEFAULT_ARROW_GEOMETRY_NAME;
+    if (!IsStructure(schema->format))
+        return -1;
+    for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
     {
-        if (i == 0 || IsBoolean(format))
+        const auto psChildSchema = schema->children[i];
+        if (strcmp(psChildSchema->name, pszGeomFieldName) == 0)
         {
-            if (i == 1)
-            {
-                CPLAssert(src_array->buffers[i]);
-            }
-            if (src_array->buffers[i])
+            if (!IsBinary(psChildSchema->format) &&
+                !IsLargeBinary(psChildSchema->format))
+                return -1;
+            if (!psChildSchema->metadata)
+                return -1;
+            const auto oMetadata =
+                OGRParseArrowMetadata(psChildSchema->metadata);
+            const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+            if (oIter != oMetadata.end() &&
+                (oIter->second == EXTENSION_NAME_OGC_WKB ||
+                 oIter->second == EXTENSION_NAME_GEOARROW_WKB))
             {
-                const size_t nBytes = nLength ? (nLength + 7) / 8 : 1;
-                uint8_t *CPL_RESTRICT p = static_cast<uint8_t *>(
-                    VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nBytes));
-                if (!p)
-                {
-                    bRet = false;
-                    break;
-                }
-                const auto *CPL_RESTRICT pSrcArray =
-                    static_cast<const uint8_t *>(src_array->buffers[i]);
-                if ((nOffset % 8) != 0)
-                {
-                    // Make sure last byte is fully initialized
-                    p[nBytes - 1] = 0;
-                    for (size_t iRow = 0; iRow < nLength; ++iRow)
-                    {
-                        if (TestBit(pSrcArray, nOffset + iRow))
-                            SetBit(p, iRow);
-                        else
-                            UnsetBit(p, iRow);
-                    }
-                }
-                else
-                {
-                    memcpy(p, pSrcArray + nOffset / 8, nBytes);
-                }
-                out_array->buffers[i] = p;
+                return i;
             }
+            return -1;
         }
-        else if (i == 1)
-        {
-            CPLAssert(src_array->buffers[i]);
-            size_t nEltSize = 0;
-            size_t nExtraElt = 0;
-            if (IsUInt8(format) || IsInt8(format))
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                          GetWKBColumn()                              */
+/************************************************************************/
+
+static struct ArrowArray *GetWKBColumn(const struct ArrowSchema *schema,
+                                       const struct ArrowArray *array,
+                                       int iCol, const char *pszFuncName,
+                                       bool &bLargeBinary)
+{
+    if (!IsStructure(schema->format) || iCol < 0 ||
+        iCol >= schema->n_children || array->n_children != schema->n_children)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s(): invalid column index %d",
+                 pszFuncName, iCol);
+        return nullptr;
+    }
+    const char *format = schema->children[iCol]->format;
+    if (IsBinary(format))
+        bLargeBinary = false;
+    else if (IsLargeBinary(format))
+        bLargeBinary = true;
+    else
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s(): column %s is not of type binary", pszFuncName,
+                 schema->children[iCol]->name);
+        return nullptr;
+    }
+    return array->children[iCol];
+}
+
+/************************************************************************/
+/*                           ForEachWKB()                               */
+/************************************************************************/
+
+/** Call func(iRow, iChildRow, pabyWkb, nWKBSize) on each non-null value
+ * of the WKB column psChild of the struct array.
+ */
+template <class OffsetType, class Func>
+static void ForEachWKB(const struct ArrowArray *array,
+                       const struct ArrowArray *psChild, Func func)
+{
+    const uint8_t *pabyValidity =
+        psChild->null_count != 0
+            ? static_cast<const uint8_t *>(psChild->buffers[0])
+            : nullptr;
+    const auto *panOffsets =
+        static_cast<const OffsetType *>(psChild->buffers[1]);
+    // Functions modifying WKB in place document that they must be passed
+    // a writable array
+    GByte *pabyData =
+        static_cast<GByte *>(const_cast<void *>(psChild->buffers[2]));
+    const size_t nOffset =
+        static_cast<size_t>(array->offset + psChild->offset);
+    const size_t nLength = static_cast<size_t>(array->length);
+    for (size_t iRow = 0; iRow < nLength; ++iRow)
+    {
+        const size_t iChildRow = nOffset + iRow;
+        if (pabyValidity && !TestBit(pabyValidity, iChildRow))
+            continue;
+        const auto nStart = panOffsets[iChildRow];
+        func(iRow, iChildRow, pabyData + nStart,
+             static_cast<size_t>(panOffsets[iChildRow + 1] - nStart));
+    }
+}
+
+template <class Func>
+static void ForEachWKB(bool bLargeBinary, const struct ArrowArray *array,
+                       const struct ArrowArray *psChild, Func func)
+{
+    if (bLargeBinary)
+        ForEachWKB<uint64_t>(array, psChild, func);
+    else
+        ForEachWKB<uint32_t>(array, psChild, func);
+}
+
+/************************************************************************/
+/*                  OGRArrowWKBColumnFilterGeometry()                   */
+/************************************************************************/
+
+/** Determine which rows of a WKB geometry column pass the spatial filter
+ * installed on a layer.
+ *
+ * This uses OGRLayer::FilterWKBGeometry(), that is the same test as
+ * OGRLayer::FilterGeometry() does on OGRGeometry objects, but geometries
+ * are only instantiated for rows whose bounding box does not suffice to
+ * decide. As OGRLayer::FilterGeometry() does for features without
+ * geometry, null rows are never kept, and neither are rows with invalid WKB.
+ * The output can be passed to OGRCompactArrowArray().
+ *
+ * @param schema Schema of a struct array. Must *NOT* be NULL.
+ * @param array Struct array. Must *NOT* be NULL.
+ * @param iCol Index of the binary or large binary WKB column.
+ * @param poLayer Layer whose spatial filter is used. Must *NOT* be NULL, and
+ *                must have a spatial filter installed.
+ * @param abyKeep Output vector, resized to array->length.
+ * @return true if success.
+ */
+bool OGRArrowWKBColumnFilterGeometry(const struct ArrowSchema *schema,
+                                     const struct ArrowArray *array, int iCol,
+                                     const OGRLayer *poLayer,
+                                     std::vector<bool> &abyKeep)
+{
+    bool bLargeBinary = false;
+    const auto psChild =
+        GetWKBColumn(schema, array, iCol, __func__, bLargeBinary);
+    if (!psChild)
+        return false;
+
+    abyKeep.clear();
+    abyKeep.resize(static_cast<size_t>(array->length), false);
+    ForEachWKB(bLargeBinary, array, psChild,
+               [&abyKeep, poLayer](size_t iRow, size_t, const GByte *pabyWkb,
+                                   size_t nWKBSize)
+               {
+                   OGREnvelope sEnvelope;
+                   abyKeep[iRow] = poLayer->FilterWKBGeometry(
+                       pabyWkb, nWKBSize,
+                       /* bEnvelopeAlreadySet = */ false, sEnvelope);
+               });
+    return true;
+}
+
+/************************************************************************/
+/*                   OGRArrowWKBColumnMakeWritable()                    */
+/************************************************************************/
+
+/** Replace a WKB geometry column by a copy owned by OGR, so that its
+ * content can be modified in place.
+ *
+ * Arrays returned by ArrowArrayStream::get_next() must be considered as
+ * read-only, as their buffers may be shared with the producer. This
+ * function must be called before OGRArrowWKBColumnSwapXY() or
+ * OGRArrowWKBColumnTransform().
+ *
+ * @param schema Schema of a struct array. Must *NOT* be NULL.
+ * @param array Struct array. Must *NOT* be NULL.
+ * @param iCol Index of the binary or large binary WKB column.
+ * @return true if success.
+ */
+bool OGRArrowWKBColumnMakeWritable(const struct ArrowSchema *schema,
+                                   struct ArrowArray *array, int iCol)
+{
+    bool bLargeBinary = false;
+    const auto psChild =
+        GetWKBColumn(schema, array, iCol, __func__, bLargeBinary);
+    if (!psChild)
+        return false;
+
+    struct ArrowArray sCopy;
+    if (!OGRCloneArrowArray(schema->children[iCol], psChild, &sCopy))
+        return false;
+    // Per the Arrow C data interface, the parent array will call our
+    // release callback on the new child.
+    psChild->release(psChild);
+    memcpy(psChild, &sCopy, sizeof(sCopy));
+    return true;
+}
+
+/************************************************************************/
+/*                      OGRArrowWKBColumnSwapXY()                       */
+/************************************************************************/
+
+/** Swap the X and Y coordinates of the geometries of a WKB geometry column,
+ * in place.
+ *
+ * The column must have been made writable with
+ * OGRArrowWKBColumnMakeWritable(). Rows with invalid WKB are left unchanged.
+ *
+ * @param schema Schema of a struct array. Must *NOT* be NULL.
+ * @param array Struct array. Must *NOT* be NULL.
+ * @param iCol Index of the binary or large binary WKB column.
+ * @return true if success.
+ */
+bool OGRArrowWKBColumnSwapXY(const struct ArrowSchema *schema,
+                             struct ArrowArray *array, int iCol)
+{
+    bool bLargeBinary = false;
+    const auto psChild =
+        GetWKBColumn(schema, array, iCol, __func__, bLargeBinary);
+    if (!psChild)
+        return false;
+
+    ForEachWKB(bLargeBinary, array, psChild,
+               [](size_t, size_t, GByte *pabyWkb, size_t nWKBSize)
+               { CPL_IGNORE_RET_VAL(OGRWKBSwapXY(pabyWkb, nWKBSize)); });
+    return true;
+}
+
+/************************************************************************/
+/*                     OGRArrowWKBColumnTransform()                     */
+/************************************************************************/
+
+/** Reproject the geometries of a WKB geometry column, in place.
+ *
+ * The column must have been made writable with
+ * OGRArrowWKBColumnMakeWritable(). Rows whose geometry cannot be
+ * transformed are set to null, similarly to OGRWarpedLayer.
+ *
+ * @param schema Schema of a struct array. Must *NOT* be NULL.
+ * @param array Struct array. Must *NOT* be NULL.
+ * @param iCol Index of the binary or large binary WKB column.
+ * @param poCT Coordinate transformation. Must *NOT* be NULL.
+ * @param oCache Cache, reused from one call to another.
+ * @return true if success.
+ */
+bool OGRArrowWKBColumnTransform(const struct ArrowSchema *schema,
+                                struct ArrowArray *array, int iCol,
+                                OGRCoordinateTransformation *poCT,
+                                OGRWKBTransformCache &oCache)
+{
+    bool bLargeBinary = false;
+    const auto psChild =
+        GetWKBColumn(schema, array, iCol, __func__, bLargeBinary);
+    if (!psChild)
+        return false;
+
+    std::vector<size_t> anFailedRows;
+    ForEachWKB(bLargeBinary, array, psChild,
+               [poCT, &oCache, &anFailedRows](size_t, size_t iChildRow,
+                                              GByte *pabyWkb, size_t nWKBSize)
+               {
+                   OGREnvelope3D sEnvelope;
+                   if (!OGRWKBTransform(pabyWkb, nWKBSize, poCT, oCache,
+                                        sEnvelope))
+                   {
+                       anFailedRows.push_back(iChildRow);
+                   }
+               });
+    if (anFailedRows.empty())
+        return true;
+
+    if (!psChild->buffers[0])
+    {
+        const size_t nBytes =
+            static_cast<size_t>(psChild->offset + psChild->length + 7) / 8;
+        void *pabyValidity = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nBytes);
+        if (!pabyValidity)
+            return false;
+        memset(pabyValidity, 0xFF, nBytes);
+        psChild->buffers[0] = pabyValidity;
+        psChild->null_count = 0;
+    }
+    else if (psChild->null_count == 0)
+    {
+        // A validity buffer may be present but ignored when null_count == 0
+        uint8_t *pabyValidity =
+            static_cast<uint8_t *>(const_cast<void *>(psChild->buffers[0]));
+        for (int64_t i = 0; i < psChild->length; ++i)
+            SetBit(pabyValidity, static_cast<size_t>(psChild->offset + i));
+    }
+    uint8_t *pabyValidity =
+        static_cast<uint8_t *>(const_cast<void *>(psChild->buffers[0]));
+    for (const size_t iChildRow : anFailedRows)
+        UnsetBit(pabyValidity, iChildRow);
+    if (psChild->null_count >= 0)
+        psChild->null_count += static_cast<int64_t>(anFailedRows.size());
+    return true;
+}
+
+/************************************************************************/
+/*               OGRArrowWKBColumnSetCoordinateDimension()              */
+/************************************************************************/
+
+template <class OffsetType>
+static bool SetWKBColumnCoordinateDimension(struct ArrowArray *psChild,
+                                            bool bHasZ, bool bHasM)
+{
+    const uint8_t *pabyValidity =
+        psChild->null_count != 0
+            ? static_cast<const uint8_t *>(psChild->buffers[0])
+            : nullptr;
+    const auto *panOffsets =
+        static_cast<const OffsetType *>(psChild->buffers[1]);
+    const GByte *pabyData = static_cast<const GByte *>(psChild->buffers[2]);
+    const size_t nOffset = static_cast<size_t>(psChild->offset);
+    const size_t nLength = static_cast<size_t>(psChild->length);
+
+    std::vector<GByte> abyNewData;
+    abyNewData.reserve(static_cast<size_t>(panOffsets[nOffset + nLength] -
+                                           panOffsets[nOffset]));
+    auto panNewOffsets = static_cast<OffsetType *>(
+        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(OffsetType) * (nLength + 1)));
+    uint8_t *pabyNewValidity = nullptr;
+    if (pabyValidity)
+    {
+        pabyNewValidity = static_cast<uint8_t *>(
+            VSI_MALLOC_ALIGNED_AUTO_VERBOSE((nLength + 7) / 8 + 1));
+    }
+    if (!panNewOffsets || (pabyValidity && !pabyNewValidity))
+    {
+        VSIFreeAligned(panNewOffsets);
+        VSIFreeAligned(pabyNewValidity);
+        return false;
+    }
+    if (pabyNewValidity)
+        memset(pabyNewValidity, 0, (nLength + 7) / 8 + 1);
+
+    panNewOffsets[0] = 0;
+    for (size_t iRow = 0; iRow < nLength; ++iRow)
+    {
+        const size_t iSrcRow = nOffset + iRow;
+        if (pabyValidity && !TestBit(pabyValidity, iSrcRow))
+        {
+            panNewOffsets[iRow + 1] = panNewOffsets[iRow];
+            continue;
+        }
+        if (pabyNewValidity)
+            SetBit(pabyNewValidity, iRow);
+        const GByte *pabyWkb = pabyData + panOffsets[iSrcRow];
+        const size_t nWKBSize =
+            static_cast<size_t>(panOffsets[iSrcRow + 1] - panOffsets[iSrcRow]);
+        if (!OGRWKBSetCoordinateDimension(pabyWkb, nWKBSize, bHasZ, bHasM,
+                                          abyNewData))
+        {
+            // Invalid WKB: leave it unchanged
+            abyNewData.insert(abyNewData.end(), pabyWkb, pabyWkb + nWKBSize);
+        }
+        if (abyNewData.size() > static_cast<size_t>(
+                                    std::numeric_limits<OffsetType>::max()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "OGRArrowWKBColumnSetCoordinateDimension(): too large "
+                     "binary array");
+            VSIFreeAligned(panNewOffsets);
+            VSIFreeAligned(pabyNewValidity);
+            return false;
+        }
+        panNewOffsets[iRow + 1] = static_cast<OffsetType>(abyNewData.size());
+    }
+
+    void *pabyNewData = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+        abyNewData.empty() ? 1 : abyNewData.size());
+    if (!pabyNewData)
+    {
+        VSIFreeAligned(panNewOffsets);
+        VSIFreeAligned(pabyNewValidity);
+        return false;
+    }
+    if (!abyNewData.empty())
+        memcpy(pabyNewData, abyNewData.data(), abyNewData.size());
+
+    struct ArrowArray sNewChild;
+    memset(&sNewChild, 0, sizeof(sNewChild));
+    sNewChild.length = psChild->length;
+    sNewChild.null_count = pabyNewValidity ? psChild->null_count : 0;
+    sNewChild.n_buffers = 3;
+    sNewChild.buffers =
+        static_cast<const void **>(CPLCalloc(3, sizeof(const void *)));
+    sNewChild.buffers[0] = pabyNewValidity;
+    sNewChild.buffers[1] = panNewOffsets;
+    sNewChild.buffers[2] = pabyNewData;
+    sNewChild.release = OGRLayerDefaultReleaseArray;
+
+    psChild->release(psChild);
+    memcpy(psChild, &sNewChild, sizeof(sNewChild));
+    return true;
+}
+
+/** Set the coordinate dimension of the geometries of a WKB geometry column.
+ *
+ * The column is replaced by a new one owned by OGR. Missing Z and M values
+ * are set to 0, and rows with invalid WKB are left unchanged.
+ *
+ * @param schema Schema of a struct array. Must *NOT* be NULL.
+ * @param array Struct array. Must *NOT* be NULL.
+ * @param iCol Index of the binary or large binary WKB column.
+ * @param bHasZ Whether the output geometries have a Z dimension.
+ * @param bHasM Whether the output geometries have a M dimension.
+ * @return true if success.
+ */
+bool OGRArrowWKBColumnSetCoordinateDimension(const struct ArrowSchema *schema,
+                                             struct ArrowArray *array,
+                                             int iCol, bool bHasZ, bool bHasM)
+{
+    bool bLargeBinary = false;
+    const auto psChild =
+        GetWKBColumn(schema, array, iCol, __func__, bLargeBinary);
+    if (!psChild)
+        return false;
+
+    return bLargeBinary
+               ? SetWKBColumnCoordinateDimension<uint64_t>(psChild, bHasZ,
+                                                           bHasM)
+               : SetWKBColumnCoordinateDimension<uint32_t>(psChild, bHasZ,
+                                                           bHasM);
+}
+
+/************************************************************************/
+/*               OGRIsGeoArrowGeometryEncodingRequested()               */
+/************************************************************************/
+
+/** Return whether the GEOMETRY_ENCODING option of GetArrowStream() asks
+ * for GeoArrow native geometry columns.
+ *
+ * @param papszOptions GetArrowStream() options.
+ * @param[out] bInterleaved Set to true for GEOARROW_INTERLEAVED (coordinates
+ *                          as a fixed size list), and false for GEOARROW
+ *                          (coordinates as a struct).
+ * @return true if GEOMETRY_ENCODING=GEOARROW or GEOARROW_INTERLEAVED.
+ */
+bool OGRIsGeoArrowGeometryEncodingRequested(CSLConstList papszOptions,
+                                            bool &bInterleaved)
+{
+    const char *pszEncoding =
+        CSLFetchNameValue(papszOptions, "GEOMETRY_ENCODING");
+    if (!pszEncoding)
+        return false;
+    if (EQUAL(pszEncoding, "GEOARROW"))
+    {
+        bInterleaved = false;
+        return true;
+    }
+    if (EQUAL(pszEncoding, "GEOARROW_INTERLEAVED"))
+    {
+        bInterleaved = true;
+        return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                       GetGeoArrowListLevels()                        */
+/************************************************************************/
+
+/** Return the number of list levels above the coordinates of the GeoArrow
+ * encoding of eFlatType, or -1 if it has no GeoArrow native encoding.
+ */
+static int GetGeoArrowListLevels(OGRwkbGeometryType eFlatType)
+{
+    switch (eFlatType)
+    {
+        case wkbPoint:
+            return 0;
+        case wkbLineString:
+        case wkbMultiPoint:
+            return 1;
+        case wkbPolygon:
+        case wkbMultiLineString:
+            return 2;
+        case wkbMultiPolygon:
+            return 3;
+        default:
+            break;
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                 OGRGeoArrowIsSupportedGeometryType()                 */
+/************************************************************************/
+
+/** Return whether a geometry type has a GeoArrow native encoding, that is
+ * if it is a (Multi)Point, (Multi)LineString or (Multi)Polygon, with any
+ * coordinate dimension.
+ */
+bool OGRGeoArrowIsSupportedGeometryType(OGRwkbGeometryType eGeomType)
+{
+    return GetGeoArrowListLevels(wkbFlatten(eGeomType)) >= 0;
+}
+
+/************************************************************************/
+/*                       OGRCreateGeoArrowSchema()                      */
+/************************************************************************/
+
+static struct ArrowSchema *CreateSchemaNode(const char *pszName,
+                                            const char *pszFormat,
+                                            int nChildren)
+{
+    auto psSchema = static_cast<struct ArrowSchema *>(
+        CPLCalloc(1, sizeof(struct ArrowSchema)));
+    psSchema->release = OGRLayerPartialReleaseSchema;
+    psSchema->name = CPLStrdup(pszName);
+    psSchema->format = pszFormat;
+    psSchema->n_children = nChildren;
+    if (nChildren)
+    {
+        psSchema->children = static_cast<struct ArrowSchema **>(
+            CPLCalloc(nChildren, sizeof(struct ArrowSchema *)));
+    }
+    return psSchema;
+}
+
+/** Return a ArrowSchema* corresponding to the GeoArrow native encoding of a
+ * geometry column, as used by GetArrowStream() with
+ * GEOMETRY_ENCODING=GEOARROW or GEOARROW_INTERLEAVED.
+ *
+ * The names of the intermediate fields follow the ones used by the
+ * Arrow and Parquet drivers.
+ *
+ * @param pszName Name of the column.
+ * @param eGeomType Geometry type. Must be one for which
+ *                  OGRGeoArrowIsSupportedGeometryType() returns true.
+ * @param bInterleaved Whether coordinates are a fixed size list of doubles
+ *                     (true), or a struct of x, y, z, m doubles (false).
+ * @param bNullable Whether the column is nullable.
+ * @param osExtensionMetadata Value of ARROW:extension:metadata, or empty.
+ * @return a new schema, or nullptr if eGeomType is not supported.
+ */
+struct ArrowSchema *
+OGRCreateGeoArrowSchema(const char *pszName, OGRwkbGeometryType eGeomType,
+                        bool bInterleaved, bool bNullable,
+                        const std::string &osExtensionMetadata)
+{
+    const auto eFlatType = wkbFlatten(eGeomType);
+    const char *pszExtensionName = nullptr;
+    std::vector<const char *> apszListNames;
+    switch (eFlatType)
+    {
+        case wkbPoint:
+            pszExtensionName = "geoarrow.point";
+            break;
+        case wkbLineString:
+            pszExtensionName = "geoarrow.linestring";
+            apszListNames = {"vertices"};
+            break;
+        case wkbPolygon:
+            pszExtensionName = "geoarrow.polygon";
+            apszListNames = {"rings", "vertices"};
+            break;
+        case wkbMultiPoint:
+            pszExtensionName = "geoarrow.multipoint";
+            apszListNames = {"points"};
+            break;
+        case wkbMultiLineString:
+            pszExtensionName = "geoarrow.multilinestring";
+            apszListNames = {"linestrings", "vertices"};
+            break;
+        case wkbMultiPolygon:
+            pszExtensionName = "geoarrow.multipolygon";
+            apszListNames = {"polygons", "rings", "vertices"};
+            break;
+        default:
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Geometry type %s has no GeoArrow native encoding",
+                     OGRGeometryTypeToName(eGeomType));
+            return nullptr;
+    }
+
+    const bool bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGeomType));
+    const bool bHasM = CPL_TO_BOOL(OGR_GT_HasM(eGeomType));
+    const int nDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+
+    // Coordinates
+    const char *pszCoordName =
+        apszListNames.empty() ? pszName : apszListNames.back();
+    struct ArrowSchema *psCoords;
+    if (bInterleaved)
+    {
+        static const char *const apszFormats[] = {"+w:2", "+w:3", "+w:4"};
+        psCoords = CreateSchemaNode(pszCoordName, apszFormats[nDim - 2], 1);
+        const char *pszDimName = nDim == 2   ? "xy"
+                                 : nDim == 4 ? "xyzm"
+                                 : bHasZ     ? "xyz"
+                                             : "xym";
+        psCoords->children[0] = CreateSchemaNode(pszDimName, "g", 0);
+    }
+    else
+    {
+        psCoords = CreateSchemaNode(pszCoordName, "+s", nDim);
+        int iChild = 0;
+        psCoords->children[iChild++] = CreateSchemaNode("x", "g", 0);
+        psCoords->children[iChild++] = CreateSchemaNode("y", "g", 0);
+        if (bHasZ)
+            psCoords->children[iChild++] = CreateSchemaNode("z", "g", 0);
+        if (bHasM)
+            psCoords->children[iChild++] = CreateSchemaNode("m", "g", 0);
+    }
+
+    // Nested lists, from the innermost one
+    struct ArrowSchema *psSchema = psCoords;
+    for (int i = static_cast<int>(apszListNames.size()) - 1; i >= 0; --i)
+    {
+        auto psList = CreateSchemaNode(i == 0 ? pszName : apszListNames[i - 1],
+                                       "+l", 1);
+        psList->children[0] = psSchema;
+        psSchema = psList;
+    }
+
+    if (bNullable)
+        psSchema->flags = ARROW_FLAG_NULLABLE;
+
+    std::vector<std::pair<std::string, std::string>> oMetadata;
+    oMetadata.emplace_back(ARROW_EXTENSION_NAME_KEY, pszExtensionName);
+    if (!osExtensionMetadata.empty())
+    {
+        oMetadata.emplace_back(ARROW_EXTENSION_METADATA_KEY,
+                               osExtensionMetadata);
+    }
+    size_t nLen = sizeof(int32_t);
+    for (const auto &oPair : oMetadata)
+    {
+        nLen += sizeof(int32_t) + oPair.first.size() + sizeof(int32_t) +
+                oPair.second.size();
+    }
+    char *pszMetadata = static_cast<char *>(CPLMalloc(nLen));
+    psSchema->metadata = pszMetadata;
+    size_t offsetMD = 0;
+    int32_t nSize = static_cast<int32_t>(oMetadata.size());
+    memcpy(pszMetadata + offsetMD, &nSize, sizeof(nSize));
+    offsetMD += sizeof(int32_t);
+    for (const auto &oPair : oMetadata)
+    {
+        for (const std::string *posStr : {&oPair.first, &oPair.second})
+        {
+            nSize = static_cast<int32_t>(posStr->size());
+            memcpy(pszMetadata + offsetMD, &nSize, sizeof(nSize));
+            offsetMD += sizeof(int32_t);
+            memcpy(pszMetadata + offsetMD, posStr->data(), posStr->size());
+            offsetMD += posStr->size();
+        }
+    }
+    CPLAssert(offsetMD == nLen);
+    CPL_IGNORE_RET_VAL(offsetMD);
+
+    return psSchema;
+}
+
+/************************************************************************/
+/*                      OGRArrowWKBColumnToGeoArrow()                   */
+/************************************************************************/
+
+namespace
+{
+/** Accumulates WKB geometries into the buffers of a GeoArrow native array */
+class OGRGeoArrowBuilder
+{
+  public:
+    OGRGeoArrowBuilder(OGRwkbGeometryType eGeomType, bool bInterleaved)
+        : m_eFlatType(wkbFlatten(eGeomType)),
+          m_bHasZ(CPL_TO_BOOL(OGR_GT_HasZ(eGeomType))),
+          m_bHasM(CPL_TO_BOOL(OGR_GT_HasM(eGeomType))),
+          m_bInterleaved(bInterleaved),
+          m_nDim(2 + (m_bHasZ ? 1 : 0) + (m_bHasM ? 1 : 0)),
+          m_nListLevels(GetGeoArrowListLevels(m_eFlatType))
+    {
+        for (int i = 0; i < m_nListLevels; ++i)
+            m_aanOffsets[i].push_back(0);
+    }
+
+    void Reserve(size_t nRows, size_t nCoords);
+    bool AddWKB(const GByte *pabyWkb, size_t nWKBSize);
+    void AddNull();
+    bool Finish(struct ArrowArray *psOut);
+
+    /** Whether Z or M values have been discarded, because the geometry
+     * type of the builder has no such dimension. */
+    bool HasDiscardedDimensions() const
+    {
+        return m_bDiscardedDimensions;
+    }
+
+  private:
+    const OGRwkbGeometryType m_eFlatType;
+    const bool m_bHasZ;
+    const bool m_bHasM;
+    const bool m_bInterleaved;
+    const int m_nDim;
+    const int m_nListLevels;
+
+    // Interleaved coordinates in m_aadfCoords[0], or one vector per
+    // dimension
+    std::vector<double> m_aadfCoords[4]{};
+    size_t m_nCoords = 0;
+    // m_aanOffsets[0] are the offsets of the outermost list
+    std::vector<int32_t> m_aanOffsets[3]{};
+    std::vector<uint8_t> m_abyValidity{};
+    size_t m_nRows = 0;
+    size_t m_nNullCount = 0;
+    bool m_bDiscardedDimensions = false;
+
+    const GByte *m_pabyWkb = nullptr;
+    size_t m_nWKBSize = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeoArrowBuilder)
+
+    void AppendValidity(bool bValid);
+    bool ReadHeader(size_t &iOffset, OGRwkbGeometryType &eFlatType,
+                    bool &bHasZ, bool &bHasM, bool &bNeedSwap) const;
+    bool ReadUInt32(size_t &iOffset, bool bNeedSwap, uint32_t &nVal) const;
+    void AppendCoord(double dfX, double dfY, double dfZ, double dfM);
+    bool AppendPoints(uint32_t nPoints, bool bHasZ, bool bHasM,
+                      bool bNeedSwap, bool bSkipEmpty, size_t &iOffset);
+    bool PushOffset(int iLevel, size_t nCount);
+    size_t GetChildCount(int iLevel) const;
+    bool AddPointSequence(int iLevel, bool bHasZ, bool bHasM, bool bNeedSwap,
+                          size_t &iOffset);
+    bool AddRings(int iLevel, bool bHasZ, bool bHasM, bool bNeedSwap,
+                  size_t &iOffset);
+    bool AddParts(OGRwkbGeometryType ePartType, bool bNeedSwap,
+                  size_t &iOffset);
+    bool AddSinglePart(OGRwkbGeometryType ePartType, bool bNeedSwap,
+                       size_t &iOffset);
+    bool AddGeometry(size_t &iOffset);
+};
+
+void OGRGeoArrowBuilder::Reserve(size_t nRows, size_t nCoords)
+{
+    m_abyValidity.reserve((nRows + 7) / 8);
+    if (m_nListLevels > 0)
+        m_aanOffsets[0].reserve(nRows + 1);
+    if (m_bInterleaved)
+    {
+        m_aadfCoords[0].reserve(nCoords * m_nDim);
+    }
+    else
+    {
+        for (int i = 0; i < m_nDim; ++i)
+            m_aadfCoords[i].reserve(nCoords);
+    }
+}
+
+void OGRGeoArrowBuilder::AppendValidity(bool bValid)
+{
+    if ((m_nRows % 8) == 0)
+        m_abyValidity.push_back(0);
+    if (bValid)
+        SetBit(m_abyValidity.data(), m_nRows);
+    else
+        ++m_nNullCount;
+    ++m_nRows;
+}
+
+bool OGRGeoArrowBuilder::ReadHeader(size_t &iOffset,
+                                    OGRwkbGeometryType &eFlatType, bool &bHasZ,
+                                    bool &bHasM, bool &bNeedSwap) const
+{
+    if (iOffset > m_nWKBSize || m_nWKBSize - iOffset < 5)
+        return false;
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(m_pabyWkb[iOffset]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+        return false;
+    bNeedSwap = OGR_SWAP(static_cast<OGRwkbByteOrder>(nByteOrder));
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    if (OGRReadWKBGeometryType(m_pabyWkb + iOffset, wkbVariantIso,
+                               &eGeomType) != OGRERR_NONE)
+        return false;
+    eFlatType = wkbFlatten(eGeomType);
+    bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGeomType));
+    bHasM = CPL_TO_BOOL(OGR_GT_HasM(eGeomType));
+    iOffset += 5;
+    return true;
+}
+
+bool OGRGeoArrowBuilder::ReadUInt32(size_t &iOffset, bool bNeedSwap,
+                                    uint32_t &nVal) const
+{
+    if (iOffset > m_nWKBSize || m_nWKBSize - iOffset < sizeof(uint32_t))
+        return false;
+    memcpy(&nVal, m_pabyWkb + iOffset, sizeof(nVal));
+    if (bNeedSwap)
+        CPL_SWAP32PTR(&nVal);
+    iOffset += sizeof(uint32_t);
+    return true;
+}
+
+void OGRGeoArrowBuilder::AppendCoord(double dfX, double dfY, double dfZ,
+                                     double dfM)
+{
+    int iDim = 0;
+    const auto Append = [this, &iDim](double dfVal)
+    { m_aadfCoords[m_bInterleaved ? 0 : iDim++].push_back(dfVal); };
+    Append(dfX);
+    Append(dfY);
+    if (m_bHasZ)
+        Append(dfZ);
+    if (m_bHasM)
+        Append(dfM);
+    ++m_nCoords;
+}
+
+bool OGRGeoArrowBuilder::AppendPoints(uint32_t nPoints, bool bHasZ, bool bHasM,
+                                      bool bNeedSwap, bool bSkipEmpty,
+                                      size_t &iOffset)
+{
+    const int nSrcDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+    const size_t nPointSize = nSrcDim * sizeof(double);
+    if (iOffset > m_nWKBSize || nPoints > (m_nWKBSize - iOffset) / nPointSize)
+        return false;
+    const GByte *pabyData = m_pabyWkb + iOffset;
+    iOffset += nPoints * nPointSize;
+    if (nPoints && ((bHasZ && !m_bHasZ) || (bHasM && !m_bHasM)))
+        m_bDiscardedDimensions = true;
+
+    if (m_bInterleaved && !bNeedSwap && !bSkipEmpty && bHasZ == m_bHasZ &&
+        bHasM == m_bHasM)
+    {
+        // Fast path: the WKB point sequence has the layout of GeoArrow
+        // interleaved coordinates.
+        auto &adfCoords = m_aadfCoords[0];
+        const size_t nOldSize = adfCoords.size();
+        adfCoords.resize(nOldSize + static_cast<size_t>(nPoints) * m_nDim);
+        if (nPoints)
+            memcpy(adfCoords.data() + nOldSize, pabyData, nPoints * nPointSize);
+        m_nCoords += nPoints;
+        return true;
+    }
+
+    const auto ReadDouble = [bNeedSwap](const GByte *pabyVal)
+    {
+        double dfVal;
+        memcpy(&dfVal, pabyVal, sizeof(dfVal));
+        if (bNeedSwap)
+            CPL_SWAP64PTR(&dfVal);
+        return dfVal;
+    };
+
+    for (uint32_t i = 0; i < nPoints; ++i, pabyData += nPointSize)
+    {
+        const double dfX = ReadDouble(pabyData);
+        const double dfY = ReadDouble(pabyData + sizeof(double));
+        // An empty point has X=Y=NaN
+        const bool bEmpty = std::isnan(dfX) && std::isnan(dfY);
+        if (bEmpty && bSkipEmpty)
+            continue;
+        const double dfMissing =
+            bEmpty ? std::numeric_limits<double>::quiet_NaN() : 0.0;
+        const double dfZ =
+            bHasZ ? ReadDouble(pabyData + 2 * sizeof(double)) : dfMissing;
+        const double dfM =
+            bHasM ? ReadDouble(pabyData + (nSrcDim - 1) * sizeof(double))
+                  : dfMissing;
+        AppendCoord(dfX, dfY, dfZ, dfM);
+    }
+    return true;
+}
+
+size_t OGRGeoArrowBuilder::GetChildCount(int iLevel) const
+{
+    return iLevel + 1 == m_nListLevels ? m_nCoords
+                                       : m_aanOffsets[iLevel + 1].size() - 1;
+}
+
+bool OGRGeoArrowBuilder::PushOffset(int iLevel, size_t nCount)
+{
+    if (nCount > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Too many elements in GeoArrow list array");
+        return false;
+    }
+    m_aanOffsets[iLevel].push_back(static_cast<int32_t>(nCount));
+    return true;
+}
+
+bool OGRGeoArrowBuilder::AddPointSequence(int iLevel, bool bHasZ, bool bHasM,
+                                          bool bNeedSwap, size_t &iOffset)
+{
+    uint32_t nPoints = 0;
+    return ReadUInt32(iOffset, bNeedSwap, nPoints) &&
+           AppendPoints(nPoints, bHasZ, bHasM, bNeedSwap,
+                        /* bSkipEmpty = */ false, iOffset) &&
+           PushOffset(iLevel, m_nCoords);
+}
+
+bool OGRGeoArrowBuilder::AddRings(int iLevel, bool bHasZ, bool bHasM,
+                                  bool bNeedSwap, size_t &iOffset)
+{
+    uint32_t nRings = 0;
+    if (!ReadUInt32(iOffset, bNeedSwap, nRings))
+        return false;
+    for (uint32_t i = 0; i < nRings; ++i)
+    {
+        if (!AddPointSequence(iLevel + 1, bHasZ, bHasM, bNeedSwap, iOffset))
+            return false;
+    }
+    return PushOffset(iLevel, GetChildCount(iLevel));
+}
+
+bool OGRGeoArrowBuilder::AddParts(OGRwkbGeometryType ePartType, bool bNeedSwap,
+                                  size_t &iOffset)
+{
+    uint32_t nParts = 0;
+    if (!ReadUInt32(iOffset, bNeedSwap, nParts))
+        return false;
+    for (uint32_t i = 0; i < nParts; ++i)
+    {
+        OGRwkbGeometryType eFlatType = wkbUnknown;
+        bool bHasZ = false;
+        bool bHasM = false;
+        bool bPartNeedSwap = false;
+        if (!ReadHeader(iOffset, eFlatType, bHasZ, bHasM, bPartNeedSwap) ||
+            eFlatType != ePartType)
+        {
+            return false;
+        }
+        bool bOK;
+        if (ePartType == wkbPoint)
+            bOK = AppendPoints(1, bHasZ, bHasM, bPartNeedSwap,
+                               /* bSkipEmpty = */ false, iOffset);
+        else if (ePartType == wkbLineString)
+            bOK = AddPointSequence(1, bHasZ, bHasM, bPartNeedSwap, iOffset);
+        else
+            bOK = AddRings(1, bHasZ, bHasM, bPartNeedSwap, iOffset);
+        if (!bOK)
+            return false;
+    }
+    return PushOffset(0, GetChildCount(0));
+}
+
+/** Append the single part of a multi geometry, or an empty geometry if it
+ * has no part, as a geometry of the type of the builder. This is lossless,
+ * contrary to merging several parts. */
+bool OGRGeoArrowBuilder::AddSinglePart(OGRwkbGeometryType ePartType,
+                                       bool bNeedSwap, size_t &iOffset)
+{
+    uint32_t nParts = 0;
+    if (!ReadUInt32(iOffset, bNeedSwap, nParts) || nParts > 1)
+        return false;
+    if (nParts == 0)
+    {
+        if (ePartType == wkbPoint)
+        {
+            const double dfNaN = std::numeric_limits<double>::quiet_NaN();
+            AppendCoord(dfNaN, dfNaN, dfNaN, dfNaN);
+            return true;
+        }
+        return PushOffset(0, GetChildCount(0));
+    }
+
+    OGRwkbGeometryType eFlatType = wkbUnknown;
+    bool bHasZ = false;
+    bool bHasM = false;
+    bool bPartNeedSwap = false;
+    if (!ReadHeader(iOffset, eFlatType, bHasZ, bHasM, bPartNeedSwap) ||
+        eFlatType != ePartType)
+    {
+        return false;
+    }
+    if (ePartType == wkbPoint)
+        return AppendPoints(1, bHasZ, bHasM, bPartNeedSwap,
+                            /* bSkipEmpty = */ false, iOffset);
+    if (ePartType == wkbLineString)
+        return AddPointSequence(0, bHasZ, bHasM, bPartNeedSwap, iOffset);
+    return AddRings(0, bHasZ, bHasM, bPartNeedSwap, iOffset);
+}
+
+bool OGRGeoArrowBuilder::AddGeometry(size_t &iOffset)
+{
+    OGRwkbGeometryType eFlatType = wkbUnknown;
+    bool bHasZ = false;
+    bool bHasM = false;
+    bool bNeedSwap = false;
+    if (!ReadHeader(iOffset, eFlatType, bHasZ, bHasM, bNeedSwap))
+        return false;
+
+    switch (m_eFlatType)
+    {
+        case wkbPoint:
+            if (eFlatType == wkbMultiPoint)
+                return AddSinglePart(wkbPoint, bNeedSwap, iOffset);
+            return eFlatType == wkbPoint &&
+                   AppendPoints(1, bHasZ, bHasM, bNeedSwap,
+                                /* bSkipEmpty = */ false, iOffset);
+
+        case wkbLineString:
+            if (eFlatType == wkbMultiLineString)
+                return AddSinglePart(wkbLineString, bNeedSwap, iOffset);
+            return eFlatType == wkbLineString &&
+                   AddPointSequence(0, bHasZ, bHasM, bNeedSwap, iOffset);
+
+        case wkbPolygon:
+            if (eFlatType == wkbMultiPolygon)
+                return AddSinglePart(wkbPolygon, bNeedSwap, iOffset);
+            return eFlatType == wkbPolygon &&
+                   AddRings(0, bHasZ, bHasM, bNeedSwap, iOffset);
+
+        case wkbMultiPoint:
+            if (eFlatType == wkbPoint)
+            {
+                // Promote to a multipoint, empty if the point is empty
+                return AppendPoints(1, bHasZ, bHasM, bNeedSwap,
+                                    /* bSkipEmpty = */ true, iOffset) &&
+                       PushOffset(0, m_nCoords);
+            }
+            return eFlatType == wkbMultiPoint &&
+                   AddParts(wkbPoint, bNeedSwap, iOffset);
+
+        case wkbMultiLineString:
+            if (eFlatType == wkbLineString)
+            {
+                return AddPointSequence(1, bHasZ, bHasM, bNeedSwap, iOffset) &&
+                       PushOffset(0, GetChildCount(0));
+            }
+            return eFlatType == wkbMultiLineString &&
+                   AddParts(wkbLineString, bNeedSwap, iOffset);
+
+        case wkbMultiPolygon:
+            if (eFlatType == wkbPolygon)
+            {
+                return AddRings(1, bHasZ, bHasM, bNeedSwap, iOffset) &&
+                       PushOffset(0, GetChildCount(0));
+            }
+            return eFlatType == wkbMultiPolygon &&
+                   AddParts(wkbPolygon, bNeedSwap, iOffset);
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/** Append a WKB geometry. If it cannot be represented with the geometry
+ * type of the builder, or is invalid, return false and leave the builder
+ * unchanged.
+ */
+bool OGRGeoArrowBuilder::AddWKB(const GByte *pabyWkb, size_t nWKBSize)
+{
+    m_pabyWkb = pabyWkb;
+    m_nWKBSize = nWKBSize;
+
+    const size_t nCoordsBefore = m_nCoords;
+    size_t anOffsetsSizeBefore[3] = {0, 0, 0};
+    for (int i = 0; i < m_nListLevels; ++i)
+        anOffsetsSizeBefore[i] = m_aanOffsets[i].size();
+
+    size_t iOffset = 0;
+    if (!AddGeometry(iOffset))
+    {
+        m_nCoords = nCoordsBefore;
+        if (m_bInterleaved)
+        {
+            m_aadfCoords[0].resize(m_nCoords * m_nDim);
+        }
+        else
+        {
+            for (int i = 0; i < m_nDim; ++i)
+                m_aadfCoords[i].resize(m_nCoords);
+        }
+        for (int i = 0; i < m_nListLevels; ++i)
+            m_aanOffsets[i].resize(anOffsetsSizeBefore[i]);
+        return false;
+    }
+    AppendValidity(true);
+    return true;
+}
+
+void OGRGeoArrowBuilder::AddNull()
+{
+    if (m_nListLevels == 0)
+    {
+        // Points are stored in a struct or fixed size list: a null entry
+        // still takes a coordinate slot.
+        const double dfNaN = std::numeric_limits<double>::quiet_NaN();
+        AppendCoord(dfNaN, dfNaN, dfNaN, dfNaN);
+    }
+    else
+    {
+        m_aanOffsets[0].push_back(m_aanOffsets[0].back());
+    }
+    AppendValidity(false);
+}
+
+static struct ArrowArray *CreateArrayNode(size_t nLength, int nBuffers,
+                                          int nChildren)
+{
+    auto psArray = static_cast<struct ArrowArray *>(
+        CPLCalloc(1, sizeof(struct ArrowArray)));
+    psArray->release = OGRLayerDefaultReleaseArray;
+    psArray->length = static_cast<int64_t>(nLength);
+    psArray->n_buffers = nBuffers;
+    psArray->buffers =
+        static_cast<const void **>(CPLCalloc(nBuffers, sizeof(const void *)));
+    psArray->n_children = nChildren;
+    if (nChildren)
+    {
+        psArray->children = static_cast<struct ArrowArray **>(
+            CPLCalloc(nChildren, sizeof(struct ArrowArray *)));
+    }
+    return psArray;
+}
+
+template <class T>
+static bool CopyToArrayBuffer(struct ArrowArray *psArray, int iBuffer,
+                              const std::vector<T> &aValues)
+{
+    // Arrow buffers cannot be null, even for empty arrays
+    void *pBuffer = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+        std::max<size_t>(1, aValues.size() * sizeof(T)));
+    if (!pBuffer)
+        return false;
+    if (!aValues.empty())
+        memcpy(pBuffer, aValues.data(), aValues.size() * sizeof(T));
+    psArray->buffers[iBuffer] = pBuffer;
+    return true;
+}
+
+/** Build the GeoArrow array, and move its content into *psOut */
+bool OGRGeoArrowBuilder::Finish(struct ArrowArray *psOut)
+{
+    // Coordinates
+    struct ArrowArray *psCoords;
+    bool bOK = true;
+    if (m_bInterleaved)
+    {
+        psCoords = CreateArrayNode(m_nCoords, 1, 1);
+        psCoords->children[0] = CreateArrayNode(m_nCoords * m_nDim, 2, 0);
+        bOK = CopyToArrayBuffer(psCoords->children[0], 1, m_aadfCoords[0]);
+    }
+    else
+    {
+        psCoords = CreateArrayNode(m_nCoords, 1, m_nDim);
+        for (int i = 0; bOK && i < m_nDim; ++i)
+        {
+            psCoords->children[i] = CreateArrayNode(m_nCoords, 2, 0);
+            bOK = CopyToArrayBuffer(psCoords->children[i], 1, m_aadfCoords[i]);
+        }
+    }
+
+    // Nested lists, from the innermost one
+    struct ArrowArray *psArray = psCoords;
+    for (int i = m_nListLevels - 1; bOK && i >= 0; --i)
+    {
+        auto psList = CreateArrayNode(m_aanOffsets[i].size() - 1, 2, 1);
+        psList->children[0] = psArray;
+        psArray = psList;
+        bOK = CopyToArrayBuffer(psList, 1, m_aanOffsets[i]);
+    }
+
+    if (bOK && m_nNullCount)
+    {
+        psArray->null_count = static_cast<int64_t>(m_nNullCount);
+        bOK = CopyToArrayBuffer(psArray, 0, m_abyValidity);
+    }
+
+    if (!bOK)
+    {
+        // psArray is the root of the partially built tree
+        psArray->release(psArray);
+        CPLFree(psArray);
+        return false;
+    }
+    CPLAssert(psArray->length == static_cast<int64_t>(m_nRows));
+
+    memcpy(psOut, psArray, sizeof(*psArray));
+    CPLFree(psArray);
+    return true;
+}
+}  // namespace
+
+template <class OffsetType>
+static bool WKBColumnToGeoArrow(struct ArrowArray *psChild,
+                                OGRwkbGeometryType eGeomType,
+                                bool bInterleaved)
+{
+    const uint8_t *pabyValidity =
+        psChild->null_count != 0
+            ? static_cast<const uint8_t *>(psChild->buffers[0])
+            : nullptr;
+    const auto *panOffsets =
+        static_cast<const OffsetType *>(psChild->buffers[1]);
+    const GByte *pabyData = static_cast<const GByte *>(psChild->buffers[2]);
+    const size_t nOffset = static_cast<size_t>(psChild->offset);
+    const size_t nLength = static_cast<size_t>(psChild->length);
+
+    OGRGeoArrowBuilder oBuilder(eGeomType, bInterleaved);
+    // Rough estimate of the number of coordinates, assuming 2D WKB
+    const size_t nDataSize = static_cast<size_t>(
+        panOffsets[nOffset + nLength] - panOffsets[nOffset]);
+    oBuilder.Reserve(nLength, nDataSize / (2 * sizeof(double)));
+
+    bool bWarningEmitted = false;
+    for (size_t iRow = 0; iRow < nLength; ++iRow)
+    {
+        const size_t iSrcRow = nOffset + iRow;
+        if (pabyValidity && !TestBit(pabyValidity, iSrcRow))
+        {
+            oBuilder.AddNull();
+            continue;
+        }
+        const GByte *pabyWkb = pabyData + panOffsets[iSrcRow];
+        const size_t nWKBSize =
+            static_cast<size_t>(panOffsets[iSrcRow + 1] - panOffsets[iSrcRow]);
+        if (!oBuilder.AddWKB(pabyWkb, nWKBSize))
+        {
+            if (!bWarningEmitted)
+            {
+                bWarningEmitted = true;
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "At least one geometry cannot be converted to the "
+                         "GeoArrow %s encoding without loss of "
+                         "information, and has been set to null",
+                         OGRGeometryTypeToName(eGeomType));
+            }
+            oBuilder.AddNull();
+        }
+    }
+    if (oBuilder.HasDiscardedDimensions())
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Z and/or M values of at least one geometry have been "
+                 "discarded, as the GeoArrow %s encoding has no such "
+                 "dimension",
+                 OGRGeometryTypeToName(eGeomType));
+    }
+
+    struct ArrowArray sNewChild;
+    memset(&sNewChild, 0, sizeof(sNewChild));
+    if (!oBuilder.Finish(&sNewChild))
+        return false;
+
+    psChild->release(psChild);
+    memcpy(psChild, &sNewChild, sizeof(sNewChild));
+    return true;
+}
+
+/** Convert a WKB geometry column to the GeoArrow native encoding of a
+ * geometry type, as described by OGRCreateGeoArrowSchema().
+ *
+ * The column is replaced by a new one owned by OGR. Single geometries are
+ * promoted to the multi type of the column, and multi geometries with a
+ * single part are converted to the single type of the column. Other
+ * geometries, such as multi geometries with several parts in a column of a
+ * single type, cannot be converted without loss of information and are set
+ * to null, with a warning. Missing Z and M values are set to 0, and Z and M
+ * values not in the geometry type of the column are discarded, with a
+ * warning. The schema of the array must be updated by the caller.
+ *
+ * @param schema Schema of a struct array. Must *NOT* be NULL.
+ * @param array Struct array. Must *NOT* be NULL.
+ * @param iCol Index of the binary or large binary WKB column.
+ * @param eGeomType Geometry type of the column. Must be one for which
+ *                  OGRGeoArrowIsSupportedGeometryType() returns true.
+ * @param bInterleaved Whether coordinates are a fixed size list of doubles
+ *                     (true), or a struct of x, y, z, m doubles (false).
+ * @return true if success.
+ */
+bool OGRArrowWKBColumnToGeoArrow(const struct ArrowSchema *schema,
+                                 struct ArrowArray *array, int iCol,
+                                 OGRwkbGeometryType eGeomType,
+                                 bool bInterleaved)
+{
+    bool bLargeBinary = false;
+    const auto psChild =
+        GetWKBColumn(schema, array, iCol, __func__, bLargeBinary);
+    if (!psChild)
+        return false;
+    if (!OGRGeoArrowIsSupportedGeometryType(eGeomType))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Geometry type %s has no GeoArrow native encoding",
+                 OGRGeometryTypeToName(eGeomType));
+        return false;
+    }
+
+    return bLargeBinary
+               ? WKBColumnToGeoArrow<uint64_t>(psChild, eGeomType, bInterleaved)
+               : WKBColumnToGeoArrow<uint32_t>(psChild, eGeomType,
+                                               bInterleaved);
+}
+
+/************************************************************************/
+/*                  OGRArrowSetGeometryColumnSchema()                   */
+/************************************************************************/
+
+/** Update the schema of a WKB geometry column, so that it is the one
+ * OGRLayer::GetArrowStream() returns for a geometry field with the given
+ * options.
+ *
+ * This is meant for layers that modify the geometries of the batches of
+ * another layer, for example by reprojecting them, and must advertise the
+ * CRS and geometry type of their own geometry field:
+ * <ul>
+ * <li>if GEOMETRY_ENCODING=GEOARROW or GEOARROW_INTERLEAVED, and the geometry
+ *     type has a GeoArrow native encoding, the column is replaced by the
+ *     one returned by OGRCreateGeoArrowSchema(). Batches must then be
+ *     converted with OGRArrowWKBColumnToGeoArrow().</li>
+ * <li>otherwise its ARROW:extension:name is set to ogc.wkb, or to
+ *     geoarrow.wkb with the CRS in ARROW:extension:metadata if
+ *     GEOMETRY_METADATA_ENCODING=GEOARROW.</li>
+ * </ul>
+ *
+ * @param schema Schema of a struct array, as returned by
+ *               OGRCloneArrowSchema(). Must *NOT* be NULL.
+ * @param iCol Index of the binary or large binary WKB column.
+ * @param poFieldDefn Geometry field definition. Must *NOT* be NULL.
+ * @param papszOptions GetArrowStream() options.
+ * @return true if success.
+ */
+bool OGRArrowSetGeometryColumnSchema(struct ArrowSchema *schema, int iCol,
+                                     const OGRGeomFieldDefn *poFieldDefn,
+                                     CSLConstList papszOptions)
+{
+    if (!IsStructure(schema->format) || iCol < 0 ||
+        iCol >= schema->n_children ||
+        (!IsBinary(schema->children[iCol]->format) &&
+         !IsLargeBinary(schema->children[iCol]->format)))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%s(): invalid WKB column index %d", __func__, iCol);
+        return false;
+    }
+
+    auto psOldSchema = schema->children[iCol];
+    const auto eGeomType = poFieldDefn->GetType();
+    bool bInterleaved = false;
+    if (OGRIsGeoArrowGeometryEncodingRequested(papszOptions, bInterleaved) &&
+        OGRGeoArrowIsSupportedGeometryType(eGeomType))
+    {
+        auto psNewSchema = OGRCreateGeoArrowSchema(
+            psOldSchema->name, eGeomType, bInterleaved,
+            (psOldSchema->flags & ARROW_FLAG_NULLABLE) != 0,
+            GetGeoArrowExtensionMetadata(poFieldDefn));
+        if (!psNewSchema)
+            return false;
+        psOldSchema->release(psOldSchema);
+        memcpy(psOldSchema, psNewSchema, sizeof(*psNewSchema));
+        CPLFree(psNewSchema);
+        return true;
+    }
+
+    const char *pszGeometryMetadataEncoding =
+        CSLFetchNameValue(papszOptions, "GEOMETRY_METADATA_ENCODING");
+    std::string osExtensionMetadata;
+    const char *pszExtensionName = EXTENSION_NAME_OGC_WKB;
+    if (pszGeometryMetadataEncoding &&
+        EQUAL(pszGeometryMetadataEncoding, "GEOARROW"))
+    {
+        pszExtensionName = EXTENSION_NAME_GEOARROW_WKB;
+        osExtensionMetadata = GetGeoArrowExtensionMetadata(poFieldDefn);
+    }
+    CPLFree(const_cast<char *>(psOldSchema->metadata));
+    psOldSchema->metadata =
+        CreateExtensionMetadata(pszExtensionName, osExtensionMetadata);
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRWrapArrowArrayStream()                      */
+/************************************************************************/
+
+namespace
+{
+struct OGRWrappedArrowArrayStreamPrivate
+{
+    struct ArrowArrayStream m_sSrcStream{};
+    struct ArrowSchema m_sSchema{};
+    struct ArrowSchema m_sOutSchema{};
+    OGRArrowArrayBatchFunc m_fnProcess{};
+    std::string m_osLastError{};
+
+    static int GetSchema(struct ArrowArrayStream *stream,
+                         struct ArrowSchema *out_schema)
+    {
+        auto psPrivate = static_cast<OGRWrappedArrowArrayStreamPrivate *>(
+            stream->private_data);
+        return OGRCloneArrowSchema(&psPrivate->m_sOutSchema, out_schema)
+                   ? 0
+                   : EIO;
+    }
+
+    static int GetNext(struct ArrowArrayStream *stream,
+                       struct ArrowArray *out_array)
+    {
+        auto psPrivate = static_cast<OGRWrappedArrowArrayStreamPrivate *>(
+            stream->private_data);
+        psPrivate->m_osLastError.clear();
+        auto &sSrcStream = psPrivate->m_sSrcStream;
+        const int ret = sSrcStream.get_next(&sSrcStream, out_array);
+        if (ret != 0 || out_array->release == nullptr)
+            return ret;
+        CPLErrorReset();
+        if (!psPrivate->m_fnProcess(&psPrivate->m_sSchema, out_array))
+        {
+            if (out_array->release)
+                out_array->release(out_array);
+            memset(out_array, 0, sizeof(*out_array));
+            psPrivate->m_osLastError = CPLGetLastErrorMsg();
+            return EIO;
+        }
+        return 0;
+    }
+
+    static const char *GetLastError(struct ArrowArrayStream *stream)
+    {
+        auto psPrivate = static_cast<OGRWrappedArrowArrayStreamPrivate *>(
+            stream->private_data);
+        if (!psPrivate->m_osLastError.empty())
+            return psPrivate->m_osLastError.c_str();
+        auto &sSrcStream = psPrivate->m_sSrcStream;
+        return sSrcStream.get_last_error(&sSrcStream);
+    }
+
+    static void Release(struct ArrowArrayStream *stream)
+    {
+        auto psPrivate = static_cast<OGRWrappedArrowArrayStreamPrivate *>(
+            stream->private_data);
+        if (psPrivate->m_sSrcStream.release)
+            psPrivate->m_sSrcStream.release(&psPrivate->m_sSrcStream);
+        if (psPrivate->m_sSchema.release)
+            psPrivate->m_sSchema.release(&psPrivate->m_sSchema);
+        if (psPrivate->m_sOutSchema.release)
+            psPrivate->m_sOutSchema.release(&psPrivate->m_sOutSchema);
+        delete psPrivate;
+        stream->release = nullptr;
+    }
+};
+}  // namespace
+
+/** Wrap an ArrowArrayStream so that each of its batches is processed by
+ * a function, typically one of the OGRArrowWKBColumnXXXX() functions,
+ * before being returned to the consumer.
+ *
+ * The function is called with the schema of the source stream, and must
+ * not change it. If it returns false, get_next() returns EIO, and
+ * get_last_error() the last error message emitted by the function.
+ *
+ * If the batches returned by fnProcess no longer match the schema of the
+ * source stream, fnProcessSchema must apply the corresponding changes to
+ * a copy of it, which is the one returned by get_schema().
+ *
+ * Ownership of src_stream is transferred to out_stream, even in case of
+ * failure.
+ *
+ * @param src_stream Source stream. Must *NOT* be NULL.
+ * @param fnProcess Processing function.
+ * @param out_stream Output stream. Must *NOT* be NULL.
+ * @param fnProcessSchema Schema processing function, or nullptr.
+ * @return true if success.
+ */
+bool OGRWrapArrowArrayStream(struct ArrowArrayStream *src_stream,
+                             OGRArrowArrayBatchFunc fnProcess,
+                             struct ArrowArrayStream *out_stream,
+                             OGRArrowSchemaFunc fnProcessSchema)
+{
+    memset(out_stream, 0, sizeof(*out_stream));
+    auto psPrivate = std::make_unique<OGRWrappedArrowArrayStreamPrivate>();
+    memcpy(&psPrivate->m_sSrcStream, src_stream, sizeof(*src_stream));
+    src_stream->release = nullptr;
+    auto &sSrcStream = psPrivate->m_sSrcStream;
+    if (sSrcStream.get_schema(&sSrcStream, &psPrivate->m_sSchema) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "get_schema() failed: %s",
+                 sSrcStream.get_last_error(&sSrcStream));
+        sSrcStream.release(&sSrcStream);
+        return false;
+    }
+    if (!OGRCloneArrowSchema(&psPrivate->m_sSchema, &psPrivate->m_sOutSchema) ||
+        (fnProcessSchema && !fnProcessSchema(&psPrivate->m_sOutSchema)))
+    {
+        if (psPrivate->m_sOutSchema.release)
+            psPrivate->m_sOutSchema.release(&psPrivate->m_sOutSchema);
+        psPrivate->m_sSchema.release(&psPrivate->m_sSchema);
+        sSrcStream.release(&sSrcStream);
+        return false;
+    }
+    psPrivate->m_fnProcess = std::move(fnProcess);
+
+    out_stream->get_schema = OGRWrappedArrowArrayStreamPrivate::GetSchema;
+    out_stream->get_next = OGRWrappedArrowArrayStreamPrivate::GetNext;
+    out_stream->get_last_error =
+        OGRWrappedArrowArrayStreamPrivate::GetLastError;
+    out_stream->release = OGRWrappedArrowArrayStreamPrivate::Release;
+    out_stream->private_data = psPrivate.release();
+    return true;
+}
+
+/************************************************************************/
+/*                          OGRCloneArrowArray                          */
+/************************************************************************/
+
+static bool OGRCloneArrowArray(const struct ArrowSchema *schema,
+                               const struct ArrowArray *src_array,
+                               struct ArrowArray *out_array,
+                               size_t nParentOffset)
+{
+    memset(out_array, 0, sizeof(*out_array));
+    const size_t nLength =
+        static_cast<size_t>(src_array->length) - nParentOffset;
+    out_array->length = nLength;
+    out_array->null_count = src_array->null_count;
+    out_array->release = OGRLayerDefaultReleaseArray;
+
+    bool bRet = true;
+
+    out_array->n_buffers = src_array->n_buffers;
+    out_array->buffers = static_cast<const void **>(CPLCalloc(
+        static_cast<size_t>(src_array->n_buffers), sizeof(const void *)));
+    CPLAssert(static_cast<size_t>(src_array->length) >= nParentOffset);
+    const char *format = schema->format;
+    const auto nOffset = static_cast<size_t>(src_array->offset) + nParentOffset;
+    for (int64_t i = 0; i < src_array->n_buffers; ++i)
+    {
+        if (i == 0 || IsBoolean(format))
+        {
+            if (i == 1)
+            {
+                CPLAssert(src_array->buffers[i]);
+            }
+            if (src_array->buffers[i])
+            {
+                const size_t nBytes = nLength ? (nLength + 7) / 8 : 1;
+                uint8_t *CPL_RESTRICT p = static_cast<uint8_t *>(
+                    VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nBytes));
+                if (!p)
+                {
+                    bRet = false;
+                    break;
+                }
+                const auto *CPL_RESTRICT pSrcArray =
+                    static_cast<const uint8_t *>(src_array->buffers[i]);
+                if ((nOffset % 8) != 0)
+                {
+                    // Make sure last byte is fully initialized
+                    p[nBytes - 1] = 0;
+                    for (size_t iRow = 0; iRow < nLength; ++iRow)
+                    {
+                        if (TestBit(pSrcArray, nOffset + iRow))
+                            SetBit(p, iRow);
+                        else
+                            UnsetBit(p, iRow);
+                    }
+                }
+                else
+                {
+                    memcpy(p, pSrcArray + nOffset / 8, nBytes);
+                }
+                out_array->buffers[i] = p;
+            }
+        }
+        else if (i == 1)
+        {
+            CPLAssert(src_array->buffers[i]);
+            size_t nEltSize = 0;
+            size_t nExtraElt = 0;
+            if (IsUInt8(format) || IsInt8(format))
                 nEltSize = sizeof(uint8_t);
             else if (IsUInt16(format) || IsInt16(format) || IsFloat16(format))
                 nEltSize = sizeof(uint16_t);
@@ -6498,8 +8274,340 @@ struct FieldInfo
     int nWidthInBytes = 0;  // only used for decimal fields
     int nPrecision = 0;     // only used for decimal fields
     int nScale = 0;         // only used for decimal fields
+    // Only set for GeoArrow native geometry columns
+    const struct ArrowSchema *psGeoArrowSchema = nullptr;
+    OGRwkbGeometryType eGeoArrowType = wkbNone;
+    bool bGeoArrowInterleaved = false;
+};
+
+/************************************************************************/
+/*                         GetGeoArrowColumnType()                      */
+/************************************************************************/
+
+/** Return whether schema is a GeoArrow native geometry column (point,
+ * linestring, polygon and their multi variants), and in that case set
+ * eGeomType and bInterleaved.
+ */
+static bool GetGeoArrowColumnType(const struct ArrowSchema *schema,
+                                  const char *pszFieldName,
+                                  OGRwkbGeometryType &eGeomType,
+                                  bool &bInterleaved, bool &bError)
+{
+    bError = false;
+    if (!schema->metadata)
+        return false;
+    const auto oMetadata = OGRParseArrowMetadata(schema->metadata);
+    const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+    if (oIter == oMetadata.end())
+        return false;
+    const auto &osExtensionName = oIter->second;
+    OGRwkbGeometryType eFlatType;
+    if (osExtensionName == "geoarrow.point")
+        eFlatType = wkbPoint;
+    else if (osExtensionName == "geoarrow.linestring")
+        eFlatType = wkbLineString;
+    else if (osExtensionName == "geoarrow.polygon")
+        eFlatType = wkbPolygon;
+    else if (osExtensionName == "geoarrow.multipoint")
+        eFlatType = wkbMultiPoint;
+    else if (osExtensionName == "geoarrow.multilinestring")
+        eFlatType = wkbMultiLineString;
+    else if (osExtensionName == "geoarrow.multipolygon")
+        eFlatType = wkbMultiPolygon;
+    else
+        return false;
+
+    const auto ReportError = [pszFieldName, &osExtensionName, &bError]()
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported Arrow layout for %s column '%s'",
+                 osExtensionName.c_str(), pszFieldName);
+        bError = true;
+        return false;
+    };
+
+    const int nListLevels = GetGeoArrowListLevels(eFlatType);
+    for (int i = 0; i < nListLevels; ++i)
+    {
+        if (!IsList(schema->format) || schema->n_children != 1)
+            return ReportError();
+        schema = schema->children[0];
+    }
+
+    bool bHasZ = false;
+    bool bHasM = false;
+    if (IsStructure(schema->format))
+    {
+        if (schema->n_children < 2 || schema->n_children > 4)
+            return ReportError();
+        for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+        {
+            const auto psChild = schema->children[i];
+            if (!IsFloat64(psChild->format))
+                return ReportError();
+            if (i >= 2 && strcmp(psChild->name, "z") == 0 && !bHasZ && !bHasM)
+                bHasZ = true;
+            else if (i >= 2 && strcmp(psChild->name, "m") == 0 && !bHasM)
+                bHasM = true;
+            else if (i >= 2)
+                return ReportError();
+        }
+        bInterleaved = false;
+    }
+    else if (IsFixedSizeList(schema->format) && schema->n_children == 1 &&
+             IsFloat64(schema->children[0]->format))
+    {
+        const int nDim = GetFixedSizeList(schema->format);
+        if (nDim == 3)
+        {
+            bHasM = strcmp(schema->children[0]->name, "xym") == 0;
+            bHasZ = !bHasM;
+        }
+        else if (nDim == 4)
+        {
+            bHasZ = true;
+            bHasM = true;
+        }
+        else if (nDim != 2)
+        {
+            return ReportError();
+        }
+        bInterleaved = true;
+    }
+    else
+    {
+        return ReportError();
+    }
+
+    eGeomType = OGR_GT_SetModifier(eFlatType, bHasZ, bHasM);
+    return true;
+}
+
+/************************************************************************/
+/*                        OGRGeoArrowGeomReader                         */
+/************************************************************************/
+
+namespace
+{
+/** Builds OGRGeometry objects from the rows of a GeoArrow native array */
+class OGRGeoArrowGeomReader
+{
+  public:
+    OGRGeoArrowGeomReader(const struct ArrowArray *array,
+                          OGRwkbGeometryType eGeomType, bool bInterleaved);
+
+    OGRGeometry *GetGeometry(size_t iRow) const;
+
+  private:
+    const OGRwkbGeometryType m_eFlatType;
+    const bool m_bHasZ;
+    const bool m_bHasM;
+    const int m_nDim;
+    // Lists, from the outermost one
+    const struct ArrowArray *m_apsLists[3] = {nullptr, nullptr, nullptr};
+    // Pointer to the value of each dimension of the first coordinate
+    const double *m_apadfCoords[4] = {nullptr, nullptr, nullptr, nullptr};
+    // 1 for separated coordinates, m_nDim for interleaved ones
+    size_t m_nStride = 1;
+
+    void GetRange(int iLevel, size_t iIdx, size_t &nStart, size_t &nEnd) const
+    {
+        const auto psList = m_apsLists[iLevel];
+        const auto panOffsets =
+            static_cast<const int32_t *>(psList->buffers[1]) + psList->offset;
+        nStart = static_cast<size_t>(panOffsets[iIdx]);
+        nEnd = static_cast<size_t>(panOffsets[iIdx + 1]);
+    }
+
+    double GetCoord(int iDim, size_t iCoord) const
+    {
+        return m_apadfCoords[iDim][iCoord * m_nStride];
+    }
+
+    OGRPoint *GetPoint(size_t iCoord) const;
+    void FillCurve(OGRSimpleCurve *poCurve, size_t nStart, size_t nEnd) const;
+    OGRPolygon *GetPolygon(int iLevel, size_t iIdx) const;
 };
 
+OGRGeoArrowGeomReader::OGRGeoArrowGeomReader(const struct ArrowArray *array,
+                                             OGRwkbGeometryType eGeomType,
+                                             bool bInterleaved)
+    : m_eFlatType(wkbFlatten(eGeomType)),
+      m_bHasZ(CPL_TO_BOOL(OGR_GT_HasZ(eGeomType))),
+      m_bHasM(CPL_TO_BOOL(OGR_GT_HasM(eGeomType))),
+      m_nDim(2 + (m_bHasZ ? 1 : 0) + (m_bHasM ? 1 : 0))
+{
+    const int nListLevels = GetGeoArrowListLevels(m_eFlatType);
+    for (int i = 0; i < nListLevels; ++i)
+    {
+        m_apsLists[i] = array;
+        array = array->children[0];
+    }
+    if (bInterleaved)
+    {
+        const auto psValues = array->children[0];
+        m_nStride = m_nDim;
+        const double *padfValues =
+            static_cast<const double *>(psValues->buffers[1]) +
+            psValues->offset + array->offset * m_nDim;
+        for (int i = 0; i < m_nDim; ++i)
+            m_apadfCoords[i] = padfValues + i;
+    }
+    else
+    {
+        for (int i = 0; i < m_nDim; ++i)
+        {
+            const auto psValues = array->children[i];
+            m_apadfCoords[i] =
+                static_cast<const double *>(psValues->buffers[1]) +
+                psValues->offset + array->offset;
+        }
+    }
+}
+
+OGRPoint *OGRGeoArrowGeomReader::GetPoint(size_t iCoord) const
+{
+    auto poPoint = new OGRPoint();
+    const double dfX = GetCoord(0, iCoord);
+    const double dfY = GetCoord(1, iCoord);
+    // An empty point has X=Y=NaN
+    if (!(std::isnan(dfX) && std::isnan(dfY)))
+    {
+        poPoint->setX(dfX);
+        poPoint->setY(dfY);
+        if (m_bHasZ)
+            poPoint->setZ(GetCoord(2, iCoord));
+        if (m_bHasM)
+            poPoint->setM(GetCoord(m_nDim - 1, iCoord));
+    }
+    poPoint->set3D(m_bHasZ);
+    poPoint->setMeasured(m_bHasM);
+    return poPoint;
+}
+
+void OGRGeoArrowGeomReader::FillCurve(OGRSimpleCurve *poCurve, size_t nStart,
+                                      size_t nEnd) const
+{
+    const int nPoints = static_cast<int>(nEnd - nStart);
+    if (m_nStride == 1)
+    {
+        poCurve->setPoints(nPoints, m_apadfCoords[0] + nStart,
+                           m_apadfCoords[1] + nStart,
+                           m_bHasZ ? m_apadfCoords[2] + nStart : nullptr,
+                           m_bHasM ? m_apadfCoords[m_nDim - 1] + nStart
+                                   : nullptr);
+    }
+    else if (m_nDim == 2)
+    {
+        poCurve->setPoints(nPoints, reinterpret_cast<const OGRRawPoint *>(
+                                        m_apadfCoords[0] + nStart * 2));
+    }
+    else
+    {
+        poCurve->set3D(m_bHasZ);
+        poCurve->setMeasured(m_bHasM);
+        poCurve->setNumPoints(nPoints, FALSE);
+        for (int i = 0; i < nPoints; ++i)
+        {
+            const size_t iCoord = nStart + i;
+            poCurve->setPoint(i, GetCoord(0, iCoord), GetCoord(1, iCoord));
+            if (m_bHasZ)
+                poCurve->setZ(i, GetCoord(2, iCoord));
+            if (m_bHasM)
+                poCurve->setM(i, GetCoord(m_nDim - 1, iCoord));
+        }
+    }
+}
+
+OGRPolygon *OGRGeoArrowGeomReader::GetPolygon(int iLevel, size_t iIdx) const
+{
+    auto poPolygon = new OGRPolygon();
+    size_t nRingStart = 0;
+    size_t nRingEnd = 0;
+    GetRange(iLevel, iIdx, nRingStart, nRingEnd);
+    for (size_t iRing = nRingStart; iRing < nRingEnd; ++iRing)
+    {
+        size_t nStart = 0;
+        size_t nEnd = 0;
+        GetRange(iLevel + 1, iRing, nStart, nEnd);
+        auto poRing = new OGRLinearRing();
+        FillCurve(poRing, nStart, nEnd);
+        poPolygon->addRingDirectly(poRing);
+    }
+    poPolygon->set3D(m_bHasZ);
+    poPolygon->setMeasured(m_bHasM);
+    return poPolygon;
+}
+
+OGRGeometry *OGRGeoArrowGeomReader::GetGeometry(size_t iRow) const
+{
+    size_t nStart = 0;
+    size_t nEnd = 0;
+    switch (m_eFlatType)
+    {
+        case wkbPoint:
+            return GetPoint(iRow);
+
+        case wkbLineString:
+        {
+            auto poLS = new OGRLineString();
+            GetRange(0, iRow, nStart, nEnd);
+            FillCurve(poLS, nStart, nEnd);
+            poLS->set3D(m_bHasZ);
+            poLS->setMeasured(m_bHasM);
+            return poLS;
+        }
+
+        case wkbPolygon:
+            return GetPolygon(0, iRow);
+
+        case wkbMultiPoint:
+        {
+            auto poMP = new OGRMultiPoint();
+            GetRange(0, iRow, nStart, nEnd);
+            for (size_t i = nStart; i < nEnd; ++i)
+                poMP->addGeometryDirectly(GetPoint(i));
+            poMP->set3D(m_bHasZ);
+            poMP->setMeasured(m_bHasM);
+            return poMP;
+        }
+
+        case wkbMultiLineString:
+        {
+            auto poMLS = new OGRMultiLineString();
+            GetRange(0, iRow, nStart, nEnd);
+            for (size_t i = nStart; i < nEnd; ++i)
+            {
+                size_t nCoordStart = 0;
+                size_t nCoordEnd = 0;
+                GetRange(1, i, nCoordStart, nCoordEnd);
+                auto poLS = new OGRLineString();
+                FillCurve(poLS, nCoordStart, nCoordEnd);
+                poMLS->addGeometryDirectly(poLS);
+            }
+            poMLS->set3D(m_bHasZ);
+            poMLS->setMeasured(m_bHasM);
+            return poMLS;
+        }
+
+        case wkbMultiPolygon:
+        {
+            auto poMPoly = new OGRMultiPolygon();
+            GetRange(0, iRow, nStart, nEnd);
+            for (size_t i = nStart; i < nEnd; ++i)
+                poMPoly->addGeometryDirectly(GetPolygon(1, i));
+            poMPoly->set3D(m_bHasZ);
+            poMPoly->setMeasured(m_bHasM);
+            return poMPoly;
+        }
+
+        default:
+            break;
+    }
+    return nullptr;
+}
+}  // namespace
+
 static bool BuildOGRFieldInfo(
     const struct ArrowSchema *schema, struct ArrowArray *array,
     const OGRFeatureDefn *poFeatureDefn, const std::string &osFieldPrefix,
@@ -6512,6 +8620,44 @@ static bool BuildOGRFieldInfo(
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
+
+    OGRwkbGeometryType eGeoArrowType = wkbNone;
+    bool bGeoArrowInterleaved = false;
+    bool bGeoArrowError = false;
+    if (GetGeoArrowColumnType(schema, fieldName, eGeoArrowType,
+                              bGeoArrowInterleaved, bGeoArrowError))
+    {
+        FieldInfo sInfo;
+        sInfo.osName = osFieldPrefix + fieldName;
+        sInfo.format = format;
+        const auto oIter = oMapArrowFieldNameToOGRFieldName.find(sInfo.osName);
+        sInfo.iOGRFieldIdx = poFeatureDefn->GetGeomFieldIndex(
+            oIter != oMapArrowFieldNameToOGRFieldName.end()
+                ? oIter->second.c_str()
+                : sInfo.osName.c_str());
+        if (sInfo.iOGRFieldIdx < 0)
+        {
+            if (poFeatureDefn->GetGeomFieldCount() == 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot find OGR geometry field for Arrow array %s",
+                         sInfo.osName.c_str());
+                return false;
+            }
+            sInfo.iOGRFieldIdx = 0;
+        }
+        sInfo.bIsGeomCol = true;
+        sInfo.psGeoArrowSchema = schema;
+        sInfo.eGeoArrowType = eGeoArrowType;
+        sInfo.bGeoArrowInterleaved = bGeoArrowInterleaved;
+        asFieldInfo.emplace_back(std::move(sInfo));
+        return true;
+    }
+    else if (bGeoArrowError)
+    {
+        return false;
+    }
+
     if (IsStructure(format))
     {
         const std::string osNewPrefix(osFieldPrefix + fieldName + ".");
@@ -7032,6 +9178,12 @@ static size_t GetWorkingBufferSize(const struct ArrowSchema *schema,
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
+    if (iArrowIdxInOut < static_cast<int>(asFieldInfo.size()) &&
+        asFieldInfo[iArrowIdxInOut].psGeoArrowSchema == schema)
+    {
+        ++iArrowIdxInOut;
+        return 0;
+    }
     if (IsStructure(format))
     {
         size_t nRet = 0;
@@ -7208,6 +9360,28 @@ static bool FillFeature(OGRLayer *poLayer, const struct ArrowSchema *schema,
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
+    if (iArrowIdxInOut < static_cast<int>(asFieldInfo.size()) &&
+        asFieldInfo[iArrowIdxInOut].psGeoArrowSchema == schema)
+    {
+        const auto &sInfo = asFieldInfo[iArrowIdxInOut];
+        ++iArrowIdxInOut;
+        const uint8_t *pabyValidity =
+            static_cast<const uint8_t *>(array->buffers[0]);
+        if (array->null_count != 0 && pabyValidity &&
+            !TestBit(pabyValidity,
+                     static_cast<size_t>(iFeature + array->offset)))
+        {
+            oFeature.SetGeomFieldDirectly(sInfo.iOGRFieldIdx, nullptr);
+        }
+        else
+        {
+            const OGRGeoArrowGeomReader oReader(array, sInfo.eGeoArrowType,
+                                                sInfo.bGeoArrowInterleaved);
+            oFeature.SetGeomFieldDirectly(sInfo.iOGRFieldIdx,
+                                          oReader.GetGeometry(iFeature));
+        }
+        return true;
+    }
     if (IsStructure(format))
     {
         const std::string osNewPrefix(osFieldPrefix + fieldName + ".");
@@ -7523,7 +9697,11 @@ static bool FillFeature(OGRLayer *poLayer, const struct ArrowSchema *schema,
  * can be used to control the behavior in case of lossy conversion.
  *
  * Arrays for geometry columns should be of binary or large binary type and
- * contain WKB geometry.
+ * contain WKB geometry. Starting with GDAL 3.12, the base implementation also
+ * accepts GeoArrow native geometry columns (geoarrow.point,
+ * geoarrow.linestring, geoarrow.polygon, geoarrow.multipoint,
+ * geoarrow.multilinestring and geoarrow.multipolygon extensions), with
+ * separated or interleaved coordinates.
  *
  * Note that the passed array may be set to a released state
  * (array->release==NULL) after this call (not by the base implementation,
@@ -8063,7 +10241,11 @@ bool OGRLayer::WriteArrowBatch(const struct ArrowSchema *schema,
  * can be used to control the behavior in case of lossy conversion.
  *
  * Arrays for geometry columns should be of binary or large binary type and
- * contain WKB geometry.
+ * contain WKB geometry. Starting with GDAL 3.12, the base implementation also
+ * accepts GeoArrow native geometry columns (geoarrow.point,
+ * geoarrow.linestring, geoarrow.polygon, geoarrow.multipoint,
+ * geoarrow.multilinestring and geoarrow.multipolygon extensions), with
+ * separated or interleaved coordinates.
  *
  * Note that the passed array may be set to a released state
  * (array->release==NULL) after this call (not by the base implementation,
@@ -15,9 +15,12 @@
 
 #include "cpl_port.h"
 
+#include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
+#include "ogr_core.h"
 #include "ogr_recordbatch.h"
 
 constexpr const char *ARROW_EXTENSION_NAME_KEY = "ARROW:extension:name";
@@ -39,6 +42,69 @@ bool CPL_DLL OGRCloneArrowArray(const struct ArrowSchema *schema,
 bool CPL_DLL OGRCloneArrowSchema(const struct ArrowSchema *schema,
                                  struct ArrowSchema *out_schema);
 
+bool CPL_DLL OGRCompactArrowArray(const struct ArrowSchema *schema,
+                                  struct ArrowArray *array,
+                                  const std::vector<bool> &abyKeep);
+
+class OGRCoordinateTransformation;
+class OGRGeomFieldDefn;
+class OGRLayer;
+struct OGRWKBTransformCache;
+
+int CPL_DLL OGRArrowGetWKBColumnIndex(const struct ArrowSchema *schema,
+                                      const char *pszGeomFieldName);
+
+bool CPL_DLL OGRArrowWKBColumnFilterGeometry(const struct ArrowSchema *schema,
+                                             const struct ArrowArray *array,
+                                             int iCol, const OGRLayer *poLayer,
+                                             std::vector<bool> &abyKeep);
+
+bool CPL_DLL OGRArrowWKBColumnMakeWritable(const struct ArrowSchema *schema,
+                                           struct ArrowArray *array, int iCol);
+
+bool CPL_DLL OGRArrowWKBColumnSwapXY(const struct ArrowSchema *schema,
+                                     struct ArrowArray *array, int iCol);
+
+bool CPL_DLL OGRArrowWKBColumnTransform(const struct ArrowSchema *schema,
+                                        struct ArrowArray *array, int iCol,
+                                        OGRCoordinateTransformation *poCT,
+                                        OGRWKBTransformCache &oCache);
+
+bool CPL_DLL OGRArrowWKBColumnSetCoordinateDimension(
+    const struct ArrowSchema *schema, struct ArrowArray *array, int iCol,
+    bool bHasZ, bool bHasM);
+
+bool CPL_DLL OGRIsGeoArrowGeometryEncodingRequested(CSLConstList papszOptions,
+                                                    bool &bInterleaved);
+
+bool CPL_DLL OGRGeoArrowIsSupportedGeometryType(OGRwkbGeometryType eGeomType);
+
+struct ArrowSchema CPL_DLL *
+OGRCreateGeoArrowSchema(const char *pszName, OGRwkbGeometryType eGeomType,
+                        bool bInterleaved, bool bNullable,
+                        const std::string &osExtensionMetadata);
+
+bool CPL_DLL OGRArrowWKBColumnToGeoArrow(const struct ArrowSchema *schema,
+                                         struct ArrowArray *array, int iCol,
+                                         OGRwkbGeometryType eGeomType,
+                                         bool bInterleaved);
+
+bool CPL_DLL OGRArrowSetGeometryColumnSchema(
+    struct ArrowSchema *schema, int iCol, const OGRGeomFieldDefn *poFieldDefn,
+    CSLConstList papszOptions);
+
+/** Function processing a batch of an ArrowArrayStream */
+using OGRArrowArrayBatchFunc =
+    std::function<bool(const struct ArrowSchema *, struct ArrowArray *)>;
+
+/** Function processing the schema of an ArrowArrayStream */
+using OGRArrowSchemaFunc = std::function<bool(struct ArrowSchema *)>;
+
+bool CPL_DLL OGRWrapArrowArrayStream(
+    struct ArrowArrayStream *src_stream, OGRArrowArrayBatchFunc fnProcess,
+    struct ArrowArrayStream *out_stream,
+    OGRArrowSchemaFunc fnProcessSchema = nullptr);
+
 /** C++ wrapper on top of ArrowArrayStream */
 class OGRArrowArrayStream
 {
@@ -12,9 +12,12 @@
 
 #ifndef DOXYGEN_SKIP
 
+#include <algorithm>
 #include <cmath>
 
 #include "ogrwarpedlayer.h"
+#include "ogrlayerarrow.h"
+#include "ogr_wkb.h"
 
 /************************************************************************/
 /*                          OGRWarpedLayer()                            */
@@ -510,7 +513,16 @@ int OGRWarpedLayer::TestCapability(const char *pszCapability) const
     int bVal = m_poDecoratedLayer->TestCapability(pszCapability);
 
     if (EQUAL(pszCapability, OLCFastGetArrowStream))
-        return false;
+    {
+        // See GetArrowStream(): the spatial filter is evaluated on the
+        // reprojected geometry column, that must thus not be ignored.
+        return bVal &&
+               m_iGeomField < m_poFeatureDefn->GetGeomFieldCount() &&
+               (m_poFilterGeom == nullptr ||
+                !m_poDecoratedLayer->GetLayerDefn()
+                     ->GetGeomFieldDefn(m_iGeomField)
+                     ->IsIgnored());
+    }
 
     if (EQUAL(pszCapability, OLCFastSpatialFilter) ||
         EQUAL(pszCapability, OLCRandomWrite) ||
@@ -548,6 +560,126 @@ void OGRWarpedLayer::SetExtent(double dfXMin, double dfYMin, double dfXMax,
 bool OGRWarpedLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
                                     CSLConstList papszOptions)
 {
+    // If the decorated layer has a fast implementation, reproject in place
+    // the WKB geometry column of its batches, instead of going through
+    // OGRFeature. The spatial filter is evaluated on the reprojected
+    // geometries, as in GetNextFeature(), and the geometry columns are
+    // given the CRS of this layer and the requested encoding.
+    const auto poLayerDefn = GetLayerDefn();
+    if (m_iGeomField < poLayerDefn->GetGeomFieldCount() &&
+        m_poDecoratedLayer->TestCapability(OLCFastGetArrowStream))
+    {
+        CPLStringList aosOptions(papszOptions);
+        aosOptions.SetNameValue("GEOMETRY_ENCODING", "WKB");
+        OGRArrowArrayStream oSrcStream;
+        if (!m_poDecoratedLayer->GetArrowStream(oSrcStream.get(),
+                                                aosOptions.List()))
+            return false;
+
+        struct ArrowSchema sSchema;
+        if (oSrcStream.get_schema(&sSchema) == 0)
+        {
+            // (Arrow column index, geometry field index) of WKB columns
+            std::vector<std::pair<int, int>> anGeomColumns;
+            int iCol = -1;
+            for (int i = 0; i < poLayerDefn->GetGeomFieldCount(); ++i)
+            {
+                const int iGeomCol = OGRArrowGetWKBColumnIndex(
+                    &sSchema, poLayerDefn->GetGeomFieldDefn(i)->GetNameRef());
+                if (iGeomCol >= 0)
+                {
+                    anGeomColumns.emplace_back(iGeomCol, i);
+                    if (i == m_iGeomField)
+                        iCol = iGeomCol;
+                }
+            }
+            sSchema.release(&sSchema);
+
+            // Without the reprojected geometry column, the spatial filter
+            // cannot be evaluated.
+            if (iCol >= 0 || m_poFilterGeom == nullptr)
+            {
+                bool bInterleaved = false;
+                const bool bGeoArrow = OGRIsGeoArrowGeometryEncodingRequested(
+                    papszOptions, bInterleaved);
+                return OGRWrapArrowArrayStream(
+                    oSrcStream.get(),
+                    [this, iCol, anGeomColumns, bGeoArrow, bInterleaved,
+                     oCache = OGRWKBTransformCache(),
+                     abyKeep = std::vector<bool>()](
+                        const struct ArrowSchema *schema,
+                        struct ArrowArray *array) mutable
+                    {
+                        if (iCol >= 0 &&
+                            (!OGRArrowWKBColumnMakeWritable(schema, array,
+                                                            iCol) ||
+                             !OGRArrowWKBColumnTransform(schema, array, iCol,
+                                                         m_poCT, oCache)))
+                        {
+                            return false;
+                        }
+                        if (iCol >= 0 && m_poFilterGeom)
+                        {
+                            if (!OGRArrowWKBColumnFilterGeometry(
+                                    schema, array, iCol, this, abyKeep))
+                                return false;
+                            if (std::find(abyKeep.begin(), abyKeep.end(),
+                                          false) != abyKeep.end())
+                            {
+                                // OGRCompactArrowArray() modifies buffers
+                                // in place: work on a copy.
+                                struct ArrowArray sCopy;
+                                if (!OGRCloneArrowArray(schema, array, &sCopy))
+                                    return false;
+                                array->release(array);
+                                memcpy(array, &sCopy, sizeof(sCopy));
+                                if (!OGRCompactArrowArray(schema, array,
+                                                          abyKeep))
+                                    return false;
+                            }
+                        }
+                        if (bGeoArrow)
+                        {
+                            for (const auto &[iGeomCol, iGeomField] :
+                                 anGeomColumns)
+                            {
+                                const auto eGeomType =
+                                    m_poFeatureDefn
+                                        ->GetGeomFieldDefn(iGeomField)
+                                        ->GetType();
+                                if (OGRGeoArrowIsSupportedGeometryType(
+                                        eGeomType) &&
+                                    !OGRArrowWKBColumnToGeoArrow(
+                                        schema, array, iGeomCol, eGeomType,
+                                        bInterleaved))
+                                {
+                                    return false;
+                                }
+                            }
+                        }
+                        return true;
+                    },
+                    out_stream,
+                    [poLayerDefn, &anGeomColumns,
+                     papszOptions](struct ArrowSchema *schema)
+                    {
+                        for (const auto &[iGeomCol, iGeomField] :
+                             anGeomColumns)
+                        {
+                            if (!OGRArrowSetGeometryColumnSchema(
+                                    schema, iGeomCol,
+                                    poLayerDefn->GetGeomFieldDefn(iGeomField),
+                                    papszOptions))
+                            {
+                                return false;
+                            }
+                        }
+                        return true;
+                    });
+            }
+        }
+    }
+
     return OGRLayer::GetArrowStream(out_stream, papszOptions);
 }
 
@@ -14,6 +14,9 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_vsi_error.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_geojson.h"
 #include "ogrlibjsonutils.h"
@@ -83,14 +86,25 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     vsi_l_offset m_nFileSize = 0;
     GIntBig m_nIter = 0;
 
+    // -1 when the first pass stopped before the end of the file
     GIntBig m_nTotalFeatures = 0;
     GIntBig m_nNextFID = 0;
 
+    // Multi-threaded reading
+    int m_nNumThreads = 1;
+    std::vector<std::string> m_aosBatchRecords{};
+    std::vector<std::unique_ptr<OGRFeature>> m_apoBatchFeatures{};
+    size_t m_iNextBatchFeature = 0;
+
     std::unique_ptr<OGRCoordinateTransformation> m_poCT{};
     OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache;
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
+    bool GetNextRecord();
     json_object *GetNextObject(bool bLooseIdentification);
+    OGRFeature *TranslateObject(json_object *poObject,
+                                const char *pszSerializedObj);
+    bool ReadFeatureBatch();
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -313,6 +327,15 @@ OGRGeoJSONSeqLayer::OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS,
     const double dfTmp =
         CPLAtof(CPLGetConfigOption("OGR_GEOJSON_MAX_OBJ_SIZE", "200"));
     m_nMaxObjectSize = dfTmp > 0 ? static_cast<size_t>(dfTmp * 1024 * 1024) : 0;
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("OGR_GEOJSONSEQ_NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        m_nNumThreads = std::min(4, CPLGetNumCPUs());
+    else if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        m_nNumThreads = CPLGetNumCPUs();
+    else
+        m_nNumThreads = std::max(1, atoi(pszNumThreads));
 }
 
 /************************************************************************/
@@ -412,9 +435,33 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
     std::vector<std::unique_ptr<OGRFieldDefn>> apoFieldDefn;
     gdal::DirectedAcyclicGraph<int, std::string> dag;
     bool bOK = false;
+    bool bThresholdReached = false;
+    const GIntBig nMaxBytesFirstPass = CPLAtoGIntBig(
+        CPLGetConfigOption("OGR_GEOJSON_MAX_BYTES_FIRST_PASS", "0"));
+    const GIntBig nLimitFeaturesFirstPass = CPLAtoGIntBig(
+        CPLGetConfigOption("OGR_GEOJSON_MAX_FEATURES_FIRST_PASS", "0"));
 
     while (true)
     {
+        if (bEstablishLayerDefn && nLimitFeaturesFirstPass > 0 &&
+            m_nTotalFeatures >= nLimitFeaturesFirstPass)
+        {
+            CPLDebug("GeoJSONSeq", "First pass: early exit since above "
+                                   "OGR_GEOJSON_MAX_FEATURES_FIRST_PASS");
+            bThresholdReached = true;
+            break;
+        }
+        if (bEstablishLayerDefn && nMaxBytesFirstPass > 0 &&
+            static_cast<GIntBig>(VSIFTellL(m_poDS->m_fp) -
+                                 (m_nBufferValidSize - m_nPosInBuffer)) >=
+                nMaxBytesFirstPass)
+        {
+            CPLDebug("GeoJSONSeq", "First pass: early exit since above "
+                                   "OGR_GEOJSON_MAX_BYTES_FIRST_PASS");
+            bThresholdReached = true;
+            break;
+        }
+
         auto poObject = GetNextObject(bLooseIdentification);
         if (!poObject)
             break;
@@ -452,7 +499,13 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
     m_nFileSize = 0;
     m_nIter = 0;
 
-    return bOK || m_nTotalFeatures > 0;
+    bOK = bOK || m_nTotalFeatures > 0;
+    if (bThresholdReached)
+    {
+        // Feature count only known after a full scan
+        m_nTotalFeatures = -1;
+    }
+    return bOK;
 }
 
 /************************************************************************/
@@ -481,13 +534,17 @@ void OGRGeoJSONSeqLayer::ResetReading()
     m_nPosInBuffer = nBufferSizeValidated;
     m_nBufferValidSize = nBufferSizeValidated;
     m_nNextFID = 0;
+    m_aosBatchRecords.clear();
+    m_apoBatchFeatures.clear();
+    m_iNextBatchFeature = 0;
 }
 
 /************************************************************************/
-/*                           GetNextObject()                            */
+/*                           GetNextRecord()                            */
 /************************************************************************/
 
-json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+// Fill m_osFeatureBuffer with the next non-empty record of the file.
+bool OGRGeoJSONSeqLayer::GetNextRecord()
 {
     m_osFeatureBuffer.clear();
     while (true)
@@ -497,7 +554,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         {
             if (m_nBufferValidSize < m_osBuffer.size())
             {
-                return nullptr;
+                return false;
             }
             m_nBufferValidSize =
                 VSIFReadL(&m_osBuffer[0], 1, m_osBuffer.size(), m_poDS->m_fp);
@@ -521,7 +578,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             }
             if (m_nPosInBuffer >= m_nBufferValidSize)
             {
-                return nullptr;
+                return false;
             }
         }
 
@@ -549,7 +606,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
                          "for larger features, or 0 to remove any size limit.",
                          static_cast<unsigned>(m_osFeatureBuffer.size() / 1024 /
                                                1024));
-                return nullptr;
+                return false;
             }
             m_nPosInBuffer = m_nBufferValidSize;
             if (m_nBufferValidSize == m_osBuffer.size())
@@ -565,22 +622,148 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             m_osFeatureBuffer.pop_back();
         }
         if (!m_osFeatureBuffer.empty())
+        {
+            return true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                           GetNextObject()                            */
+/************************************************************************/
+
+json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+{
+    while (GetNextRecord())
+    {
+        json_object *poObject = nullptr;
+        CPL_IGNORE_RET_VAL(OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
+        if (json_object_get_type(poObject) == json_type_object)
+        {
+            return poObject;
+        }
+        json_object_put(poObject);
+        if (bLooseIdentification)
+        {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                          TranslateObject()                           */
+/************************************************************************/
+
+// Return a new feature, or nullptr if the object must be skipped.
+// May be called concurrently from several threads.
+OGRFeature *OGRGeoJSONSeqLayer::TranslateObject(json_object *poObject,
+                                                const char *pszSerializedObj)
+{
+    const auto type = OGRGeoJSONGetType(poObject);
+    if (type == GeoJSONObject::eFeature)
+    {
+        return m_oReader.ReadFeature(this, poObject, pszSerializedObj);
+    }
+    else if (type == GeoJSONObject::eFeatureCollection ||
+             type == GeoJSONObject::eUnknown)
+    {
+        return nullptr;
+    }
+
+    OGRGeometry *poGeom = m_oReader.ReadGeometry(poObject, GetSpatialRef());
+    if (!poGeom)
+    {
+        return nullptr;
+    }
+    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    poFeature->SetGeometryDirectly(poGeom);
+    return poFeature;
+}
+
+/************************************************************************/
+/*                          ReadFeatureBatch()                          */
+/************************************************************************/
+
+// Read a batch of records from the file, and parse and translate them to
+// features in the global thread pool. Features are stored in
+// m_apoBatchFeatures in file order, with nullptr for skipped records.
+bool OGRGeoJSONSeqLayer::ReadFeatureBatch()
+{
+    m_aosBatchRecords.clear();
+    m_apoBatchFeatures.clear();
+    m_iNextBatchFeature = 0;
+
+    // Bounds the memory used by a batch, while giving enough work to each
+    // thread to amortize the synchronization cost.
+    constexpr size_t RECORDS_PER_THREAD = 1000;
+    constexpr size_t BYTES_PER_THREAD = 4 * 1024 * 1024;
+    const size_t nMaxRecords = RECORDS_PER_THREAD * m_nNumThreads;
+    const size_t nMaxBytes = BYTES_PER_THREAD * m_nNumThreads;
+    size_t nBatchBytes = 0;
+    while (m_aosBatchRecords.size() < nMaxRecords && nBatchBytes < nMaxBytes &&
+           GetNextRecord())
+    {
+        nBatchBytes += m_osFeatureBuffer.size();
+        m_aosBatchRecords.push_back(std::move(m_osFeatureBuffer));
+        m_osFeatureBuffer.clear();
+    }
+    if (m_aosBatchRecords.empty())
+        return false;
+
+    const size_t nRecords = m_aosBatchRecords.size();
+    m_apoBatchFeatures.resize(nRecords);
+
+    const auto ProcessRecords = [this](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
         {
             json_object *poObject = nullptr;
             CPL_IGNORE_RET_VAL(
-                OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
-            m_osFeatureBuffer.clear();
+                OGRJSonParse(m_aosBatchRecords[i].c_str(), &poObject));
             if (json_object_get_type(poObject) == json_type_object)
             {
-                return poObject;
+                m_apoBatchFeatures[i].reset(
+                    TranslateObject(poObject, m_aosBatchRecords[i].c_str()));
             }
             json_object_put(poObject);
-            if (bLooseIdentification)
-            {
-                return nullptr;
-            }
         }
+    };
+
+    constexpr size_t MIN_RECORDS_PER_JOB = 100;
+    const int nJobs = static_cast<int>(
+        std::min<size_t>(m_nNumThreads, (nRecords + MIN_RECORDS_PER_JOB - 1) /
+                                            MIN_RECORDS_PER_JOB));
+    CPLWorkerThreadPool *poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>();
+    if (!poJobQueue)
+    {
+        ProcessRecords(0, nRecords);
+    }
+    else
+    {
+        CPLErrorAccumulator oErrorAccumulator;
+        const size_t nRecordsPerJob = (nRecords + nJobs - 1) / nJobs;
+        for (size_t iStart = 0; iStart < nRecords; iStart += nRecordsPerJob)
+        {
+            const size_t iEnd = std::min(nRecords, iStart + nRecordsPerJob);
+            poJobQueue->SubmitJob(
+                [&ProcessRecords, &oErrorAccumulator, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    ProcessRecords(iStart, iEnd);
+                });
+        }
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
     }
+
+    m_aosBatchRecords.clear();
+    return true;
 }
 
 /************************************************************************/
@@ -603,34 +786,27 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     GetLayerDefn();  // force scan if not already done
     while (true)
     {
-        auto poObject = GetNextObject(false);
-        if (!poObject)
-            return nullptr;
-        OGRFeature *poFeature;
-        auto type = OGRGeoJSONGetType(poObject);
-        if (type == GeoJSONObject::eFeature)
+        OGRFeature *poFeature = nullptr;
+        if (m_nNumThreads > 1)
         {
-            poFeature = m_oReader.ReadFeature(this, poObject,
-                                              m_osFeatureBuffer.c_str());
-            json_object_put(poObject);
-        }
-        else if (type == GeoJSONObject::eFeatureCollection ||
-                 type == GeoJSONObject::eUnknown)
-        {
-            json_object_put(poObject);
-            continue;
+            if (m_iNextBatchFeature == m_apoBatchFeatures.size() &&
+                !ReadFeatureBatch())
+            {
+                return nullptr;
+            }
+            poFeature = m_apoBatchFeatures[m_iNextBatchFeature++].release();
+            if (!poFeature)
+                continue;
         }
         else
         {
-            OGRGeometry *poGeom =
-                m_oReader.ReadGeometry(poObject, GetSpatialRef());
+            auto poObject = GetNextObject(false);
+            if (!poObject)
+                return nullptr;
+            poFeature = TranslateObject(poObject, m_osFeatureBuffer.c_str());
             json_object_put(poObject);
-            if (!poGeom)
-            {
+            if (!poFeature)
                 continue;
-            }
-            poFeature = new OGRFeature(m_poFeatureDefn);
-            poFeature->SetGeometryDirectly(poGeom);
         }
 
         if (poFeature->GetFID() == OGRNullFID)
@@ -657,6 +833,8 @@ GIntBig OGRGeoJSONSeqLayer::GetFeatureCount(int bForce)
     if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr)
     {
         GetLayerDefn();  // force scan if not already done
+        if (m_nTotalFeatures < 0 && bForce)
+            m_nTotalFeatures = OGRLayer::GetFeatureCount(bForce);
         return m_nTotalFeatures;
     }
     return OGRLayer::GetFeatureCount(bForce);
@@ -673,7 +851,7 @@ int OGRGeoJSONSeqLayer::TestCapability(const char *pszCap) const
     if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
         EQUAL(pszCap, OLCFastFeatureCount))
     {
-        return true;
+        return m_nTotalFeatures >= 0;
     }
     if (EQUAL(pszCap, OLCCreateField) || EQUAL(pszCap, OLCSequentialWrite))
     {
@@ -731,7 +909,8 @@ OGRErr OGRGeoJSONSeqLayer::ICreateFeature(OGRFeature *poFeature)
         }
     }
 
-    ++m_nTotalFeatures;
+    if (m_nTotalFeatures >= 0)
+        ++m_nTotalFeatures;
 
     json_object *poObj = OGRGeoJSONWriteFeature(
         poFeatureToWrite.get() ? poFeatureToWrite.get() : poFeature,
@@ -713,6 +713,12 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     int m_nIsCompatOfOptimizedGetNextArrowArray = -1;
     bool m_bGetNextArrowArrayCalledSinceResetReading = false;
+    // FID range scanned when m_nIsCompatOfOptimizedGetNextArrowArray == TRUE.
+    // Batches are made of the features whose FID is in
+    // [m_nArrowArrayNextFID, m_nArrowArrayNextFID + max_batch_size - 1]
+    GIntBig m_nArrowArrayMinFID = 0;
+    GIntBig m_nArrowArrayMaxFID = 0;
+    GIntBig m_nArrowArrayNextFID = 0;
 
     int m_nCountInsertInTransactionThreshold = -1;
     GIntBig m_nCountInsertInTransaction = 0;
@@ -807,7 +813,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
         std::string m_osErrorMsg{};
         std::unique_ptr<GDALGeoPackageDataset> m_poDS{};
         OGRGeoPackageTableLayer *m_poLayer{};
-        GIntBig m_iStartShapeId = 0;
+        GIntBig m_nStartFID = 0;
         std::unique_ptr<struct ArrowArray> m_psArrowArray = nullptr;
     };
 
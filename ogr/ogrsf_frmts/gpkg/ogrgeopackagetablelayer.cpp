@@ -8648,275 +8648,317 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return GetNextArrowArrayAsynchronous(stream, out_array);
     }
 
-    // We can use this optimized version only if there is no hole in FID
-    // numbering. That is min(fid) == 1 and max(fid) == m_nTotalFeatureCount
+    // We can use this optimized version only if there are not too many holes
+    // in FID numbering, as each batch is made of the features whose FID is
+    // in a range of max_batch_size values, so that several worker threads,
+    // each with its own SQLite connection, can read disjoint FID ranges.
     if (m_nIsCompatOfOptimizedGetNextArrowArray < 0)
     {
         m_nIsCompatOfOptimizedGetNextArrowArray = FALSE;
         const auto nTotalFeatureCount = GetTotalFeatureCount();
-        if (nTotalFeatureCount < 0)
+        if (nTotalFeatureCount <= 0)
             return GetNextArrowArrayAsynchronous(stream, out_array);
         {
             char *pszSQL = sqlite3_mprintf("SELECT MAX(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
-            OGRErr err;
-            const auto nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            OGRErr err = OGRERR_NONE;
+            m_nArrowArrayMaxFID =
+                SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMaxFID != nTotalFeatureCount)
+            if (err != OGRERR_NONE)
                 return GetNextArrowArrayAsynchronous(stream, out_array);
         }
         {
             char *pszSQL = sqlite3_mprintf("SELECT MIN(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
-            OGRErr err;
-            const auto nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            OGRErr err = OGRERR_NONE;
+            m_nArrowArrayMinFID =
+                SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMinFID != 1)
+            if (err != OGRERR_NONE)
                 return GetNextArrowArrayAsynchronous(stream, out_array);
         }
+        // Avoid integer overflows when iterating over FID ranges, and
+        // do not use FID ranges if more than half of them would be empty.
+        constexpr GIntBig MAX_FID = std::numeric_limits<GIntBig>::max() / 2;
+        if (m_nArrowArrayMinFID < -MAX_FID || m_nArrowArrayMaxFID > MAX_FID ||
+            m_nArrowArrayMaxFID - m_nArrowArrayMinFID + 1 >
+                2 * nTotalFeatureCount)
+        {
+            return GetNextArrowArrayAsynchronous(stream, out_array);
+        }
         m_nIsCompatOfOptimizedGetNextArrowArray = TRUE;
     }
 
+    if (!m_bGetNextArrowArrayCalledSinceResetReading)
+        m_nArrowArrayNextFID = m_nArrowArrayMinFID;
     m_bGetNextArrowArrayCalledSinceResetReading = true;
 
-    // CPLDebug("GPKG", "m_iNextShapeId = " CPL_FRMT_GIB, m_iNextShapeId);
+    // CPLDebug("GPKG", "m_nArrowArrayNextFID = " CPL_FRMT_GIB,
+    //          m_nArrowArrayNextFID);
 
     const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
         m_aosArrowArrayStreamOptions);
 
-    // Fetch the answer from a potentially queued asynchronous task
-    if (!m_oQueueArrowArrayPrefetchTasks.empty())
+    // Loop until we get a non-empty batch, as FID ranges that correspond to
+    // holes in FID numbering result in empty batches.
+    while (true)
     {
-        const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
-        auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
-        m_oQueueArrowArrayPrefetchTasks.pop();
-
-        // Wait for thread to be ready
+        // Fetch the answer from a potentially queued asynchronous task
+        if (!m_oQueueArrowArrayPrefetchTasks.empty())
         {
-            std::unique_lock<std::mutex> oLock(task->m_oMutex);
-            while (!task->m_bArrayReady)
-            {
-                task->m_oCV.wait(oLock);
-            }
-            task->m_bArrayReady = false;
-        }
-        if (!task->m_osErrorMsg.empty())
-            CPLError(CE_Failure, CPLE_AppDefined, "%s",
-                     task->m_osErrorMsg.c_str());
+            const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
+            auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
+            m_oQueueArrowArrayPrefetchTasks.pop();
 
-        const auto stopThread = [&task]()
-        {
+            // Wait for thread to be ready
             {
-                std::lock_guard oLock(task->m_oMutex);
-                task->m_bStop = true;
-                task->m_oCV.notify_one();
+                std::unique_lock<std::mutex> oLock(task->m_oMutex);
+                while (!task->m_bArrayReady)
+                {
+                    task->m_oCV.wait(oLock);
+                }
+                task->m_bArrayReady = false;
             }
-            if (task->m_oThread.joinable())
-                task->m_oThread.join();
-        };
+            if (!task->m_osErrorMsg.empty())
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         task->m_osErrorMsg.c_str());
 
-        if (task->m_iStartShapeId != m_iNextShapeId)
-        {
-            // Should not normally happen, unless the user messes with
-            // GetNextFeature()
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Worker thread task has not expected m_iStartShapeId "
-                     "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
-                     task->m_iStartShapeId, m_iNextShapeId);
-            if (task->m_psArrowArray->release)
-                task->m_psArrowArray->release(task->m_psArrowArray.get());
-
-            stopThread();
-        }
-        else if (task->m_psArrowArray->release)
-        {
-            m_iNextShapeId += task->m_psArrowArray->length;
-
-            // Transfer the task ArrowArray to the client array
-            memcpy(out_array, task->m_psArrowArray.get(),
-                   sizeof(struct ArrowArray));
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
-
-            const bool bMemoryLimitReached = [&task]()
+            const auto stopThread = [&task]()
             {
-                std::unique_lock oLock(task->m_oMutex);
-                return task->m_bMemoryLimitReached;
-            }();
+                {
+                    std::lock_guard oLock(task->m_oMutex);
+                    task->m_bStop = true;
+                    task->m_oCV.notify_one();
+                }
+                if (task->m_oThread.joinable())
+                    task->m_oThread.join();
+            };
 
-            if (bMemoryLimitReached)
+            if (task->m_nStartFID != m_nArrowArrayNextFID)
             {
-                m_nIsCompatOfOptimizedGetNextArrowArray = false;
+                // Should not normally happen, unless the user messes with
+                // GetNextFeature()
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Worker thread task has not expected m_nStartFID "
+                         "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
+                         task->m_nStartFID, m_nArrowArrayNextFID);
+                if (task->m_psArrowArray->release)
+                    task->m_psArrowArray->release(task->m_psArrowArray.get());
+
                 stopThread();
-                CancelAsyncNextArrowArray();
-                return 0;
             }
-            // Are the records still available for reading beyond the current
-            // queued tasks ? If so, recycle this task to read them
-            else if (task->m_iStartShapeId +
-                         static_cast<GIntBig>(nTasks) * nMaxBatchSize <=
-                     m_nTotalFeatureCount)
+            else if (task->m_psArrowArray->release ||
+                     task->m_osErrorMsg.empty())
             {
-                task->m_iStartShapeId +=
-                    static_cast<GIntBig>(nTasks) * nMaxBatchSize;
-                task->m_poLayer->m_iNextShapeId = task->m_iStartShapeId;
-                try
+                m_nArrowArrayNextFID += nMaxBatchSize;
+
+                // Transfer the task ArrowArray to the client array
+                if (task->m_psArrowArray->release)
+                {
+                    m_iNextShapeId += task->m_psArrowArray->length;
+                    memcpy(out_array, task->m_psArrowArray.get(),
+                           sizeof(struct ArrowArray));
+                    memset(task->m_psArrowArray.get(), 0,
+                           sizeof(struct ArrowArray));
+                }
+
+                const bool bMemoryLimitReached = [&task]()
+                {
+                    std::unique_lock oLock(task->m_oMutex);
+                    return task->m_bMemoryLimitReached;
+                }();
+
+                if (bMemoryLimitReached)
                 {
-                    // Wake-up thread with new task
+                    m_nIsCompatOfOptimizedGetNextArrowArray = false;
+                    stopThread();
+                    CancelAsyncNextArrowArray();
+                    return 0;
+                }
+                // Are the records still available for reading beyond the
+                // current queued tasks ? If so, recycle this task to read them
+                else if (task->m_nStartFID +
+                             static_cast<GIntBig>(nTasks) * nMaxBatchSize <=
+                         m_nArrowArrayMaxFID)
+                {
+                    task->m_nStartFID +=
+                        static_cast<GIntBig>(nTasks) * nMaxBatchSize;
+                    task->m_poLayer->m_nArrowArrayNextFID = task->m_nStartFID;
+                    try
                     {
-                        std::lock_guard oLock(task->m_oMutex);
-                        task->m_bFetchRows = true;
-                        task->m_oCV.notify_one();
+                        // Wake-up thread with new task
+                        {
+                            std::lock_guard oLock(task->m_oMutex);
+                            task->m_bFetchRows = true;
+                            task->m_oCV.notify_one();
+                        }
+                        m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
+                    }
+                    catch (const std::exception &e)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Cannot start worker thread: %s", e.what());
+                        stopThread();
                     }
-                    m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
-                    return 0;
                 }
-                catch (const std::exception &e)
+                else
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot start worker thread: %s", e.what());
+                    stopThread();
                 }
+
+                if (out_array->release ||
+                    m_nArrowArrayNextFID > m_nArrowArrayMaxFID)
+                    return 0;
+                continue;
             }
             else
             {
                 stopThread();
-                return 0;
             }
         }
 
-        stopThread();
-    }
-
-    const auto GetThreadsAvailable = []()
-    {
-        const char *pszMaxThreads =
-            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
-        if (pszMaxThreads == nullptr)
-            return std::min(4, CPLGetNumCPUs());
-        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
-            return CPLGetNumCPUs();
-        else
-            return atoi(pszMaxThreads);
-    };
-
-    // Start asynchronous tasks to prefetch the next ArrowArray
-    if (m_poDS->GetAccess() == GA_ReadOnly &&
-        m_oQueueArrowArrayPrefetchTasks.empty() &&
-        m_iNextShapeId + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
-            m_nTotalFeatureCount &&
-        sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
-        CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
-    {
-        const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
-            DIV_ROUND_UP(m_nTotalFeatureCount - nMaxBatchSize - m_iNextShapeId,
-                         nMaxBatchSize),
-            GetThreadsAvailable()));
-        CPLDebug("GPKG", "Using %d threads", nMaxTasks);
-        GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
-        oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
-        oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
-        for (int iTask = 0; iTask < nMaxTasks; ++iTask)
-        {
-            auto task = std::make_unique<ArrowArrayPrefetchTask>();
-            task->m_iStartShapeId =
-                m_iNextShapeId +
-                static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
-            task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
-            if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
-            {
-                break;
-            }
-            auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
-                task->m_poDS->GetLayerByName(GetName()));
-            if (poOtherLayer == nullptr ||
-                poOtherLayer->GetLayerDefn()->GetFieldCount() !=
-                    m_poFeatureDefn->GetFieldCount())
-            {
-                break;
-            }
+        const auto GetThreadsAvailable = []()
+        {
+            const char *pszMaxThreads =
+                CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
+            if (pszMaxThreads == nullptr)
+                return std::min(4, CPLGetNumCPUs());
+            else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+                return CPLGetNumCPUs();
+            else
+                return atoi(pszMaxThreads);
+        };
 
-            // Install query logging callback
-            if (m_poDS->pfnQueryLoggerFunc)
-            {
-                task->m_poDS->SetQueryLoggerFunc(m_poDS->pfnQueryLoggerFunc,
-                                                 m_poDS->poQueryLoggerArg);
-            }
+        // Start asynchronous tasks to prefetch the next ArrowArray
+        if (m_poDS->GetAccess() == GA_ReadOnly &&
+            m_oQueueArrowArrayPrefetchTasks.empty() &&
+            m_nArrowArrayNextFID + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
+                m_nArrowArrayMaxFID + 1 &&
+            sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
+            CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
+        {
+            const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
+                DIV_ROUND_UP(m_nArrowArrayMaxFID + 1 - nMaxBatchSize -
+                                 m_nArrowArrayNextFID,
+                             nMaxBatchSize),
+                GetThreadsAvailable()));
+            CPLDebug("GPKG", "Using %d threads", nMaxTasks);
+            GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
+            oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
+            oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
+            for (int iTask = 0; iTask < nMaxTasks; ++iTask)
+            {
+                auto task = std::make_unique<ArrowArrayPrefetchTask>();
+                task->m_nStartFID =
+                    m_nArrowArrayNextFID +
+                    static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
+                task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
+                if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
+                {
+                    break;
+                }
+                auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
+                    task->m_poDS->GetLayerByName(GetName()));
+                if (poOtherLayer == nullptr ||
+                    poOtherLayer->GetLayerDefn()->GetFieldCount() !=
+                        m_poFeatureDefn->GetFieldCount())
+                {
+                    break;
+                }
 
-            task->m_poLayer = poOtherLayer;
-            task->m_psArrowArray = std::make_unique<struct ArrowArray>();
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+                // Install query logging callback
+                if (m_poDS->pfnQueryLoggerFunc)
+                {
+                    task->m_poDS->SetQueryLoggerFunc(
+                        m_poDS->pfnQueryLoggerFunc, m_poDS->poQueryLoggerArg);
+                }
 
-            poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
-            poOtherLayer->m_aosArrowArrayStreamOptions =
-                m_aosArrowArrayStreamOptions;
-            OGRLayer *poOtherLayerAsLayer = poOtherLayer;
-            auto poOtherFDefn = poOtherLayerAsLayer->GetLayerDefn();
-            for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
-            {
-                poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
-            }
-            for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
-            {
-                poOtherFDefn->GetFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
-            }
+                task->m_poLayer = poOtherLayer;
+                task->m_psArrowArray = std::make_unique<struct ArrowArray>();
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
+
+                poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
+                poOtherLayer->m_nArrowArrayMinFID = m_nArrowArrayMinFID;
+                poOtherLayer->m_nArrowArrayMaxFID = m_nArrowArrayMaxFID;
+                poOtherLayer->m_aosArrowArrayStreamOptions =
+                    m_aosArrowArrayStreamOptions;
+                OGRLayer *poOtherLayerAsLayer = poOtherLayer;
+                auto poOtherFDefn = poOtherLayerAsLayer->GetLayerDefn();
+                for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+                }
+                for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+                }
 
-            poOtherLayer->m_iNextShapeId = task->m_iStartShapeId;
+                poOtherLayer->m_nArrowArrayNextFID = task->m_nStartFID;
 
-            auto taskPtr = task.get();
-            auto taskRunner = [taskPtr]()
-            {
-                std::unique_lock oLock(taskPtr->m_oMutex);
-                do
+                auto taskPtr = task.get();
+                auto taskRunner = [taskPtr]()
                 {
-                    taskPtr->m_bFetchRows = false;
-                    taskPtr->m_poLayer->GetNextArrowArrayInternal(
-                        taskPtr->m_psArrowArray.get(), taskPtr->m_osErrorMsg,
-                        taskPtr->m_bMemoryLimitReached);
-                    taskPtr->m_bArrayReady = true;
-                    taskPtr->m_oCV.notify_one();
-                    if (taskPtr->m_bMemoryLimitReached)
-                        break;
-                    // cppcheck-suppress knownConditionTrueFalse
-                    // Coverity apparently is confused by the fact that we
-                    // use unique_lock here to guard access for m_bStop whereas
-                    // in other places we use a lock_guard, but there's nothing
-                    // wrong.
-                    // coverity[missing_lock:FALSE]
-                    while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                    std::unique_lock oLock(taskPtr->m_oMutex);
+                    do
                     {
-                        taskPtr->m_oCV.wait(oLock);
-                    }
-                } while (!taskPtr->m_bStop);
-            };
+                        taskPtr->m_bFetchRows = false;
+                        taskPtr->m_poLayer->GetNextArrowArrayInternal(
+                            taskPtr->m_psArrowArray.get(),
+                            taskPtr->m_osErrorMsg,
+                            taskPtr->m_bMemoryLimitReached);
+                        taskPtr->m_bArrayReady = true;
+                        taskPtr->m_oCV.notify_one();
+                        if (taskPtr->m_bMemoryLimitReached)
+                            break;
+                        // cppcheck-suppress knownConditionTrueFalse
+                        // Coverity apparently is confused by the fact that we
+                        // use unique_lock here to guard access for m_bStop
+                        // whereas in other places we use a lock_guard, but
+                        // there's nothing wrong.
+                        // coverity[missing_lock:FALSE]
+                        while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                        {
+                            taskPtr->m_oCV.wait(oLock);
+                        }
+                    } while (!taskPtr->m_bStop);
+                };
 
-            task->m_bFetchRows = true;
-            try
-            {
-                task->m_oThread = std::thread(taskRunner);
-            }
-            catch (const std::exception &e)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot start worker thread: %s", e.what());
-                break;
+                task->m_bFetchRows = true;
+                try
+                {
+                    task->m_oThread = std::thread(taskRunner);
+                }
+                catch (const std::exception &e)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot start worker thread: %s", e.what());
+                    break;
+                }
+                m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
             }
-            m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
         }
-    }
 
-    std::string osErrorMsg;
-    bool bMemoryLimitReached = false;
-    int ret =
-        GetNextArrowArrayInternal(out_array, osErrorMsg, bMemoryLimitReached);
-    if (!osErrorMsg.empty())
-        CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
-    if (bMemoryLimitReached)
-    {
-        CancelAsyncNextArrowArray();
-        m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        std::string osErrorMsg;
+        bool bMemoryLimitReached = false;
+        const int ret = GetNextArrowArrayInternal(out_array, osErrorMsg,
+                                                  bMemoryLimitReached);
+        if (!osErrorMsg.empty())
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
+        if (bMemoryLimitReached)
+        {
+            CancelAsyncNextArrowArray();
+            m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        }
+        if (ret != 0 || out_array->release || !osErrorMsg.empty() ||
+            bMemoryLimitReached || m_nArrowArrayNextFID > m_nArrowArrayMaxFID)
+        {
+            return ret;
+        }
     }
-    return ret;
 }
 
 /************************************************************************/
@@ -8930,7 +8972,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     bMemoryLimitReached = false;
     memset(out_array, 0, sizeof(*out_array));
 
-    if (m_iNextShapeId >= m_nTotalFeatureCount)
+    if (m_nArrowArrayNextFID > m_nArrowArrayMaxFID)
     {
         return 0;
     }
@@ -8939,6 +8981,8 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
         m_poDS, m_poFeatureDefn, m_aosArrowArrayStreamOptions, out_array);
     if (out_array->release == nullptr)
     {
+        // Distinguish from an empty FID range when run in a worker thread
+        osErrorMsg = "Cannot allocate ArrowArray";
         return ENOMEM;
     }
 
@@ -9005,10 +9049,10 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     osSQL += "\" WHERE \"";
     osSQL += SQLEscapeName(m_pszFidColumn);
     osSQL += "\" BETWEEN ";
-    osSQL += std::to_string(m_iNextShapeId + 1);
+    osSQL += std::to_string(m_nArrowArrayNextFID);
     osSQL += " AND ";
-    osSQL += std::to_string(m_iNextShapeId +
-                            sFillArrowArray.psHelper->m_nMaxBatchSize);
+    osSQL += std::to_string(m_nArrowArrayNextFID +
+                            sFillArrowArray.psHelper->m_nMaxBatchSize - 1);
 
     // CPLDebug("GPKG", "%s", osSQL.c_str());
 
@@ -9044,6 +9088,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     }
 
     m_iNextShapeId += sFillArrowArray.nCountRows;
+    m_nArrowArrayNextFID += sFillArrowArray.psHelper->m_nMaxBatchSize;
 
     return 0;
 }
@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <deque>
+#include <utility>
 
 /**
  * \file ogrsf_frmts.h
@@ -136,6 +137,20 @@ class CPL_DLL OGRLayer : public GDALMajorObject
         std::vector<GIntBig> m_anQueriedFIDs{};
         size_t m_iQueriedFIDS = 0;
         std::deque<std::unique_ptr<OGRFeature>> m_oFeatureQueue{};
+        // (Arrow column index, OGR geometry field index) of the WKB columns
+        // converted to GeoArrow when GEOMETRY_ENCODING=GEOARROW[_INTERLEAVED]
+        std::vector<std::pair<int, int>> m_anGeoArrowColumns{};
+        // Schema with the WKB columns, or nullptr if not computed yet
+        struct ArrowSchema *m_psWKBSchema = nullptr;
+
+        ArrowArrayStreamPrivateData() = default;
+        ~ArrowArrayStreamPrivateData();
+        ArrowArrayStreamPrivateData(const ArrowArrayStreamPrivateData &) =
+            delete;
+        ArrowArrayStreamPrivateData &
+        operator=(const ArrowArrayStreamPrivateData &) = delete;
+
+        void ResetGeoArrowColumns();
     };
 
     std::shared_ptr<ArrowArrayStreamPrivateData>
@@ -149,6 +164,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     friend class OGRArrowArrayHelper;
     friend class OGRGenSQLResultsLayer;
+    friend struct OGRGenSQLJoinHashTable;
     static void ReleaseArray(struct ArrowArray *array);
     static void ReleaseSchema(struct ArrowSchema *schema);
     static void ReleaseStream(struct ArrowArrayStream *stream);
@@ -161,6 +177,9 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     static int StaticGetNextArrowArray(struct ArrowArrayStream *,
                                        struct ArrowArray *out_array);
     static const char *GetLastErrorArrowArrayStream(struct ArrowArrayStream *);
+    bool ConvertArrowSchemaToGeoArrow(struct ArrowSchema *schema);
+    bool ConvertArrowArrayToGeoArrow(struct ArrowArrayStream *stream,
+                                     struct ArrowArray *array);
 
     static struct ArrowSchema *
     CreateSchemaForWKBGeometryColumn(const OGRGeomFieldDefn *poFieldDefn,
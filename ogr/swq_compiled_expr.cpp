@@ -0,0 +1,857 @@
+/******************************************************************************
+ *
+ * Component: OGR SQL Engine
+ * Purpose: Compiled form of OGR SQL WHERE expressions.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "ogr_swq_compiled.h"
+
+#include <cctype>
+#include <cstring>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "ogr_feature.h"
+#include "ogr_p.h"
+#include "ogr_recordbatch.h"
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                          GetRuntimeType()                            */
+/*                                                                      */
+/*      Type of the value returned for a node by                        */
+/*      swq_expr_node::Evaluate() with the OGRFeature fetcher, which is */
+/*      what SWQGeneralEvaluator() dispatches on.                       */
+/************************************************************************/
+
+static swq_field_type GetRuntimeType(const swq_expr_node *poNode)
+{
+    if (poNode->eNodeType == SNT_COLUMN && poNode->field_type == SWQ_BOOLEAN)
+        return SWQ_INTEGER;
+    return poNode->field_type;
+}
+
+static bool IsIntegerOrBoolean(swq_field_type eType)
+{
+    return SWQ_IS_INTEGER(eType) || eType == SWQ_BOOLEAN;
+}
+
+/************************************************************************/
+/*                             SetColumn()                              */
+/************************************************************************/
+
+void swq_compiled_expr::SetColumn(Instr &sInstr,
+                                  const swq_expr_node *poColumn,
+                                  const OGRFeatureDefn *poDefn)
+{
+    // Same logic as OGRFeatureFetcherFixFieldIndex() in ogrfeaturequery.cpp:
+    // an extra FID column may be declared after the regular, special and
+    // geometry fields.
+    const int nFieldCount = poDefn->GetFieldCount();
+    sInstr.iField = poColumn->field_index;
+    if (sInstr.iField ==
+        nFieldCount + SPECIAL_FIELD_COUNT + poDefn->GetGeomFieldCount())
+    {
+        sInstr.iField = nFieldCount + SPF_FID;
+    }
+    sInstr.bRegularField = sInstr.iField < nFieldCount;
+    if (sInstr.bRegularField)
+        sInstr.osFieldName = poDefn->GetFieldDefn(sInstr.iField)->GetNameRef();
+    sInstr.eFieldType = poColumn->field_type;
+}
+
+/************************************************************************/
+/*                      CompileColumnPredicate()                        */
+/*                                                                      */
+/*      Compile "column op constant", "constant op column",             */
+/*      "column IN (constants)" and "column BETWEEN constant AND        */
+/*      constant" when the comparison made by SWQGeneralEvaluator() can */
+/*      be reproduced.                                                  */
+/************************************************************************/
+
+bool swq_compiled_expr::CompileColumnPredicate(swq_expr_node *poNode,
+                                               const OGRFeatureDefn *poDefn,
+                                               Instr &sInstr)
+{
+    const swq_op eOp = poNode->nOperation;
+    const int nSubExprCount = poNode->nSubExprCount;
+    if (nSubExprCount < 2)
+        return false;
+    if (eOp == SWQ_BETWEEN && nSubExprCount != 3)
+        return false;
+    if (eOp != SWQ_IN && eOp != SWQ_BETWEEN && nSubExprCount != 2)
+        return false;
+
+    int iColumn = 0;
+    if (nSubExprCount == 2 && eOp != SWQ_IN &&
+        poNode->papoSubExpr[1]->eNodeType == SNT_COLUMN)
+    {
+        iColumn = 1;
+    }
+
+    const swq_expr_node *poColumn = poNode->papoSubExpr[iColumn];
+    if (poColumn->eNodeType != SNT_COLUMN || poColumn->table_index != 0 ||
+        poColumn->field_index < 0)
+    {
+        return false;
+    }
+    const swq_field_type eColumnType = poColumn->field_type;
+    if (eColumnType != SWQ_INTEGER && eColumnType != SWQ_INTEGER64 &&
+        eColumnType != SWQ_BOOLEAN && eColumnType != SWQ_FLOAT &&
+        eColumnType != SWQ_STRING)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < nSubExprCount; ++i)
+    {
+        if (i == iColumn)
+            continue;
+        const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+        if (poConstant->eNodeType != SNT_CONSTANT || poConstant->is_null)
+            return false;
+        const swq_field_type eType = poConstant->field_type;
+        if (!IsIntegerOrBoolean(eType) && eType != SWQ_FLOAT &&
+            !(eType == SWQ_STRING && poConstant->string_value))
+        {
+            return false;
+        }
+    }
+
+    // Reproduce the selection of the branch of SWQGeneralEvaluator()
+    const swq_field_type eType0 = GetRuntimeType(poNode->papoSubExpr[0]);
+    const swq_field_type eType1 = GetRuntimeType(poNode->papoSubExpr[1]);
+    if (eType0 == SWQ_FLOAT || eType1 == SWQ_FLOAT)
+    {
+        sInstr.eValueType = ValueType::REAL;
+        for (int i = 0; i < nSubExprCount; ++i)
+        {
+            // Only the first two values are converted from integer to
+            // floating point by SWQGeneralEvaluator(), and never booleans.
+            const swq_field_type eType =
+                GetRuntimeType(poNode->papoSubExpr[i]);
+            if (!(eType == SWQ_FLOAT || (i < 2 && SWQ_IS_INTEGER(eType))))
+                return false;
+            if (i != iColumn)
+            {
+                const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+                sInstr.adfValues.push_back(
+                    eType == SWQ_FLOAT
+                        ? poConstant->float_value
+                        : static_cast<double>(poConstant->int_value));
+            }
+        }
+    }
+    else if (IsIntegerOrBoolean(eType0))
+    {
+        sInstr.eValueType = ValueType::INTEGER;
+        for (int i = 0; i < nSubExprCount; ++i)
+        {
+            if (!IsIntegerOrBoolean(GetRuntimeType(poNode->papoSubExpr[i])))
+                return false;
+            if (i != iColumn)
+                sInstr.anValues.push_back(poNode->papoSubExpr[i]->int_value);
+        }
+    }
+    else if (eType0 == SWQ_STRING)
+    {
+        sInstr.eValueType = ValueType::STRING;
+        for (int i = 0; i < nSubExprCount; ++i)
+        {
+            if (GetRuntimeType(poNode->papoSubExpr[i]) != SWQ_STRING)
+                return false;
+            if (i == iColumn)
+                continue;
+            const char *pszValue = poNode->papoSubExpr[i]->string_value;
+            // SWQGeneralEvaluator() has special rules for the equality of
+            // strings that look like timestamps with or without a +00
+            // timezone.
+            const size_t nLen = strlen(pszValue);
+            if (eOp == SWQ_EQ && nLen > 3 &&
+                (strcmp(pszValue + nLen - 3, "+00") == 0 ||
+                 pszValue[nLen - 3] == ':'))
+            {
+                return false;
+            }
+            sInstr.aosValues.push_back(pszValue);
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    switch (eOp)
+    {
+        case SWQ_EQ:
+        case SWQ_NE:
+            sInstr.eOpCode = OpCode::COMPARE;
+            sInstr.eOp = eOp;
+            break;
+
+        // Mirror the operator when the column is on the right side
+        case SWQ_LT:
+        case SWQ_GE:
+            sInstr.eOpCode = OpCode::COMPARE;
+            sInstr.eOp = iColumn == 0 ? eOp : eOp == SWQ_LT ? SWQ_GT : SWQ_LE;
+            break;
+
+        case SWQ_GT:
+        case SWQ_LE:
+            sInstr.eOpCode = OpCode::COMPARE;
+            sInstr.eOp = iColumn == 0 ? eOp : eOp == SWQ_GT ? SWQ_LT : SWQ_GE;
+            break;
+
+        case SWQ_IN:
+            sInstr.eOpCode = OpCode::IN;
+            break;
+
+        case SWQ_BETWEEN:
+            sInstr.eOpCode = OpCode::BETWEEN;
+            break;
+
+        default:
+            return false;
+    }
+
+    SetColumn(sInstr, poColumn, poDefn);
+    return true;
+}
+
+/************************************************************************/
+/*                            CompileNode()                             */
+/************************************************************************/
+
+int swq_compiled_expr::CompileNode(swq_expr_node *poNode,
+                                   const OGRFeatureDefn *poDefn,
+                                   bool bNeedNull)
+{
+    Instr sInstr;
+    sInstr.bNeedNull = bNeedNull;
+
+    if (poNode->eNodeType == SNT_OPERATION)
+    {
+        const swq_op eOp = poNode->nOperation;
+        if ((eOp == SWQ_AND || eOp == SWQ_OR) && poNode->nSubExprCount == 2 &&
+            IsIntegerOrBoolean(GetRuntimeType(poNode->papoSubExpr[0])))
+        {
+            sInstr.eOpCode = eOp == SWQ_AND ? OpCode::AND : OpCode::OR;
+            sInstr.iFirst =
+                CompileNode(poNode->papoSubExpr[0], poDefn, bNeedNull);
+            sInstr.iSecond =
+                CompileNode(poNode->papoSubExpr[1], poDefn, bNeedNull);
+        }
+        else if (eOp == SWQ_NOT && poNode->nSubExprCount == 1 &&
+                 IsIntegerOrBoolean(GetRuntimeType(poNode->papoSubExpr[0])))
+        {
+            sInstr.eOpCode = OpCode::NOT;
+            sInstr.iFirst = CompileNode(poNode->papoSubExpr[0], poDefn,
+                                        /* bNeedNull = */ true);
+        }
+        else if (eOp == SWQ_ISNULL && poNode->nSubExprCount == 1 &&
+                 poNode->papoSubExpr[0]->eNodeType == SNT_COLUMN &&
+                 poNode->papoSubExpr[0]->table_index == 0 &&
+                 poNode->papoSubExpr[0]->field_type != SWQ_GEOMETRY &&
+                 poNode->papoSubExpr[0]->field_index >= 0)
+        {
+            sInstr.eOpCode = OpCode::IS_NULL;
+            SetColumn(sInstr, poNode->papoSubExpr[0], poDefn);
+        }
+        else if (!CompileColumnPredicate(poNode, poDefn, sInstr))
+        {
+            sInstr = Instr();
+            sInstr.bNeedNull = bNeedNull;
+        }
+    }
+
+    if (sInstr.eOpCode == OpCode::GENERIC)
+    {
+        sInstr.poNode = poNode;
+        m_bHasGeneric = true;
+    }
+
+    m_aoInstrs.push_back(std::move(sInstr));
+    return static_cast<int>(m_aoInstrs.size()) - 1;
+}
+
+/************************************************************************/
+/*                              Compile()                               */
+/************************************************************************/
+
+/** Compile a WHERE expression, that has been checked against poDefn.
+ *
+ * Returns nullptr if the root of the expression cannot be compiled.
+ */
+std::unique_ptr<swq_compiled_expr>
+swq_compiled_expr::Compile(const swq_expr_node *poExpr,
+                           const OGRFeatureDefn *poDefn)
+{
+    if (poExpr == nullptr || poExpr->HasReachedMaxDepth())
+        return nullptr;
+
+    std::unique_ptr<swq_compiled_expr> poCompiled(new swq_compiled_expr());
+    // Work on a copy, as callers of OGRFeatureQuery::GetSWQExpr() may
+    // rewrite the expression in place.
+    poCompiled->m_poExpr.reset(const_cast<swq_expr_node *>(poExpr)->Clone());
+    poCompiled->m_iRoot = poCompiled->CompileNode(
+        poCompiled->m_poExpr.get(), poDefn, /* bNeedNull = */ false);
+    if (poCompiled->m_aoInstrs[poCompiled->m_iRoot].eOpCode ==
+        OpCode::GENERIC)
+    {
+        return nullptr;
+    }
+    return poCompiled;
+}
+
+/************************************************************************/
+/*                          CompareStrings()                            */
+/*                                                                      */
+/*      Same as strcasecmp(), with a first string that is not           */
+/*      necessarily nul-terminated.                                     */
+/************************************************************************/
+
+static int CompareStrings(const char *pszA, size_t nLenA, const char *pszB)
+{
+    for (size_t i = 0;; ++i)
+    {
+        const int chA =
+            i < nLenA ? tolower(static_cast<unsigned char>(pszA[i])) : 0;
+        const int chB = tolower(static_cast<unsigned char>(pszB[i]));
+        if (chA != chB)
+            return chA - chB;
+        if (chA == 0)
+            return 0;
+    }
+}
+
+/************************************************************************/
+/*                          ApplyComparison()                           */
+/************************************************************************/
+
+template <class T> static bool ApplyComparison(swq_op eOp, T a, T b)
+{
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            return a == b;
+        case SWQ_NE:
+            return a != b;
+        case SWQ_LT:
+            return a < b;
+        case SWQ_LE:
+            return a <= b;
+        case SWQ_GT:
+            return a > b;
+        case SWQ_GE:
+            return a >= b;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                           TestPredicate()                            */
+/*                                                                      */
+/*      Evaluate a COMPARE, IN or BETWEEN instruction for a non-null    */
+/*      value of the column. cmp(eOp, a, b) applies a comparison        */
+/*      operator.                                                       */
+/************************************************************************/
+
+template <class T, class U, class Cmp>
+static bool TestPredicate(swq_op eOp, bool bIn, bool bBetween, const T &value,
+                          const std::vector<U> &values, Cmp cmp)
+{
+    if (bIn)
+    {
+        for (const auto &v : values)
+        {
+            if (cmp(SWQ_EQ, value, v))
+                return true;
+        }
+        return false;
+    }
+    if (bBetween)
+        return cmp(SWQ_GE, value, values[0]) && cmp(SWQ_LE, value, values[1]);
+    return cmp(eOp, value, values[0]);
+}
+
+static bool CompareIntegers(swq_op eOp, GIntBig a, GIntBig b)
+{
+    return ApplyComparison(eOp, a, b);
+}
+
+static bool CompareReals(swq_op eOp, double a, double b)
+{
+    return ApplyComparison(eOp, a, b);
+}
+
+static bool CompareCStrings(swq_op eOp, const char *a, const std::string &b)
+{
+    return ApplyComparison(eOp, strcasecmp(a, b.c_str()), 0);
+}
+
+/************************************************************************/
+/*                           EvaluateInstr()                            */
+/************************************************************************/
+
+swq_compiled_expr::Value swq_compiled_expr::EvaluateInstr(
+    int iInstr, OGRFeature *poFeature, swq_field_fetcher pfnFetcher,
+    const swq_evaluation_context &sContext, bool &bError) const
+{
+    const Instr &sInstr = m_aoInstrs[iInstr];
+    Value sRet;
+
+    switch (sInstr.eOpCode)
+    {
+        case OpCode::AND:
+        {
+            const Value sFirst = EvaluateInstr(sInstr.iFirst, poFeature,
+                                               pfnFetcher, sContext, bError);
+            // AND is null only if both operands are null
+            if (bError ||
+                (!sFirst.bValue && (!sInstr.bNeedNull || !sFirst.bNull)))
+            {
+                return sRet;
+            }
+            const Value sSecond = EvaluateInstr(sInstr.iSecond, poFeature,
+                                                pfnFetcher, sContext, bError);
+            sRet.bValue = sFirst.bValue && sSecond.bValue;
+            sRet.bNull = sFirst.bNull && sSecond.bNull;
+            return sRet;
+        }
+
+        case OpCode::OR:
+        {
+            const Value sFirst = EvaluateInstr(sInstr.iFirst, poFeature,
+                                               pfnFetcher, sContext, bError);
+            if (bError)
+                return sRet;
+            if (sFirst.bValue && !sInstr.bNeedNull)
+            {
+                sRet.bValue = true;
+                return sRet;
+            }
+            const Value sSecond = EvaluateInstr(sInstr.iSecond, poFeature,
+                                                pfnFetcher, sContext, bError);
+            sRet.bValue = sFirst.bValue || sSecond.bValue;
+            sRet.bNull = sFirst.bNull || sSecond.bNull;
+            return sRet;
+        }
+
+        case OpCode::NOT:
+        {
+            const Value sFirst = EvaluateInstr(sInstr.iFirst, poFeature,
+                                               pfnFetcher, sContext, bError);
+            sRet.bValue = !sFirst.bValue && !sFirst.bNull;
+            sRet.bNull = sFirst.bNull;
+            return sRet;
+        }
+
+        case OpCode::IS_NULL:
+        {
+            sRet.bValue = !poFeature->IsFieldSetAndNotNull(sInstr.iField);
+            return sRet;
+        }
+
+        case OpCode::GENERIC:
+        {
+            swq_expr_node *poResult =
+                sInstr.poNode->Evaluate(pfnFetcher, poFeature, sContext);
+            if (poResult == nullptr)
+            {
+                bError = true;
+                return sRet;
+            }
+            sRet.bValue = poResult->int_value != 0;
+            sRet.bNull = poResult->is_null != 0;
+            delete poResult;
+            return sRet;
+        }
+
+        case OpCode::COMPARE:
+        case OpCode::IN:
+        case OpCode::BETWEEN:
+            break;
+    }
+
+    if (!poFeature->IsFieldSetAndNotNull(sInstr.iField))
+    {
+        // Comparisons with NULL are NULL
+        sRet.bNull = true;
+        return sRet;
+    }
+
+    const bool bIn = sInstr.eOpCode == OpCode::IN;
+    const bool bBetween = sInstr.eOpCode == OpCode::BETWEEN;
+    switch (sInstr.eValueType)
+    {
+        case ValueType::INTEGER:
+        {
+            const GIntBig nValue =
+                sInstr.eFieldType == SWQ_INTEGER64
+                    ? poFeature->GetFieldAsInteger64(sInstr.iField)
+                    : poFeature->GetFieldAsInteger(sInstr.iField);
+            sRet.bValue = TestPredicate(sInstr.eOp, bIn, bBetween, nValue,
+                                        sInstr.anValues, CompareIntegers);
+            break;
+        }
+
+        case ValueType::REAL:
+        {
+            double dfValue;
+            if (sInstr.eFieldType == SWQ_FLOAT)
+                dfValue = poFeature->GetFieldAsDouble(sInstr.iField);
+            else if (sInstr.eFieldType == SWQ_INTEGER64)
+                dfValue = static_cast<double>(
+                    poFeature->GetFieldAsInteger64(sInstr.iField));
+            else
+                dfValue = poFeature->GetFieldAsInteger(sInstr.iField);
+            sRet.bValue = TestPredicate(sInstr.eOp, bIn, bBetween, dfValue,
+                                        sInstr.adfValues, CompareReals);
+            break;
+        }
+
+        case ValueType::STRING:
+        {
+            const char *pszValue = poFeature->GetFieldAsString(sInstr.iField);
+            sRet.bValue = TestPredicate(sInstr.eOp, bIn, bBetween, pszValue,
+                                        sInstr.aosValues, CompareCStrings);
+            break;
+        }
+    }
+
+    return sRet;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+/** Evaluate the expression on a feature, and return its logical value. */
+bool swq_compiled_expr::Evaluate(OGRFeature *poFeature,
+                                 swq_field_fetcher pfnFetcher,
+                                 const swq_evaluation_context &sContext) const
+{
+    bool bError = false;
+    const Value sValue =
+        EvaluateInstr(m_iRoot, poFeature, pfnFetcher, sContext, bError);
+    return !bError && sValue.bValue;
+}
+
+/************************************************************************/
+/*                         Arrow column helpers                         */
+/************************************************************************/
+
+static bool IsArrowNull(const struct ArrowArray *psArray, size_t iRow)
+{
+    if (psArray->null_count == 0 || psArray->buffers[0] == nullptr)
+        return false;
+    const uint8_t *pabyValidity =
+        static_cast<const uint8_t *>(psArray->buffers[0]);
+    const size_t i = iRow + static_cast<size_t>(psArray->offset);
+    return (pabyValidity[i / 8] & (1 << (i % 8))) == 0;
+}
+
+template <class T>
+static void ReadArrowValues(const struct ArrowArray *psArray, size_t nLength,
+                            std::vector<GIntBig> &anValues)
+{
+    const T *panData = static_cast<const T *>(psArray->buffers[1]) +
+                       static_cast<size_t>(psArray->offset);
+    for (size_t i = 0; i < nLength; ++i)
+        anValues[i] = static_cast<GIntBig>(panData[i]);
+}
+
+/** Read the values of an Arrow column of integer or boolean type, only if
+ * its values are exactly representable with eFieldType. */
+static bool ReadArrowIntegerValues(const char *pszFormat,
+                                   swq_field_type eFieldType,
+                                   const struct ArrowArray *psArray,
+                                   size_t nLength,
+                                   std::vector<GIntBig> &anValues)
+{
+    anValues.resize(nLength);
+    if (strcmp(pszFormat, "b") == 0)
+    {
+        const uint8_t *pabyData =
+            static_cast<const uint8_t *>(psArray->buffers[1]);
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            const size_t j = i + nOffset;
+            anValues[i] = (pabyData[j / 8] >> (j % 8)) & 1;
+        }
+    }
+    else if (strcmp(pszFormat, "c") == 0)
+        ReadArrowValues<int8_t>(psArray, nLength, anValues);
+    else if (strcmp(pszFormat, "C") == 0)
+        ReadArrowValues<uint8_t>(psArray, nLength, anValues);
+    else if (strcmp(pszFormat, "s") == 0)
+        ReadArrowValues<int16_t>(psArray, nLength, anValues);
+    else if (strcmp(pszFormat, "S") == 0)
+        ReadArrowValues<uint16_t>(psArray, nLength, anValues);
+    else if (strcmp(pszFormat, "i") == 0)
+        ReadArrowValues<int32_t>(psArray, nLength, anValues);
+    else if (eFieldType == SWQ_INTEGER64 && strcmp(pszFormat, "I") == 0)
+        ReadArrowValues<uint32_t>(psArray, nLength, anValues);
+    else if (eFieldType == SWQ_INTEGER64 && strcmp(pszFormat, "l") == 0)
+        ReadArrowValues<int64_t>(psArray, nLength, anValues);
+    else
+        return false;
+    return true;
+}
+
+/** Read the values of an Arrow column of floating point type. */
+static bool ReadArrowRealValues(const char *pszFormat,
+                                const struct ArrowArray *psArray,
+                                size_t nLength, std::vector<double> &adfValues)
+{
+    adfValues.resize(nLength);
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    if (strcmp(pszFormat, "f") == 0)
+    {
+        const float *pafData =
+            static_cast<const float *>(psArray->buffers[1]) + nOffset;
+        for (size_t i = 0; i < nLength; ++i)
+            adfValues[i] = static_cast<double>(pafData[i]);
+    }
+    else if (strcmp(pszFormat, "g") == 0)
+    {
+        const double *padfData =
+            static_cast<const double *>(psArray->buffers[1]) + nOffset;
+        for (size_t i = 0; i < nLength; ++i)
+            adfValues[i] = padfData[i];
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/** Return the i-th value of a string Arrow column, truncated at the first
+ * nul character as it would be in a OGRFeature. */
+template <class OffsetType>
+static const char *GetArrowString(const struct ArrowArray *psArray, size_t i,
+                                  size_t &nLen)
+{
+    const OffsetType *panOffsets =
+        static_cast<const OffsetType *>(psArray->buffers[1]) +
+        static_cast<size_t>(psArray->offset);
+    const char *pszData = static_cast<const char *>(psArray->buffers[2]) +
+                          static_cast<size_t>(panOffsets[i]);
+    nLen = static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]);
+    const void *pNul = memchr(pszData, 0, nLen);
+    if (pNul)
+        nLen = static_cast<size_t>(static_cast<const char *>(pNul) - pszData);
+    return pszData;
+}
+
+/************************************************************************/
+/*                     EvaluateInstrOnArrowArray()                      */
+/************************************************************************/
+
+bool swq_compiled_expr::EvaluateInstrOnArrowArray(
+    int iInstr, const struct ArrowSchema *schema,
+    const struct ArrowArray *array, std::vector<GByte> &abyValue,
+    std::vector<GByte> &abyNull) const
+{
+    const Instr &sInstr = m_aoInstrs[iInstr];
+    const size_t nLength = static_cast<size_t>(array->length);
+    abyValue.assign(nLength, 0);
+    abyNull.assign(nLength, 0);
+
+    switch (sInstr.eOpCode)
+    {
+        case OpCode::AND:
+        case OpCode::OR:
+        {
+            std::vector<GByte> abySecondValue, abySecondNull;
+            if (!EvaluateInstrOnArrowArray(sInstr.iFirst, schema, array,
+                                           abyValue, abyNull) ||
+                !EvaluateInstrOnArrowArray(sInstr.iSecond, schema, array,
+                                           abySecondValue, abySecondNull))
+            {
+                return false;
+            }
+            if (sInstr.eOpCode == OpCode::AND)
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                {
+                    abyValue[i] = abyValue[i] & abySecondValue[i];
+                    abyNull[i] = abyNull[i] & abySecondNull[i];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                {
+                    abyValue[i] = abyValue[i] | abySecondValue[i];
+                    abyNull[i] = abyNull[i] | abySecondNull[i];
+                }
+            }
+            return true;
+        }
+
+        case OpCode::NOT:
+        {
+            if (!EvaluateInstrOnArrowArray(sInstr.iFirst, schema, array,
+                                           abyValue, abyNull))
+            {
+                return false;
+            }
+            for (size_t i = 0; i < nLength; ++i)
+                abyValue[i] = !abyValue[i] && !abyNull[i];
+            return true;
+        }
+
+        case OpCode::GENERIC:
+            return false;
+
+        case OpCode::IS_NULL:
+        case OpCode::COMPARE:
+        case OpCode::IN:
+        case OpCode::BETWEEN:
+            break;
+    }
+
+    if (!sInstr.bRegularField)
+        return false;
+    const struct ArrowArray *psArray = nullptr;
+    const char *pszFormat = nullptr;
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        if (strcmp(schema->children[i]->name, sInstr.osFieldName.c_str()) ==
+            0)
+        {
+            // Dictionary-encoded columns are not handled
+            if (schema->children[i]->dictionary)
+                return false;
+            psArray = array->children[i];
+            pszFormat = schema->children[i]->format;
+            break;
+        }
+    }
+    if (psArray == nullptr)
+        return false;
+
+    if (sInstr.eOpCode == OpCode::IS_NULL)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+            abyValue[i] = IsArrowNull(psArray, i);
+        return true;
+    }
+
+    const bool bIn = sInstr.eOpCode == OpCode::IN;
+    const bool bBetween = sInstr.eOpCode == OpCode::BETWEEN;
+    if (sInstr.eValueType == ValueType::STRING)
+    {
+        const bool bLarge = strcmp(pszFormat, "U") == 0;
+        if (!bLarge && strcmp(pszFormat, "u") != 0)
+            return false;
+        const auto CompareArrowString =
+            [](swq_op eOp, const std::pair<const char *, size_t> &oValue,
+               const std::string &osConstant)
+        {
+            return ApplyComparison(eOp,
+                                   CompareStrings(oValue.first, oValue.second,
+                                                  osConstant.c_str()),
+                                   0);
+        };
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            if (IsArrowNull(psArray, i))
+            {
+                abyNull[i] = true;
+                continue;
+            }
+            std::pair<const char *, size_t> oValue;
+            oValue.first =
+                bLarge ? GetArrowString<uint64_t>(psArray, i, oValue.second)
+                       : GetArrowString<uint32_t>(psArray, i, oValue.second);
+            abyValue[i] = TestPredicate(sInstr.eOp, bIn, bBetween, oValue,
+                                        sInstr.aosValues, CompareArrowString);
+        }
+        return true;
+    }
+
+    std::vector<GIntBig> anValues;
+    std::vector<double> adfValues;
+    if (sInstr.eFieldType == SWQ_FLOAT)
+    {
+        if (!ReadArrowRealValues(pszFormat, psArray, nLength, adfValues))
+            return false;
+    }
+    else if (sInstr.eFieldType == SWQ_STRING ||
+             !ReadArrowIntegerValues(pszFormat, sInstr.eFieldType, psArray,
+                                     nLength, anValues))
+    {
+        return false;
+    }
+    if (sInstr.eValueType == ValueType::REAL && adfValues.empty())
+    {
+        adfValues.resize(nLength);
+        for (size_t i = 0; i < nLength; ++i)
+            adfValues[i] = static_cast<double>(anValues[i]);
+    }
+
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        if (IsArrowNull(psArray, i))
+        {
+            abyNull[i] = true;
+            continue;
+        }
+        abyValue[i] =
+            sInstr.eValueType == ValueType::INTEGER
+                ? TestPredicate(sInstr.eOp, bIn, bBetween, anValues[i],
+                                sInstr.anValues, CompareIntegers)
+                : TestPredicate(sInstr.eOp, bIn, bBetween, adfValues[i],
+                                sInstr.adfValues, CompareReals);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        EvaluateOnArrowArray()                        */
+/************************************************************************/
+
+/** Evaluate the expression column-wise on the top-level columns of an
+ * Arrow array.
+ *
+ * abResult[i] is set to false for rows for which the expression is false.
+ *
+ * Returns false, without modifying abResult, if the expression involves
+ * non-compiled sub-expressions, or columns absent from the array or of
+ * unhandled format.
+ */
+bool swq_compiled_expr::EvaluateOnArrowArray(const struct ArrowSchema *schema,
+                                             const struct ArrowArray *array,
+                                             std::vector<bool> &abResult) const
+{
+    if (m_bHasGeneric || schema->n_children != array->n_children ||
+        abResult.size() != static_cast<size_t>(array->length))
+    {
+        return false;
+    }
+
+    std::vector<GByte> abyValue, abyNull;
+    if (!EvaluateInstrOnArrowArray(m_iRoot, schema, array, abyValue, abyNull))
+        return false;
+    for (size_t i = 0; i < abResult.size(); ++i)
+    {
+        if (!abyValue[i])
+            abResult[i] = false;
+    }
+    return true;
+}
+
+//! @endcond
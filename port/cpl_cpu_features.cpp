@@ -22,6 +22,8 @@
 
 #define CPUID_SSE_EDX_BIT 25
 
+#define CPUID_AVX2_EBX_BIT 5
+
 #define BIT_XMM_STATE (1 << 1)
 #define BIT_YMM_STATE (2 << 1)
 
@@ -47,13 +49,32 @@
             : "0"(level))
 #endif
 
+#if defined(__x86_64)
+#define GCC_CPUID_COUNT(level, count, a, b, c, d)                              \
+    __asm__("xchgq %%rbx, %q1\n"                                               \
+            "cpuid\n"                                                          \
+            "xchgq %%rbx, %q1"                                                 \
+            : "=a"(a), "=r"(b), "=c"(c), "=d"(d)                               \
+            : "0"(level), "2"(count))
+#else
+#define GCC_CPUID_COUNT(level, count, a, b, c, d)                              \
+    __asm__("xchgl %%ebx, %1\n"                                                \
+            "cpuid\n"                                                          \
+            "xchgl %%ebx, %1"                                                  \
+            : "=a"(a), "=r"(b), "=c"(c), "=d"(d)                               \
+            : "0"(level), "2"(count))
+#endif
+
 #define CPL_CPUID(level, array)                                                \
     GCC_CPUID(level, array[0], array[1], array[2], array[3])
+#define CPL_CPUID_COUNT(level, count, array)                                   \
+    GCC_CPUID_COUNT(level, count, array[0], array[1], array[2], array[3])
 
 #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
 
 #include <intrin.h>
 #define CPL_CPUID(level, array) __cpuid(array, level)
+#define CPL_CPUID_COUNT(level, count, array) __cpuidex(array, level, count)
 
 #endif
 
@@ -196,4 +217,97 @@ bool CPLHaveRuntimeAVX()
 
 #endif  // defined(HAVE_AVX_AT_COMPILE_TIME) && !defined(CPLHaveRuntimeAVX)
 
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
+
+/************************************************************************/
+/*                         CPLHaveRuntimeAVX2()                         */
+/************************************************************************/
+
+#if defined(__GNUC__) ||                                                       \
+    (defined(_MSC_FULL_VER) && (_MSC_FULL_VER >= 160040219) &&                 \
+     (defined(_M_IX86) || defined(_M_X64)))
+
+static bool CPLDetectRuntimeAVX2()
+{
+    int cpuinfo[4] = {0, 0, 0, 0};
+    CPL_CPUID(0, cpuinfo);
+
+    // Check that the extended features leaf is available.
+    if (cpuinfo[REG_EAX] < 7)
+    {
+        return false;
+    }
+
+    CPL_CPUID(1, cpuinfo);
+
+    // Check OSXSAVE feature.
+    if ((cpuinfo[REG_ECX] & (1 << CPUID_OSXSAVE_ECX_BIT)) == 0)
+    {
+        return false;
+    }
+
+    // Check AVX feature.
+    if ((cpuinfo[REG_ECX] & (1 << CPUID_AVX_ECX_BIT)) == 0)
+    {
+        return false;
+    }
+
+    // Issue XGETBV and check the XMM and YMM state bit.
+#if defined(__GNUC__)
+    unsigned int nXCRLow;
+    unsigned int nXCRHigh;
+    __asm__("xgetbv" : "=a"(nXCRLow), "=d"(nXCRHigh) : "c"(0));
+    CPL_IGNORE_RET_VAL(nXCRHigh);  // unused
+#else
+    const unsigned __int64 nXCRLow = _xgetbv(_XCR_XFEATURE_ENABLED_MASK);
+#endif
+    if ((nXCRLow & (BIT_XMM_STATE | BIT_YMM_STATE)) !=
+        (BIT_XMM_STATE | BIT_YMM_STATE))
+    {
+        return false;
+    }
+
+    // Check AVX2 feature.
+    CPL_CPUID_COUNT(7, 0, cpuinfo);
+    return (cpuinfo[REG_EBX] & (1 << CPUID_AVX2_EBX_BIT)) != 0;
+}
+
+#endif
+
+#if defined(__GNUC__) && !defined(DEBUG)
+
+bool bCPLHasAVX2 = false;
+static void CPLHaveRuntimeAVX2Initialize() __attribute__((constructor));
+
+static void CPLHaveRuntimeAVX2Initialize()
+{
+    bCPLHasAVX2 = CPLDetectRuntimeAVX2();
+}
+
+#elif defined(__GNUC__) ||                                                     \
+    (defined(_MSC_FULL_VER) && (_MSC_FULL_VER >= 160040219) &&                 \
+     (defined(_M_IX86) || defined(_M_X64)))
+
+bool CPLHaveRuntimeAVX2()
+{
+#ifdef DEBUG
+    // Allows testing the SSE2 code paths on AVX2 capable machines
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX2", "YES")))
+        return false;
+#endif
+    static const bool bHasAVX2 = CPLDetectRuntimeAVX2();
+    return bHasAVX2;
+}
+
+#else
+
+bool CPLHaveRuntimeAVX2()
+{
+    return false;
+}
+
+#endif
+
+#endif  // defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
+
 //! @endcond
@@ -82,6 +82,26 @@ bool CPLHaveRuntimeAVX();
 #endif
 #endif
 
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+#if __AVX2__
+#define HAVE_INLINE_AVX2
+
+static bool inline CPLHaveRuntimeAVX2()
+{
+    return true;
+}
+#elif defined(__GNUC__) && !defined(DEBUG)
+extern bool bCPLHasAVX2;
+
+static bool inline CPLHaveRuntimeAVX2()
+{
+    return bCPLHasAVX2;
+}
+#else
+bool CPLHaveRuntimeAVX2();
+#endif
+#endif
+
 //! @endcond
 
 #endif  // CPL_CPU_FEATURES_H
@@ -346,6 +346,55 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
         return aosRetList.StealList();
 }
 
+/************************************************************************/
+/*                      CSVSplitLineNoQuote()                           */
+/*                                                                      */
+/*      Specialized version of CSVSplitLine() for lines without any     */
+/*      double quote character and a single character delimiter.        */
+/*      Delimiters are located with memchr(), which is vectorized by    */
+/*      the C runtime libraries of all mainstream platforms.            */
+/************************************************************************/
+
+static char **CSVSplitLineNoQuote(const char *pszString, char chDelimiter,
+                                  bool bMergeDelimiter)
+
+{
+    CPLStringList aosRetList;
+    std::string osToken;
+
+    const char *pszIter = pszString;
+    const char *const pszEnd = pszString + strlen(pszString);
+    while (pszIter < pszEnd)
+    {
+        const char *pszDelimiter = static_cast<const char *>(
+            memchr(pszIter, chDelimiter, pszEnd - pszIter));
+        if (pszDelimiter == nullptr)
+        {
+            aosRetList.AddString(pszIter);
+            break;
+        }
+
+        osToken.assign(pszIter, pszDelimiter - pszIter);
+        aosRetList.AddString(osToken.c_str());
+
+        pszIter = pszDelimiter + 1;
+        if (bMergeDelimiter)
+        {
+            while (pszIter < pszEnd && *pszIter == chDelimiter)
+                ++pszIter;
+        }
+
+        // Catch the empty token after a trailing delimiter.
+        if (pszIter == pszEnd)
+            aosRetList.AddString("");
+    }
+
+    if (aosRetList.Count() == 0)
+        return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
+    else
+        return aosRetList.StealList();
+}
+
 /************************************************************************/
 /*                          CSVFindNextLine()                           */
 /*                                                                      */
@@ -609,17 +658,19 @@ char CSVDetectSeperator(const char *pszLine)
 }
 
 /************************************************************************/
-/*                      CSVReadParseLine3L()                            */
+/*                        CSVReadRecordGeneric()                        */
 /*                                                                      */
-/*      Read one line, and return split into fields.  The return        */
-/*      result is a stringlist, in the sense of the CSL functions.      */
+/*      Read one record, that is one line, or several lines if a        */
+/*      quoted string contains newline characters. The returned         */
+/*      pointer is either the line buffer of pfnReadLine, or            */
+/*      osWorkLine.c_str() when lines had to be joined.                 */
 /************************************************************************/
 
-static char **
-CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
-                        size_t nMaxLineSize, const char *pszDelimiter,
-                        bool bHonourStrings, bool bKeepLeadingAndClosingQuotes,
-                        bool bMergeDelimiter, bool bSkipBOM)
+static const char *
+CSVReadRecordGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
+                     size_t nMaxLineSize, const char *pszDelimiter,
+                     bool bHonourStrings, bool bSkipBOM,
+                     std::string &osWorkLine)
 {
     const char *pszLine = pfnReadLine(fp, nMaxLineSize);
     if (pszLine == nullptr)
@@ -633,69 +684,58 @@ CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
             pszLine += 3;
     }
 
-    // Special fix to read NdfcFacilities.xls with un-balanced double quotes.
-    if (!bHonourStrings)
-    {
-        return CSLTokenizeStringComplex(pszLine, pszDelimiter, FALSE, TRUE);
-    }
-
     // If there are no quotes, then this is the simple case.
-    // Parse, and return tokens.
-    if (strchr(pszLine, '\"') == nullptr)
-        return CSVSplitLine(pszLine, pszDelimiter, bKeepLeadingAndClosingQuotes,
-                            bMergeDelimiter);
+    if (!bHonourStrings || strchr(pszLine, '\"') == nullptr)
+        return pszLine;
 
     const size_t nDelimiterLength = strlen(pszDelimiter);
-    bool bInString = false;           // keep in that scope !
-    std::string osWorkLine(pszLine);  // keep in that scope !
-    size_t i = 0;                     // keep in that scope !
+    bool bInString = false;  // keep in that scope !
+    size_t i = 0;            // keep in that scope !
 
     try
     {
+        osWorkLine.assign(pszLine);
         while (true)
         {
-            for (; i < osWorkLine.size(); ++i)
+            // Jump from one double quote to the next one.
+            for (i = osWorkLine.find('\"', i); i != std::string::npos;
+                 i = osWorkLine.find('\"', i + 1))
             {
-                if (osWorkLine[i] == '\"')
+                if (!bInString)
                 {
-                    if (!bInString)
-                    {
-                        // Only consider " as the start of a quoted string
-                        // if it is the first character of the line, or
-                        // if it is immediately after the field delimiter.
-                        if (i == 0 ||
-                            (i >= nDelimiterLength &&
-                             osWorkLine.compare(i - nDelimiterLength,
-                                                nDelimiterLength, pszDelimiter,
-                                                nDelimiterLength) == 0))
-                        {
-                            bInString = true;
-                        }
-                    }
-                    else if (i + 1 < osWorkLine.size() &&
-                             osWorkLine[i + 1] == '"')
+                    // Only consider " as the start of a quoted string
+                    // if it is the first character of the line, or
+                    // if it is immediately after the field delimiter.
+                    if (i == 0 ||
+                        (i >= nDelimiterLength &&
+                         osWorkLine.compare(i - nDelimiterLength,
+                                            nDelimiterLength, pszDelimiter,
+                                            nDelimiterLength) == 0))
                     {
-                        // Escaped double quote in a quoted string
-                        ++i;
-                    }
-                    else
-                    {
-                        bInString = false;
+                        bInString = true;
                     }
                 }
+                else if (i + 1 < osWorkLine.size() && osWorkLine[i + 1] == '"')
+                {
+                    // Escaped double quote in a quoted string
+                    ++i;
+                }
+                else
+                {
+                    bInString = false;
+                }
             }
 
             if (!bInString)
             {
-                return CSVSplitLine(osWorkLine.c_str(), pszDelimiter,
-                                    bKeepLeadingAndClosingQuotes,
-                                    bMergeDelimiter);
+                return osWorkLine.c_str();
             }
 
             const char *pszNewLine = pfnReadLine(fp, nMaxLineSize);
             if (pszNewLine == nullptr)
                 break;
 
+            i = osWorkLine.size();
             osWorkLine.append("\n");
             osWorkLine.append(pszNewLine);
         }
@@ -715,6 +755,71 @@ CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
     return nullptr;
 }
 
+/************************************************************************/
+/*                          CSVSplitRecord()                            */
+/************************************************************************/
+
+/** Split a record, as returned by CSVReadRecordL(), into fields.
+ * The return result is a stringlist, in the sense of the CSL functions.
+ *
+ * This function is thread-safe, and may be used to split records read
+ * by a single thread in several worker threads.
+ *
+ * @param pszRecord Record. Must not be NULL
+ * @param pszDelimiter Delimiter sequence for readers (can be multiple bytes)
+ * @param bHonourStrings Should be true, unless double quotes should not be
+ *                       considered when separating fields.
+ * @param bKeepLeadingAndClosingQuotes Whether the leading and closing double
+ *                                     quote characters should be kept.
+ * @param bMergeDelimiter Whether consecutive delimiters should be considered
+ *                        as a single one. Should generally be set to false.
+ * @since GDAL 3.12
+ */
+char **CSVSplitRecord(const char *pszRecord, const char *pszDelimiter,
+                      bool bHonourStrings, bool bKeepLeadingAndClosingQuotes,
+                      bool bMergeDelimiter)
+{
+    // Special fix to read NdfcFacilities.xls with un-balanced double quotes.
+    if (!bHonourStrings)
+    {
+        return CSLTokenizeStringComplex(pszRecord, pszDelimiter, FALSE, TRUE);
+    }
+
+    if (pszDelimiter[0] != '\0' && pszDelimiter[1] == '\0' &&
+        strchr(pszRecord, '\"') == nullptr)
+    {
+        return CSVSplitLineNoQuote(pszRecord, pszDelimiter[0],
+                                   bMergeDelimiter);
+    }
+
+    return CSVSplitLine(pszRecord, pszDelimiter, bKeepLeadingAndClosingQuotes,
+                        bMergeDelimiter);
+}
+
+/************************************************************************/
+/*                      CSVReadParseLineGeneric()                       */
+/*                                                                      */
+/*      Read one line, and return split into fields.  The return        */
+/*      result is a stringlist, in the sense of the CSL functions.      */
+/************************************************************************/
+
+static char **
+CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
+                        size_t nMaxLineSize, const char *pszDelimiter,
+                        bool bHonourStrings, bool bKeepLeadingAndClosingQuotes,
+                        bool bMergeDelimiter, bool bSkipBOM)
+{
+    std::string osWorkLine;
+    const char *pszRecord =
+        CSVReadRecordGeneric(fp, pfnReadLine, nMaxLineSize, pszDelimiter,
+                             bHonourStrings, bSkipBOM, osWorkLine);
+    if (pszRecord == nullptr)
+        return nullptr;
+
+    return CSVSplitRecord(pszRecord, pszDelimiter, bHonourStrings,
+                          bKeepLeadingAndClosingQuotes, bMergeDelimiter);
+}
+
 /************************************************************************/
 /*                          CSVReadParseLine()                          */
 /*                                                                      */
@@ -827,6 +932,40 @@ char **CSVReadParseLine3L(VSILFILE *fp, size_t nMaxLineSize,
         bKeepLeadingAndClosingQuotes, bMergeDelimiter, bSkipBOM);
 }
 
+/************************************************************************/
+/*                          CSVReadRecordL()                            */
+/************************************************************************/
+
+/** Read one record, without splitting it into fields.
+ *
+ * A record is a line, or several lines joined with a newline character
+ * when a quoted string contains newlines. The record may be split into
+ * fields with CSVSplitRecord().
+ *
+ * @param fp File handle. Must not be NULL
+ * @param nMaxLineSize Maximum line size, or 0 for unlimited.
+ * @param pszDelimiter Delimiter sequence for readers (can be multiple bytes)
+ * @param bHonourStrings Should be true, unless double quotes should not be
+ *                       considered when separating records.
+ * @param bSkipBOM Whether leading UTF-8 BOM should be skipped.
+ * @param[out] osRecord Record.
+ * @return true if a record has been read, false at end of file or in case
+ *         of error.
+ * @since GDAL 3.12
+ */
+bool CSVReadRecordL(VSILFILE *fp, size_t nMaxLineSize, const char *pszDelimiter,
+                    bool bHonourStrings, bool bSkipBOM, std::string &osRecord)
+{
+    const char *pszRecord =
+        CSVReadRecordGeneric(fp, ReadLineLargeFile, nMaxLineSize, pszDelimiter,
+                             bHonourStrings, bSkipBOM, osRecord);
+    if (pszRecord == nullptr)
+        return false;
+    if (pszRecord != osRecord.c_str())
+        osRecord.assign(pszRecord);
+    return true;
+}
+
 /************************************************************************/
 /*                             CSVCompare()                             */
 /*                                                                      */
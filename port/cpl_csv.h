@@ -45,6 +45,11 @@ char CPL_DLL **CSVReadParseLine3L(VSILFILE *fp, size_t nMaxLineSize,
                                   bool bKeepLeadingAndClosingQuotes,
                                   bool bMergeDelimiter, bool bSkipBOM);
 
+char CPL_DLL **CSVSplitRecord(const char *pszRecord, const char *pszDelimiter,
+                              bool bHonourStrings,
+                              bool bKeepLeadingAndClosingQuotes,
+                              bool bMergeDelimiter);
+
 char CPL_DLL **CSVScanLines(FILE *, int, const char *, CSVCompareCriteria);
 char CPL_DLL **CSVScanLinesL(VSILFILE *, int, const char *, CSVCompareCriteria);
 char CPL_DLL **CSVScanFile(const char *, int, const char *, CSVCompareCriteria);
@@ -67,4 +72,14 @@ void CPL_DLL SetCSVFilenameHook(const char *(*)(const char *));
 
 CPL_C_END
 
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
+#include <string>
+
+bool CPL_DLL CSVReadRecordL(VSILFILE *fp, size_t nMaxLineSize,
+                            const char *pszDelimiter, bool bHonourStrings,
+                            bool bSkipBOM, std::string &osRecord);
+
+#endif
+
 #endif /* ndef CPL_CSV_H_INCLUDED */
@@ -136,11 +136,14 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSIL_CURL_AUTHORIZATION_HEADER_ALLOWED_IF_REDIRECT", // from cpl_http.cpp, cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_DIR", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_DISK_CACHE_SIZE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_HONOR_CACHE_CONTROL", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_MAX_RANGES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_NON_CACHED", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READ_AHEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_SLOW_GET_SIZE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_STREMAING_SIMULATED_CURL_ERROR", // from cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_USE_HEAD", // from cpl_vsil_curl.cpp
@@ -354,6 +357,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_OVR_CHUNK_MAX_SIZE", // from overview.cpp
    "GDAL_OVR_CHUNK_MAX_SIZE_FOR_TEMP_FILE", // from overview.cpp
    "GDAL_OVR_CHUNKYSIZE", // from overview.cpp
+   "GDAL_OVR_PIPELINE", // from overview.cpp
    "GDAL_OVR_PROPAGATE_NODATA", // from overview.cpp
    "GDAL_OVR_TEMP_DRIVER", // from overview.cpp
    "GDAL_PAM_ENABLE_MARK_DIRTY", // from gdalpamdataset.cpp
@@ -387,6 +391,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_RASTER_TILE_PNG_FILTER", // from gdalalg_raster_tile.cpp
    "GDAL_RASTER_TILE_USE_PNG_OPTIM", // from gdalalg_raster_tile.cpp
    "GDAL_RASTERIO_RESAMPLING", // from gdal_misc.cpp
+   "GDAL_RB_CACHE_SHARDS", // from gdalrasterblock.cpp
    "GDAL_RB_FLUSHBLOCK_SLEEP_AFTER_DROP_LOCK", // from gdalrasterblock.cpp
    "GDAL_RB_FLUSHBLOCK_SLEEP_AFTER_RB_LOCK", // from gdalrasterblock.cpp
    "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DETACH_BEFORE_WRITE", // from gdalrasterblock.cpp
@@ -413,6 +418,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_TIFF_OVR_BLOCKSIZE", // from geotiff.cpp
    "GDAL_TRY_PDS3_WITH_VICAR", // from pdsdrivercore.cpp
    "GDAL_USE_AVX", // from gdalgrid.cpp
+   "GDAL_USE_AVX2", // from cpl_cpu_features.cpp
    "GDAL_USE_GEOJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_GMLJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_SSE", // from gdalgrid.cpp
@@ -685,6 +691,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "ODS_RESOLVE_FORMULAS", // from ogrodsdatasource.cpp
    "OGR2OGR_MIN_FEATURES_FOR_THREADED_REPROJ", // from ogr2ogr_lib.cpp
    "OGR2OGR_USE_ARROW_API", // from ogr2ogr_lib.cpp
+   "OGR2OGR_USE_PARALLEL_PIPELINE", // from ogr2ogr_lib.cpp
    "OGR_ADBC_AUTO_LOAD_DUCKDB_SPATIAL", // from ogradbcdataset.cpp
    "OGR_API_SPY_FILE", // from ograpispy.cpp
    "OGR_API_SPY_SNAPSHOT_PATH", // from ograpispy.cpp
@@ -703,6 +710,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_ARROW_WRITE_GEO", // from ogrfeatherwriterlayer.cpp
    "OGR_CSV_MAX_FIELD_COUNT", // from ogrcsvlayer.cpp
    "OGR_CSV_MAX_LINE_SIZE", // from ogrcsvdatasource.cpp
+   "OGR_CSV_NUM_THREADS", // from ogrcsvlayer.cpp
    "OGR_CSV_SIMULATE_VSISTDIN", // from ogrcsvlayer.cpp
    "OGR_CT_DEBUG", // from ogrct.cpp
    "OGR_CT_FORCE_TRADITIONAL_GIS_ORDER", // from ogrct.cpp
@@ -720,16 +728,18 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_ENABLE_PARTIAL_REPROJECTION", // from ogrlinestring.cpp
    "OGR_EXPAT_UNLIMITED_MEM_ALLOC", // from ogr_expat.cpp
    "OGR_FGDB_WORKAROUND_CRASH_ON_BINARY_FIELD", // from FGdbLayer.cpp
+   "OGR_FLATGEOBUF_NUM_THREADS", // from ogrflatgeobuflayer.cpp
    "OGR_FLATGEOBUF_STREAM_BASE_IMPL", // from ogrflatgeobuflayer.cpp
    "OGR_FORCE_ASCII", // from ogrgpxlayer.cpp, ogrlibkmlfield.cpp, ogrutils.cpp
    "OGR_GENSQL_STREAM_BASE_IMPL", // from ogr_gensql.cpp
    "OGR_GEOJSON_ARRAY_AS_STRING", // from ogrgeojsondatasource.cpp
    "OGR_GEOJSON_DATE_AS_STRING", // from ogrgeojsondatasource.cpp
-   "OGR_GEOJSON_MAX_BYTES_FIRST_PASS", // from ogrgeojsondatasource.cpp, ogrgeojsonreader.cpp
-   "OGR_GEOJSON_MAX_FEATURES_FIRST_PASS", // from ogrgeojsonreader.cpp
+   "OGR_GEOJSON_MAX_BYTES_FIRST_PASS", // from ogrgeojsondatasource.cpp, ogrgeojsonreader.cpp, ogrgeojsonseqdriver.cpp
+   "OGR_GEOJSON_MAX_FEATURES_FIRST_PASS", // from ogrgeojsonreader.cpp, ogrgeojsonseqdriver.cpp
    "OGR_GEOJSON_MAX_OBJ_SIZE", // from ogrgeojsonreader.cpp, ogrgeojsonseqdriver.cpp
    "OGR_GEOJSON_REWRITE_IN_PLACE", // from ogrgeojsondatasource.cpp
    "OGR_GEOJSONSEQ_CHUNK_SIZE", // from ogrgeojsonseqdriver.cpp
+   "OGR_GEOJSONSEQ_NUM_THREADS", // from ogrgeojsonseqdriver.cpp
    "OGR_GEOMETRY_ACCEPT_UNCLOSED_RING", // from ogrcurvepolygon.cpp, ogrpolygon.cpp
    "OGR_GML_NESTING_LEVEL", // from gmlhandler.cpp
    "OGR_GMLAS_USE_SCHEMAS_FROM_OGC_ZIP", // from ogrgmlasxsdcache.cpp
@@ -813,6 +823,9 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_PACK_IN_PLACE", // from ogrshapedatasource.cpp, ogrshapelayer.cpp
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
+   "OGR_SQL_COMPILE_EXPRESSION", // from ogrfeaturequery.cpp
+   "OGR_SQL_JOIN_HASH", // from ogr_gensql.cpp
+   "OGR_SQL_JOIN_HASH_MAX_MEMORY", // from ogr_gensql.cpp
    "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
    "OGR_SQL_STRICT", // from swq.cpp
    "OGR_SQLITE_ALLOW_EXTERNAL_ACCESS", // from ogrsqlitesqlfunctionscommon.cpp
@@ -26,6 +26,7 @@
 #include "cpl_json_header.h"
 #include "cpl_minixml.h"
 #include "cpl_multiproc.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
@@ -33,6 +34,12 @@
 #include "cpl_http.h"
 #include "cpl_mem_cache.h"
 
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
 #ifndef S_IRUSR
 #define S_IRUSR 00400
 #define S_IWUSR 00200
@@ -479,7 +486,9 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
       m_aosHTTPOptions(CPLHTTPGetOptionsFromEnv(pszFilename)),
       m_oRetryParameters(m_aosHTTPOptions),
       m_bUseHead(
-          CPLTestBool(CPLGetConfigOption("CPL_VSIL_CURL_USE_HEAD", "YES")))
+          CPLTestBool(CPLGetConfigOption("CPL_VSIL_CURL_USE_HEAD", "YES"))),
+      m_bReadAhead(
+          CPLTestBool(CPLGetConfigOption("CPL_VSIL_CURL_READ_AHEAD", "NO")))
 {
     if (pszURLIn)
     {
@@ -2355,6 +2364,11 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
             poFS->GetRegion(m_pszURL, nOffsetToDownload);
+        if (psRegion == nullptr &&
+            ConsumeReadAheadRanges(nOffsetToDownload))
+        {
+            psRegion = poFS->GetRegion(m_pszURL, nOffsetToDownload);
+        }
         if (psRegion != nullptr)
         {
             osRegion = *psRegion;
@@ -2450,11 +2464,264 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     if (ret != nMemb)
         bEOF = true;
 
+    if (m_bReadAhead && iterOffset > curOffset)
+    {
+        ScheduleReadAhead(curOffset,
+                          static_cast<size_t>(iterOffset - curOffset));
+    }
+
     curOffset = iterOffset;
 
     return ret;
 }
 
+/************************************************************************/
+/*                        ConsumeReadAheadRanges()                      */
+/************************************************************************/
+
+/** Moves the content of the ranges fetched by the read-ahead engine that
+ * are completed to the region cache.
+ *
+ * If one of those ranges contains nOffset, wait for its completion.
+ *
+ * @return true if a successfully fetched range contained nOffset.
+ */
+bool VSICurlHandle::ConsumeReadAheadRanges(vsi_l_offset nOffset)
+{
+    if (!m_bAdviseReadFromReadAhead)
+        return false;
+
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    bool bFound = false;
+    for (auto &poRange : m_aoAdviseReadRanges)
+    {
+        if (poRange->bConsumedByReadAhead)
+            continue;
+        const bool bContainsOffset =
+            nOffset >= poRange->nStartOffset &&
+            nOffset - poRange->nStartOffset < poRange->nSize;
+        {
+            std::unique_lock<std::mutex> oLock(poRange->oMutex);
+            if (bContainsOffset)
+            {
+                // coverity[missing_lock:FALSE]
+                while (!poRange->bDone)
+                {
+                    poRange->oCV.wait(oLock);
+                }
+            }
+            else if (!poRange->bDone)
+            {
+                continue;
+            }
+        }
+
+        poRange->bConsumedByReadAhead = true;
+        if (poRange->abyData.empty())
+            continue;
+        const int nBlocks = static_cast<int>(
+            (poRange->abyData.size() + knDOWNLOAD_CHUNK_SIZE - 1) /
+            knDOWNLOAD_CHUNK_SIZE);
+        DownloadRegionPostProcess(
+            poRange->nStartOffset, nBlocks,
+            reinterpret_cast<const char *>(poRange->abyData.data()),
+            poRange->abyData.size());
+        std::vector<GByte>().swap(poRange->abyData);
+        if (bContainsOffset)
+            bFound = true;
+    }
+    return bFound;
+}
+
+/************************************************************************/
+/*                          ScheduleReadAhead()                         */
+/************************************************************************/
+
+/** Updates the detection of the access pattern with a request at
+ * [nOffset, nOffset + nSize[ that has just been served, and if it is
+ * sequential or strided, starts fetching in the background the ranges
+ * that are likely to be requested next.
+ *
+ * Predicted ranges are aligned on CPL_VSIL_CURL_CHUNK_SIZE, so that they
+ * can be moved to the region cache, and nearby ones are coalesced into a
+ * single HTTP request.
+ */
+void VSICurlHandle::ScheduleReadAhead(vsi_l_offset nOffset, size_t nSize)
+{
+    if (nOffset == m_nReadAheadLastEndOffset)
+    {
+        m_nReadAheadSequentialCount++;
+        m_nReadAheadStrideCount = 0;
+    }
+    else if (m_nReadAheadLastOffset != VSI_L_OFFSET_MAX &&
+             nOffset > m_nReadAheadLastOffset)
+    {
+        m_nReadAheadSequentialCount = 0;
+        const vsi_l_offset nStride = nOffset - m_nReadAheadLastOffset;
+        if (nStride == m_nReadAheadStride)
+        {
+            m_nReadAheadStrideCount++;
+        }
+        else
+        {
+            m_nReadAheadStride = nStride;
+            m_nReadAheadStrideCount = 1;
+        }
+    }
+    else
+    {
+        m_nReadAheadSequentialCount = 0;
+        m_nReadAheadStrideCount = 0;
+    }
+    m_nReadAheadLastOffset = nOffset;
+    m_nReadAheadLastEndOffset = nOffset + nSize;
+
+    // Wait for the same pattern to be repeated before speculating
+    constexpr int MIN_REPEATED_ACCESSES = 2;
+    const bool bSequential =
+        m_nReadAheadSequentialCount >= MIN_REPEATED_ACCESSES;
+    if (!bSequential && m_nReadAheadStrideCount < MIN_REPEATED_ACCESSES)
+        return;
+
+    // For small sequential reads, only reconsider once per chunk.
+    const vsi_l_offset nChunkSize = VSICURLGetDownloadChunkSize();
+    if (bSequential && nOffset / nChunkSize == (nOffset + nSize) / nChunkSize)
+        return;
+
+    // Only speculate on files of known size, so as not to request ranges
+    // after end of file.
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (!oFileProp.bHasComputedFileSize)
+        return;
+    const vsi_l_offset nFileSize = oFileProp.fileSize;
+
+    // Do not interfere with ranges requested by the user with AdviseRead(),
+    // and do not start a new read-ahead while the previous one is running.
+    if (!m_aoAdviseReadRanges.empty())
+    {
+        if (!m_bAdviseReadFromReadAhead)
+            return;
+        for (auto &poRange : m_aoAdviseReadRanges)
+        {
+            std::lock_guard<std::mutex> oLock(poRange->oMutex);
+            if (!poRange->bDone)
+                return;
+        }
+        ConsumeReadAheadRanges(VSI_L_OFFSET_MAX);
+    }
+
+    // Limit the amount of data fetched in advance to half of the region
+    // cache, so that moving it to the cache does not evict what we read.
+    const vsi_l_offset nMaxReadAheadSize = (GetMaxRegions() / 2) * nChunkSize;
+    vsi_l_offset nTotalSize = 0;
+
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    const auto AddRange =
+        [this, nChunkSize, nFileSize, nMaxReadAheadSize, &nTotalSize,
+         &anOffsets, &anSizes](vsi_l_offset nStart, vsi_l_offset nEnd)
+    {
+        nStart = (nStart / nChunkSize) * nChunkSize;
+        nEnd = std::min(nFileSize,
+                        ((nEnd + nChunkSize - 1) / nChunkSize) * nChunkSize);
+        while (nStart < nEnd && poFS->GetRegion(m_pszURL, nStart) != nullptr)
+            nStart += nChunkSize;
+        if (nStart >= nEnd)
+            return true;
+        if (nTotalSize + (nEnd - nStart) > nMaxReadAheadSize)
+            return false;
+        nTotalSize += nEnd - nStart;
+        // Coalesce with the previous range if they are separated by at most
+        // one chunk.
+        if (!anOffsets.empty() &&
+            nStart <= anOffsets.back() + anSizes.back() + nChunkSize)
+        {
+            anSizes.back() = static_cast<size_t>(
+                std::max(nEnd, anOffsets.back() + anSizes.back()) -
+                anOffsets.back());
+        }
+        else
+        {
+            anOffsets.push_back(nStart);
+            anSizes.push_back(static_cast<size_t>(nEnd - nStart));
+        }
+        return true;
+    };
+
+    const vsi_l_offset nEndOffset = nOffset + nSize;
+    if (bSequential)
+    {
+        // Fetch the next window, whose size grows with the one used by the
+        // synchronous heuristics of Read().
+        const vsi_l_offset nWindow = std::max<vsi_l_offset>(
+            nSize, static_cast<vsi_l_offset>(nBlocksToDownload) * nChunkSize);
+        AddRange(nEndOffset,
+                 nEndOffset + std::min(nWindow, nMaxReadAheadSize / 2));
+    }
+    else
+    {
+        constexpr int READ_AHEAD_DEPTH = 4;
+        for (int i = 1; i <= READ_AHEAD_DEPTH; ++i)
+        {
+            const vsi_l_offset nPredictedOffset =
+                nOffset + static_cast<vsi_l_offset>(i) * m_nReadAheadStride;
+            if (nPredictedOffset >= nFileSize)
+                break;
+            if (!AddRange(nPredictedOffset, nPredictedOffset + nSize))
+                break;
+        }
+    }
+    if (anOffsets.empty())
+        return;
+
+    if (ENABLE_DEBUG)
+        CPLDebug(poFS->GetDebugKey(),
+                 "Read-ahead of %d range(s) after %s access at " CPL_FRMT_GUIB,
+                 static_cast<int>(anOffsets.size()),
+                 bSequential ? "sequential" : "strided", nOffset);
+
+    AdviseReadInternal(static_cast<int>(anOffsets.size()), anOffsets.data(),
+                       anSizes.data(), /* bReadAhead = */ true);
+}
+
+/************************************************************************/
+/*                   ReadMultiRangeFromRegionCache()                    */
+/************************************************************************/
+
+/** Serves a ReadMultiRange() request from the region cache.
+ *
+ * @return true if all ranges were available in the region cache.
+ */
+bool VSICurlHandle::ReadMultiRangeFromRegionCache(
+    int nRanges, void **ppData, const vsi_l_offset *panOffsets,
+    const size_t *panSizes)
+{
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    for (int i = 0; i < nRanges; ++i)
+    {
+        vsi_l_offset nOffset = panOffsets[i];
+        size_t nRemaining = panSizes[i];
+        GByte *pabyDst = static_cast<GByte *>(ppData[i]);
+        while (nRemaining > 0)
+        {
+            const vsi_l_offset nChunkOffset =
+                (nOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+            const auto psRegion = poFS->GetRegion(m_pszURL, nChunkOffset);
+            const size_t nOffsetInChunk =
+                static_cast<size_t>(nOffset - nChunkOffset);
+            if (psRegion == nullptr || psRegion->size() <= nOffsetInChunk)
+                return false;
+            const size_t nToCopy =
+                std::min(nRemaining, psRegion->size() - nOffsetInChunk);
+            memcpy(pabyDst, psRegion->data() + nOffsetInChunk, nToCopy);
+            pabyDst += nToCopy;
+            nOffset += nToCopy;
+            nRemaining -= nToCopy;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -2488,6 +2755,30 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                                                 panSizes);
     }
 
+    if (m_bReadAhead)
+    {
+        // Requests covering successive rows of tiles are typically strided:
+        // use their extent for the detection of the access pattern.
+        vsi_l_offset nMinOffset = VSI_L_OFFSET_MAX;
+        vsi_l_offset nMaxEndOffset = 0;
+        for (int i = 0; i < nRanges; ++i)
+        {
+            ConsumeReadAheadRanges(panOffsets[i]);
+            nMinOffset = std::min(nMinOffset, panOffsets[i]);
+            nMaxEndOffset =
+                std::max(nMaxEndOffset, panOffsets[i] + panSizes[i]);
+        }
+        const bool bFromRegionCache = ReadMultiRangeFromRegionCache(
+            nRanges, ppData, panOffsets, panSizes);
+        if (nMaxEndOffset > nMinOffset)
+        {
+            ScheduleReadAhead(nMinOffset,
+                              static_cast<size_t>(nMaxEndOffset - nMinOffset));
+        }
+        if (bFromRegionCache)
+            return 0;
+    }
+
     UpdateQueryString();
 
     bool bHasExpired = false;
@@ -3112,7 +3403,8 @@ size_t VSICurlHandle::PRead(void *pBuffer, size_t nSize,
     {
         for (auto &poRange : m_aoAdviseReadRanges)
         {
-            if (nOffset >= poRange->nStartOffset &&
+            if (!poRange->bConsumedByReadAhead &&
+                nOffset >= poRange->nStartOffset &&
                 nOffset + nSize <= poRange->nStartOffset + poRange->nSize)
             {
                 {
@@ -3324,6 +3616,22 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
             CPLGetConfigOption("GDAL_HTTP_ENABLE_ADVISE_READ", "TRUE")))
         return;
 
+    AdviseReadInternal(nRanges, panOffsets, panSizes, false);
+}
+
+/************************************************************************/
+/*                        AdviseReadInternal()                          */
+/************************************************************************/
+
+/** Fetches ranges in a background thread.
+ *
+ * bReadAhead must be set when the ranges are a prediction of the read-ahead
+ * engine, in which case download failures are not reported as errors.
+ */
+void VSICurlHandle::AdviseReadInternal(int nRanges,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes, bool bReadAhead)
+{
     if (m_oThreadAdviseRead.joinable())
     {
         m_oThreadAdviseRead.join();
@@ -3360,6 +3668,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
     try
     {
         m_aoAdviseReadRanges.clear();
+        m_bAdviseReadFromReadAhead = bReadAhead;
         m_aoAdviseReadRanges.reserve(nRanges);
         for (int i = 0; i < nRanges;)
         {
@@ -3411,7 +3720,8 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
              static_cast<unsigned>(m_aoAdviseReadRanges.size()));
 #endif
 
-    const auto task = [this, aosHTTPOptions = std::move(aosHTTPOptions)](
+    const auto task = [this, bReadAhead,
+                       aosHTTPOptions = std::move(aosHTTPOptions)](
                           const std::string &osURL)
     {
         if (!m_hCurlMultiHandleForAdviseRead)
@@ -3419,7 +3729,8 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
         NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
         NetworkStatisticsFile oContextFile(m_osFilename.c_str());
-        NetworkStatisticsAction oContextAction("AdviseRead");
+        NetworkStatisticsAction oContextAction(bReadAhead ? "ReadAhead"
+                                                          : "AdviseRead");
 
 #ifdef CURLPIPE_MULTIPLEX
         // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
@@ -3540,9 +3851,9 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                                       hCurlHandle);
             }
 
-            const auto DealWithRequest = [this, &osURL, &nTotalDownloaded,
-                                          &oMapHandleToIdx, &asCurlErrors,
-                                          &asWriteFuncHeaderData,
+            const auto DealWithRequest = [this, bReadAhead, &osURL,
+                                          &nTotalDownloaded, &oMapHandleToIdx,
+                                          &asCurlErrors, &asWriteFuncHeaderData,
                                           &asWriteFuncData](CURL *hCurlHandle)
             {
                 auto oIter = oMapHandleToIdx.find(hCurlHandle);
@@ -3601,10 +3912,19 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                     }
                     else
                     {
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "Request for %s range %s failed with "
-                                 "response_code=%ld",
-                                 osURL.c_str(), rangeStr, response_code);
+                        // A failed speculative request is not an error:
+                        // the range will be requested again if needed.
+                        if (bReadAhead)
+                            CPLDebug(poFS->GetDebugKey(),
+                                     "Read-ahead request for %s range %s "
+                                     "failed with response_code=%ld",
+                                     osURL.c_str(), rangeStr, response_code);
+                        else
+                            CPLError(CE_Failure, CPLE_AppDefined,
+                                     "Request for %s range %s failed with "
+                                     "response_code=%ld",
+                                     osURL.c_str(), rangeStr, response_code);
+                        m_aoAdviseReadRanges[iReq]->abyData.clear();
                     }
                 }
                 else
@@ -3917,6 +4237,255 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
+/************************************************************************/
+/*                       VSICurlDiskCacheGetPath()                      */
+/************************************************************************/
+
+/** Returns the path of the file of the persistent disk cache that holds the
+ * region of pszURL starting at nFileOffsetStart, or an empty string if the
+ * disk cache is disabled or the ETag of pszURL is unknown.
+ *
+ * Content is keyed by URL, ETag, chunk size and offset, so that a remote file
+ * that has been modified, and has thus a new ETag, never gets stale content.
+ */
+static std::string VSICurlDiskCacheGetPath(const char *pszURL,
+                                           vsi_l_offset nFileOffsetStart)
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == '\0')
+        return std::string();
+
+    FileProp oFileProp;
+    if (!VSICURLGetCachedFileProp(pszURL, oFileProp) || oFileProp.ETag.empty())
+        return std::string();
+
+    CPL_SHA256Context sContext;
+    CPL_SHA256Init(&sContext);
+    // Include the nul terminating character as a separator
+    CPL_SHA256Update(&sContext, pszURL, strlen(pszURL) + 1);
+    CPL_SHA256Update(&sContext, oFileProp.ETag.data(), oFileProp.ETag.size());
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256Final(&sContext, abyHash);
+    char *pszHash = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osFilename(
+        CPLSPrintf("%s_%d_" CPL_FRMT_GUIB, pszHash,
+                   VSICURLGetDownloadChunkSize(), nFileOffsetStart));
+    CPLFree(pszHash);
+    return CPLFormFilenameSafe(pszDir, osFilename.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                     VSICurlDiskCacheIsCacheFile()                    */
+/************************************************************************/
+
+/** Returns whether pszFilename has the form of the names of the files of the
+ * disk cache built by VSICurlDiskCacheGetPath(), that is the hexadecimal
+ * SHA256 hash followed by the chunk size and the offset.
+ */
+static bool VSICurlDiskCacheIsCacheFile(const char *pszFilename)
+{
+    for (int i = 0; i < 2 * CPL_SHA256_HASH_SIZE; ++i)
+    {
+        if (!isxdigit(static_cast<unsigned char>(pszFilename[i])))
+            return false;
+    }
+    const char *pszIter = pszFilename + 2 * CPL_SHA256_HASH_SIZE;
+    for (int iNumber = 0; iNumber < 2; ++iNumber)
+    {
+        if (*pszIter != '_' ||
+            !isdigit(static_cast<unsigned char>(pszIter[1])))
+            return false;
+        ++pszIter;
+        while (isdigit(static_cast<unsigned char>(*pszIter)))
+            ++pszIter;
+    }
+    return *pszIter == '\0';
+}
+
+/************************************************************************/
+/*                        VSICurlDiskCacheTouch()                       */
+/************************************************************************/
+
+/** Sets the modification time of a file of the disk cache to the current
+ * time, so that VSICurlDiskCacheTrim() evicts the least recently used files
+ * first. Failures are silently ignored.
+ */
+static void VSICurlDiskCacheTouch(const std::string &osPath)
+{
+#ifdef _WIN32
+    if (CPLTestBool(CPLGetConfigOption("GDAL_FILENAME_IS_UTF8", "YES")))
+    {
+        wchar_t *pwszPath =
+            CPLRecodeToWChar(osPath.c_str(), CPL_ENC_UTF8, CPL_ENC_UCS2);
+        _wutime(pwszPath, nullptr);
+        CPLFree(pwszPath);
+    }
+    else
+    {
+        _utime(osPath.c_str(), nullptr);
+    }
+#else
+    utime(osPath.c_str(), nullptr);
+#endif
+}
+
+/************************************************************************/
+/*                         VSICurlDiskCacheRead()                       */
+/************************************************************************/
+
+static std::shared_ptr<std::string>
+VSICurlDiskCacheRead(const std::string &osPath)
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osPath.c_str(), "rb"));
+    if (!fp)
+        return nullptr;
+    fp->Seek(0, SEEK_END);
+    const vsi_l_offset nSize = fp->Tell();
+    if (nSize == 0 ||
+        nSize > static_cast<vsi_l_offset>(VSICURLGetDownloadChunkSize()))
+        return nullptr;
+    fp->Seek(0, SEEK_SET);
+    auto poRegion = std::make_shared<std::string>();
+    poRegion->resize(static_cast<size_t>(nSize));
+    if (fp->Read(poRegion->data(), poRegion->size(), 1) != 1)
+        return nullptr;
+    fp.reset();
+    VSICurlDiskCacheTouch(osPath);
+    return poRegion;
+}
+
+/************************************************************************/
+/*                         VSICurlDiskCacheTrim()                       */
+/************************************************************************/
+
+/** Removes the least recently used files of the disk cache directory when
+ * its total size exceeds CPL_VSIL_CURL_DISK_CACHE_SIZE.
+ *
+ * As listing the directory is costly, this is only done when a tenth of the
+ * maximum size has been written by this process since the last check.
+ *
+ * Only the files named by VSICurlDiskCacheGetPath() are taken into account,
+ * so that other files of the directory are never removed. osJustWrittenPath
+ * is never evicted either.
+ */
+static void VSICurlDiskCacheTrim(const std::string &osDir,
+                                 const std::string &osJustWrittenPath,
+                                 size_t nNewBytes)
+{
+    constexpr GIntBig DISK_CACHE_SIZE_DEFAULT = 1024 * 1024 * 1024;
+    GIntBig nMaxSize = DISK_CACHE_SIZE_DEFAULT;
+    if (const char *pszSize =
+            CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr))
+    {
+        if (CPLParseMemorySize(pszSize, &nMaxSize, nullptr) != CE_None ||
+            nMaxSize <= 0)
+        {
+            nMaxSize = DISK_CACHE_SIZE_DEFAULT;
+        }
+    }
+
+    {
+        static std::mutex oMutex;
+        static bool bFirstTime = true;
+        static GIntBig nBytesSinceLastTrim = 0;
+        std::lock_guard<std::mutex> oLock(oMutex);
+        nBytesSinceLastTrim += static_cast<GIntBig>(nNewBytes);
+        if (!bFirstTime && nBytesSinceLastTrim < nMaxSize / 10)
+            return;
+        bFirstTime = false;
+        nBytesSinceLastTrim = 0;
+    }
+
+    struct CacheFile
+    {
+        time_t nMTime;
+        vsi_l_offset nSize;
+        std::string osPath;
+    };
+
+    std::vector<CacheFile> asFiles;
+    GIntBig nTotalSize = 0;
+    const CPLStringList aosFiles(VSIReadDir(osDir.c_str()));
+    for (const char *pszFilename : aosFiles)
+    {
+        // This also skips the temporary files that other processes may be
+        // writing.
+        if (!VSICurlDiskCacheIsCacheFile(pszFilename))
+            continue;
+        std::string osPath =
+            CPLFormFilenameSafe(osDir.c_str(), pszFilename, nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(osPath.c_str(), &sStat) == 0 && VSI_ISREG(sStat.st_mode))
+        {
+            nTotalSize += static_cast<GIntBig>(sStat.st_size);
+            asFiles.push_back(
+                CacheFile{sStat.st_mtime,
+                          static_cast<vsi_l_offset>(sStat.st_size),
+                          std::move(osPath)});
+        }
+    }
+    if (nTotalSize <= nMaxSize)
+        return;
+
+    // mtime has a resolution of one second on many file systems, hence
+    // a stable sort to keep the eviction order deterministic among ties.
+    std::stable_sort(asFiles.begin(), asFiles.end(),
+                     [](const CacheFile &a, const CacheFile &b)
+                     { return a.nMTime < b.nMTime; });
+    for (const auto &sFile : asFiles)
+    {
+        if (nTotalSize <= nMaxSize)
+            break;
+        if (sFile.osPath == osJustWrittenPath)
+            continue;
+        // Another process may have removed the file in the meantime
+        if (VSIUnlink(sFile.osPath.c_str()) == 0)
+            nTotalSize -= static_cast<GIntBig>(sFile.nSize);
+    }
+}
+
+/************************************************************************/
+/*                        VSICurlDiskCacheWrite()                       */
+/************************************************************************/
+
+/** Writes a region in the disk cache.
+ *
+ * The content is first written in a temporary file, then atomically renamed,
+ * so that other processes sharing the cache directory never see partially
+ * written files.
+ */
+static void VSICurlDiskCacheWrite(const std::string &osPath, const char *pData,
+                                  size_t nSize)
+{
+    const std::string osDir = CPLGetPathSafe(osPath.c_str());
+    VSIStatBufL sStat;
+    if (VSIStatL(osDir.c_str(), &sStat) != 0 &&
+        VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+    {
+        return;
+    }
+
+    const std::string osTmpPath(
+        osPath + CPLSPrintf(".%d_" CPL_FRMT_GIB ".tmp",
+                            CPLGetCurrentProcessID(), CPLGetPID()));
+    bool bOK;
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(osTmpPath.c_str(), "wb"));
+        if (!fp)
+            return;
+        bOK = fp->Write(pData, nSize, 1) == 1;
+        bOK = fp->Close() == 0 && bOK;
+    }
+    if (!bOK || VSIRename(osTmpPath.c_str(), osPath.c_str()) != 0)
+    {
+        VSIUnlink(osTmpPath.c_str());
+        return;
+    }
+
+    VSICurlDiskCacheTrim(osDir, osPath, nSize);
+}
+
 /************************************************************************/
 /*                          GetRegion()                                 */
 /************************************************************************/
@@ -3925,17 +4494,36 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                out))
+        {
+            return out;
+        }
+    }
+
+    // Fallback to the persistent disk cache, outside of the mutex.
+    const std::string osDiskCachePath =
+        VSICurlDiskCacheGetPath(pszURL, nFileOffsetStart);
+    if (!osDiskCachePath.empty())
+    {
+        auto poRegion = VSICurlDiskCacheRead(osDiskCachePath);
+        if (poRegion)
+        {
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                poRegion);
+            return poRegion;
+        }
     }
 
     return nullptr;
@@ -3949,12 +4537,19 @@ void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
                                              size_t nSize, const char *pData)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> value(new std::string());
+        value->assign(pData, nSize);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    }
 
-    std::shared_ptr<std::string> value(new std::string());
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    const std::string osDiskCachePath =
+        VSICurlDiskCacheGetPath(pszURL, nFileOffsetStart);
+    if (!osDiskCachePath.empty() && nSize > 0)
+        VSICurlDiskCacheWrite(osDiskCachePath, pData, nSize);
 }
 
 /************************************************************************/
@@ -4249,6 +4844,14 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT' "            \
     "type='integer' description='Maximum number of bytes AdviseRead() is "     \
     "allowed to fetch at once' default='104857600'/>"                          \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_DIR' type='string' "             \
+    "description='Directory of a persistent cache of downloaded content'/>"    \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_SIZE' type='integer' "           \
+    "description='Maximum size in bytes of the persistent cache' "             \
+    "default='1073741824'/>"                                                   \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD' type='boolean' "                \
+    "description='Whether to prefetch in the background the ranges "           \
+    "predicted from sequential or strided access patterns' default='NO'/>"     \
     "  <Option name='GDAL_HTTP_MAX_CACHED_CONNECTIONS' type='integer' "        \
     "description='Maximum amount of connections that libcurl may keep alive "  \
     "in its connection cache after use'/>"                                     \
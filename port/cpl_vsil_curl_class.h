@@ -425,6 +425,9 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
         size_t nSize = 0;
         std::vector<GByte> abyData{};
         CPLHTTPRetryContext retryContext;
+        // Set when the content has been moved to the region cache (or
+        // discarded, on failure) by the read-ahead engine.
+        bool bConsumedByReadAhead = false;
 
         explicit AdviseReadRange(const CPLHTTPRetryParameters &oRetryParameters)
             : retryContext(oRetryParameters)
@@ -441,6 +444,27 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     std::thread m_oThreadAdviseRead{};
     CURLM *m_hCurlMultiHandleForAdviseRead = nullptr;
 
+    void AdviseReadInternal(int nRanges, const vsi_l_offset *panOffsets,
+                            const size_t *panSizes, bool bReadAhead);
+
+    // Used by the read-ahead engine (CPL_VSIL_CURL_READ_AHEAD=YES), that
+    // detects sequential or strided access patterns in Read() and
+    // ReadMultiRange(), and prefetches the next predicted ranges in the
+    // background with AdviseReadInternal().
+    bool m_bReadAhead = false;
+    bool m_bAdviseReadFromReadAhead = false;
+    vsi_l_offset m_nReadAheadLastOffset = VSI_L_OFFSET_MAX;
+    vsi_l_offset m_nReadAheadLastEndOffset = VSI_L_OFFSET_MAX;
+    vsi_l_offset m_nReadAheadStride = 0;
+    int m_nReadAheadStrideCount = 0;
+    int m_nReadAheadSequentialCount = 0;
+
+    void ScheduleReadAhead(vsi_l_offset nOffset, size_t nSize);
+    bool ConsumeReadAheadRanges(vsi_l_offset nOffset);
+    bool ReadMultiRangeFromRegionCache(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes);
+
   protected:
     virtual struct curl_slist *GetCurlHeaders(const std::string & /*osVerb*/,
                                               struct curl_slist *psHeaders)
@@ -13,6 +13,7 @@
 #include "cpl_port.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 
@@ -21,6 +22,7 @@
 #include "cpl_vsi.h"
 
 static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
+static thread_local CPLWorkerThread *threadLocalCurrentWorkerThread = nullptr;
 
 /************************************************************************/
 /*                         CPLWorkerThreadPool()                        */
@@ -31,7 +33,7 @@ static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
  * The pool is in an uninitialized state after this call. The Setup() method
  * must be called.
  */
-CPLWorkerThreadPool::CPLWorkerThreadPool() : jobQueue{}
+CPLWorkerThreadPool::CPLWorkerThreadPool()
 {
 }
 
@@ -39,7 +41,7 @@ CPLWorkerThreadPool::CPLWorkerThreadPool() : jobQueue{}
  *
  * \param nThreads  Number of threads in the pool.
  */
-CPLWorkerThreadPool::CPLWorkerThreadPool(int nThreads) : jobQueue{}
+CPLWorkerThreadPool::CPLWorkerThreadPool(int nThreads)
 {
     Setup(nThreads, nullptr, nullptr);
 }
@@ -69,8 +71,6 @@ CPLWorkerThreadPool::~CPLWorkerThreadPool()
         }
         CPLJoinThread(wt->hThread);
     }
-
-    CPLListDestroy(psWaitingWorkerThreadsList);
 }
 
 /************************************************************************/
@@ -93,17 +93,16 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     CPLWorkerThreadPool *poTP = psWT->poTP;
 
     threadLocalCurrentThreadPool = poTP;
+    threadLocalCurrentWorkerThread = psWT;
 
     if (psWT->pfnInitFunc)
         psWT->pfnInitFunc(psWT->pInitData);
 
-    while (true)
+    CPLWorkerThreadJob oJob;
+    while (poTP->GetNextJob(psWT, oJob))
     {
-        std::function<void()> task = poTP->GetNextJob(psWT);
-        if (!task)
-            break;
-
-        task();
+        RunJob(oJob);
+        oJob = CPLWorkerThreadJob();
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "%p finished a job", psWT);
 #endif
@@ -111,6 +110,126 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     }
 }
 
+/************************************************************************/
+/*                               RunJob()                               */
+/************************************************************************/
+
+void CPLWorkerThreadPool::RunJob(CPLWorkerThreadJob &oJob)
+{
+    if (oJob.pfnFunc)
+        oJob.pfnFunc(oJob.pData);
+    else
+        oJob.task();
+    if (oJob.poQueue)
+        oJob.poQueue->DeclareJobFinished();
+}
+
+/************************************************************************/
+/*                             AddThread()                              */
+/************************************************************************/
+
+/* Must be called with m_mutex held */
+void CPLWorkerThreadPool::AddThread(std::unique_ptr<CPLWorkerThread> &&wt)
+{
+    wt->psNextThread = m_psThreadList.load();
+    m_psThreadList.store(wt.get());
+    aWT.emplace_back(std::move(wt));
+}
+
+/************************************************************************/
+/*                        StartThreadIfNeeded()                         */
+/************************************************************************/
+
+/* Must be called with m_mutex held */
+bool CPLWorkerThreadPool::StartThreadIfNeeded()
+{
+    if (static_cast<int>(aWT.size()) >= m_nMaxThreads)
+        return false;
+
+    // CPLDebug("CPL", "Starting new thread...");
+    auto wt = std::make_unique<CPLWorkerThread>();
+    wt->poTP = this;
+    // The new thread will look for a job as soon as it is started
+    wt->bWokenUp = true;
+    m_nWokenUpThreads++;
+    wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
+    if (!wt->hThread)
+    {
+        m_nWokenUpThreads--;
+        return false;
+    }
+    AddThread(std::move(wt));
+    return true;
+}
+
+/************************************************************************/
+/*                     WakeUpWaitingWorkerThread()                      */
+/************************************************************************/
+
+/* Must be called with oGuard locking m_mutex. If a thread is woken up,
+ * oGuard is unlocked on return. */
+void CPLWorkerThreadPool::WakeUpWaitingWorkerThread(
+    std::unique_lock<std::mutex> &oGuard)
+{
+    if (m_apoWaitingWorkerThreads.empty())
+        return;
+
+    CPLWorkerThread *psWorkerThread = m_apoWaitingWorkerThreads.back();
+    m_apoWaitingWorkerThreads.pop_back();
+
+    CPLAssert(psWorkerThread->bMarkedAsWaiting);
+    psWorkerThread->bMarkedAsWaiting = false;
+    nWaitingWorkerThreads--;
+    if (!psWorkerThread->bWokenUp.exchange(true))
+        m_nWokenUpThreads++;
+
+#if DEBUG_VERBOSE
+    CPLDebug("JOB", "Waking up %p", psWorkerThread);
+#endif
+
+#ifdef __COVERITY__
+    CPLError(CE_Failure, CPLE_AppDefined, "Not implemented");
+#else
+    {
+        std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
+        // coverity[uninit_use_in_call]
+        oGuard.unlock();
+        psWorkerThread->m_cv.notify_one();
+    }
+#endif
+}
+
+/************************************************************************/
+/*                       RemoveFromWaitingList()                        */
+/************************************************************************/
+
+/* Must be called with m_mutex held */
+void CPLWorkerThreadPool::RemoveFromWaitingList(
+    CPLWorkerThread *psWorkerThread)
+{
+    if (!psWorkerThread->bMarkedAsWaiting)
+        return;
+    psWorkerThread->bMarkedAsWaiting = false;
+    const auto oIter =
+        std::find(m_apoWaitingWorkerThreads.begin(),
+                  m_apoWaitingWorkerThreads.end(), psWorkerThread);
+    if (oIter != m_apoWaitingWorkerThreads.end())
+    {
+        m_apoWaitingWorkerThreads.erase(oIter);
+        nWaitingWorkerThreads--;
+    }
+}
+
+/************************************************************************/
+/*                            ClearWokenUp()                            */
+/************************************************************************/
+
+void CPLWorkerThreadPool::ClearWokenUp(CPLWorkerThread *psWorkerThread)
+{
+    if (psWorkerThread->bWokenUp.exchange(false))
+        m_nWokenUpThreads--;
+}
+
 /************************************************************************/
 /*                             SubmitJob()                              */
 /************************************************************************/
@@ -123,7 +242,10 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
  */
 bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
 {
-    return SubmitJob([=] { pfnFunc(pData); });
+    CPLWorkerThreadJob oJob;
+    oJob.pfnFunc = pfnFunc;
+    oJob.pData = pData;
+    return QueueJob(std::move(oJob));
 }
 
 /** Queue a new job.
@@ -132,6 +254,17 @@ bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
  * @return true in case of success.
  */
 bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
+{
+    CPLWorkerThreadJob oJob;
+    oJob.task = std::move(task);
+    return QueueJob(std::move(oJob));
+}
+
+/************************************************************************/
+/*                              QueueJob()                              */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::QueueJob(CPLWorkerThreadJob &&oJob)
 {
 #ifdef DEBUG
     {
@@ -140,87 +273,50 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
     }
 #endif
 
-    bool bMustIncrementWaitingWorkerThreadsAfterSubmission = false;
-    if (threadLocalCurrentThreadPool == this)
+    CPLWorkerThread *psCurrentWT = threadLocalCurrentThreadPool == this
+                                       ? threadLocalCurrentWorkerThread
+                                       : nullptr;
+    if (psCurrentWT && nWaitingWorkerThreads == 0)
     {
-        // If there are waiting threads or we have not started all allowed
-        // threads, we can submit this job asynchronously
+        // If we have not started all allowed threads, we can submit this job
+        // asynchronously through the common queue.
+        bool bCanStartThread;
         {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
-            if (nWaitingWorkerThreads > 0 ||
-                static_cast<int>(aWT.size()) < m_nMaxThreads)
-            {
-                bMustIncrementWaitingWorkerThreadsAfterSubmission = true;
-                nWaitingWorkerThreads--;
-            }
+            std::lock_guard<std::mutex> oGuard(m_mutex);
+            bCanStartThread = static_cast<int>(aWT.size()) < m_nMaxThreads;
         }
-        if (!bMustIncrementWaitingWorkerThreadsAfterSubmission)
+        if (!bCanStartThread)
         {
             // otherwise there is a risk of deadlock, so execute synchronously.
-            task();
+            RunJob(oJob);
             return true;
         }
+        psCurrentWT = nullptr;
     }
 
-    std::unique_lock<std::mutex> oGuard(m_mutex);
-
-    if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
-        nWaitingWorkerThreads++;
+    nPendingJobs++;
 
-    if (static_cast<int>(aWT.size()) < m_nMaxThreads)
+    if (psCurrentWT)
     {
-        // CPLDebug("CPL", "Starting new thread...");
-        auto wt = std::make_unique<CPLWorkerThread>();
-        wt->poTP = this;
-        //ABELL - Why should this fail? And this is a *pool* thread, not necessarily
-        //  tied to the submitted job. The submitted job still needs to run, even if
-        //  this fails. If we can't create a thread, should the entire pool become invalid?
-        wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-        /**
-        if (!wt->hThread)
+        // Queue the job to the current worker thread, and wake up a waiting
+        // thread that will steal it.
         {
-            VSIFree(psJob);
-            VSIFree(psItem);
-            return false;
+            std::lock_guard<std::mutex> oGuard(psCurrentWT->m_oJobsMutex);
+            psCurrentWT->m_aoJobs.emplace_back(std::move(oJob));
+            m_nQueuedThreadJobs++;
         }
-        **/
-        if (wt->hThread)
-            aWT.emplace_back(std::move(wt));
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+        WakeUpWaitingWorkerThread(oGuard);
+        return true;
     }
 
-    jobQueue.emplace(task);
-    nPendingJobs++;
-
-    if (psWaitingWorkerThreadsList)
-    {
-        CPLWorkerThread *psWorkerThread =
-            static_cast<CPLWorkerThread *>(psWaitingWorkerThreadsList->pData);
+    std::unique_lock<std::mutex> oGuard(m_mutex);
 
-        CPLAssert(psWorkerThread->bMarkedAsWaiting);
-        psWorkerThread->bMarkedAsWaiting = false;
+    StartThreadIfNeeded();
 
-        CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-        CPLList *psToFree = psWaitingWorkerThreadsList;
-        psWaitingWorkerThreadsList = psNext;
-        nWaitingWorkerThreads--;
+    jobQueue.emplace_back(std::move(oJob));
 
-#if DEBUG_VERBOSE
-        CPLDebug("JOB", "Waking up %p", psWorkerThread);
-#endif
-
-#ifdef __COVERITY__
-        CPLError(CE_Failure, CPLE_AppDefined, "Not implemented");
-#else
-        {
-            std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-            // coverity[uninit_use_in_call]
-            oGuard.unlock();
-            psWorkerThread->m_cv.notify_one();
-        }
-#endif
-
-        CPLFree(psToFree);
-    }
+    WakeUpWaitingWorkerThread(oGuard);
 
     // coverity[double_unlock]
     return true;
@@ -231,6 +327,10 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
 /************************************************************************/
 
 /** Queue several jobs
+ *
+ * The jobs are distributed among the worker threads, which steal jobs from
+ * each other when they run out of work. Contrary to SubmitJob(), this does
+ * not allocate a std::function per job.
  *
  * @param pfnFunc Function to run for the job.
  * @param apData User data instances to pass to the job function.
@@ -260,63 +360,43 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
 
     std::unique_lock<std::mutex> oGuard(m_mutex);
 
-    for (void *pData : apData)
+    for (size_t i = 0; i < apData.size(); i++)
     {
-        if (static_cast<int>(aWT.size()) < m_nMaxThreads)
+        if (!StartThreadIfNeeded())
+            break;
+    }
+    if (aWT.empty())
+        return false;
+
+    // Distribute contiguous ranges of jobs among worker threads
+    nPendingJobs += static_cast<int>(apData.size());
+    const size_t nThreads = aWT.size();
+    size_t iJob = 0;
+    for (size_t iThread = 0; iThread < nThreads; ++iThread)
+    {
+        const size_t nJobsThisThread =
+            (apData.size() - iJob) / (nThreads - iThread);
+        if (nJobsThisThread == 0)
+            continue;
+        CPLWorkerThread *psWorkerThread = aWT[iThread].get();
+        std::lock_guard<std::mutex> oGuardJobs(psWorkerThread->m_oJobsMutex);
+        for (size_t i = 0; i < nJobsThisThread; ++i, ++iJob)
         {
-            std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-            wt->poTP = this;
-            wt->hThread =
-                CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-            if (wt->hThread == nullptr)
-            {
-                if (aWT.empty())
-                    return false;
-            }
-            else
-            {
-                aWT.emplace_back(std::move(wt));
-            }
+            CPLWorkerThreadJob oJob;
+            oJob.pfnFunc = pfnFunc;
+            oJob.pData = apData[iJob];
+            psWorkerThread->m_aoJobs.emplace_back(std::move(oJob));
         }
-
-        jobQueue.emplace([=] { pfnFunc(pData); });
-        nPendingJobs++;
+        m_nQueuedThreadJobs += static_cast<int>(nJobsThisThread);
     }
 
     for (size_t i = 0; i < apData.size(); i++)
     {
-        if (psWaitingWorkerThreadsList)
-        {
-            CPLWorkerThread *psWorkerThread;
-
-            psWorkerThread = static_cast<CPLWorkerThread *>(
-                psWaitingWorkerThreadsList->pData);
-
-            CPLAssert(psWorkerThread->bMarkedAsWaiting);
-            psWorkerThread->bMarkedAsWaiting = false;
-
-            CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-            CPLList *psToFree = psWaitingWorkerThreadsList;
-            psWaitingWorkerThreadsList = psNext;
-            nWaitingWorkerThreads--;
-
-#if DEBUG_VERBOSE
-            CPLDebug("JOB", "Waking up %p", psWorkerThread);
-#endif
-            {
-                std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-                // coverity[uninit_use_in_call]
-                oGuard.unlock();
-                psWorkerThread->m_cv.notify_one();
-            }
-
-            CPLFree(psToFree);
+        if (!oGuard.owns_lock())
             oGuard.lock();
-        }
-        else
-        {
+        if (m_apoWaitingWorkerThreads.empty())
             break;
-        }
+        WakeUpWaitingWorkerThread(oGuard);
     }
 
     return true;
@@ -337,8 +417,10 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
     if (nMaxRemainingJobs < 0)
         nMaxRemainingJobs = 0;
     std::unique_lock<std::mutex> oGuard(m_mutex);
+    m_nWaiters++;
     m_cv.wait(oGuard, [this, nMaxRemainingJobs]
               { return nPendingJobs <= nMaxRemainingJobs; });
+    m_nWaiters--;
 }
 
 /************************************************************************/
@@ -357,8 +439,10 @@ void CPLWorkerThreadPool::WaitEvent()
     if (nPendingJobs == 0)
         return;
     const int nPendingJobsBefore = nPendingJobs;
+    m_nWaiters++;
     m_cv.wait(oGuard, [this, nPendingJobsBefore]
               { return nPendingJobs < nPendingJobsBefore || m_bNotifyEvent; });
+    m_nWaiters--;
     m_bNotifyEvent = false;
 }
 
@@ -376,7 +460,7 @@ void CPLWorkerThreadPool::WakeUpWaitEvent()
 {
     std::unique_lock<std::mutex> oGuard(m_mutex);
     m_bNotifyEvent = true;
-    m_cv.notify_one();
+    m_cv.notify_all();
 }
 
 /************************************************************************/
@@ -434,7 +518,8 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
             bRet = false;
             break;
         }
-        aWT.emplace_back(std::move(wt));
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        AddThread(std::move(wt));
     }
 
     {
@@ -465,60 +550,135 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
 
 void CPLWorkerThreadPool::DeclareJobFinished()
 {
-    std::lock_guard<std::mutex> oGuard(m_mutex);
     nPendingJobs--;
-    m_cv.notify_one();
+    if (m_nWaiters > 0)
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        m_cv.notify_all();
+    }
+}
+
+/************************************************************************/
+/*                            PopThreadJob()                            */
+/************************************************************************/
+
+/* Pop a job from the queue of a worker thread: from the front if it is the
+ * current thread, so that jobs are started in submission order, or from the
+ * back if stealing it. If poQueue is not null, only the oldest job of that
+ * queue is considered. */
+bool CPLWorkerThreadPool::PopThreadJob(CPLWorkerThread *psWorkerThread,
+                                       CPLWorkerThreadJob &oJob, bool bSteal,
+                                       const CPLJobQueue *poQueue)
+{
+    std::lock_guard<std::mutex> oGuard(psWorkerThread->m_oJobsMutex);
+    auto &aoJobs = psWorkerThread->m_aoJobs;
+    if (aoJobs.empty())
+        return false;
+    if (poQueue)
+    {
+        const auto oIter =
+            std::find_if(aoJobs.begin(), aoJobs.end(),
+                         [poQueue](const CPLWorkerThreadJob &oOtherJob)
+                         { return oOtherJob.poQueue == poQueue; });
+        if (oIter == aoJobs.end())
+            return false;
+        oJob = std::move(*oIter);
+        aoJobs.erase(oIter);
+    }
+    else if (bSteal)
+    {
+        oJob = std::move(aoJobs.back());
+        aoJobs.pop_back();
+    }
+    else
+    {
+        oJob = std::move(aoJobs.front());
+        aoJobs.pop_front();
+    }
+    m_nQueuedThreadJobs--;
+    return true;
+}
+
+/************************************************************************/
+/*                              StealJob()                              */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::StealJob(CPLWorkerThread *psThief,
+                                   CPLWorkerThreadJob &oJob,
+                                   const CPLJobQueue *poQueue)
+{
+    for (CPLWorkerThread *psWorkerThread = m_psThreadList.load();
+         psWorkerThread && m_nQueuedThreadJobs > 0;
+         psWorkerThread = psWorkerThread->psNextThread)
+    {
+        if (psWorkerThread != psThief &&
+            PopThreadJob(psWorkerThread, oJob, true, poQueue))
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 /************************************************************************/
 /*                             GetNextJob()                             */
 /************************************************************************/
 
-std::function<void()>
-CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
+bool CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread,
+                                     CPLWorkerThreadJob &oJob)
 {
-    std::unique_lock<std::mutex> oGuard(m_mutex);
+    bool bHasBeenMarkedAsWaiting = false;
     while (true)
     {
+        if (m_nQueuedThreadJobs > 0 &&
+            (PopThreadJob(psWorkerThread, oJob, false, nullptr) ||
+             StealJob(psWorkerThread, oJob, nullptr)))
+        {
+#if DEBUG_VERBOSE
+            CPLDebug("JOB", "%p got a job from a thread queue",
+                     psWorkerThread);
+#endif
+            ClearWokenUp(psWorkerThread);
+            if (bHasBeenMarkedAsWaiting)
+            {
+                std::lock_guard<std::mutex> oGuard(m_mutex);
+                RemoveFromWaitingList(psWorkerThread);
+            }
+            return true;
+        }
+
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+
         if (eState == CPLWTS_STOP)
-            return std::function<void()>();
+            return false;
 
-        if (jobQueue.size())
+        ClearWokenUp(psWorkerThread);
+
+        if (!jobQueue.empty())
         {
 #if DEBUG_VERBOSE
             CPLDebug("JOB", "%p got a job", psWorkerThread);
 #endif
-            auto task = std::move(jobQueue.front());
-            jobQueue.pop();
-            return task;
+            oJob = std::move(jobQueue.front());
+            jobQueue.pop_front();
+            RemoveFromWaitingList(psWorkerThread);
+            return true;
         }
 
         if (!psWorkerThread->bMarkedAsWaiting)
         {
             psWorkerThread->bMarkedAsWaiting = true;
+            m_apoWaitingWorkerThreads.push_back(psWorkerThread);
             nWaitingWorkerThreads++;
-
-            CPLList *psItem =
-                static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
-            if (psItem == nullptr)
-            {
-                eState = CPLWTS_ERROR;
-                m_cv.notify_one();
-
-                return nullptr;
-            }
-
-            psItem->pData = psWorkerThread;
-            psItem->psNext = psWaitingWorkerThreadsList;
-            psWaitingWorkerThreadsList = psItem;
-
-#if DEBUG_VERBOSE
-            CPLAssert(CPLListCount(psWaitingWorkerThreadsList) ==
-                      nWaitingWorkerThreads);
-#endif
         }
+        bHasBeenMarkedAsWaiting = true;
+
+        m_cv.notify_all();
 
-        m_cv.notify_one();
+        // A job might have been queued to a worker thread after we checked,
+        // but before its submitter could see us as waiting.
+        if (m_nQueuedThreadJobs > 0)
+            continue;
 
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "%p sleeping", psWorkerThread);
@@ -532,12 +692,57 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
         oGuard.unlock();
         // coverity[wait_not_in_locked_loop]
         psWorkerThread->m_cv.wait(oGuardThisThread);
-        // coverity[lock_order]
-        oGuard.lock();
 #endif
     }
 }
 
+/************************************************************************/
+/*                            RunQueuedJob()                            */
+/************************************************************************/
+
+/* Run, in the current thread, a job of poQueue that has not yet been picked
+ * by a worker thread. Used by job queue waiting methods called from a worker
+ * thread, so that it helps running sub-jobs instead of being blocked.
+ * Jobs that threads that have just been woken up are going to take are left
+ * to them. */
+bool CPLWorkerThreadPool::RunQueuedJob(CPLJobQueue *poQueue)
+{
+    CPLWorkerThreadJob oJob;
+    bool bFound = false;
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        const int nQueuedJobs =
+            static_cast<int>(jobQueue.size()) + m_nQueuedThreadJobs;
+        if (nQueuedJobs <= m_nWokenUpThreads)
+            return false;
+        for (auto oIter = jobQueue.rbegin(); oIter != jobQueue.rend(); ++oIter)
+        {
+            if (oIter->poQueue == poQueue)
+            {
+                oJob = std::move(*oIter);
+                jobQueue.erase(std::next(oIter).base());
+                bFound = true;
+                break;
+            }
+        }
+    }
+
+    if (!bFound && m_nQueuedThreadJobs > 0)
+    {
+        CPLWorkerThread *psCurrentWT = threadLocalCurrentWorkerThread;
+        bFound = PopThreadJob(psCurrentWT, oJob, false, poQueue) ||
+                 StealJob(psCurrentWT, oJob, poQueue);
+    }
+
+    if (!bFound)
+        return false;
+
+    RunJob(oJob);
+    oJob = CPLWorkerThreadJob();
+    DeclareJobFinished();
+    return true;
+}
+
 /************************************************************************/
 /*                         CreateJobQueue()                             */
 /************************************************************************/
@@ -597,7 +802,10 @@ void CPLJobQueue::DeclareJobFinished()
  */
 bool CPLJobQueue::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
 {
-    return SubmitJob([=] { pfnFunc(pData); });
+    CPLWorkerThreadJob oJob;
+    oJob.pfnFunc = pfnFunc;
+    oJob.pData = pData;
+    return QueueJob(std::move(oJob));
 }
 
 /** Queue a new job.
@@ -606,20 +814,25 @@ bool CPLJobQueue::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
  * @return true in case of success.
  */
 bool CPLJobQueue::SubmitJob(std::function<void()> task)
+{
+    CPLWorkerThreadJob oJob;
+    oJob.task = std::move(task);
+    return QueueJob(std::move(oJob));
+}
+
+/************************************************************************/
+/*                              QueueJob()                              */
+/************************************************************************/
+
+bool CPLJobQueue::QueueJob(CPLWorkerThreadJob &&oJob)
 {
     {
         std::lock_guard<std::mutex> oGuard(m_mutex);
         m_nPendingJobs++;
     }
 
-    // coverity[uninit_member,copy_constructor_call]
-    const auto lambda = [this, capturedTask = std::move(task)]
-    {
-        capturedTask();
-        DeclareJobFinished();
-    };
-    // cppcheck-suppress knownConditionTrueFalse
-    return m_poPool->SubmitJob(std::move(lambda));
+    oJob.poQueue = this;
+    return m_poPool->QueueJob(std::move(oJob));
 }
 
 /************************************************************************/
@@ -627,6 +840,10 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
 /************************************************************************/
 
 /** Wait for completion of part or whole jobs.
+ *
+ * When called from a worker thread of the pool (that is from a job that
+ * waits for sub-jobs), jobs of this queue that have not yet been picked by
+ * another thread are run by the current thread while waiting.
  *
  * @param nMaxRemainingJobs Maximum number of pendings jobs that are allowed
  *                          in the queue after this method has completed. Might
@@ -634,9 +851,20 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
  */
 void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
 {
+    const bool bCanRunJobs = threadLocalCurrentThreadPool == m_poPool;
     std::unique_lock<std::mutex> oGuard(m_mutex);
-    m_cv.wait(oGuard, [this, nMaxRemainingJobs]
-              { return m_nPendingJobs <= nMaxRemainingJobs; });
+    while (m_nPendingJobs > nMaxRemainingJobs)
+    {
+        if (bCanRunJobs)
+        {
+            oGuard.unlock();
+            const bool bHasRunJob = m_poPool->RunQueuedJob(this);
+            oGuard.lock();
+            if (bHasRunJob)
+                continue;
+        }
+        m_cv.wait(oGuard);
+    }
 }
 
 /************************************************************************/
@@ -656,6 +884,15 @@ bool CPLJobQueue::WaitEvent()
     if (m_nPendingJobs == 0)
         return false;
 
+    if (threadLocalCurrentThreadPool == m_poPool)
+    {
+        oGuard.unlock();
+        const bool bHasRunJob = m_poPool->RunQueuedJob(this);
+        oGuard.lock();
+        if (bHasRunJob)
+            return m_nPendingJobs > 0;
+    }
+
     const int nPendingJobsBefore = m_nPendingJobs;
     m_cv.wait(oGuard, [this, nPendingJobsBefore]
               { return m_nPendingJobs < nPendingJobsBefore; });
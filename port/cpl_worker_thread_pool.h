@@ -16,11 +16,12 @@
 #include "cpl_multiproc.h"
 #include "cpl_list.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 /**
@@ -32,6 +33,17 @@
 
 #ifndef DOXYGEN_SKIP
 class CPLWorkerThreadPool;
+class CPLJobQueue;
+
+/* A job is either a (pfnFunc, pData) pair, which avoids the allocation of a
+ * std::function, or a std::function. */
+struct CPLWorkerThreadJob
+{
+    CPLThreadFunc pfnFunc = nullptr;
+    void *pData = nullptr;
+    std::function<void()> task{};
+    CPLJobQueue *poQueue = nullptr;
+};
 
 struct CPLWorkerThread
 {
@@ -43,9 +55,16 @@ struct CPLWorkerThread
     CPLWorkerThreadPool *poTP = nullptr;
     CPLJoinableThread *hThread = nullptr;
     bool bMarkedAsWaiting = false;
+    std::atomic<bool> bWokenUp{false};
+    CPLWorkerThread *psNextThread = nullptr;
 
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
+
+    // Jobs queued to that thread. The owning thread pops from the front,
+    // in submission order, and other threads steal from the back.
+    std::mutex m_oJobsMutex{};
+    std::deque<CPLWorkerThreadJob> m_aoJobs{};
 };
 
 typedef enum
@@ -65,23 +84,48 @@ class CPL_DLL CPLWorkerThreadPool
 {
     CPL_DISALLOW_COPY_ASSIGN(CPLWorkerThreadPool)
 
+    friend class CPLJobQueue;
+
     std::vector<std::unique_ptr<CPLWorkerThread>> aWT{};
     mutable std::mutex m_mutex{};
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
-    std::queue<std::function<void()>> jobQueue;
-    int nPendingJobs = 0;
+    std::deque<CPLWorkerThreadJob> jobQueue{};
+    std::atomic<int> nPendingJobs{0};
     bool m_bNotifyEvent = false;
 
-    CPLList *psWaitingWorkerThreadsList = nullptr;
-    int nWaitingWorkerThreads = 0;
+    // Number of jobs in the m_aoJobs deque of worker threads
+    std::atomic<int> m_nQueuedThreadJobs{0};
+    // Number of threads blocked in WaitCompletion() or WaitEvent()
+    std::atomic<int> m_nWaiters{0};
+    // Number of woken up threads that have not yet looked for a job
+    std::atomic<int> m_nWokenUpThreads{0};
+
+    std::vector<CPLWorkerThread *> m_apoWaitingWorkerThreads{};
+    std::atomic<int> nWaitingWorkerThreads{0};
+
+    // Singly linked list of the threads of aWT, that can be walked without
+    // holding m_mutex
+    std::atomic<CPLWorkerThread *> m_psThreadList{nullptr};
 
     int m_nMaxThreads = 0;
 
     static void WorkerThreadFunction(void *user_data);
 
     void DeclareJobFinished();
-    std::function<void()> GetNextJob(CPLWorkerThread *psWorkerThread);
+    bool GetNextJob(CPLWorkerThread *psWorkerThread, CPLWorkerThreadJob &oJob);
+    bool QueueJob(CPLWorkerThreadJob &&oJob);
+    void AddThread(std::unique_ptr<CPLWorkerThread> &&wt);
+    bool StartThreadIfNeeded();
+    void WakeUpWaitingWorkerThread(std::unique_lock<std::mutex> &oGuard);
+    void RemoveFromWaitingList(CPLWorkerThread *psWorkerThread);
+    void ClearWokenUp(CPLWorkerThread *psWorkerThread);
+    bool PopThreadJob(CPLWorkerThread *psWorkerThread, CPLWorkerThreadJob &oJob,
+                      bool bSteal, const CPLJobQueue *poQueue);
+    bool StealJob(CPLWorkerThread *psThief, CPLWorkerThreadJob &oJob,
+                  const CPLJobQueue *poQueue);
+    bool RunQueuedJob(CPLJobQueue *poQueue);
+    static void RunJob(CPLWorkerThreadJob &oJob);
 
   public:
     CPLWorkerThreadPool();
@@ -115,6 +159,7 @@ class CPL_DLL CPLJobQueue
     int m_nPendingJobs = 0;
 
     void DeclareJobFinished();
+    bool QueueJob(CPLWorkerThreadJob &&oJob);
 
     //! @cond Doxygen_Suppress
   protected: